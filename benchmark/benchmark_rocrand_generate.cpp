@@ -176,6 +176,34 @@ void run_benchmarks(const cli::Parser& parser,
             }
         );
     }
+    // Per-shard reseed workflows treat "reseed + generate" as the unit
+    // of work; the two variants below measure it with the in-place
+    // re-key path (rocrand_reseed) and the full state reset
+    // (rocrand_set_seed) so the reseed overhead is directly comparable
+    if (distribution == "reseed-uniform-uint")
+    {
+        unsigned long long shard = 0;
+        run_benchmark<unsigned int>(parser, rng_type,
+            [shard](rocrand_generator gen, unsigned int * data, size_t size) mutable {
+                const rocrand_status status = rocrand_reseed(gen, ++shard);
+                if (status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+                return rocrand_generate(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "set-seed-uniform-uint")
+    {
+        unsigned long long shard = 0;
+        run_benchmark<unsigned int>(parser, rng_type,
+            [shard](rocrand_generator gen, unsigned int * data, size_t size) mutable {
+                const rocrand_status status = rocrand_set_seed(gen, ++shard);
+                if (status != ROCRAND_STATUS_SUCCESS)
+                    return status;
+                return rocrand_generate(gen, data, size);
+            }
+        );
+    }
     if (distribution == "poisson")
     {
         const auto lambdas = parser.get<std::vector<double>>("lambda");
@@ -209,6 +237,8 @@ const std::vector<std::string> all_distributions = {
     "normal-double",
     "log-normal-float",
     "log-normal-double",
+    "reseed-uniform-uint",
+    "set-seed-uniform-uint",
     "poisson"
 };
 
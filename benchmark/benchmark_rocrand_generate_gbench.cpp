@@ -0,0 +1,246 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Google-Benchmark-based variant of benchmark_rocrand_generate. It covers
+// the same engine x distribution x type matrix, but registers the size
+// sweep as a parameter axis and leaves repetitions, statistics and
+// machine-readable output to the harness:
+//
+//   benchmark_rocrand_generate_gbench --benchmark_repetitions=10 \
+//       --benchmark_format=json --benchmark_out=rocrand.json
+//
+// Throughput appears as the bytes_per_second / items_per_second counters.
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cerr << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cerr << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+template<typename T>
+using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
+
+// Common size axis; the upper end matches DEFAULT_RAND_N of the
+// free-text benchmark
+benchmark::internal::Benchmark * configure(benchmark::internal::Benchmark * b)
+{
+    return b->ArgName("size")
+        ->RangeMultiplier(8)->Range(1 << 18, 1 << 27)
+        ->UseManualTime()->Unit(benchmark::kMillisecond);
+}
+
+// Poisson gets lambda as a second axis so table-size effects are
+// tracked separately
+benchmark::internal::Benchmark * configure_lambda(benchmark::internal::Benchmark * b)
+{
+    b->ArgNames({"size", "lambda"});
+    for (int size_exp = 18; size_exp <= 27; size_exp += 3)
+    {
+        for (long long lambda : {10LL, 1000LL, 100000LL})
+        {
+            b->Args({1LL << size_exp, lambda});
+        }
+    }
+    return b->UseManualTime()->Unit(benchmark::kMillisecond);
+}
+
+template<typename T>
+void run_benchmark(benchmark::State& state,
+                   const rng_type_t rng_type,
+                   generate_func_type<T> generate_func)
+{
+    const size_t size = state.range(0);
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    // Warm-up: engine initialization and distribution tables are built
+    // lazily by the first calls and must not pollute the samples
+    for (size_t i = 0; i < 5; i++)
+    {
+        ROCRAND_CHECK(generate_func(generator, data, size));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        ROCRAND_CHECK(generate_func(generator, data, size));
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * size);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+void add_benchmarks(const std::string& engine, const rng_type_t rng_type)
+{
+    configure(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",uniform-uint>").c_str(),
+        [rng_type](benchmark::State& state) {
+            run_benchmark<unsigned int>(state, rng_type,
+                [](rocrand_generator gen, unsigned int * data, size_t size) {
+                    return rocrand_generate(gen, data, size);
+                }
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",uniform-float>").c_str(),
+        [rng_type](benchmark::State& state) {
+            run_benchmark<float>(state, rng_type,
+                [](rocrand_generator gen, float * data, size_t size) {
+                    return rocrand_generate_uniform(gen, data, size);
+                }
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",uniform-double>").c_str(),
+        [rng_type](benchmark::State& state) {
+            run_benchmark<double>(state, rng_type,
+                [](rocrand_generator gen, double * data, size_t size) {
+                    return rocrand_generate_uniform_double(gen, data, size);
+                }
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",normal-float>").c_str(),
+        [rng_type](benchmark::State& state) {
+            run_benchmark<float>(state, rng_type,
+                [](rocrand_generator gen, float * data, size_t size) {
+                    return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
+                }
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",normal-double>").c_str(),
+        [rng_type](benchmark::State& state) {
+            run_benchmark<double>(state, rng_type,
+                [](rocrand_generator gen, double * data, size_t size) {
+                    return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
+                }
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",log-normal-float>").c_str(),
+        [rng_type](benchmark::State& state) {
+            run_benchmark<float>(state, rng_type,
+                [](rocrand_generator gen, float * data, size_t size) {
+                    return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
+                }
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",log-normal-double>").c_str(),
+        [rng_type](benchmark::State& state) {
+            run_benchmark<double>(state, rng_type,
+                [](rocrand_generator gen, double * data, size_t size) {
+                    return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
+                }
+            );
+        }
+    ));
+    configure_lambda(benchmark::RegisterBenchmark(
+        ("generate<" + engine + ",poisson>").c_str(),
+        [rng_type](benchmark::State& state) {
+            const double lambda = static_cast<double>(state.range(1));
+            run_benchmark<unsigned int>(state, rng_type,
+                [lambda](rocrand_generator gen, unsigned int * data, size_t size) {
+                    return rocrand_generate_poisson(gen, data, size, lambda);
+                }
+            );
+        }
+    ));
+}
+
+int main(int argc, char *argv[])
+{
+    benchmark::Initialize(&argc, argv);
+
+    // Report versions and the device on stderr, so that stdout stays
+    // machine-readable with --benchmark_format=json/csv
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cerr << "rocRAND: " << version << " ";
+    std::cerr << "Runtime: " << runtime_version << " ";
+    std::cerr << "Device: " << props.name;
+    std::cerr << std::endl;
+
+    add_benchmarks("xorwow", ROCRAND_RNG_PSEUDO_XORWOW);
+    add_benchmarks("mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A);
+    add_benchmarks("mtgp32", ROCRAND_RNG_PSEUDO_MTGP32);
+    add_benchmarks("philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+    add_benchmarks("sobol32", ROCRAND_RNG_QUASI_SOBOL32);
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
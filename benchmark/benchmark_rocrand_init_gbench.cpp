@@ -0,0 +1,328 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Initialization-latency benchmarks. The throughput benchmarks hide the
+// init path behind warm-up, yet construction and (re)seeding latency is
+// what short-lived consumers feel. Per engine this tracks:
+//
+//   create_generator  - rocrand_create_generator alone
+//   first_generate    - the first generate call of a fresh generator,
+//                       which runs init_engines_kernel (and builds the
+//                       MTGP32 parameter states, Sobol direction copies,
+//                       etc.) before producing output
+//   set_seed_reinit   - rocrand_set_seed plus the generate call that
+//                       performs the forced re-initialization
+//   device_init       - per-thread rocrand_init of the device-side state
+//                       types (rocrand_make_state_mtgp32 for MTGP32)
+//
+// Same harness conventions as benchmark_rocrand_generate_gbench.cpp.
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+
+#include <benchmark/benchmark.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+#include <rocrand_mtgp32_11213.h>
+#include <rocrand_sobol_precomputed.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cerr << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status status = condition;           \
+    if(status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cerr << "ROCRAND error: " << status << " line: " << __LINE__ << std::endl; \
+        exit(status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+const size_t init_blocks = 256;
+const size_t init_threads = 256;
+
+// Small enough that generation itself is negligible next to the init
+// work the first call performs
+const size_t first_generate_size = 4096;
+
+benchmark::internal::Benchmark * configure(benchmark::internal::Benchmark * b)
+{
+    return b->UseManualTime()->Unit(benchmark::kMicrosecond);
+}
+
+void benchmark_create_generator(benchmark::State& state, const rng_type_t rng_type)
+{
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(
+            std::chrono::duration<double>(end - start).count());
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+}
+
+void benchmark_first_generate(benchmark::State& state, const rng_type_t rng_type)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, first_generate_size * sizeof(unsigned int)));
+
+    for (auto _ : state)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        auto start = std::chrono::high_resolution_clock::now();
+        ROCRAND_CHECK(rocrand_generate(generator, data, first_generate_size));
+        HIP_CHECK(hipDeviceSynchronize());
+        auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(
+            std::chrono::duration<double>(end - start).count());
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+void benchmark_set_seed_reinit(benchmark::State& state, const rng_type_t rng_type)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, first_generate_size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    // Pay the first-generate cost up front so only re-initialization
+    // is measured
+    ROCRAND_CHECK(rocrand_generate(generator, data, first_generate_size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long seed = 12345ULL;
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        ROCRAND_CHECK(rocrand_set_seed(generator, seed++));
+        ROCRAND_CHECK(rocrand_generate(generator, data, first_generate_size));
+        HIP_CHECK(hipDeviceSynchronize());
+        auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(
+            std::chrono::duration<double>(end - start).count());
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+template<typename GeneratorState>
+__global__
+void init_kernel(GeneratorState * states,
+                 const unsigned long long seed,
+                 const unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    GeneratorState state;
+    rocrand_init(seed, state_id, offset, &state);
+    states[state_id] = state;
+}
+
+template<typename Directions>
+__global__
+void init_kernel(rocrand_state_sobol32 * states,
+                 const Directions directions,
+                 const unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocrand_state_sobol32 state;
+    rocrand_init(&directions[0], offset + state_id, &state);
+    states[state_id] = state;
+}
+
+template<typename GeneratorState>
+void benchmark_device_init(benchmark::State& state)
+{
+    const size_t states_size = init_blocks * init_threads;
+    GeneratorState * states;
+    HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(GeneratorState)));
+
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_kernel),
+            dim3(init_blocks), dim3(init_threads), 0, 0,
+            states, 12345ULL, 6789ULL
+        );
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+    HIP_CHECK(hipPeekAtLastError());
+    state.SetItemsProcessed(state.iterations() * states_size);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(states));
+}
+
+// MTGP32 states are built by the host-side helper, not by per-thread
+// rocrand_init
+template<>
+void benchmark_device_init<rocrand_state_mtgp32>(benchmark::State& state)
+{
+    const size_t states_size = 200;
+    rocrand_state_mtgp32 * states;
+    HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(rocrand_state_mtgp32)));
+
+    unsigned long long seed = 12345ULL;
+    for (auto _ : state)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, states_size, seed++));
+        HIP_CHECK(hipDeviceSynchronize());
+        auto end = std::chrono::high_resolution_clock::now();
+        state.SetIterationTime(
+            std::chrono::duration<double>(end - start).count());
+    }
+    state.SetItemsProcessed(state.iterations() * states_size);
+
+    HIP_CHECK(hipFree(states));
+}
+
+// Sobol32 initializes from direction vectors; the device copy of the
+// vectors is made once, as generators do
+template<>
+void benchmark_device_init<rocrand_state_sobol32>(benchmark::State& state)
+{
+    const size_t states_size = init_blocks * init_threads;
+    rocrand_state_sobol32 * states;
+    HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(rocrand_state_sobol32)));
+
+    unsigned int * directions;
+    HIP_CHECK(hipMalloc((void **)&directions, 32 * sizeof(unsigned int)));
+    HIP_CHECK(hipMemcpy(directions, h_sobol32_direction_vectors,
+                        32 * sizeof(unsigned int), hipMemcpyHostToDevice));
+
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_kernel),
+            dim3(init_blocks), dim3(init_threads), 0, 0,
+            states, directions, 6789ULL
+        );
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+    HIP_CHECK(hipPeekAtLastError());
+    state.SetItemsProcessed(state.iterations() * states_size);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(directions));
+    HIP_CHECK(hipFree(states));
+}
+
+template<typename GeneratorState>
+void add_benchmarks(const std::string& engine, const rng_type_t rng_type)
+{
+    configure(benchmark::RegisterBenchmark(
+        ("create_generator<" + engine + ">").c_str(),
+        [rng_type](benchmark::State& state) {
+            benchmark_create_generator(state, rng_type);
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("first_generate<" + engine + ">").c_str(),
+        [rng_type](benchmark::State& state) {
+            benchmark_first_generate(state, rng_type);
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("set_seed_reinit<" + engine + ">").c_str(),
+        [rng_type](benchmark::State& state) {
+            benchmark_set_seed_reinit(state, rng_type);
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("device_init<" + engine + ">").c_str(),
+        [](benchmark::State& state) {
+            benchmark_device_init<GeneratorState>(state);
+        }
+    ));
+}
+
+int main(int argc, char *argv[])
+{
+    benchmark::Initialize(&argc, argv);
+
+    // Report versions and the device on stderr, so that stdout stays
+    // machine-readable with --benchmark_format=json/csv
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cerr << "rocRAND: " << version << " ";
+    std::cerr << "Runtime: " << runtime_version << " ";
+    std::cerr << "Device: " << props.name;
+    std::cerr << std::endl;
+
+    add_benchmarks<rocrand_state_xorwow>("xorwow", ROCRAND_RNG_PSEUDO_XORWOW);
+    add_benchmarks<rocrand_state_mrg32k3a>("mrg32k3a", ROCRAND_RNG_PSEUDO_MRG32K3A);
+    add_benchmarks<rocrand_state_mtgp32>("mtgp32", ROCRAND_RNG_PSEUDO_MTGP32);
+    add_benchmarks<rocrand_state_philox4x32_10>("philox", ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+    add_benchmarks<rocrand_state_sobol32>("sobol32", ROCRAND_RNG_QUASI_SOBOL32);
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
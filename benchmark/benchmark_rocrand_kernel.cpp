@@ -26,6 +26,7 @@
 #include <numeric>
 #include <utility>
 #include <algorithm>
+#include <random>
 
 #include "cmdparser.hpp"
 
@@ -459,6 +460,50 @@ void run_benchmarks(const cli::Parser& parser,
             ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
         }
     }
+    if (distribution == "discrete-alias" || distribution == "discrete-cdf")
+    {
+        const auto discrete_sizes = parser.get<std::vector<size_t>>("discrete-size");
+        for (size_t discrete_size : discrete_sizes)
+        {
+            // Irregular weights keep the alias and CDF tables
+            // non-trivial (uniform weights degenerate both methods)
+            std::vector<double> probabilities(discrete_size);
+            std::mt19937 prng(112233);
+            std::uniform_real_distribution<double> weight(0.001, 1.0);
+            for (auto& p : probabilities)
+            {
+                p = weight(prng);
+            }
+
+            rocrand_discrete_distribution discrete_distribution;
+            auto build_start = std::chrono::high_resolution_clock::now();
+            ROCRAND_CHECK(rocrand_create_discrete_distribution(
+                probabilities.data(), probabilities.size(), 0, &discrete_distribution));
+            auto build_end = std::chrono::high_resolution_clock::now();
+            std::chrono::duration<double, std::milli> build_elapsed = build_end - build_start;
+            std::cout << "    " << "outcomes " << discrete_size
+                << std::fixed << std::setprecision(3)
+                << " (table build " << build_elapsed.count() << " ms)" << std::endl;
+
+            if (distribution == "discrete-alias")
+            {
+                run_benchmark<unsigned int, GeneratorState>(parser,
+                    [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
+                        return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+                    }, discrete_distribution
+                );
+            }
+            else
+            {
+                run_benchmark<unsigned int, GeneratorState>(parser,
+                    [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
+                        return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+                    }, discrete_distribution
+                );
+            }
+            ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+        }
+    }
     if (distribution == "discrete-custom")
     {
         const unsigned int offset = 1234;
@@ -508,6 +553,8 @@ const std::vector<std::string> all_distributions = {
     "log-normal-double",
     "poisson",
     "discrete-poisson",
+    "discrete-alias",
+    "discrete-cdf",
     "discrete-custom",
 };
 
@@ -539,7 +586,8 @@ int main(int argc, char *argv[])
     parser.set_optional<size_t>("threads", "threads", 256, "number of threads in each block");
     parser.set_optional<std::vector<std::string>>("dis", "dis", {"uniform-uint"}, distribution_desc.c_str());
     parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"}, engine_desc.c_str());
-    parser.set_optional<std::vector<double>>("lambda", "lambda", {10.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::vector<double>>("lambda", "lambda", {0.5, 5.0, 50.0, 500.0, 5000.0}, "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::vector<size_t>>("discrete-size", "discrete-size", {16, 256, 4096, 65536, 1048576}, "space-separated list of sizes (numbers of outcomes) of discrete distributions");
     parser.run_and_exit_if_error();
 
     std::vector<std::string> engines;
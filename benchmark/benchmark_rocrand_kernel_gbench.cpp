@@ -0,0 +1,602 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Google-Benchmark-based variant of benchmark_rocrand_kernel covering the
+// same engine x distribution x type matrix of the device-side API, with
+// the size sweep registered as a parameter axis (see
+// benchmark_rocrand_generate_gbench.cpp for usage). The kernels and
+// runners mirror those of the free-text benchmark; the launch grid stays
+// at its defaults (256 blocks of 256 threads).
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+#include <rocrand_mtgp32_11213.h>
+#include <rocrand_sobol_precomputed.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cerr << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status status = condition;           \
+    if(status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cerr << "ROCRAND error: " << status << " line: " << __LINE__ << std::endl; \
+        exit(status); \
+    } \
+  }
+
+const size_t benchmark_blocks = 256;
+const size_t benchmark_threads = 256;
+
+size_t next_power2(size_t x)
+{
+    size_t power = 1;
+    while (power < x)
+    {
+        power *= 2;
+    }
+    return power;
+}
+
+template<typename GeneratorState>
+__global__
+void init_kernel(GeneratorState * states,
+                 const unsigned long long seed,
+                 const unsigned long long offset)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    GeneratorState state;
+    rocrand_init(seed, state_id, offset, &state);
+    states[state_id] = state;
+}
+
+template<typename T, typename GeneratorState, typename GenerateFunc, typename Extra>
+__global__
+void generate_kernel(GeneratorState * states,
+                     T * data,
+                     const size_t size,
+                     GenerateFunc generate_func,
+                     const Extra extra)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    GeneratorState state = states[state_id];
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        data[index] = generate_func(&state, extra);
+        index += stride;
+    }
+    states[state_id] = state;
+}
+
+template<typename GeneratorState>
+struct runner
+{
+    GeneratorState * states;
+
+    runner(const size_t /* dimensions */,
+           const size_t blocks,
+           const size_t threads,
+           const unsigned long long seed,
+           const unsigned long long offset)
+    {
+        const size_t states_size = blocks * threads;
+        HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(GeneratorState)));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_kernel),
+            dim3(blocks), dim3(threads), 0, 0,
+            states, seed, offset
+        );
+
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+    }
+
+    ~runner()
+    {
+        HIP_CHECK(hipFree(states));
+    }
+
+    template<typename T, typename GenerateFunc, typename Extra>
+    void generate(const size_t blocks,
+                  const size_t threads,
+                  T * data,
+                  const size_t size,
+                  const GenerateFunc& generate_func,
+                  const Extra extra)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(generate_kernel),
+            dim3(blocks), dim3(threads), 0, 0,
+            states, data, size, generate_func, extra
+        );
+    }
+};
+
+template<typename T, typename GenerateFunc, typename Extra>
+__global__
+void generate_kernel(rocrand_state_mtgp32 * states,
+                     T * data,
+                     const size_t size,
+                     GenerateFunc generate_func,
+                     const Extra extra)
+{
+    const unsigned int state_id = hipBlockIdx_x;
+    unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    __shared__ rocrand_state_mtgp32 state;
+    rocrand_mtgp32_block_copy(&states[state_id], &state);
+
+    const size_t r = size%hipBlockDim_x;
+    const size_t size_rounded_down = size - r;
+    const size_t size_rounded_up = r == 0 ? size : size_rounded_down + hipBlockDim_x;
+    while(index < size_rounded_down)
+    {
+        data[index] = generate_func(&state, extra);
+        index += stride;
+    }
+    while(index < size_rounded_up)
+    {
+        auto value = generate_func(&state, extra);
+        if(index < size)
+            data[index] = value;
+        index += stride;
+    }
+
+    rocrand_mtgp32_block_copy(&state, &states[state_id]);
+}
+
+template<>
+struct runner<rocrand_state_mtgp32>
+{
+    rocrand_state_mtgp32 * states;
+
+    runner(const size_t /* dimensions */,
+           const size_t blocks,
+           const size_t /* threads */,
+           const unsigned long long seed,
+           const unsigned long long /* offset */)
+    {
+        const size_t states_size = std::min((size_t)200, blocks);
+        HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(rocrand_state_mtgp32)));
+
+        ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, states_size, seed));
+    }
+
+    ~runner()
+    {
+        HIP_CHECK(hipFree(states));
+    }
+
+    template<typename T, typename GenerateFunc, typename Extra>
+    void generate(const size_t blocks,
+                  const size_t /* threads */,
+                  T * data,
+                  const size_t size,
+                  const GenerateFunc& generate_func,
+                  const Extra extra)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(generate_kernel),
+            dim3(std::min((size_t)200, blocks)), dim3(256), 0, 0,
+            states, data, size, generate_func, extra
+        );
+    }
+};
+
+template<typename Directions>
+__global__
+void init_kernel(rocrand_state_sobol32 * states,
+                 const Directions directions,
+                 const unsigned long long offset)
+{
+    const unsigned int dimension = hipBlockIdx_y;
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocrand_state_sobol32 state;
+    rocrand_init(&directions[dimension * 32], offset + state_id, &state);
+    states[hipGridDim_x * hipBlockDim_x * dimension + state_id] = state;
+}
+
+template<typename T, typename GenerateFunc, typename Extra>
+__global__
+void generate_kernel(rocrand_state_sobol32 * states,
+                     T * data,
+                     const size_t size,
+                     GenerateFunc generate_func,
+                     const Extra extra)
+{
+    const unsigned int dimension = hipBlockIdx_y;
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    rocrand_state_sobol32 state = states[hipGridDim_x * hipBlockDim_x * dimension + state_id];
+    const unsigned int offset = dimension * size;
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        data[offset + index] = generate_func(&state, extra);
+        skipahead(stride - 1, &state);
+        index += stride;
+    }
+    state = states[hipGridDim_x * hipBlockDim_x * dimension + state_id];
+    skipahead(static_cast<unsigned int>(size), &state);
+    states[hipGridDim_x * hipBlockDim_x * dimension + state_id] = state;
+}
+
+template<>
+struct runner<rocrand_state_sobol32>
+{
+    rocrand_state_sobol32 * states;
+    size_t dimensions;
+
+    runner(const size_t dimensions,
+           const size_t blocks,
+           const size_t threads,
+           const unsigned long long /* seed */,
+           const unsigned long long offset)
+    {
+        this->dimensions = dimensions;
+
+        const size_t states_size = blocks * threads * dimensions;
+        HIP_CHECK(hipMalloc((void **)&states, states_size * sizeof(rocrand_state_sobol32)));
+
+        unsigned int * directions;
+        const size_t size = dimensions * 32 * sizeof(unsigned int);
+        HIP_CHECK(hipMalloc((void **)&directions, size));
+        HIP_CHECK(hipMemcpy(directions, h_sobol32_direction_vectors, size, hipMemcpyHostToDevice));
+
+        const size_t blocks_x = next_power2((blocks + dimensions - 1) / dimensions);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_kernel),
+            dim3(blocks_x, dimensions), dim3(threads), 0, 0,
+            states, directions, offset
+        );
+
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+
+        HIP_CHECK(hipFree(directions));
+    }
+
+    ~runner()
+    {
+        HIP_CHECK(hipFree(states));
+    }
+
+    template<typename T, typename GenerateFunc, typename Extra>
+    void generate(const size_t blocks,
+                  const size_t threads,
+                  T * data,
+                  const size_t size,
+                  const GenerateFunc& generate_func,
+                  const Extra extra)
+    {
+        const size_t blocks_x = next_power2((blocks + dimensions - 1) / dimensions);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(generate_kernel),
+            dim3(blocks_x, dimensions), dim3(threads), 0, 0,
+            states, data, size / dimensions, generate_func, extra
+        );
+    }
+};
+
+// Common size axis; the upper end matches DEFAULT_RAND_N of the
+// free-text benchmark
+benchmark::internal::Benchmark * configure(benchmark::internal::Benchmark * b)
+{
+    return b->ArgName("size")
+        ->RangeMultiplier(8)->Range(1 << 18, 1 << 27)
+        ->UseManualTime()->Unit(benchmark::kMillisecond);
+}
+
+// Poisson variants get lambda as a second axis so table-size effects
+// are tracked separately
+benchmark::internal::Benchmark * configure_lambda(benchmark::internal::Benchmark * b)
+{
+    b->ArgNames({"size", "lambda"});
+    for (int size_exp = 18; size_exp <= 27; size_exp += 3)
+    {
+        for (long long lambda : {10LL, 1000LL, 100000LL})
+        {
+            b->Args({1LL << size_exp, lambda});
+        }
+    }
+    return b->UseManualTime()->Unit(benchmark::kMillisecond);
+}
+
+// The discrete-alias/discrete-cdf variants get the table size as a
+// second axis; sampling cost depends on it very differently for the
+// two methods
+benchmark::internal::Benchmark * configure_outcomes(benchmark::internal::Benchmark * b)
+{
+    b->ArgNames({"size", "outcomes"});
+    for (int size_exp = 18; size_exp <= 27; size_exp += 3)
+    {
+        for (long long outcomes : {16LL, 4096LL, 1048576LL})
+        {
+            b->Args({1LL << size_exp, outcomes});
+        }
+    }
+    return b->UseManualTime()->Unit(benchmark::kMillisecond);
+}
+
+// Irregular weights keep the alias and CDF tables non-trivial (uniform
+// weights degenerate both methods)
+rocrand_discrete_distribution make_random_discrete_distribution(const size_t size)
+{
+    std::vector<double> probabilities(size);
+    std::mt19937 prng(112233);
+    std::uniform_real_distribution<double> weight(0.001, 1.0);
+    for (auto& p : probabilities)
+    {
+        p = weight(prng);
+    }
+
+    rocrand_discrete_distribution discrete_distribution;
+    ROCRAND_CHECK(rocrand_create_discrete_distribution(
+        probabilities.data(), probabilities.size(), 0, &discrete_distribution));
+    return discrete_distribution;
+}
+
+template<typename T, typename GeneratorState, typename GenerateFunc, typename Extra>
+void run_benchmark(benchmark::State& state,
+                   const GenerateFunc& generate_func,
+                   const Extra extra)
+{
+    const size_t size = state.range(0);
+    const size_t dimensions = 1;
+
+    T * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(T)));
+
+    runner<GeneratorState> r(dimensions, benchmark_blocks, benchmark_threads, 12345ULL, 6789ULL);
+
+    // Warm-up
+    for (size_t i = 0; i < 5; i++)
+    {
+        r.generate(benchmark_blocks, benchmark_threads, data, size, generate_func, extra);
+        HIP_CHECK(hipPeekAtLastError());
+        HIP_CHECK(hipDeviceSynchronize());
+    }
+
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+
+    for (auto _ : state)
+    {
+        HIP_CHECK(hipEventRecord(start, 0));
+        r.generate(benchmark_blocks, benchmark_threads, data, size, generate_func, extra);
+        HIP_CHECK(hipEventRecord(stop, 0));
+        HIP_CHECK(hipEventSynchronize(stop));
+        float elapsed;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+        state.SetIterationTime(elapsed / 1e3);
+    }
+    HIP_CHECK(hipPeekAtLastError());
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * size);
+
+    HIP_CHECK(hipEventDestroy(start));
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipFree(data));
+}
+
+template<typename GeneratorState>
+void add_benchmarks(const std::string& engine)
+{
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",uniform-uint>").c_str(),
+        [](benchmark::State& state) {
+            run_benchmark<unsigned int, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, int) {
+                    return rocrand(state);
+                }, 0
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",uniform-float>").c_str(),
+        [](benchmark::State& state) {
+            run_benchmark<float, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, int) {
+                    return rocrand_uniform(state);
+                }, 0
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",uniform-double>").c_str(),
+        [](benchmark::State& state) {
+            run_benchmark<double, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, int) {
+                    return rocrand_uniform_double(state);
+                }, 0
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",normal-float>").c_str(),
+        [](benchmark::State& state) {
+            run_benchmark<float, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, int) {
+                    return rocrand_normal(state);
+                }, 0
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",normal-double>").c_str(),
+        [](benchmark::State& state) {
+            run_benchmark<double, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, int) {
+                    return rocrand_normal_double(state);
+                }, 0
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",log-normal-float>").c_str(),
+        [](benchmark::State& state) {
+            run_benchmark<float, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, int) {
+                    return rocrand_log_normal(state, 0.0f, 1.0f);
+                }, 0
+            );
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",log-normal-double>").c_str(),
+        [](benchmark::State& state) {
+            run_benchmark<double, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, int) {
+                    return rocrand_log_normal_double(state, 0.0, 1.0);
+                }, 0
+            );
+        }
+    ));
+    configure_lambda(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",poisson>").c_str(),
+        [](benchmark::State& state) {
+            const double lambda = static_cast<double>(state.range(1));
+            run_benchmark<unsigned int, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, double lambda) {
+                    return rocrand_poisson(state, lambda);
+                }, lambda
+            );
+        }
+    ));
+    configure_lambda(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",discrete-poisson>").c_str(),
+        [](benchmark::State& state) {
+            const double lambda = static_cast<double>(state.range(1));
+            rocrand_discrete_distribution discrete_distribution;
+            ROCRAND_CHECK(rocrand_create_poisson_distribution(lambda, &discrete_distribution));
+            run_benchmark<unsigned int, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
+                    return rocrand_discrete(state, discrete_distribution);
+                }, discrete_distribution
+            );
+            ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+        }
+    ));
+    configure_outcomes(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",discrete-alias>").c_str(),
+        [](benchmark::State& state) {
+            rocrand_discrete_distribution discrete_distribution =
+                make_random_discrete_distribution(state.range(1));
+            run_benchmark<unsigned int, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
+                    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+                }, discrete_distribution
+            );
+            ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+        }
+    ));
+    configure_outcomes(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",discrete-cdf>").c_str(),
+        [](benchmark::State& state) {
+            rocrand_discrete_distribution discrete_distribution =
+                make_random_discrete_distribution(state.range(1));
+            run_benchmark<unsigned int, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
+                    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+                }, discrete_distribution
+            );
+            ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+        }
+    ));
+    configure(benchmark::RegisterBenchmark(
+        ("kernel<" + engine + ",discrete-custom>").c_str(),
+        [](benchmark::State& state) {
+            const unsigned int offset = 1234;
+            std::vector<double> probabilities = { 10, 10, 1, 120, 8, 6, 140, 2, 150, 150, 10, 80 };
+            const int size = probabilities.size();
+            double sum = 0.0;
+            for (int i = 0; i < size; i++)
+            {
+                sum += probabilities[i];
+            }
+            for (int i = 0; i < size; i++)
+            {
+                probabilities[i] /= sum;
+            }
+
+            rocrand_discrete_distribution discrete_distribution;
+            ROCRAND_CHECK(rocrand_create_discrete_distribution(probabilities.data(), probabilities.size(), offset, &discrete_distribution));
+            run_benchmark<unsigned int, GeneratorState>(state,
+                [] __device__ (GeneratorState * state, rocrand_discrete_distribution discrete_distribution) {
+                    return rocrand_discrete(state, discrete_distribution);
+                }, discrete_distribution
+            );
+            ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+        }
+    ));
+}
+
+int main(int argc, char *argv[])
+{
+    benchmark::Initialize(&argc, argv);
+
+    // Report versions and the device on stderr, so that stdout stays
+    // machine-readable with --benchmark_format=json/csv
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cerr << "rocRAND: " << version << " ";
+    std::cerr << "Runtime: " << runtime_version << " ";
+    std::cerr << "Device: " << props.name;
+    std::cerr << std::endl;
+
+    add_benchmarks<rocrand_state_xorwow>("xorwow");
+    add_benchmarks<rocrand_state_mrg32k3a>("mrg32k3a");
+    add_benchmarks<rocrand_state_mtgp32>("mtgp32");
+    add_benchmarks<rocrand_state_philox4x32_10>("philox");
+    add_benchmarks<rocrand_state_sobol32>("sobol32");
+
+    benchmark::RunSpecifiedBenchmarks();
+
+    return 0;
+}
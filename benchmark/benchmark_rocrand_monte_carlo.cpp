@@ -0,0 +1,444 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// End-to-end Monte Carlo applications. The generator benchmarks measure
+// raw generation into memcpy-shaped streams; the applications here
+// consume the numbers the way real simulations do — pi estimation with
+// the device API (Philox state kept in registers), Black-Scholes path
+// simulation fed by the host API (rocrand_generate_normal), and
+// quasi-Monte Carlo integration over a Sobol point set — so
+// generator-level changes can be validated against realistic access
+// patterns. Each application reports its result, the error against the
+// known answer, wall time and consumed samples per second.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+#include <rocrand_kernel.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cout << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cout << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+const size_t DEFAULT_SAMPLES = 1024 * 1024 * 64;
+
+struct mc_result
+{
+    double value;
+    double reference;
+    size_t samples;
+};
+
+void print_result(const mc_result& result, double elapsed_ms, size_t trials)
+{
+    std::cout << std::fixed << std::setprecision(6)
+              << "      "
+              << "Result = " << result.value
+              << ", AbsError = " << std::fabs(result.value - result.reference)
+              << std::setprecision(3)
+              << ", Samples = "
+              << std::setw(8) << (trials * result.samples) /
+                    (elapsed_ms / 1e3 * (1 << 30))
+              << " GSample/s, AvgTime (1 trial) = "
+              << std::setw(8) << elapsed_ms / trials
+              << " ms, Time (all) = "
+              << std::setw(8) << elapsed_ms
+              << " ms, Size = " << result.samples
+              << std::endl;
+}
+
+// Pi estimation — device API.
+//
+// Every thread owns a Philox state in registers, draws (x, y) points
+// four at a time with rocrand_uniform4 and counts hits inside the unit
+// quarter circle; nothing but the per-thread counts ever touches
+// memory, so this stresses in-kernel generation latency rather than
+// bandwidth.
+__global__
+void pi_estimation_kernel(unsigned long long * counts,
+                          const size_t points_per_thread,
+                          const unsigned long long seed)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    rocrand_state_philox4x32_10 state;
+    rocrand_init(seed, state_id, 0, &state);
+
+    unsigned long long inside = 0;
+    for(size_t i = 0; i < points_per_thread; i += 4)
+    {
+        const float4 x = rocrand_uniform4(&state);
+        const float4 y = rocrand_uniform4(&state);
+        inside += (x.x * x.x + y.x * y.x <= 1.0f) ? 1 : 0;
+        inside += (x.y * x.y + y.y * y.y <= 1.0f) ? 1 : 0;
+        inside += (x.z * x.z + y.z * y.z <= 1.0f) ? 1 : 0;
+        inside += (x.w * x.w + y.w * y.w <= 1.0f) ? 1 : 0;
+    }
+    counts[state_id] = inside;
+}
+
+mc_result run_pi_estimation(const size_t size, const unsigned long long seed)
+{
+    const size_t threads = 256;
+    const size_t blocks = 512;
+    const size_t points_per_thread =
+        std::max<size_t>(4, (size / (blocks * threads) + 3) & ~size_t(3));
+    const size_t points = blocks * threads * points_per_thread;
+
+    unsigned long long * counts;
+    HIP_CHECK(hipMalloc((void **)&counts, blocks * threads * sizeof(unsigned long long)));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(pi_estimation_kernel),
+        dim3(blocks), dim3(threads), 0, 0,
+        counts, points_per_thread, seed
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned long long> h_counts(blocks * threads);
+    HIP_CHECK(hipMemcpy(h_counts.data(), counts,
+                        h_counts.size() * sizeof(unsigned long long),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(counts));
+
+    const unsigned long long inside =
+        std::accumulate(h_counts.begin(), h_counts.end(), 0ULL);
+
+    mc_result result;
+    result.value = 4.0 * inside / points;
+    result.reference = 3.14159265358979323846;
+    // Two uniforms consumed per point
+    result.samples = 2 * points;
+    return result;
+}
+
+// Black-Scholes path simulation — host API.
+//
+// The generator fills one buffer with all increments of all paths
+// (rocrand_generate_normal), then every thread evolves one path of
+// geometric Brownian motion step by step and writes its discounted
+// call payoff. The increments are laid out step-major so consecutive
+// threads read consecutive values. Priced against the closed-form
+// Black-Scholes value.
+__global__
+void black_scholes_paths_kernel(float * payoffs,
+                                const float * z,
+                                const size_t paths,
+                                const unsigned int steps,
+                                const float s0,
+                                const float strike,
+                                const float drift,
+                                const float diffusion)
+{
+    const size_t path = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(path >= paths)
+        return;
+
+    float s = s0;
+    for(unsigned int step = 0; step < steps; step++)
+    {
+        s *= expf(drift + diffusion * z[step * paths + path]);
+    }
+    payoffs[path] = s > strike ? s - strike : 0.0f;
+}
+
+double normal_cdf(double x)
+{
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+mc_result run_black_scholes(rocrand_generator generator,
+                            const size_t paths,
+                            const unsigned int steps)
+{
+    const double s0 = 100.0;
+    const double strike = 105.0;
+    const double rate = 0.03;
+    const double sigma = 0.2;
+    const double maturity = 1.0;
+    const double dt = maturity / steps;
+
+    float * z;
+    float * payoffs;
+    HIP_CHECK(hipMalloc((void **)&z, paths * steps * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&payoffs, paths * sizeof(float)));
+
+    ROCRAND_CHECK(rocrand_generate_normal(generator, z, paths * steps, 0.0f, 1.0f));
+
+    const size_t threads = 256;
+    const size_t blocks = (paths + threads - 1) / threads;
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(black_scholes_paths_kernel),
+        dim3(blocks), dim3(threads), 0, 0,
+        payoffs, z, paths, steps,
+        float(s0), float(strike),
+        float((rate - 0.5 * sigma * sigma) * dt),
+        float(sigma * std::sqrt(dt))
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> h_payoffs(paths);
+    HIP_CHECK(hipMemcpy(h_payoffs.data(), payoffs,
+                        paths * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(payoffs));
+    HIP_CHECK(hipFree(z));
+
+    const double sum =
+        std::accumulate(h_payoffs.begin(), h_payoffs.end(), 0.0);
+
+    const double d1 = (std::log(s0 / strike)
+                       + (rate + 0.5 * sigma * sigma) * maturity)
+                      / (sigma * std::sqrt(maturity));
+    const double d2 = d1 - sigma * std::sqrt(maturity);
+
+    mc_result result;
+    result.value = std::exp(-rate * maturity) * sum / paths;
+    result.reference = s0 * normal_cdf(d1)
+                       - strike * std::exp(-rate * maturity) * normal_cdf(d2);
+    result.samples = paths * steps;
+    return result;
+}
+
+// Quasi-Monte Carlo integration — host API, Sobol.
+//
+// Integrates Sobol's g-function prod_i |4 x_i - 2| / (1 + a_i) with
+// a_i = i (exact integral 1) over the unit cube. The generator writes
+// the point set dimension-major (each dimension's n values are
+// contiguous), every thread evaluates the integrand at one point, and
+// the mean of the evaluations is the estimate.
+__global__
+void g_function_kernel(float * values,
+                       const float * points,
+                       const size_t n,
+                       const unsigned int dimensions)
+{
+    const size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(index >= n)
+        return;
+
+    float f = 1.0f;
+    for(unsigned int dim = 0; dim < dimensions; dim++)
+    {
+        const float x = points[dim * n + index];
+        f *= (fabsf(4.0f * x - 2.0f) + dim) / (1.0f + dim);
+    }
+    values[index] = f;
+}
+
+mc_result run_sobol_integration(rocrand_generator generator,
+                                const size_t n,
+                                const unsigned int dimensions)
+{
+    float * points;
+    float * values;
+    HIP_CHECK(hipMalloc((void **)&points, n * dimensions * sizeof(float)));
+    HIP_CHECK(hipMalloc((void **)&values, n * sizeof(float)));
+
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, points, n * dimensions));
+
+    const size_t threads = 256;
+    const size_t blocks = (n + threads - 1) / threads;
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(g_function_kernel),
+        dim3(blocks), dim3(threads), 0, 0,
+        values, points, n, dimensions
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> h_values(n);
+    HIP_CHECK(hipMemcpy(h_values.data(), values,
+                        n * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(values));
+    HIP_CHECK(hipFree(points));
+
+    const double sum = std::accumulate(h_values.begin(), h_values.end(), 0.0);
+
+    mc_result result;
+    result.value = sum / n;
+    result.reference = 1.0;
+    result.samples = n * dimensions;
+    return result;
+}
+
+void run_application(const cli::Parser& parser, const std::string& application)
+{
+    const size_t size = parser.get<size_t>("size");
+    const size_t trials = parser.get<size_t>("trials");
+
+    std::cout << "  " << application << ":" << std::endl;
+
+    mc_result result = { 0.0, 0.0, 0 };
+    std::chrono::duration<double, std::milli> elapsed(0.0);
+    if(application == "pi")
+    {
+        const unsigned long long seed = 12345ULL;
+        // Warm-up
+        run_pi_estimation(size, seed);
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for(size_t trial = 0; trial < trials; trial++)
+        {
+            result = run_pi_estimation(size, seed + trial);
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+        elapsed = std::chrono::high_resolution_clock::now() - start;
+    }
+    else if(application == "black-scholes")
+    {
+        const unsigned int steps = parser.get<unsigned int>("steps");
+        const size_t paths = std::max<size_t>(1, size / steps);
+
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator,
+                                               ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+        // Warm-up
+        run_black_scholes(generator, paths, steps);
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for(size_t trial = 0; trial < trials; trial++)
+        {
+            result = run_black_scholes(generator, paths, steps);
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+        elapsed = std::chrono::high_resolution_clock::now() - start;
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+    else if(application == "sobol-integration")
+    {
+        const unsigned int dimensions = parser.get<unsigned int>("dimensions");
+        const size_t n = std::max<size_t>(1, size / dimensions);
+
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator,
+                                               ROCRAND_RNG_QUASI_SOBOL32));
+        ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator,
+                                                                    dimensions));
+        // Warm-up
+        run_sobol_integration(generator, n, dimensions);
+        HIP_CHECK(hipDeviceSynchronize());
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for(size_t trial = 0; trial < trials; trial++)
+        {
+            result = run_sobol_integration(generator, n, dimensions);
+        }
+        HIP_CHECK(hipDeviceSynchronize());
+        elapsed = std::chrono::high_resolution_clock::now() - start;
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    print_result(result, elapsed.count(), trials);
+}
+
+const std::vector<std::string> all_applications = {
+    "pi",
+    "black-scholes",
+    "sobol-integration"
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string application_desc =
+        "space-separated list of applications:" +
+        std::accumulate(all_applications.begin(), all_applications.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        ) +
+        "\n      or all";
+
+    parser.set_optional<size_t>("size", "size", DEFAULT_SAMPLES, "number of samples to consume per trial");
+    parser.set_optional<size_t>("trials", "trials", 20, "number of trials");
+    parser.set_optional<unsigned int>("steps", "steps", 256, "time steps per Black-Scholes path");
+    parser.set_optional<unsigned int>("dimensions", "dimensions", 8, "dimensions of the Sobol integration");
+    parser.set_optional<std::vector<std::string>>("app", "app", {"all"}, application_desc.c_str());
+    parser.run_and_exit_if_error();
+
+    std::vector<std::string> applications;
+    {
+        auto as = parser.get<std::vector<std::string>>("app");
+        if (std::find(as.begin(), as.end(), "all") != as.end())
+        {
+            applications = all_applications;
+        }
+        else
+        {
+            for (auto a : all_applications)
+            {
+                if (std::find(as.begin(), as.end(), a) != as.end())
+                    applications.push_back(a);
+            }
+        }
+    }
+
+    int version;
+    ROCRAND_CHECK(rocrand_get_version(&version));
+    int runtime_version;
+    HIP_CHECK(hipRuntimeGetVersion(&runtime_version));
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+    hipDeviceProp_t props;
+    HIP_CHECK(hipGetDeviceProperties(&props, device_id));
+
+    std::cout << "rocRAND: " << version << " ";
+    std::cout << "Runtime: " << runtime_version << " ";
+    std::cout << "Device: " << props.name;
+    std::cout << std::endl << std::endl;
+
+    for (auto application : applications)
+    {
+        run_application(parser, application);
+    }
+
+    return 0;
+}
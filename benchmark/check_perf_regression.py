@@ -0,0 +1,162 @@
+#!/usr/bin/env python
+# Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""CTest-runnable throughput regression gate.
+
+Runs a short fixed matrix of the Google-Benchmark suite, compares the
+measured bytes/second against the checked-in per-device baseline, and
+fails (non-zero exit) when any case degrades by more than --threshold
+percent (default 5).
+
+Baselines live in benchmark/baselines/<device>.json, keyed by benchmark
+name; <device> is the device name the benchmark reports (e.g. gfx900).
+Throughput is machine-specific, so each CI machine records its own
+baseline once with:
+
+    ./check_perf_regression.py --binary .../benchmark_rocrand_generate_gbench \\
+        --baseline-dir .../benchmark/baselines --update
+
+Without a baseline for the current device the gate passes with a
+warning instead of failing, so fresh machines are not blocked.
+"""
+
+from __future__ import print_function
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+# Short but representative: the widest and narrowest output types for
+# every engine, at one production-sized buffer
+BENCHMARK_FILTER = r"generate<[a-z0-9]+,(uniform-uint|normal-double)>/size:16777216$"
+REPETITIONS = 5
+
+DEVICE_RE = re.compile(r"Device: (\S+)")
+
+
+def run_benchmarks(binary):
+    out_file = tempfile.NamedTemporaryFile(suffix=".json", delete=False)
+    out_file.close()
+    command = [
+        binary,
+        "--benchmark_filter=" + BENCHMARK_FILTER,
+        "--benchmark_repetitions={}".format(REPETITIONS),
+        "--benchmark_format=json",
+        "--benchmark_out=" + out_file.name,
+        "--benchmark_out_format=json",
+    ]
+    sys.stderr.write("Running: " + " ".join(command) + "\n")
+    process = subprocess.Popen(command, stderr=subprocess.PIPE,
+                               universal_newlines=True)
+    _, stderr = process.communicate()
+    sys.stderr.write(stderr)
+    if process.returncode != 0:
+        sys.stderr.write("benchmark exited with status {}\n".format(
+            process.returncode))
+        sys.exit(1)
+
+    match = DEVICE_RE.search(stderr)
+    device = match.group(1) if match else "unknown"
+
+    with open(out_file.name) as f:
+        report = json.load(f)
+    os.unlink(out_file.name)
+
+    # Prefer the median aggregate; fall back to the raw entries when
+    # the harness emits no aggregates
+    results = {}
+    for entry in report["benchmarks"]:
+        name = entry["name"]
+        if name.endswith("_median"):
+            results[name[:-len("_median")]] = entry["bytes_per_second"]
+        elif not re.search(r"_(mean|stddev|cv)$", name):
+            results.setdefault(name, entry["bytes_per_second"])
+    return device, results
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="throughput regression gate for CTest")
+    parser.add_argument("--binary", required=True,
+                        help="benchmark_rocrand_generate_gbench executable")
+    parser.add_argument("--baseline-dir", required=True,
+                        help="directory with per-device baseline JSON files")
+    parser.add_argument("--threshold", default=5.0, type=float,
+                        help="maximum tolerated degradation in percent")
+    parser.add_argument("--update", action="store_true",
+                        help="write the current results as the baseline")
+    args = parser.parse_args()
+
+    device, results = run_benchmarks(args.binary)
+    baseline_path = os.path.join(args.baseline_dir, device + ".json")
+
+    if args.update:
+        if not os.path.isdir(args.baseline_dir):
+            os.makedirs(args.baseline_dir)
+        with open(baseline_path, "w") as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print("Baseline for {} written to {}".format(device, baseline_path))
+        return
+
+    if not os.path.isfile(baseline_path):
+        sys.stderr.write(
+            "Warning: no baseline for device {} ({}); run with --update to "
+            "record one\n".format(device, baseline_path))
+        return
+
+    with open(baseline_path) as f:
+        baseline = json.load(f)
+
+    failures = []
+    for name in sorted(baseline):
+        if name not in results:
+            sys.stderr.write(
+                "Warning: baseline case {} not measured\n".format(name))
+            continue
+        expected = baseline[name]
+        measured = results[name]
+        change = 100.0 * (measured - expected) / expected
+        line = "{}: {:.3f} GB/s vs baseline {:.3f} GB/s ({:+.1f}%)".format(
+            name, measured / 2.0**30, expected / 2.0**30, change)
+        if change < -args.threshold:
+            failures.append(line)
+            line += "  REGRESSION"
+        print(line)
+
+    for name in sorted(set(results) - set(baseline)):
+        sys.stderr.write(
+            "Warning: {} has no baseline entry\n".format(name))
+
+    if failures:
+        print()
+        print("Throughput regressions over {}%:".format(args.threshold))
+        for line in failures:
+            print("  " + line)
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,208 @@
+#!/usr/bin/env python
+# Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+"""Runs matching rocRAND and cuRAND benchmarks with an identical
+size/trial/engine/distribution matrix and prints a normalized
+side-by-side throughput table.
+
+Both libraries must have been benchmarked on the same machine, which in
+practice means an nvcc build (HIP_PLATFORM=nvcc), as that is the only
+configuration that builds the benchmark_curand_* executables.
+
+Example:
+
+    ./compare_rocrand_curand.py --binary-dir ../build/benchmark \\
+        --mode generate --engine all --dis all --trials 20
+
+Cases where rocRAND is more than --threshold percent (default 10)
+behind cuRAND are marked LAG and listed at the end; the exit status is
+non-zero if any such case exists, so the script can gate CI jobs.
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import os
+import re
+import subprocess
+import sys
+
+
+ENGINE_RE = re.compile(r"^(\S+):$")
+DISTRIBUTION_RE = re.compile(r"^  (\S+):$")
+LAMBDA_RE = re.compile(r"^    lambda (\S+)$")
+THROUGHPUT_RE = re.compile(
+    r"^      Throughput = +(\S+) GB/s, .* Size = (\d+)$")
+
+
+def run_benchmark(executable, args):
+    command = [executable]
+    for name, value in args:
+        command.append("--" + name)
+        command.extend(str(v) for v in value)
+    sys.stderr.write("Running: " + " ".join(command) + "\n")
+    process = subprocess.Popen(command, stdout=subprocess.PIPE,
+                               universal_newlines=True)
+    output, _ = process.communicate()
+    if process.returncode != 0:
+        sys.stderr.write("{} exited with status {}\n".format(
+            executable, process.returncode))
+        sys.exit(1)
+    return output
+
+
+def parse_results(output):
+    """Parses the free-text benchmark output into a dict mapping
+    (engine, distribution, lambda, size) to throughput in GB/s;
+    lambda is None for non-Poisson distributions."""
+    results = {}
+    engine = None
+    distribution = None
+    lam = None
+    for line in output.splitlines():
+        match = ENGINE_RE.match(line)
+        if match:
+            engine = match.group(1)
+            distribution = None
+            lam = None
+            continue
+        match = DISTRIBUTION_RE.match(line)
+        if match:
+            distribution = match.group(1)
+            lam = None
+            continue
+        match = LAMBDA_RE.match(line)
+        if match:
+            lam = match.group(1)
+            continue
+        match = THROUGHPUT_RE.match(line)
+        if match and engine and distribution:
+            key = (engine, distribution, lam, int(match.group(2)))
+            results[key] = float(match.group(1))
+    return results
+
+
+def format_case(key):
+    engine, distribution, lam, size = key
+    case = engine + "/" + distribution
+    if lam is not None:
+        case += "(lambda=" + lam + ")"
+    return case, size
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="rocRAND vs cuRAND benchmark comparison")
+    parser.add_argument("--binary-dir", default=".",
+                        help="directory with the benchmark executables")
+    parser.add_argument("--mode", choices=["generate", "kernel"],
+                        default="generate",
+                        help="host API (generate) or device API (kernel) "
+                             "benchmarks")
+    parser.add_argument("--engine", nargs="+", default=["all"],
+                        help="engines to benchmark (as the benchmarks "
+                             "accept them)")
+    parser.add_argument("--dis", nargs="+", default=["all"],
+                        help="distributions to benchmark")
+    parser.add_argument("--size", nargs="+", default=[1024 * 1024 * 128],
+                        type=int, help="number of values")
+    parser.add_argument("--trials", default=20, type=int,
+                        help="number of trials")
+    parser.add_argument("--lambda", dest="lambdas", nargs="+",
+                        default=[10.0], type=float,
+                        help="Poisson lambdas")
+    parser.add_argument("--threshold", default=10.0, type=float,
+                        help="flag cases where rocRAND is more than this "
+                             "many percent behind cuRAND")
+    parser.add_argument("--csv", default=None,
+                        help="also write the table to this CSV file")
+    args = parser.parse_args()
+
+    rocrand_results = {}
+    curand_results = {}
+    for size in args.size:
+        benchmark_args = [
+            ("size", [size]),
+            ("trials", [args.trials]),
+            ("engine", args.engine),
+            ("dis", args.dis),
+            ("lambda", args.lambdas),
+        ]
+        rocrand_results.update(parse_results(run_benchmark(
+            os.path.join(args.binary_dir,
+                         "benchmark_rocrand_" + args.mode),
+            benchmark_args)))
+        curand_results.update(parse_results(run_benchmark(
+            os.path.join(args.binary_dir,
+                         "benchmark_curand_" + args.mode),
+            benchmark_args)))
+
+    common = sorted(set(rocrand_results) & set(curand_results))
+    if not common:
+        sys.stderr.write("No matching benchmark cases found\n")
+        sys.exit(1)
+    missing = sorted(set(rocrand_results) ^ set(curand_results))
+    for key in missing:
+        case, size = format_case(key)
+        sys.stderr.write(
+            "Warning: {} (size {}) measured by one library only\n".format(
+                case, size))
+
+    header = ("case", "size", "rocRAND GB/s", "cuRAND GB/s", "ratio", "")
+    rows = []
+    flagged = []
+    for key in common:
+        case, size = format_case(key)
+        rocrand_gbps = rocrand_results[key]
+        curand_gbps = curand_results[key]
+        ratio = rocrand_gbps / curand_gbps if curand_gbps > 0 else float("inf")
+        lag = ratio < 1.0 - args.threshold / 100.0
+        rows.append((case, size, rocrand_gbps, curand_gbps, ratio,
+                     "LAG" if lag else ""))
+        if lag:
+            flagged.append((case, size, ratio))
+
+    case_width = max(len(header[0]), max(len(row[0]) for row in rows))
+    print("{:<{}}  {:>10}  {:>12}  {:>12}  {:>6}  {}".format(
+        header[0], case_width, *header[1:]))
+    for row in rows:
+        print("{:<{}}  {:>10}  {:>12.3f}  {:>12.3f}  {:>6.3f}  {}".format(
+            row[0], case_width, *row[1:]))
+
+    if args.csv:
+        with open(args.csv, "w") as csv_file:
+            writer = csv.writer(csv_file)
+            writer.writerow(header[:-1] + ("flagged",))
+            for row in rows:
+                writer.writerow(row)
+
+    if flagged:
+        print()
+        print("rocRAND more than {}% behind cuRAND:".format(args.threshold))
+        for case, size, ratio in flagged:
+            print("  {} (size {}): {:.1f}% of cuRAND".format(
+                case, size, 100.0 * ratio))
+        sys.exit(2)
+
+
+if __name__ == "__main__":
+    main()
@@ -97,3 +97,29 @@ if(BUILD_CRUSH_TEST)
     endif()
     find_package(TestU01 REQUIRED)
 endif()
+
+# Benchmark dependencies
+if(BUILD_BENCHMARK)
+    if(NOT DEPENDENCIES_FORCE_DOWNLOAD)
+        find_package(benchmark QUIET)
+    endif()
+
+    if(NOT benchmark_FOUND)
+        message(STATUS "Google Benchmark not found. Downloading and building Google Benchmark.")
+        # Download, build and install googlebenchmark library
+        set(GBENCHMARK_ROOT ${CMAKE_CURRENT_BINARY_DIR}/gbenchmark CACHE PATH "")
+        download_project(PROJ                googlebenchmark
+                         GIT_REPOSITORY      https://github.com/google/benchmark.git
+                         GIT_TAG             master
+                         INSTALL_DIR         ${GBENCHMARK_ROOT}
+                         CMAKE_ARGS          -DCMAKE_BUILD_TYPE=Release -DBENCHMARK_ENABLE_TESTING=OFF -DCMAKE_INSTALL_PREFIX=<INSTALL_DIR>
+                         LOG_DOWNLOAD        TRUE
+                         LOG_CONFIGURE       TRUE
+                         LOG_BUILD           TRUE
+                         LOG_INSTALL         TRUE
+                         ${UPDATE_DISCONNECTED_IF_AVAILABLE}
+        )
+        list(APPEND CMAKE_PREFIX_PATH ${GBENCHMARK_ROOT})
+    endif()
+    find_package(benchmark REQUIRED CONFIG)
+endif()
@@ -17,6 +17,9 @@ if(HIP_PLATFORM STREQUAL "nvcc")
 endif()
     message(STATUS "  Build type            : ${CMAKE_BUILD_TYPE}")
     message(STATUS "  Install prefix        : ${CMAKE_INSTALL_PREFIX}")
+if(NOT HIP_PLATFORM STREQUAL "nvcc")
+    message(STATUS "  AMD GPU targets       : ${AMDGPU_TARGETS}")
+endif()
     message(STATUS "")
     message(STATUS "  BUILD_SHARED_LIBS     : ${BUILD_SHARED_LIBS}")
     message(STATUS "  BUILD_FORTRAN_WRAPPER : ${BUILD_FORTRAN_WRAPPER}")
@@ -30,8 +30,16 @@
 
 /// \cond HIPRAND_DOCS_MACRO
 #ifndef HIPRANDAPI
+/// \def HIPRAND_HEADER_ONLY
+/// \brief Defined by the user before including hiprand.h to get inline
+/// definitions of the hipRAND host API instead of calls into the hiprand
+/// library (supported on the ROCm platform only, see hiprand_hcc_inline.h).
+#ifdef HIPRAND_HEADER_ONLY
+#define HIPRANDAPI inline
+#else
 #define HIPRANDAPI
 #endif
+#endif
 /// \endcond
 
 #include "hiprand_version.h"
@@ -550,6 +558,14 @@ hiprandDestroyDistribution(hiprandDiscreteDistribution_t discrete_distribution);
 }
 #endif /* __cplusplus */
 
+#ifdef HIPRAND_HEADER_ONLY
+#if defined(__HIP_PLATFORM_HCC__)
+#include "hiprand_hcc_inline.h"
+#else
+#error HIPRAND_HEADER_ONLY is supported on the ROCm (HCC) platform only
+#endif
+#endif // HIPRAND_HEADER_ONLY
+
 #endif // HIPRAND_H_
 
 /** @} */ // end of group hiprandhost
@@ -186,6 +186,27 @@ void hiprand_mtgp32_set_params(hiprandStateMtgp32_t * state,
     rocrand_mtgp32_set_params(state, params);
 }
 
+/**
+ * \brief Generates \p count values with a whole block, managing the
+ * shared-state copies internally.
+ *
+ * Stages the MTGP32 state into shared memory, draws in whole-block
+ * iterations with coalesced stores to \p output, and writes the
+ * advanced state back to \p state. Must be called by every thread of
+ * the block with the same \p state and \p count.
+ *
+ * \param state - Pointer to the block's state in global memory
+ * \param output - Pointer to the block's output segment
+ * \param count - Number of <tt>unsigned int</tt>s to store
+ */
+QUALIFIERS
+void hiprand_mtgp32_block_generate(hiprandStateMtgp32_t * state,
+                                   unsigned int * output,
+                                   size_t count)
+{
+    rocrand_mtgp32_block_generate(state, output, count);
+}
+
 /// \brief Initializes a PRNG state.
 ///
 /// \tparam StateType - Pseudorandom number generator state type.
@@ -493,6 +514,126 @@ float4 hiprand_normal4(hiprandStatePhilox4_32_10_t * state)
     return rocrand_normal4(state);
 }
 
+/// \brief Generates one uniformly distributed <tt>float</tt> value and
+/// applies \p transform to it in-register.
+///
+/// Equivalent to <tt>transform(hiprand_uniform(state))</tt>, but
+/// expressed as a single call so `a * x + b`-style epilogues are
+/// guaranteed to fuse with the generator instead of round-tripping
+/// through a wrapper-layer value the compiler may spill.
+///
+/// \tparam StateType - Random number generator state type
+/// \tparam UnaryFunction - Device-callable functor taking a \p float
+///
+/// \param state - Pointer to a RNG state to use
+/// \param transform - Functor applied to the generated value
+/// \return <tt>transform(x)</tt> for a uniformly distributed \p x
+template<class StateType, class UnaryFunction>
+QUALIFIERS
+auto hiprand_uniform_transformed(StateType * state, UnaryFunction transform)
+    -> decltype(transform(0.0f))
+{
+    check_state_type<StateType>();
+    return transform(rocrand_uniform(state));
+}
+
+/// \brief Generates one normally distributed <tt>float</tt> value and
+/// applies \p transform to it in-register.
+///
+/// Equivalent to <tt>transform(hiprand_normal(state))</tt>; see
+/// hiprand_uniform_transformed() for the motivation.
+///
+/// \tparam StateType - Random number generator state type
+/// \tparam UnaryFunction - Device-callable functor taking a \p float
+///
+/// \param state - Pointer to a RNG state to use
+/// \param transform - Functor applied to the generated value
+/// \return <tt>transform(x)</tt> for a normally distributed \p x
+template<class StateType, class UnaryFunction>
+QUALIFIERS
+auto hiprand_normal_transformed(StateType * state, UnaryFunction transform)
+    -> decltype(transform(0.0f))
+{
+    check_state_type<StateType>();
+    return transform(rocrand_normal(state));
+}
+
+/// \brief Fills a thread-local array with transformed uniformly
+/// distributed <tt>float</tt> values.
+///
+/// Draws one \p uint4 from the Philox generator per four values and
+/// stores <tt>transform(x_i)</tt> into \p output. The fixed-size array
+/// form lets the compiler keep the whole batch in registers and unroll
+/// the loop, so the transform fuses with the generation of every lane
+/// of the draw.
+///
+/// \tparam N - Number of values to generate
+/// \tparam UnaryFunction - Device-callable functor taking a \p float
+///
+/// \param state - Pointer to a Philox state to use
+/// \param output - Thread-local array receiving the transformed values
+/// \param transform - Functor applied to each generated value
+template<unsigned int N, class UnaryFunction>
+QUALIFIERS
+void hiprand_uniform_transformed_n(hiprandStatePhilox4_32_10_t * state,
+                                   float (&output)[N],
+                                   UnaryFunction transform)
+{
+    unsigned int i = 0;
+    while(i + 4 <= N)
+    {
+        const float4 v = rocrand_uniform4(state);
+        output[i]     = transform(v.x);
+        output[i + 1] = transform(v.y);
+        output[i + 2] = transform(v.z);
+        output[i + 3] = transform(v.w);
+        i += 4;
+    }
+    while(i < N)
+    {
+        output[i] = transform(rocrand_uniform(state));
+        i++;
+    }
+}
+
+/// \brief Fills a thread-local array with transformed normally
+/// distributed <tt>float</tt> values.
+///
+/// Draws one \p uint4 from the Philox generator per four values --
+/// each feeding a four-wide Box-Muller transform -- and stores
+/// <tt>transform(x_i)</tt> into \p output; see
+/// hiprand_uniform_transformed_n() for the register-residency
+/// rationale.
+///
+/// \tparam N - Number of values to generate
+/// \tparam UnaryFunction - Device-callable functor taking a \p float
+///
+/// \param state - Pointer to a Philox state to use
+/// \param output - Thread-local array receiving the transformed values
+/// \param transform - Functor applied to each generated value
+template<unsigned int N, class UnaryFunction>
+QUALIFIERS
+void hiprand_normal_transformed_n(hiprandStatePhilox4_32_10_t * state,
+                                  float (&output)[N],
+                                  UnaryFunction transform)
+{
+    unsigned int i = 0;
+    while(i + 4 <= N)
+    {
+        const float4 v = rocrand_normal4(state);
+        output[i]     = transform(v.x);
+        output[i + 1] = transform(v.y);
+        output[i + 2] = transform(v.z);
+        output[i + 3] = transform(v.w);
+        i += 4;
+    }
+    while(i < N)
+    {
+        output[i] = transform(rocrand_normal(state));
+        i++;
+    }
+}
+
 /// \brief Generates normally distributed random <tt>double</tt> value
 ///
 /// Mean value of normal distribution is equal to 0.0, and standard deviation
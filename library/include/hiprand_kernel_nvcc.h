@@ -157,6 +157,35 @@ void hiprand_mtgp32_set_params(hiprandStateMtgp32_t * state,
     static_cast<base_type*>(state)->k = params;
 }
 
+QUALIFIERS
+void hiprand_mtgp32_block_generate(hiprandStateMtgp32_t * state,
+                                   unsigned int * output,
+                                   size_t count)
+{
+    #if defined(__CUDA_ARCH__)
+    __shared__ hiprandStateMtgp32_t block_state;
+    hiprand_mtgp32_block_copy(state, &block_state);
+
+    // Every thread draws each iteration (curand() synchronizes the
+    // block); the final partial iteration only masks the store
+    size_t base = 0;
+    while(base < count)
+    {
+        const unsigned int value = curand(&block_state);
+        const size_t index = base + threadIdx.x;
+        if(index < count)
+        {
+            output[index] = value;
+        }
+        base += blockDim.x;
+    }
+
+    hiprand_mtgp32_block_copy(&block_state, state);
+    #else
+    (void)state; (void)output; (void)count;
+    #endif
+}
+
 template<class StateType>
 QUALIFIERS
 void hiprand_init(const unsigned long long seed,
@@ -331,6 +360,72 @@ float4 hiprand_normal4(hiprandStatePhilox4_32_10_t * state)
     return curand_normal4(state);
 }
 
+// In-register epilogue fusion helpers; see hiprand_kernel_hcc.h for
+// the full documentation
+template<class StateType, class UnaryFunction>
+QUALIFIERS
+auto hiprand_uniform_transformed(StateType * state, UnaryFunction transform)
+    -> decltype(transform(0.0f))
+{
+    check_state_type<StateType>();
+    return transform(curand_uniform(state));
+}
+
+template<class StateType, class UnaryFunction>
+QUALIFIERS
+auto hiprand_normal_transformed(StateType * state, UnaryFunction transform)
+    -> decltype(transform(0.0f))
+{
+    check_state_type<StateType>();
+    return transform(curand_normal(state));
+}
+
+template<unsigned int N, class UnaryFunction>
+QUALIFIERS
+void hiprand_uniform_transformed_n(hiprandStatePhilox4_32_10_t * state,
+                                   float (&output)[N],
+                                   UnaryFunction transform)
+{
+    unsigned int i = 0;
+    while(i + 4 <= N)
+    {
+        const float4 v = curand_uniform4(state);
+        output[i]     = transform(v.x);
+        output[i + 1] = transform(v.y);
+        output[i + 2] = transform(v.z);
+        output[i + 3] = transform(v.w);
+        i += 4;
+    }
+    while(i < N)
+    {
+        output[i] = transform(curand_uniform(state));
+        i++;
+    }
+}
+
+template<unsigned int N, class UnaryFunction>
+QUALIFIERS
+void hiprand_normal_transformed_n(hiprandStatePhilox4_32_10_t * state,
+                                  float (&output)[N],
+                                  UnaryFunction transform)
+{
+    unsigned int i = 0;
+    while(i + 4 <= N)
+    {
+        const float4 v = curand_normal4(state);
+        output[i]     = transform(v.x);
+        output[i + 1] = transform(v.y);
+        output[i + 2] = transform(v.z);
+        output[i + 3] = transform(v.w);
+        i += 4;
+    }
+    while(i < N)
+    {
+        output[i] = transform(curand_normal(state));
+        i++;
+    }
+}
+
 template<class StateType>
 QUALIFIERS
 double hiprand_normal_double(StateType * state)
@@ -27,6 +27,9 @@
 #define ROCRAND_H_
 
 #include <hip/hip_runtime.h>
+#if defined(__cplusplus)
+#include <hip/hip_fp16.h>
+#endif /* __cplusplus */
 
 #include "rocrand_discrete_types.h"
 
@@ -74,10 +77,78 @@ typedef enum rocrand_rng_type {
     ROCRAND_RNG_PSEUDO_MRG32K3A = 402, ///< MRG32k3a pseudorandom generator
     ROCRAND_RNG_PSEUDO_MTGP32 = 403, ///< Mersenne Twister MTGP32 pseudorandom generator
     ROCRAND_RNG_PSEUDO_PHILOX4_32_10 = 404, ///< PHILOX-4x32-10 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI = 405, ///< Multi-device PHILOX-4x32-10 pseudorandom generator
+                                                  ///< (created by rocrand_create_generator_multi())
+    ROCRAND_RNG_PSEUDO_MT19937 = 406, ///< Mersenne Twister MT19937 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 407, ///< THREEFRY-4x32-20 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_MRG31K3P = 408, ///< MRG31k3p pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7 = 409, ///< PHILOX-4x32 pseudorandom generator with 7 rounds;
+                                           ///< faster, with less statistical headroom than the
+                                           ///< 10-round default
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST = 410, ///< PHILOX-4x32-10 generator running on host
+                                                 ///< threads for systems without a GPU; integer
+                                                 ///< and uniform output is bit-identical to the
+                                                 ///< device generator under
+                                                 ///< ROCRAND_ORDERING_PSEUDO_LEGACY. Output
+                                                 ///< pointers must be host-accessible and calls
+                                                 ///< complete synchronously
     ROCRAND_RNG_QUASI_DEFAULT = 500,  ///< Default quasirandom generator
-    ROCRAND_RNG_QUASI_SOBOL32 = 501 ///< Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SOBOL32 = 501, ///< Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SOBOL64 = 502, ///< Sobol64 quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 503, ///< Scrambled Sobol32 quasirandom generator
+    ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64 = 504 ///< Scrambled Sobol64 quasirandom generator
 } rocrand_rng_type;
 
+/**
+ * \brief rocRAND output orderings for Sobol generators
+ */
+typedef enum rocrand_sobol_order {
+    ROCRAND_SOBOL_ORDER_DIMENSION = 600, ///< Dimension-major: each dimension occupies one
+                                         ///< contiguous segment of the output (default)
+    ROCRAND_SOBOL_ORDER_INTERLEAVED = 601 ///< Point-major: each d-dimensional point is
+                                          ///< contiguous in the output
+} rocrand_sobol_order;
+
+/**
+ * \brief rocRAND output orderings of pseudo-random generators
+ */
+typedef enum rocrand_ordering {
+    ROCRAND_ORDERING_PSEUDO_BEST = 100, ///< Engine grids sized for the present device
+                                        ///< (default); the output layout may differ
+                                        ///< between GPU models
+    ROCRAND_ORDERING_PSEUDO_LEGACY = 101, ///< Fixed device-independent engine grids;
+                                          ///< output is bitwise reproducible on any GPU
+    ROCRAND_ORDERING_PSEUDO_COUNTER = 102 ///< Every output element is derived from a
+                                          ///< counter keyed by (seed, element index),
+                                          ///< decoupling the output from the grid
+                                          ///< shape entirely; PHILOX4_32 generators
+                                          ///< only
+} rocrand_ordering;
+
+/**
+ * \brief rocRAND distributions for transforming raw draws
+ * (see rocrand_transform())
+ */
+typedef enum rocrand_transform_type {
+    ROCRAND_TRANSFORM_UNIFORM = 700, ///< Uniformly distributed values in (0; 1]
+    ROCRAND_TRANSFORM_NORMAL = 701, ///< Normally distributed values (Box-Muller)
+    ROCRAND_TRANSFORM_LOG_NORMAL = 702, ///< Log-normally distributed values
+    ROCRAND_TRANSFORM_EXPONENTIAL = 703 ///< Exponentially distributed values
+} rocrand_transform_type;
+
+/**
+ * \brief rocRAND engine initialization modes of pseudo-random generators
+ */
+typedef enum rocrand_initialization {
+    ROCRAND_INIT_DEFAULT = 200, ///< Every engine is positioned on its own
+                                ///< subsequence of the generator's sequence
+                                ///< with a skipahead (default)
+    ROCRAND_INIT_FAST = 201 ///< Engine states are hashed directly from the
+                            ///< seed and the engine id; near-instant
+                            ///< initialization without contiguous-stream
+                            ///< positioning guarantees
+} rocrand_initialization;
+
 
 // Host API function
 
@@ -90,9 +161,22 @@ typedef enum rocrand_rng_type {
  * Values for \p rng_type are:
  * - ROCRAND_RNG_PSEUDO_XORWOW
  * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ * - ROCRAND_RNG_PSEUDO_MRG31K3P
  * - ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_RNG_PSEUDO_MT19937
  * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_7
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
  * - ROCRAND_RNG_QUASI_SOBOL32
+ * - ROCRAND_RNG_QUASI_SOBOL64
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+ * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+ *
+ * A generator handle may be shared between host threads: every API
+ * call on it is serialized internally, so concurrent generate calls
+ * are safe and their work is issued to the generator's stream in some
+ * order. Destroying a generator while another thread still uses it is
+ * not protected.
  *
  * \param generator - Pointer to generator
  * \param rng_type - Type of generator to create
@@ -122,6 +206,34 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
 rocrand_status ROCRANDAPI
 rocrand_destroy_generator(rocrand_generator generator);
 
+/**
+ * \brief Creates a random number generator spanning multiple devices.
+ *
+ * Creates a counter-based pseudo random number generator which fills each
+ * generation request in parallel on all devices listed in \p devices,
+ * partitioning the counter space so the devices produce disjoint parts of
+ * one logical stream. Only ROCRAND_RNG_PSEUDO_PHILOX4_32_10 is supported
+ * as the underlying generator; the created generator reports type
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI.
+ *
+ * The output buffers passed to the generate functions must be accessible
+ * from all listed devices. Generation runs asynchronously on each
+ * device's null stream; synchronize the devices before reading results.
+ *
+ * \param generator - Pointer to generator
+ * \param devices - Device ids to span
+ * \param device_count - Number of entries in \p devices
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p devices is NULL, \p device_count
+ *   is lower than one, or a device id is invalid \n
+ * - ROCRAND_STATUS_SUCCESS if generator was created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_generator_multi(rocrand_generator * generator,
+                               const int * devices, int device_count);
+
 /**
  * \brief Generates uniformly distributed 32-bit unsigned integers.
  *
@@ -146,6 +258,227 @@ rocrand_status ROCRANDAPI
 rocrand_generate(rocrand_generator generator,
                  unsigned int * output_data, size_t n);
 
+/**
+ * \brief Generates uniformly distributed 8-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 8-bit unsigned integers and
+ * saves them to \p output_data. Four bytes are packed per generated
+ * 32-bit value and stored through the vectorized 32-bit path, so
+ * narrow output runs at the full word output rate.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers;
+ * must be aligned to 4 bytes
+ * \param n - Number of 8-bit unsigned integers to generate;
+ * must be a multiple of 4
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of 4,
+ * \p output_data is not aligned to 4 bytes, or the packed word count
+ * is not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_char(rocrand_generator generator,
+                      unsigned char * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed 16-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 16-bit unsigned integers and
+ * saves them to \p output_data. Two values are packed per generated
+ * 32-bit value and stored through the vectorized 32-bit path, so
+ * narrow output runs at the full word output rate.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers;
+ * must be aligned to 4 bytes
+ * \param n - Number of 16-bit unsigned integers to generate;
+ * must be even
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even,
+ * \p output_data is not aligned to 4 bytes, or the packed word count
+ * is not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_short(rocrand_generator generator,
+                       unsigned short * output_data, size_t n);
+
+/**
+ * \brief Generates uniformly distributed 64-bit unsigned integers.
+ *
+ * Generates \p n uniformly distributed 64-bit unsigned integers and
+ * saves them to \p output_data. For 32-bit generators two generated
+ * values are spliced per 64-bit output while keeping the 128-bit
+ * vectorized stores, so 64-bit streams run at full memory bandwidth;
+ * Sobol64 produces native 64-bit values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 64-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if the generated word count is
+ * not a multiple of the dimension of used quasi-random generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_long_long(rocrand_generator generator,
+                           unsigned long long * output_data, size_t n);
+
+/**
+ * \brief Fills a buffer with random bytes.
+ *
+ * Fills \p bytes bytes of \p output_data with uniformly distributed
+ * random bytes. Unlike rocrand_generate(), the buffer may have any
+ * length and alignment; the bulk of the buffer is still written with
+ * vectorized 32-bit stores in a single kernel launch.
+ *
+ * Supported only by counter-based generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_32_20).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated bytes
+ * \param bytes - Number of bytes to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support byte buffers \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random bytes were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_bytes(rocrand_generator generator,
+                       void * output_data, size_t bytes);
+
+/**
+ * \brief Callback receiving one chunk of generated data (see
+ * rocrand_generate_chunks()).
+ *
+ * \p chunk_data points to pinned host memory owned by the generator
+ * and is valid only until the callback returns; copy the data out if
+ * it is needed afterwards. The callback runs on a HIP-internal thread
+ * and must not call HIP API functions.
+ */
+typedef void (*rocrand_chunk_callback)(void * chunk_data,
+                                       size_t chunk_bytes,
+                                       void * user_data);
+
+/**
+ * \brief Generates random bytes delivered to the host in pipelined chunks.
+ *
+ * Generates \p total_bytes uniformly distributed random bytes and
+ * delivers them to \p callback in chunks of \p chunk_bytes (the last
+ * chunk may be shorter). Internally the call cycles two device staging
+ * buffers and two pinned host buffers in a three-stage pipeline:
+ * generation of chunk i+2 runs on the generator's stream while the
+ * device-to-host copy of chunk i+1 is in flight and the callback is
+ * processing chunk i, so for host consumers that work chunk by chunk
+ * the first data arrives after one chunk instead of after the whole
+ * buffer. Callbacks fire in chunk order. The call returns after the
+ * last callback has completed.
+ *
+ * A long-running callback stalls the copy pipeline, not the
+ * generation kernels; size \p chunk_bytes so that processing one chunk
+ * takes about as long as generating one.
+ *
+ * Supported by the generators that implement rocrand_generate_bytes()
+ * and by host generators, which generate each chunk on the calling
+ * thread and invoke the callback directly.
+ *
+ * \param generator - Generator to use
+ * \param total_bytes - Total number of bytes to generate
+ * \param chunk_bytes - Number of bytes per delivered chunk
+ * \param callback - Function receiving each chunk
+ * \param user_data - Opaque pointer passed through to the callback
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p callback is NULL or
+ * \p chunk_bytes is zero \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support byte
+ * buffers \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the staging buffers could not
+ * be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if all chunks were generated and
+ * delivered \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_chunks(rocrand_generator generator,
+                        size_t total_bytes, size_t chunk_bytes,
+                        rocrand_chunk_callback callback,
+                        void * user_data);
+
+/**
+ * \brief Generates 32-bit unsigned integers from an absolute stream position.
+ *
+ * Generates \p n uniformly distributed 32-bit unsigned integers taken
+ * from position \p sequence_offset of the generator's logical stream
+ * and saves them to \p output_data. The generator's state is neither
+ * read nor modified, so concurrent host threads can fill disjoint
+ * slices of one stream through a shared generator without
+ * synchronization or state save/restore.
+ *
+ * Supported only by counter-based generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_THREEFRY4_32_20).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param sequence_offset - Absolute position in the generator's stream
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not counter-based \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_at(rocrand_generator generator,
+                    unsigned int * output_data, size_t n,
+                    unsigned long long sequence_offset);
+
+/**
+ * \brief Generates 32-bit unsigned integers into a batch of buffers.
+ *
+ * Fills each of the \p count buffers \p output_data[i] with
+ * \p sizes[i] uniformly distributed 32-bit unsigned integers in a
+ * single kernel launch, amortizing launch overhead and engine
+ * load/store across the whole batch. The output is a valid stream of
+ * the generator, but it matches buffer-by-buffer rocrand_generate()
+ * calls only when every buffer size is a multiple of 4.
+ *
+ * Supported only by Philox generators (ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Array of \p count pointers to device memory
+ * \param sizes - Number of values to generate into each buffer
+ * \param count - Number of buffers
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support batched generation \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p count is lower than 1 or a pointer is NULL \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED, if descriptor memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_batch(rocrand_generator generator,
+                       unsigned int * const * output_data,
+                       const size_t * sizes, int count);
+
 /**
  * \brief Generates uniformly distributed \p float values.
  *
@@ -194,6 +527,122 @@ rocrand_status ROCRANDAPI
 rocrand_generate_uniform_double(rocrand_generator generator,
                                 double * output_data, size_t n);
 
+#if defined(__cplusplus)
+/**
+ * \brief Generates uniformly distributed half-precision values.
+ *
+ * Generates \p n uniformly distributed 16-bit half-precision floating-point
+ * values and saves them to \p output_data. Two halves are packed per
+ * generated 32-bit value, so half buffers are filled at the same rate
+ * as <tt>unsigned int</tt> buffers.
+ *
+ * Generated numbers are between \p 0.0 and \p 1.0, excluding \p 0.0 and
+ * including \p 1.0.
+ *
+ * Not available from C translation units, as \p __half is a C++ type.
+ * Supported only by generators with full-range 32-bit output (not
+ * supported by MRG32k3a, MRG31k3p and 64-bit Sobol generators).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>__half</tt>s to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support half precision \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data
+ * is not aligned to \p sizeof(__half2) bytes \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              __half * output_data, size_t n);
+#endif /* __cplusplus */
+
+/**
+ * \brief Generates uniformly distributed floats from a given range.
+ *
+ * Generates \p n uniformly distributed 32-bit floating-point values
+ * from the range (\p low; \p high] and saves them to \p output_data.
+ * The affine transform is fused into the generation kernel, so this
+ * costs the same single pass over memory as rocrand_generate_uniform().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param low - Start of the range (excluded from the output)
+ * \param high - End of the range (included in the output)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_range(rocrand_generator generator,
+                               float * output_data, size_t n,
+                               float low, float high);
+
+/**
+ * \brief Generates uniformly distributed doubles from a given range.
+ *
+ * Generates \p n uniformly distributed 64-bit double-precision
+ * floating-point values from the range (\p low; \p high] and saves
+ * them to \p output_data. The affine transform is fused into the
+ * generation kernel, so this costs the same single pass over memory
+ * as rocrand_generate_uniform_double().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param low - Start of the range (excluded from the output)
+ * \param high - End of the range (included in the output)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_range_double(rocrand_generator generator,
+                                      double * output_data, size_t n,
+                                      double low, double high);
+
+/**
+ * \brief Generates reduced-precision uniformly distributed floats.
+ *
+ * Generates \p n uniformly distributed 32-bit floating-point values
+ * from (0; 1] carrying only \p bits bits of resolution and saves them
+ * to \p output_data. Every 32-bit draw of the underlying engine is
+ * sliced into <tt>32 / bits</tt> values, multiplying the output rate
+ * for consumers that trade entropy per value for throughput (noise
+ * textures and the like). With \p bits equal to 32 the output matches
+ * rocrand_generate_uniform() exactly.
+ *
+ * Supported only by PHILOX4_32 generators.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param bits - Bits of resolution per value; must be 8, 16 or 32
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a PHILOX4_32 generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p bits is not 8, 16 or 32 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_bits(rocrand_generator generator,
+                              float * output_data, size_t n,
+                              unsigned int bits);
+
 /**
  * \brief Generates normally distributed \p float values.
  *
@@ -211,7 +660,8 @@ rocrand_generate_uniform_double(rocrand_generator generator,
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
  * aligned to \p sizeof(float2) bytes, or \p n is not a multiple of the dimension
- * of used quasi-random generator \n
+ * of used quasi-random generator; counter-based generators (Philox, Threefry)
+ * accept any length and alignment \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
@@ -236,7 +686,8 @@ rocrand_generate_normal(rocrand_generator generator,
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
  * aligned to \p sizeof(double2) bytes, or \p n is not a multiple of the dimension
- * of used quasi-random generator \n
+ * of used quasi-random generator; counter-based generators (Philox, Threefry)
+ * accept any length and alignment \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
@@ -244,6 +695,134 @@ rocrand_generate_normal_double(rocrand_generator generator,
                                double * output_data, size_t n,
                                double mean, double stddev);
 
+/**
+ * \brief Generates normally distributed \p double values using a
+ * hybrid-precision transform.
+ *
+ * Generates \p n normally distributed 64-bit double-precision floating-point
+ * numbers and saves them to \p output_data. The uniform inputs of the
+ * Box-Muller transform keep full 53-bit mantissa granularity, so the
+ * distribution reaches the same tail range as
+ * rocrand_generate_normal_double(), but the transcendental functions of
+ * the transform (log, sqrt, sin, cos) are evaluated in single precision.
+ * On GPUs with a reduced double-precision rate this is substantially
+ * faster, at the cost of roughly single-precision accuracy in each
+ * generated value.
+ *
+ * Supported by generators with full-range 32-bit output: Philox,
+ * Threefry, XORWOW and MT19937. Other generators return
+ * ROCRAND_STATUS_TYPE_ERROR.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support the
+ * hybrid-precision path \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data
+ * is not aligned to \p sizeof(double2) bytes; counter-based generators
+ * (Philox, Threefry) accept any length and alignment \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_fast(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double mean, double stddev);
+
+#if defined(__cplusplus)
+/**
+ * \brief Generates normally distributed half-precision values.
+ *
+ * Generates \p n normally distributed 16-bit half-precision floating-point
+ * values and saves them to \p output_data. Two halves are packed per
+ * generated 32-bit value, with the two 16-bit halves of each draw fed
+ * through a Box-Muller transform.
+ *
+ * Not available from C translation units, as \p __half is a C++ type.
+ * Supported only by generators with full-range 32-bit output (not
+ * supported by MRG32k3a, MRG31k3p and 64-bit Sobol generators).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>__half</tt>s to generate
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support half precision \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even or \p output_data
+ * is not aligned to \p sizeof(__half2) bytes \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_half(rocrand_generator generator,
+                             __half * output_data, size_t n,
+                             __half mean, __half stddev);
+#endif /* __cplusplus */
+
+/**
+ * \brief Generates and reduces normally distributed \p float values.
+ *
+ * Draws \p n normally distributed 32-bit floating-point values with
+ * the given \p mean and \p stddev and accumulates them on the fly:
+ * \p sums must point to 2 device <tt>float</tt>s, which receive the
+ * sum of the drawn values and the sum of their squares. The stream is
+ * never written to memory, so Monte Carlo estimators that only need
+ * moments avoid the output bandwidth entirely. The generator state
+ * advances as if rocrand_generate_normal() was called with the same
+ * \p n.
+ *
+ * Supported only by Philox generators (ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7).
+ *
+ * \param generator - Generator to use
+ * \param n - Number of <tt>float</tt>s to draw
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ * \param sums - Pointer to 2 device values receiving the reductions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support fused reduction \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the values were successfully generated and reduced \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_reduce(rocrand_generator generator,
+                               size_t n, float mean, float stddev,
+                               float * sums);
+
+/**
+ * \brief Generates and reduces normally distributed \p double values.
+ *
+ * Behaves like rocrand_generate_normal_reduce() with 64-bit
+ * double-precision values; \p sums must point to 2 device
+ * <tt>double</tt>s.
+ *
+ * \param generator - Generator to use
+ * \param n - Number of <tt>double</tt>s to draw
+ * \param mean - Mean value of normal distribution
+ * \param stddev - Standard deviation value of normal distribution
+ * \param sums - Pointer to 2 device values receiving the reductions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support fused reduction \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the values were successfully generated and reduced \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_reduce_double(rocrand_generator generator,
+                                      size_t n, double mean, double stddev,
+                                      double * sums);
+
 /**
  * \brief Generates log-normally distributed \p float values.
  *
@@ -261,7 +840,8 @@ rocrand_generate_normal_double(rocrand_generator generator,
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
  * aligned to \p sizeof(float2) bytes, or \p n is not a multiple of the dimension
- * of used quasi-random generator \n
+ * of used quasi-random generator; counter-based generators (Philox, Threefry)
+ * accept any length and alignment \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
@@ -286,7 +866,8 @@ rocrand_generate_log_normal(rocrand_generator generator,
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
  * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, \p output_data is not
  * aligned to \p sizeof(double2) bytes, or \p n is not a multiple of the dimension
- * of used quasi-random generator \n
+ * of used quasi-random generator; counter-based generators (Philox, Threefry)
+ * accept any length and alignment \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
@@ -295,28 +876,673 @@ rocrand_generate_log_normal_double(rocrand_generator generator,
                                    double mean, double stddev);
 
 /**
- * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ * \brief Generates normally distributed \p float values truncated
+ * to an interval.
  *
- * Generates \p n Poisson-distributed 32-bit unsigned integers and
- * saves them to \p output_data.
+ * Generates \p n 32-bit floating-point values from the normal
+ * distribution with the given \p mean and \p stddev conditioned on
+ * the interval [\p low, \p high], and saves them to \p output_data.
+ * Each uniform draw is mapped into the CDF mass of the interval and
+ * pushed back through the inverse normal CDF, so every draw yields an
+ * accepted sample and throughput does not depend on the width of the
+ * interval.
+ *
+ * Supported by generators with full-range 32-bit output (Philox,
+ * Threefry, XORWOW and MT19937).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param mean - Mean value of the underlying normal distribution
+ * \param stddev - Standard deviation of the underlying normal distribution
+ * \param low - Lower bound of the interval
+ * \param high - Upper bound of the interval
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support truncation \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p low is not less than \p high or
+ * \p stddev is not positive \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float low, float high);
+
+/**
+ * \brief Generates normally distributed \p double values truncated
+ * to an interval.
+ *
+ * Behaves like rocrand_generate_truncated_normal() with 64-bit
+ * double-precision values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param mean - Mean value of the underlying normal distribution
+ * \param stddev - Standard deviation of the underlying normal distribution
+ * \param low - Lower bound of the interval
+ * \param high - Upper bound of the interval
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support truncation \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p low is not less than \p high or
+ * \p stddev is not positive \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double low, double high);
+
+/**
+ * \brief Generates exponentially distributed \p float values.
+ *
+ * Generates \p n exponentially distributed 32-bit floating-point values
+ * with rate \p lambda and saves them to \p output_data. The inverse-CDF
+ * transform is fused into the generation kernel, so this costs the same
+ * single pass over memory as rocrand_generate_uniform().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param lambda - Rate of the exponential distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential(rocrand_generator generator,
+                             float * output_data, size_t n,
+                             float lambda);
+
+/**
+ * \brief Generates exponentially distributed \p double values.
+ *
+ * Generates \p n exponentially distributed 64-bit double-precision
+ * floating-point values with rate \p lambda and saves them to
+ * \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param lambda - Rate of the exponential distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential_double(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double lambda);
+
+/**
+ * \brief Generates Cauchy distributed \p float values.
+ *
+ * Generates \p n Cauchy distributed 32-bit floating-point values with
+ * location \p median and scale \p scale and saves them to
+ * \p output_data. The inverse-CDF transform is fused into the
+ * generation kernel, so this costs the same single pass over memory
+ * as rocrand_generate_uniform().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param median - Location of the Cauchy distribution
+ * \param scale - Scale of the Cauchy distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_cauchy(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float median, float scale);
+
+/**
+ * \brief Generates Cauchy distributed \p double values.
+ *
+ * Generates \p n Cauchy distributed 64-bit double-precision
+ * floating-point values with location \p median and scale \p scale
+ * and saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param median - Location of the Cauchy distribution
+ * \param scale - Scale of the Cauchy distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_cauchy_double(rocrand_generator generator,
+                               double * output_data, size_t n,
+                               double median, double scale);
+
+/**
+ * \brief Generates Weibull distributed \p float values.
+ *
+ * Generates \p n Weibull distributed 32-bit floating-point values with
+ * the given \p shape and \p scale and saves them to \p output_data.
+ * The inverse-CDF transform is fused into the generation kernel, so
+ * this costs the same single pass over memory as
+ * rocrand_generate_uniform().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param shape - Shape of the Weibull distribution
+ * \param scale - Scale of the Weibull distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not positive \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_weibull(rocrand_generator generator,
+                         float * output_data, size_t n,
+                         float shape, float scale);
+
+/**
+ * \brief Generates Weibull distributed \p double values.
+ *
+ * Generates \p n Weibull distributed 64-bit double-precision
+ * floating-point values with the given \p shape and \p scale and
+ * saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param shape - Shape of the Weibull distribution
+ * \param scale - Scale of the Weibull distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not positive \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_weibull_double(rocrand_generator generator,
+                                double * output_data, size_t n,
+                                double shape, double scale);
+
+/**
+ * \brief Generates logistic distributed \p float values.
+ *
+ * Generates \p n logistic distributed 32-bit floating-point values
+ * with the given \p location and \p scale and saves them to
+ * \p output_data. The inverse-CDF transform is fused into the
+ * generation kernel, so this costs the same single pass over memory
+ * as rocrand_generate_uniform().
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param location - Location of the logistic distribution
+ * \param scale - Scale of the logistic distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_logistic(rocrand_generator generator,
+                          float * output_data, size_t n,
+                          float location, float scale);
+
+/**
+ * \brief Generates logistic distributed \p double values.
+ *
+ * Generates \p n logistic distributed 64-bit double-precision
+ * floating-point values with the given \p location and \p scale and
+ * saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param location - Location of the logistic distribution
+ * \param scale - Scale of the logistic distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_logistic_double(rocrand_generator generator,
+                                 double * output_data, size_t n,
+                                 double location, double scale);
+
+/**
+ * \brief Transforms caller-provided raw 32-bit draws into \p float
+ * values of a chosen distribution.
+ *
+ * Applies the library's distribution transform to \p n values from
+ * \p input (raw output of rocrand_generate()) and stores the results
+ * in \p output, one <tt>float</tt> per 32-bit value, in a single
+ * bandwidth-bound pass on \p stream. This reuses entropy that was
+ * already generated: one cached raw buffer can be turned into
+ * uniforms, normals or exponentials without running a generator
+ * again.
+ *
+ * The meaning of \p p1 and \p p2 depends on \p distribution:
+ * - ROCRAND_TRANSFORM_UNIFORM - both ignored
+ * - ROCRAND_TRANSFORM_NORMAL - mean and standard deviation
+ * - ROCRAND_TRANSFORM_LOG_NORMAL - mean and standard deviation
+ * - ROCRAND_TRANSFORM_EXPONENTIAL - rate (\p p2 ignored)
+ *
+ * \param input - Pointer to \p n raw 32-bit values; must be aligned
+ * to 16 bytes
+ * \param output - Pointer to memory to store transformed values; must
+ * be aligned to 16 bytes
+ * \param n - Number of values to transform
+ * \param distribution - Distribution to apply
+ * \param p1 - First distribution parameter
+ * \param p2 - Second distribution parameter
+ * \param stream - HIP stream to launch on (0 for the default stream)
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p input or \p output is NULL, or
+ * \p distribution is not a valid transform \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p input or \p output is
+ * not aligned to 16 bytes \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the values were successfully transformed \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_transform(const unsigned int * input,
+                  float * output, size_t n,
+                  rocrand_transform_type distribution,
+                  float p1, float p2,
+                  hipStream_t stream);
+
+/**
+ * \brief Transforms caller-provided raw 32-bit draws into \p double
+ * values of a chosen distribution.
+ *
+ * Behaves like rocrand_transform() with 64-bit double-precision
+ * output; each <tt>double</tt> consumes two 32-bit values, so
+ * \p input must hold <tt>2 * n</tt> values and \p n must be even.
+ * See rocrand_transform() for the meaning of \p p1 and \p p2.
+ *
+ * \param input - Pointer to <tt>2 * n</tt> raw 32-bit values; must be
+ * aligned to 16 bytes
+ * \param output - Pointer to memory to store transformed values; must
+ * be aligned to 16 bytes
+ * \param n - Number of values to transform; must be even
+ * \param distribution - Distribution to apply
+ * \param p1 - First distribution parameter
+ * \param p2 - Second distribution parameter
+ * \param stream - HIP stream to launch on (0 for the default stream)
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p input or \p output is NULL, or
+ * \p distribution is not a valid transform \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not even, or
+ * \p input or \p output is not aligned to 16 bytes \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the values were successfully transformed \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_transform_double(const unsigned int * input,
+                         double * output, size_t n,
+                         rocrand_transform_type distribution,
+                         double p1, double p2,
+                         hipStream_t stream);
+
+/**
+ * \brief Generates gamma distributed \p float values.
+ *
+ * Generates \p n gamma distributed 32-bit floating-point values with
+ * the given \p shape and \p scale and saves them to \p output_data,
+ * using Marsaglia-Tsang rejection sampling. Each element draws from its
+ * own subsequence of a re-keyed stream, so the generator's main stream
+ * is not advanced by this call.
+ *
+ * Supported only by counter-based generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_32_20).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>float</tt>s to generate
+ * \param shape - Shape parameter of the gamma distribution (> 0)
+ * \param scale - Scale parameter of the gamma distribution (> 0)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not counter-based \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not positive \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma(rocrand_generator generator,
+                       float * output_data, size_t n,
+                       float shape, float scale);
+
+/**
+ * \brief Generates gamma distributed \p double values.
+ *
+ * Behaves like rocrand_generate_gamma() with 64-bit double-precision
+ * values.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of <tt>double</tt>s to generate
+ * \param shape - Shape parameter of the gamma distribution (> 0)
+ * \param scale - Scale parameter of the gamma distribution (> 0)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not counter-based \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not positive \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma_double(rocrand_generator generator,
+                              double * output_data, size_t n,
+                              double shape, double scale);
+
+/**
+ * \brief Generates Poisson-distributed 32-bit unsigned integers.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers and
+ * saves them to \p output_data.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lambda - lambda for the Poisson distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda);
+
+/**
+ * \brief Generates Poisson-distributed values with per-element rates.
+ *
+ * Generates \p n Poisson-distributed 32-bit unsigned integers where
+ * element \p i uses rate <tt>lambdas[i]</tt>, in a single kernel
+ * launch. \p lambdas must be a device array of \p n <tt>double</tt>s.
+ * Rates below 64 are drawn exactly with Knuth's method; larger rates
+ * use the normal approximation with continuity correction. Each
+ * element draws from its own subsequence of a re-keyed stream, so the
+ * generator's main stream is not advanced by this call.
+ *
+ * Supported only by counter-based generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_32_20).
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param lambdas - Device array of \p n rates, one per element
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not counter-based \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data, size_t n,
+                               const double * lambdas);
+
+/**
+ * \brief Generates binomially distributed 32-bit unsigned integers.
+ *
+ * Generates \p n binomially distributed 32-bit unsigned integers with
+ * \p trials trials and success probability \p p and saves them to
+ * \p output_data. Like the Poisson generator, outcomes are drawn in
+ * O(1) from a precomputed discrete table covering the probable window
+ * of the distribution; the table is cached and rebuilt only when
+ * (\p trials, \p p) changes.
+ *
+ * \param generator - Generator to use
+ * \param output_data - Pointer to memory to store generated numbers
+ * \param n - Number of 32-bit unsigned integers to generate
+ * \param trials - Number of trials of the binomial distribution
+ * \param p - Success probability of a single trial, in (0; 1)
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p trials is zero or \p p is outside (0; 1) \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          unsigned int trials, double p);
+
+/**
+ * \brief Generates indices sampled from a custom discrete distribution.
+ *
+ * Generates \p n indices in [0; \p num_weights) distributed according
+ * to the \p num_weights non-negative \p weights (which do not need to
+ * sum to 1) and saves them to \p indices. The weights may be in host
+ * or device memory; device weights are processed without a copy to the
+ * host.
+ *
+ * The table built from the weights is cached inside the generator and
+ * reused as long as \p weights and \p num_weights stay the same, so
+ * repeated sampling from one distribution pays the construction cost
+ * once. The weights are identified by their pointer: pass a different
+ * pointer after changing the weight values in place.
+ *
+ * \param generator - Generator to use
+ * \param indices - Pointer to memory to store generated indices
+ * \param n - Number of indices to generate
+ * \param weights - Weights of the distribution in host or device memory
+ * \param num_weights - Number of weights
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p num_weights is zero or too large \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory for the table could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if indices were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_sample_discrete(rocrand_generator generator,
+                        unsigned int * indices, size_t n,
+                        const double * weights, size_t num_weights);
+
+/**
+ * \brief Generates a uniform random permutation of [0; n).
+ *
+ * Fills \p perm with a random permutation of the integers 0 to
+ * \p n - 1. Every element is computed independently in O(1) by
+ * encrypting its index with a keyed Feistel network (a bijection on
+ * [0; \p n)), so no sort or host round trip is involved. Successive
+ * calls produce independent permutations; the generator's main stream
+ * is not advanced by this call.
+ *
+ * Supported only by counter-based generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_32_20).
+ *
+ * \param generator - Generator to use
+ * \param perm - Pointer to memory to store the permutation
+ * \param n - Length of the permutation
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not counter-based \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p n exceeds 2^32 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the permutation was successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * perm, size_t n);
+
+/**
+ * \brief Generates multinomial count vectors.
+ *
+ * Generates \p num_draws independent multinomial draws of \p trials
+ * trials over \p num_weights categories weighted by the non-negative
+ * device array \p weights (which does not need to sum to 1), and saves
+ * them to \p counts row-major: draw \p d occupies
+ * counts[d * num_weights] to counts[d * num_weights + num_weights - 1],
+ * and each row sums to exactly \p trials. Each draw is produced by one
+ * kernel in a single launch via the conditional-binomial decomposition,
+ * instead of one call per category; the generator's main stream is not
+ * advanced by this call.
+ *
+ * Supported only by counter-based generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_32_20).
+ *
+ * \param generator - Generator to use
+ * \param counts - Pointer to memory to store the generated counts; at
+ * least \p num_draws * \p num_weights values must fit
+ * \param num_draws - Number of multinomial vectors to generate
+ * \param trials - Number of trials per draw
+ * \param weights - Category weights in device memory
+ * \param num_weights - Number of categories
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not counter-based \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p num_weights is zero or too large \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_SUCCESS if the counts were successfully generated \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_multinomial(rocrand_generator generator,
+                             unsigned int * counts, size_t num_draws,
+                             unsigned int trials,
+                             const double * weights, size_t num_weights);
+
+/**
+ * \brief Generates 32-bit unsigned integers asynchronously.
+ *
+ * Behaves like rocrand_generate(), and additionally records \p event
+ * on the generator's stream after the generation kernel when \p event
+ * is not NULL, so consumption work on other streams can wait on it
+ * with hipStreamWaitEvent() without host synchronization.
+ *
+ * The call performs no host-blocking work: it only enqueues kernels on
+ * the generator's stream (the first call after a seed or offset change
+ * initializes the engines inside the generation kernel). The Poisson
+ * distribution is excluded from the asynchronous family because
+ * changing lambda builds distribution tables on the host.
  *
  * \param generator - Generator to use
  * \param output_data - Pointer to memory to store generated numbers
  * \param n - Number of 32-bit unsigned integers to generate
- * \param lambda - lambda for the Poisson distribution
+ * \param event - Event to record after generation, or NULL
  *
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
- * - ROCRAND_STATUS_OUT_OF_RANGE if lambda is non-positive \n
- * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
- * of used quasi-random generator \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the event could not be recorded \n
  * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
  */
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda);
+rocrand_generate_async(rocrand_generator generator,
+                       unsigned int * output_data, size_t n,
+                       hipEvent_t event);
+
+/**
+ * \brief Generates uniformly distributed \p float values asynchronously.
+ *
+ * Behaves like rocrand_generate_uniform(); see rocrand_generate_async()
+ * for the completion-event and host-blocking guarantees.
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_async(rocrand_generator generator,
+                               float * output_data, size_t n,
+                               hipEvent_t event);
+
+/**
+ * \brief Generates uniformly distributed \p double values asynchronously.
+ *
+ * Behaves like rocrand_generate_uniform_double(); see
+ * rocrand_generate_async() for the completion-event and host-blocking
+ * guarantees.
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_async(rocrand_generator generator,
+                                      double * output_data, size_t n,
+                                      hipEvent_t event);
+
+/**
+ * \brief Generates normally distributed \p float values asynchronously.
+ *
+ * Behaves like rocrand_generate_normal(); see rocrand_generate_async()
+ * for the completion-event and host-blocking guarantees.
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_async(rocrand_generator generator,
+                              float * output_data, size_t n,
+                              float mean, float stddev,
+                              hipEvent_t event);
+
+/**
+ * \brief Generates normally distributed \p double values asynchronously.
+ *
+ * Behaves like rocrand_generate_normal_double(); see
+ * rocrand_generate_async() for the completion-event and host-blocking
+ * guarantees.
+ */
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_async(rocrand_generator generator,
+                                     double * output_data, size_t n,
+                                     double mean, double stddev,
+                                     hipEvent_t event);
 
 /**
  * \brief Initializes the generator's state on GPU or host.
@@ -328,6 +1554,15 @@ rocrand_generate_poisson(rocrand_generator generator,
  * automatically called by functions which generates random numbers like
  * rocrand_generate(), rocrang_generate_uniform() etc.
  *
+ * Calling this function explicitly also hoists all state-mutating setup
+ * out of the generation functions: once a generator is initialized, the
+ * rocrand_generate() family enqueues plain kernel launches on the
+ * generator's stream with no other host-side work, which makes the
+ * launches safe to record into captured stream work (the same applies to
+ * rocrand_generate_poisson() as long as lambda does not change between
+ * calls). Quasi-random generators advance their offset on the host per
+ * call and are excluded from this guarantee.
+ *
  * \param generator - Generator to initialize
  *
  * \return
@@ -338,6 +1573,146 @@ rocrand_generate_poisson(rocrand_generator generator,
 rocrand_status ROCRANDAPI
 rocrand_initialize_generator(rocrand_generator generator);
 
+/**
+ * \brief Returns the size of the generator's serialized state.
+ *
+ * Returns in \p state_size the number of bytes needed to store the
+ * complete state of \p generator (see rocrand_save_state()).
+ *
+ * \param generator - Generator to query
+ * \param state_size - Size of the state in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state_size is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support state serialization \n
+ * - ROCRAND_STATUS_SUCCESS if the size was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_state_size(rocrand_generator generator, size_t * state_size);
+
+/**
+ * \brief Saves the generator's state to a host buffer.
+ *
+ * Snapshots the complete state of \p generator (including the device-side
+ * engine states) into \p state, which must be at least the number of bytes
+ * reported by rocrand_get_state_size(). The generator is initialized first
+ * when it was not initialized yet.
+ *
+ * A saved state can be restored with rocrand_load_state() by a generator
+ * of the same type running on the same device configuration, which makes
+ * checkpoint/restart a single copy instead of re-initialization and
+ * fast-forwarding.
+ *
+ * \param generator - Generator to save
+ * \param state - Host buffer to write the state into
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support state serialization \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if copying the state failed \n
+ * - ROCRAND_STATUS_SUCCESS if the state was successfully saved \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_save_state(rocrand_generator generator, void * state);
+
+/**
+ * \brief Restores the generator's state from a host buffer.
+ *
+ * Restores the complete state of \p generator from \p state previously
+ * written by rocrand_save_state().
+ *
+ * \param generator - Generator to restore
+ * \param state - Host buffer holding a saved state
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL or does not match
+ * the generator's type or engine array size \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support state serialization \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if copying the state failed \n
+ * - ROCRAND_STATUS_SUCCESS if the state was successfully restored \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_load_state(rocrand_generator generator, const void * state);
+
+/**
+ * \brief Creates an initialized array of device API states.
+ *
+ * Allocates a device array of \p count states of the device API type
+ * matching \p rng_type (e.g. \p rocrand_state_xorwow for
+ * ROCRAND_RNG_PSEUDO_XORWOW) and initializes every state as if by
+ * <tt>rocrand_init(seed, state_id, 0, &state)</tt>, i.e. each state on
+ * its own subsequence. The returned pointer can be cast to the state
+ * type and passed directly to application kernels, replacing the
+ * hand-written allocate-and-init pattern.
+ *
+ * Initialized states are pooled: repeated creation with the same
+ * \p rng_type, \p seed and \p count (also by host-API generators of the
+ * same type and seed) is served with a device-to-device copy instead of
+ * re-running the skipahead-heavy initialization kernel.
+ *
+ * Supported types: ROCRAND_RNG_PSEUDO_DEFAULT, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_RNG_PSEUDO_MRG31K3P,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_THREEFRY4_32_20.
+ * Generators whose device states need parameter sets or direction
+ * vectors (MTGP32, MT19937, the Sobol family) have their own setup
+ * helpers and are not supported here.
+ *
+ * The array must be freed with rocrand_destroy_device_states().
+ *
+ * \param rng_type - Type of the device API states to create
+ * \param count - Number of states
+ * \param seed - Seed used to initialize every state
+ * \param device_states - Pointer to the created device array
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p device_states is NULL or \p count is 0 \n
+ * - ROCRAND_STATUS_TYPE_ERROR if \p rng_type has no supported device state type \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the initialization kernel failed to launch \n
+ * - ROCRAND_STATUS_SUCCESS if the states were created successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_device_states(rocrand_rng_type rng_type,
+                             size_t count,
+                             unsigned long long seed,
+                             void ** device_states);
+
+/**
+ * \brief Returns the size of one device API state.
+ *
+ * Returns in \p state_size the size in bytes of the device API state
+ * type matching \p rng_type, for indexing into arrays created by
+ * rocrand_create_device_states() from code that treats them as opaque.
+ *
+ * \param rng_type - Type of the device API states
+ * \param state_size - Size of one state in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state_size is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if \p rng_type has no supported device state type \n
+ * - ROCRAND_STATUS_SUCCESS if the size was successfully returned \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_device_state_size(rocrand_rng_type rng_type, size_t * state_size);
+
+/**
+ * \brief Destroys an array of device API states.
+ *
+ * Frees a device array created by rocrand_create_device_states().
+ *
+ * \param device_states - Device array of states to destroy
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p device_states is NULL \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if freeing the memory failed \n
+ * - ROCRAND_STATUS_SUCCESS if the states were destroyed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_destroy_device_states(void * device_states);
+
 /**
  * \brief Sets the current stream for kernel launches.
  *
@@ -354,6 +1729,173 @@ rocrand_initialize_generator(rocrand_generator generator);
 rocrand_status ROCRANDAPI
 rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
 
+/**
+ * \brief Splits large generate calls across internal streams.
+ *
+ * When \p count is greater than 1, generate calls large enough to keep
+ * every stream busy are cut into \p count contiguous slices, each
+ * filled concurrently on its own internal stream from its own engine
+ * partition; the generator's stream waits on all slices, so to callers
+ * the call still completes as one unit. This improves single-call wall
+ * time on devices where one grid cannot saturate all channels. Split
+ * calls draw from the generator's side stream: output is reproducible
+ * for a fixed seed and split count, but differs from the single-launch
+ * layout, and the main stream's sequence is not advanced. A \p count
+ * of 0 or 1 restores the default single launch; values above 8 are
+ * clamped.
+ *
+ * Supported only by Philox generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7).
+ *
+ * \param generator - Generator to modify
+ * \param count - Number of internal streams to spread large calls over
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support splitting \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if stream or event creation failed \n
+ * - ROCRAND_STATUS_SUCCESS if the split count was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_split_streams(rocrand_generator generator, unsigned int count);
+
+/**
+ * \brief Starts or stops the persistent generation service.
+ *
+ * When \p enabled is nonzero, the generator launches one resident
+ * kernel that keeps the device engines in registers and polls a
+ * lock-free work queue in coherent pinned memory. While the mode is
+ * active, rocrand_generate(), rocrand_generate_uniform() and
+ * rocrand_generate_uniform_double() push a work descriptor to that
+ * queue instead of launching a kernel, so the per-call cost drops to a
+ * queue push; this pays off for workloads issuing many small generate
+ * calls, where launch overhead dominates. Enqueued requests complete
+ * asynchronously in submission order; call
+ * rocrand_persistent_synchronize() before reading the output (stream
+ * synchronization does not cover service requests, and synchronizing
+ * the whole device while the service is resident will not return).
+ * Other generate functions remain available and run through the
+ * counter-keyed path, so they never race the resident kernel for the
+ * engine state. The service owns the engine grid while it runs: the
+ * output interleaving matches one value per engine per round rather
+ * than the ordinary launch layout. Passing 0 stops the service,
+ * waiting for pending requests and writing the engines back, so
+ * ordinary generation continues where the service left off; changing
+ * the seed, offset or ordering stops it implicitly.
+ *
+ * Supported only by Philox generators
+ * (ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_PHILOX4_32_7).
+ *
+ * \param generator - Generator to modify
+ * \param enabled - Nonzero to start the service, 0 to stop it
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support the service \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the queue could not be allocated \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the resident kernel could not be launched \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was changed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_persistent_mode(rocrand_generator generator, int enabled);
+
+/**
+ * \brief Waits for the persistent generation service.
+ *
+ * Blocks until every request enqueued to the generator's persistent
+ * service (see rocrand_set_persistent_mode()) has been fully written
+ * to its output buffer. A no-op when the mode is off.
+ *
+ * \param generator - Generator to synchronize
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support the service \n
+ * - ROCRAND_STATUS_SUCCESS if all enqueued requests have completed \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_persistent_synchronize(rocrand_generator generator);
+
+/**
+ * \brief Binds a pool of user streams to one generator.
+ *
+ * Binds the \p count streams in \p streams to disjoint partitions of
+ * the generator's engine array, so one generator can serve callers
+ * that rotate among several streams without duplicating its state
+ * memory. After this call rocrand_set_stream() with a pool stream
+ * selects the partition bound to that stream instead of just changing
+ * the launch stream; generate calls issued on different pool streams
+ * then never touch the same engines and need no synchronization
+ * between them. Engine initialization still covers all partitions at
+ * once, and every pool stream is ordered after it. Each partition
+ * produces its own subsequence layout, so the output differs from
+ * single-stream operation. Setting a stream outside the pool, or a
+ * \p count of 0, leaves pool mode. Changing the seed, offset or
+ * ordering while pool work is in flight requires the caller to
+ * synchronize the device first, as everywhere else in the API.
+ *
+ * The generator's current stream becomes \p streams[0].
+ *
+ * Supported by the XORWOW and MRG32K3A generators.
+ *
+ * \param generator - Generator to modify
+ * \param streams - Streams to bind; must stay valid while the pool is in use
+ * \param count - Number of streams in \p streams; at most 16, and at most
+ * one per block of the generator's engine grid
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support stream pools \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p count is too large \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if event creation failed \n
+ * - ROCRAND_STATUS_SUCCESS if the pool was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_stream_pool(rocrand_generator generator,
+                        const hipStream_t * streams, unsigned int count);
+
+/// \brief Allocation callback installed by rocrand_set_allocator().
+///
+/// Must return a device pointer to at least \p bytes bytes, or NULL on
+/// failure. \p state is the value passed to rocrand_set_allocator().
+typedef void * (*rocrand_allocate_func)(size_t bytes, void * state);
+
+/// \brief Deallocation callback installed by rocrand_set_allocator().
+///
+/// Receives pointers previously returned by the matching
+/// rocrand_allocate_func. \p state is the value passed to
+/// rocrand_set_allocator().
+typedef void (*rocrand_deallocate_func)(void * ptr, void * state);
+
+/**
+ * \brief Replaces the allocator used for generator-internal device memory.
+ *
+ * By default the library serves its internal device allocations (engine
+ * state arrays, direction vectors, Poisson and discrete-distribution
+ * tables) from a sub-allocating memory pool, so that creating generators
+ * and rebuilding distribution tables does not call hipMalloc/hipFree --
+ * and thus does not synchronize the device -- on every operation.
+ *
+ * Calling this function with non-NULL \p allocate and \p deallocate
+ * routes those allocations through the given callbacks instead, e.g. to
+ * integrate with an application-wide pool. Passing NULL for both
+ * restores the built-in pool. The setting is process-wide and should not
+ * be changed while generators created with the previous allocator are
+ * still alive.
+ *
+ * \param allocate - Allocation callback, or NULL
+ * \param deallocate - Deallocation callback, or NULL
+ * \param state - Opaque value passed through to both callbacks
+ *
+ * \return
+ * - ROCRAND_STATUS_OUT_OF_RANGE if exactly one of the callbacks is NULL \n
+ * - ROCRAND_STATUS_SUCCESS if the allocator was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_allocator(rocrand_allocate_func allocate,
+                      rocrand_deallocate_func deallocate,
+                      void * state);
+
 /**
  * \brief Sets the seed of a pseudo-random number generator.
  *
@@ -362,9 +1904,9 @@ rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
  * - This operation resets the generator's internal state.
  * - This operation does not change the generator's offset.
  *
- * For a MRG32K3a generator seed value can't be zero. If \p seed is
- * equal zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A,
- * value \p 12345 is used as a seed instead.
+ * For MRG32K3a and MRG31K3p generators seed value can't be zero. If \p seed is
+ * equal zero and generator's type is ROCRAND_RNG_PSEUDO_MRG32K3A or
+ * ROCRAND_RNG_PSEUDO_MRG31K3P, value \p 12345 is used as a seed instead.
  *
  * \param generator - Pseudo-random number generator
  * \param seed - New seed value
@@ -377,6 +1919,37 @@ rocrand_set_stream(rocrand_generator generator, hipStream_t stream);
 rocrand_status ROCRANDAPI
 rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
 
+/**
+ * \brief Reseeds a pseudo-random number generator in place.
+ *
+ * Switches the generator to the stream keyed by \p seed. For the
+ * counter-based generators (ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+ * ROCRAND_RNG_PSEUDO_PHILOX4_32_7 and
+ * ROCRAND_RNG_PSEUDO_THREEFRY4_32_20) the engines are re-keyed in
+ * place: a single kernel swaps the key of every engine while the
+ * counters keep their position, so no skip-ahead has to be replayed
+ * and per-shard reseed loops cost microseconds instead of a full
+ * engine reinitialization. Streams produced by different seeds are
+ * statistically independent, but because the position is preserved,
+ * the output after rocrand_reseed() differs from the output of a
+ * freshly created generator with the same seed; use rocrand_set_seed()
+ * when bit-exact restart semantics are required.
+ *
+ * For every other pseudo-random generator type this call behaves
+ * exactly like rocrand_set_seed().
+ *
+ * \param generator - Pseudo-random number generator
+ * \param seed - New seed value
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the re-key kernel could not be launched \n
+ * - ROCRAND_STATUS_SUCCESS if seed was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_reseed(rocrand_generator generator, unsigned long long seed);
+
 /**
  * \brief Sets the offset of a random number generator.
  *
@@ -385,7 +1958,16 @@ rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
  * - This operation resets the generator's internal state.
  * - This operation does not change the generator's seed.
  *
- * Absolute offset cannot be set if generator's type is ROCRAND_RNG_PSEUDO_MTGP32.
+ * Absolute offset cannot be set if generator's type is ROCRAND_RNG_PSEUDO_MT19937.
+ *
+ * For ROCRAND_RNG_PSEUDO_MTGP32 the offset is applied to every engine with
+ * precomputed jump polynomials when the states are initialized, so jumping
+ * far into the sequence does not require generating the skipped values.
+ *
+ * The full 64-bit offset is kept by every generator that supports it.
+ * For the 32-bit Sobol generators the sequence period is 2^32 points
+ * per dimension, so positions are taken modulo 2^32; jumping to any
+ * offset is a constant-time Gray-code update either way.
  *
  * \param generator - Random number generator
  * \param offset - New absolute offset
@@ -393,16 +1975,63 @@ rocrand_set_seed(rocrand_generator generator, unsigned long long seed);
  * \return
  * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
  * - ROCRAND_STATUS_SUCCESS if offset was successfully set \n
- * - ROCRAND_STATUS_TYPE_ERROR if generator's type is ROCRAND_RNG_PSEUDO_MTGP32
+ * - ROCRAND_STATUS_TYPE_ERROR if generator's type is ROCRAND_RNG_PSEUDO_MT19937
  */
 rocrand_status ROCRANDAPI
 rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
 
+/**
+ * \brief Positions the generator into a disjoint partition of its
+ * sequence space.
+ *
+ * Splits the generator's subsequence space into \p num_ranks equal,
+ * disjoint partitions and positions the engines at the start of
+ * partition \p rank. Generators created with the same seed on
+ * different ranks then produce non-overlapping streams, which is the
+ * positioning every rank of a distributed (e.g. MPI) run needs. The
+ * per-engine skipahead is O(1), so the call costs one kernel launch
+ * regardless of how far partition \p rank is into the sequence.
+ *
+ * Partitions are carved out of the generator's subsequence index
+ * space (2^64 indices), so they remain disjoint even when ranks run
+ * on devices with different engine grid sizes. Rank 0 produces the
+ * same output as an unpartitioned generator.
+ *
+ * Supported by MRG32k3a, XORWOW and Philox generators; other types
+ * return ROCRAND_STATUS_TYPE_ERROR. For Philox the partitioning
+ * applies to the engine-array generation paths and is rejected under
+ * ROCRAND_ORDERING_PSEUDO_COUNTER, which keys outputs by element
+ * index instead of the engine array.
+ *
+ * Calling rocrand_set_seed(), rocrand_set_offset(), changing the
+ * ordering or the initialization mode resets the generator to the
+ * full sequence; set the partition again afterwards.
+ *
+ * \param generator - Random number generator
+ * \param rank - Index of the partition to own, in [0, num_ranks)
+ * \param num_ranks - Total number of partitions
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator type does not support
+ * partitioning \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p num_ranks is zero or \p rank is
+ * not smaller than \p num_ranks \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if the skipahead kernel launch
+ * failed \n
+ * - ROCRAND_STATUS_SUCCESS if the partition was set \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_subsequence(rocrand_generator generator,
+                        unsigned int rank, unsigned int num_ranks);
+
 /**
  * \brief Set the number of dimensions of a quasi-random number generator.
  *
  * Set the number of dimensions of a quasi-random number generator.
- * Supported values of \p dimensions are 1 to 20000.
+ * Supported values of \p dimensions are 1 to 20000, or up to the
+ * number of dimensions carried by the direction-vector table file named
+ * by the ROCRAND_TABLE_FILE environment variable when one is in use.
  *
  * - This operation resets the generator's internal state.
  * - This operation does not change the generator's offset.
@@ -420,6 +2049,208 @@ rocrand_status ROCRANDAPI
 rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
                                               unsigned int dimensions);
 
+/**
+ * \brief Sets the output ordering of a Sobol generator.
+ *
+ * By default multi-dimensional output is dimension-major: each of the
+ * d dimensions occupies one contiguous segment of the output buffer
+ * (ROCRAND_SOBOL_ORDER_DIMENSION). With
+ * ROCRAND_SOBOL_ORDER_INTERLEAVED the output is point-major instead:
+ * consecutive d-dimensional points are contiguous, so consumers that
+ * process whole points need no transpose pass. The generated values
+ * are the same in both orderings, only their placement differs.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's offset.
+ *
+ * \param generator - Quasi-random number generator
+ * \param order - New output ordering
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a Sobol generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p order is not a valid ordering \n
+ * - ROCRAND_STATUS_SUCCESS if the ordering was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_sobol_order(rocrand_generator generator,
+                        rocrand_sobol_order order);
+
+/**
+ * \brief Sets the output ordering of a pseudo-random number generator.
+ *
+ * With ROCRAND_ORDERING_PSEUDO_BEST (the default) the generator sizes
+ * its engine grid for the device active at creation time, trading the
+ * exact output layout for full occupancy; results are reproducible on
+ * the same GPU model but may differ between models.
+ * ROCRAND_ORDERING_PSEUDO_LEGACY pins the grid to a fixed
+ * device-independent size, so the output is bitwise reproducible on
+ * any GPU at a possible cost in bandwidth.
+ *
+ * ROCRAND_ORDERING_PSEUDO_COUNTER goes a step further for the PHILOX4_32
+ * generators: every group of output elements is drawn from its own
+ * counter value, advanced per call, so a buffer depends only on the
+ * seed, the offset and the sequence of generate calls — never on the
+ * grid geometry. The same seed then gives bit-identical buffers on any
+ * device at a possible cost in throughput. Other generator types return
+ * ROCRAND_STATUS_TYPE_ERROR for this ordering; their
+ * ROCRAND_ORDERING_PSEUDO_LEGACY mode remains the device-independent
+ * option.
+ *
+ * For MTGP32 the grid is additionally capped at the number of published
+ * parameter sets, as every engine needs its own set for an independent
+ * sequence.
+ *
+ * Generators whose engine layout is already device-independent
+ * (MT19937) accept both orderings and produce identical output under
+ * either.
+ *
+ * - This operation resets the generator's internal state.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param ordering - New output ordering
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is a quasi-random number generator,
+ *   or if \p ordering is ROCRAND_ORDERING_PSEUDO_COUNTER and the generator is not
+ *   a PHILOX4_32 generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p ordering is not a valid ordering \n
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if the engine grid could not be resized \n
+ * - ROCRAND_STATUS_SUCCESS if the ordering was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering ordering);
+
+/**
+ * \brief Sets the engine initialization mode of a pseudo-random number generator.
+ *
+ * With ROCRAND_INIT_DEFAULT (the default) every engine is placed on
+ * its own subsequence of the generator's sequence with a matrix-power
+ * skipahead, which dominates generator startup time. ROCRAND_INIT_FAST
+ * instead hashes each engine's state directly from the seed and the
+ * engine id, making initialization and reseeding near-instant. The
+ * engines remain statistically independent, but the output is no
+ * longer a reordering of one contiguous sequence, the generator
+ * produces different values than under ROCRAND_INIT_DEFAULT, and the
+ * generator's offset is ignored.
+ *
+ * Supported by the XORWOW and MRG32K3A generators.
+ *
+ * - This operation resets the generator's internal state.
+ *
+ * \param generator - Pseudo-random number generator
+ * \param initialization - New initialization mode
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support initialization modes \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p initialization is not a valid mode \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_initialization(rocrand_generator generator,
+                           rocrand_initialization initialization);
+
+/**
+ * \brief Per-generator profiling counters (see rocrand_get_stats()).
+ */
+typedef struct rocrand_stats
+{
+    double last_time_ms;  ///< Time of the last completed generate call, in
+                          ///< milliseconds. GPU time of the launched kernels
+                          ///< for device generators, wall time for host
+                          ///< generators
+    double total_time_ms; ///< Accumulated time of all completed generate
+                          ///< calls since profiling was enabled
+    unsigned long long bytes_written; ///< Total output bytes requested by
+                                      ///< generate calls
+    unsigned long long launches; ///< Number of generate calls
+    unsigned long long reinits; ///< Number of engine array initializations
+                                ///< consumed by generate calls (creation and
+                                ///< every seed, offset or ordering change
+                                ///< each trigger one)
+} rocrand_stats;
+
+/**
+ * \brief Enables or disables profiling of a generator.
+ *
+ * When enabled, every generate call on \p generator is wrapped in a
+ * pair of events on the generator's stream and its time, output size
+ * and engine reinitializations are folded into counters readable with
+ * rocrand_get_stats(). Before recording a new pair the previous
+ * profiled call is waited for; in steady state that work has long
+ * completed and the overhead is two event records per call.
+ *
+ * Profiling is off by default. Disabling keeps the counters.
+ *
+ * \param generator - Generator to profile
+ * \param enabled - Non-zero to enable profiling, zero to disable
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the profiling events could not be created \n
+ * - ROCRAND_STATUS_SUCCESS if the mode was set successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_profiling(rocrand_generator generator, int enabled);
+
+/**
+ * \brief Reads the profiling counters of a generator.
+ *
+ * Returns in \p stats the counters accumulated since profiling was
+ * enabled with rocrand_set_profiling(). The call waits for the last
+ * profiled generate call to complete so its time is included.
+ *
+ * \param generator - Generator being profiled
+ * \param stats - Pointer to the structure to fill
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stats is NULL \n
+ * - ROCRAND_STATUS_INTERNAL_ERROR if the pending call could not be waited for \n
+ * - ROCRAND_STATUS_SUCCESS if the counters were returned successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_get_stats(rocrand_generator generator, rocrand_stats * stats);
+
+/**
+ * \brief Type of the callback registered with rocrand_set_log_callback().
+ *
+ * \p record is one structured line of the form
+ * <tt>op=&lt;name&gt; n=&lt;count&gt; grid=&lt;blocks&gt;x&lt;threads&gt; stream=&lt;ptr&gt; us=&lt;time&gt;</tt>
+ * (<tt>grid=-</tt> for operations without a launch grid); the pointer
+ * is only valid for the duration of the call. \p user_data is the
+ * pointer passed to rocrand_set_log_callback().
+ */
+typedef void (*rocrand_log_callback)(const char * record, void * user_data);
+
+/**
+ * \brief Registers a callback receiving structured perf records.
+ *
+ * When a callback is registered, or when the \c ROCRAND_LOG
+ * environment variable is set (records then go to \c stderr), the
+ * library emits one record per internal operation -- generate calls,
+ * engine array initializations and distribution table rebuilds --
+ * with the operation name, element count, launch grid, stream and
+ * duration in microseconds.
+ *
+ * Timing synchronizes the operation's stream, so enabled logging
+ * makes the timed operations effectively synchronous; the hook is
+ * meant for production triage, not steady-state use. Passing NULL
+ * unregisters the callback.
+ *
+ * The setting is process-wide and applies to all generators.
+ *
+ * \param callback - Callback to register, or NULL to unregister
+ * \param user_data - Opaque pointer passed through to the callback
+ *
+ * \return
+ * - ROCRAND_STATUS_SUCCESS always \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_set_log_callback(rocrand_log_callback callback, void * user_data);
+
 /**
  * \brief Returns the version number of the library.
  *
@@ -460,7 +2291,11 @@ rocrand_create_poisson_distribution(double lambda,
  * 32-bit unsigned integers from the range [\p offset, \p offset + \p size)
  * using \p probabilities as probabilities.
  *
- * \param probabilities - probabilities of the the distribution in host memory
+ * \p probabilities may point to host or device memory. When it points
+ * to device memory, the histogram is constructed directly on the device
+ * without copying the probabilities to the host.
+ *
+ * \param probabilities - probabilities of the the distribution in host or device memory
  * \param size - size of \p probabilities
  * \param offset - offset of values
  * \param discrete_distribution - pointer to the histogram in device memory
@@ -477,6 +2312,33 @@ rocrand_create_discrete_distribution(const double * probabilities,
                                      unsigned int offset,
                                      rocrand_discrete_distribution * discrete_distribution);
 
+/**
+ * \brief Construct the histogram for a custom discrete distribution
+ * with single-precision tables.
+ *
+ * Behaves like rocrand_create_discrete_distribution(), but stores the
+ * probability and CDF tables as single-precision values. This halves
+ * the table memory and the cache footprint of sampling from large
+ * distributions, at the cost of rounding the probabilities to about
+ * seven significant decimal digits.
+ *
+ * \param probabilities - probabilities of the the distribution in host or device memory
+ * \param size - size of \p probabilities
+ * \param offset - offset of values
+ * \param discrete_distribution - pointer to the histogram in device memory
+ *
+ * \return
+ * - ROCRAND_STATUS_ALLOCATION_FAILED if memory could not be allocated \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p discrete_distribution pointer was null \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size was zero \n
+ * - ROCRAND_STATUS_SUCCESS if the histogram was constructed successfully \n
+ */
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_fp32(const double * probabilities,
+                                          unsigned int size,
+                                          unsigned int offset,
+                                          rocrand_discrete_distribution * discrete_distribution);
+
 /**
  * \brief Destroy the histogram array for a discrete distribution.
  *
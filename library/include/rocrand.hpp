@@ -34,6 +34,14 @@
 #include "rocrand.h"
 #include "rocrand_kernel.h"
 
+// C++20 std::span support for the generate overloads below
+#if defined(__cplusplus) && __cplusplus >= 202002L && defined(__has_include)
+    #if __has_include(<span>)
+        #include <span>
+        #define ROCRAND_CPP_HAVE_SPAN
+    #endif
+#endif
+
 namespace rocrand_cpp {
 
 /// \rocrand_internal \addtogroup rocrandhostcpp
@@ -200,6 +208,17 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(g, output.data(), output.size())</tt>.
+    template<class Generator>
+    void operator()(Generator& g, std::span<IntType> output)
+    {
+        (*this)(g, output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// Returns \c true if the distribution is the same as \p other.
     bool operator==(const uniform_int_distribution<IntType>& other)
     {
@@ -282,6 +301,17 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(g, output.data(), output.size())</tt>.
+    template<class Generator>
+    void operator()(Generator& g, std::span<RealType> output)
+    {
+        (*this)(g, output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// Returns \c true if the distribution is the same as \p other.
     bool operator==(const uniform_real_distribution<RealType>& other)
     {
@@ -462,6 +492,17 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(g, output.data(), output.size())</tt>.
+    template<class Generator>
+    void operator()(Generator& g, std::span<RealType> output)
+    {
+        (*this)(g, output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// \brief Returns \c true if the distribution is the same as \p other.
     ///
     /// Two distribution are equal, if their parameters are equal.
@@ -652,6 +693,17 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(g, output.data(), output.size())</tt>.
+    template<class Generator>
+    void operator()(Generator& g, std::span<RealType> output)
+    {
+        (*this)(g, output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// \brief Returns \c true if the distribution is the same as \p other.
     ///
     /// Two distribution are equal, if their parameters are equal.
@@ -825,6 +877,17 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(g, output.data(), output.size())</tt>.
+    template<class Generator>
+    void operator()(Generator& g, std::span<IntType> output)
+    {
+        (*this)(g, output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// \brief Returns \c true if the distribution is the same as \p other.
     ///
     /// Two distribution are equal, if their parameters are equal.
@@ -981,6 +1044,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// Returns the smallest possible value that can be generated by the engine.
     result_type min() const
     {
@@ -1106,6 +1179,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
@@ -1230,6 +1313,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
@@ -1274,18 +1367,15 @@ template<unsigned long long DefaultSeed>
 constexpr typename mrg32k3a_engine<DefaultSeed>::seed_type mrg32k3a_engine<DefaultSeed>::default_seed;
 /// \endcond
 
-/// \brief Random number engine based on
-/// <a href="http://www.math.sci.hiroshima-u.ac.jp/~m-mat/MT/MTGP/">Mersenne Twister
-/// for Graphic Processors</a> algorithm.
+/// \brief Pseudorandom number engine based on the MRG31k3p CMRG.
 ///
-/// mtgp32_engine is a random number engine based on
-/// <a href="http://www.math.sci.hiroshima-u.ac.jp/~m-mat/MT/MTGP/">Mersenne Twister
-/// for Graphic Processors</a> algorithm, which is a version of well-known
-/// <a href="https://en.wikipedia.org/wiki/Mersenne_Twister">Mersenne Twister</a>
-/// algorithm. It produces high quality random numbers of type \p unsigned \p int
+/// mrg31k3p_engine is an implementation of L'Ecuyer and Touzin's MRG31k3p
+/// combined multiple recursive generator. Its moduli are close to 2^31, so
+/// the recurrences avoid 64-bit multiplies and it is cheaper to advance
+/// than MRG32k3a. It produces random numbers of type \p unsigned \p int
 /// on the interval [0; 2^32 - 1].
-template<unsigned long long DefaultSeed = 0>
-class mtgp32_engine
+template<unsigned long long DefaultSeed = ROCRAND_MRG31K3P_DEFAULT_SEED>
+class mrg31k3p_engine
 {
 public:
     /// \copydoc philox4x32_10_engine::result_type
@@ -1297,23 +1387,22 @@ public:
     /// \copydoc philox4x32_10_engine::default_seed
     static constexpr seed_type default_seed = DefaultSeed;
 
-    /// \brief Constructs the pseudo-random number engine.
-    ///
-    /// MTGP32 engine does not accept offset.
-    ///
-    /// \param seed_value - seed value to use in the initialization of the internal state, see also seed()
-    ///
-    /// See also: hiprandCreateGenerator()
-    mtgp32_engine(seed_type seed_value = DefaultSeed)
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    mrg31k3p_engine(seed_type seed_value = DefaultSeed,
+                    offset_type offset_value = 0)
     {
         rocrand_status status;
         status = rocrand_create_generator(&m_generator, this->type());
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
         this->seed(seed_value);
     }
 
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
-    mtgp32_engine(rocrand_generator& generator)
+    mrg31k3p_engine(rocrand_generator& generator)
         : m_generator(generator)
     {
         if(generator == NULL)
@@ -1324,7 +1413,7 @@ public:
     }
 
     /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
-    ~mtgp32_engine() noexcept(false)
+    ~mrg31k3p_engine() noexcept(false)
     {
         rocrand_status status = rocrand_destroy_generator(m_generator);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
@@ -1337,6 +1426,13 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \copydoc philox4x32_10_engine::seed()
     void seed(seed_type value)
     {
@@ -1353,10 +1449,20 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
-        return 0;
+        return 1;
     }
 
     /// \copydoc philox4x32_10_engine::max()
@@ -1368,7 +1474,7 @@ public:
     /// \copydoc philox4x32_10_engine::type()
     static constexpr rocrand_rng_type type()
     {
-        return ROCRAND_RNG_PSEUDO_MTGP32;
+        return ROCRAND_RNG_PSEUDO_MRG31K3P;
     }
 
 private:
@@ -1394,39 +1500,33 @@ private:
 
 /// \cond
 template<unsigned long long DefaultSeed>
-constexpr typename mtgp32_engine<DefaultSeed>::seed_type mtgp32_engine<DefaultSeed>::default_seed;
+constexpr typename mrg31k3p_engine<DefaultSeed>::seed_type mrg31k3p_engine<DefaultSeed>::default_seed;
 /// \endcond
 
-/// \brief Sobol's quasi-random sequence generator
+/// \brief Pseudorandom number engine based on the ThreeFry algorithm.
 ///
-/// sobol32_engine is quasi-random number engine which produced
-/// <a href="https://en.wikipedia.org/wiki/Sobol_sequence">Sobol sequences</a>.
-/// This implementation supports generating sequences in up to 20,000 dimensions.
-/// The engine produces random unsigned integers on the interval [0, 2^32 - 1].
-template<unsigned int DefaultNumDimensions = 1>
-class sobol32_engine
+/// threefry4x32_20_engine implements a
+/// <a href="https://en.wikipedia.org/wiki/Counter-based_random_number_generator_(CBRNG)">
+/// counter-based random number generator</a> built from a reduced-strength
+/// Threefish cipher, developed by a group at D. E. Shaw Research.
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
+/// Random numbers are generated in sets of four.
+template<unsigned long long DefaultSeed = ROCRAND_THREEFRY4x32_DEFAULT_SEED>
+class threefry4x32_20_engine
 {
 public:
     /// \copydoc philox4x32_10_engine::result_type
     typedef unsigned int result_type;
     /// \copydoc philox4x32_10_engine::offset_type
     typedef unsigned long long offset_type;
-    /// \typedef dimensions_num_type
-    /// Quasi-random number engine type for number of dimensions.
-    ///
-    /// See also dimensions()
-    typedef unsigned int dimensions_num_type;
-    /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
-    static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
 
-    /// \brief Constructs the pseudo-random number engine.
-    ///
-    /// \param num_of_dimensions - number of dimensions to use in the initialization of the internal state, see also dimensions()
-    /// \param offset_value - number of internal states that should be skipped, see also offset()
-    ///
-    /// See also: rocrand_create_generator()
-    sobol32_engine(dimensions_num_type num_of_dimensions = DefaultNumDimensions,
-                   offset_type offset_value = 0)
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    threefry4x32_20_engine(seed_type seed_value = DefaultSeed,
+                    offset_type offset_value = 0)
     {
         rocrand_status status;
         status = rocrand_create_generator(&m_generator, this->type());
@@ -1435,11 +1535,11 @@ public:
         {
             this->offset(offset_value);
         }
-        this->dimensions(num_of_dimensions);
+        this->seed(seed_value);
     }
 
     /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
-    sobol32_engine(rocrand_generator& generator)
+    threefry4x32_20_engine(rocrand_generator& generator)
         : m_generator(generator)
     {
         if(generator == NULL)
@@ -1450,7 +1550,7 @@ public:
     }
 
     /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
-    ~sobol32_engine() noexcept(false)
+    ~threefry4x32_20_engine() noexcept(false)
     {
         rocrand_status status = rocrand_destroy_generator(m_generator);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
@@ -1470,38 +1570,14 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
-    /// \brief Set the number of dimensions of a quasi-random number generator.
-    ///
-    /// Supported values of \p dimensions are 1 to 20000.
-    ///
-    /// - This operation resets the generator's internal state.
-    /// - This operation does not change the generator's offset.
-    ///
-    /// \param value - Number of dimensions
-    ///
-    /// See also: rocrand_set_quasi_random_generator_dimensions()
-    void dimensions(dimensions_num_type value)
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
     {
-        rocrand_status status =
-            rocrand_set_quasi_random_generator_dimensions(this->m_generator, value);
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
-    /// \brief Fills \p output with uniformly distributed random integer values.
-    ///
-    /// Generates \p size random integer values uniformly distributed
-    /// on the interval [0, 2^32 - 1], and stores them into the device memory
-    /// referenced by \p output pointer.
-    ///
-    /// \param output - Pointer to device memory to store results
-    /// \param size - Number of values to generate
-    ///
-    /// Requirements:
-    /// * The device memory pointed by \p output must have been previously allocated
-    /// and be large enough to store at least \p size values of \p IntType type.
-    /// * \p size must be a multiple of the engine's number of dimensions.
-    ////
-    /// See also: rocrand_generate()
+    /// \copydoc philox4x32_10_engine::operator()()
     template<class Generator>
     void operator()(result_type * output, size_t size)
     {
@@ -1510,6 +1586,16 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
     /// \copydoc philox4x32_10_engine::min()
     result_type min() const
     {
@@ -1525,7 +1611,7 @@ public:
     /// \copydoc philox4x32_10_engine::type()
     static constexpr rocrand_rng_type type()
     {
-        return ROCRAND_RNG_QUASI_SOBOL32;
+        return ROCRAND_RNG_PSEUDO_THREEFRY4_32_20;
     }
 
 private:
@@ -1550,9 +1636,876 @@ private:
 };
 
 /// \cond
-template<unsigned int DefaultNumDimensions>
-constexpr typename sobol32_engine<DefaultNumDimensions>::dimensions_num_type
-sobol32_engine<DefaultNumDimensions>::default_num_dimensions;
+template<unsigned long long DefaultSeed>
+constexpr typename threefry4x32_20_engine<DefaultSeed>::seed_type threefry4x32_20_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Random number engine based on
+/// <a href="http://www.math.sci.hiroshima-u.ac.jp/~m-mat/MT/MTGP/">Mersenne Twister
+/// for Graphic Processors</a> algorithm.
+///
+/// mtgp32_engine is a random number engine based on
+/// <a href="http://www.math.sci.hiroshima-u.ac.jp/~m-mat/MT/MTGP/">Mersenne Twister
+/// for Graphic Processors</a> algorithm, which is a version of well-known
+/// <a href="https://en.wikipedia.org/wiki/Mersenne_Twister">Mersenne Twister</a>
+/// algorithm. It produces high quality random numbers of type \p unsigned \p int
+/// on the interval [0; 2^32 - 1].
+template<unsigned long long DefaultSeed = 0>
+class mtgp32_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type)
+    mtgp32_engine(seed_type seed_value = DefaultSeed,
+                  offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    mtgp32_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~mtgp32_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_MTGP32;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename mtgp32_engine<DefaultSeed>::seed_type mtgp32_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Random number engine based on
+/// <a href="https://en.wikipedia.org/wiki/Mersenne_Twister">Mersenne Twister</a>
+/// algorithm.
+///
+/// mt19937_engine is a random number engine based on the well-known
+/// MT19937 variant of the
+/// <a href="https://en.wikipedia.org/wiki/Mersenne_Twister">Mersenne Twister</a>
+/// algorithm. It produces high quality random numbers of type \p unsigned \p int
+/// on the interval [0; 2^32 - 1].
+template<unsigned long long DefaultSeed = 0>
+class mt19937_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \brief Constructs the pseudo-random number engine.
+    ///
+    /// MT19937 does not support skipping ahead, so unlike the other
+    /// pseudo-random number engines there is no constructor taking
+    /// an offset.
+    ///
+    /// \param seed_value - seed value to use in the initialization of the internal state, see also seed()
+    ///
+    /// See also: rocrand_create_generator()
+    mt19937_engine(seed_type seed_value = DefaultSeed)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        this->seed(seed_value);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    mt19937_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~mt19937_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_MT19937;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename mt19937_engine<DefaultSeed>::seed_type mt19937_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Sobol's quasi-random sequence generator
+///
+/// sobol32_engine is quasi-random number engine which produced
+/// <a href="https://en.wikipedia.org/wiki/Sobol_sequence">Sobol sequences</a>.
+/// This implementation supports generating sequences in up to 20,000 dimensions.
+/// The engine produces random unsigned integers on the interval [0, 2^32 - 1].
+template<unsigned int DefaultNumDimensions = 1>
+class sobol32_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \typedef dimensions_num_type
+    /// Quasi-random number engine type for number of dimensions.
+    ///
+    /// See also dimensions()
+    typedef unsigned int dimensions_num_type;
+    /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
+    static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
+
+    /// \brief Constructs the pseudo-random number engine.
+    ///
+    /// \param num_of_dimensions - number of dimensions to use in the initialization of the internal state, see also dimensions()
+    /// \param offset_value - number of internal states that should be skipped, see also offset()
+    ///
+    /// See also: rocrand_create_generator()
+    sobol32_engine(dimensions_num_type num_of_dimensions = DefaultNumDimensions,
+                   offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->dimensions(num_of_dimensions);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    sobol32_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~sobol32_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Set the number of dimensions of a quasi-random number generator.
+    ///
+    /// Supported values of \p dimensions are 1 to 20000.
+    ///
+    /// - This operation resets the generator's internal state.
+    /// - This operation does not change the generator's offset.
+    ///
+    /// \param value - Number of dimensions
+    ///
+    /// See also: rocrand_set_quasi_random_generator_dimensions()
+    void dimensions(dimensions_num_type value)
+    {
+        rocrand_status status =
+            rocrand_set_quasi_random_generator_dimensions(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Fills \p output with uniformly distributed random integer values.
+    ///
+    /// Generates \p size random integer values uniformly distributed
+    /// on the interval [0, 2^32 - 1], and stores them into the device memory
+    /// referenced by \p output pointer.
+    ///
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    ///
+    /// Requirements:
+    /// * The device memory pointed by \p output must have been previously allocated
+    /// and be large enough to store at least \p size values of \p IntType type.
+    /// * \p size must be a multiple of the engine's number of dimensions.
+    ////
+    /// See also: rocrand_generate()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_QUASI_SOBOL32;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned int DefaultNumDimensions>
+constexpr typename sobol32_engine<DefaultNumDimensions>::dimensions_num_type
+sobol32_engine<DefaultNumDimensions>::default_num_dimensions;
+/// \endcond
+
+/// \brief Sobol's quasi-random sequence generator
+///
+/// sobol64_engine is quasi-random number engine which produces
+/// <a href="https://en.wikipedia.org/wiki/Sobol_sequence">Sobol sequences</a>.
+/// This implementation supports generating sequences in up to 20,000 dimensions.
+/// The engine produces random unsigned integers on the interval [0, 2^64 - 1].
+template<unsigned int DefaultNumDimensions = 1>
+class sobol64_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc sobol32_engine::dimensions_num_type
+    typedef unsigned int dimensions_num_type;
+    /// \copydoc sobol32_engine::default_num_dimensions
+    static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
+
+    /// \copydoc sobol32_engine::sobol32_engine(dimensions_num_type, offset_type)
+    sobol64_engine(dimensions_num_type num_of_dimensions = DefaultNumDimensions,
+                   offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->dimensions(num_of_dimensions);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    sobol64_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~sobol64_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc sobol32_engine::dimensions()
+    void dimensions(dimensions_num_type value)
+    {
+        rocrand_status status =
+            rocrand_set_quasi_random_generator_dimensions(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \brief Fills \p output with uniformly distributed random integer values.
+    ///
+    /// Generates \p size random integer values uniformly distributed
+    /// on the interval [0, 2^64 - 1], and stores them into the device memory
+    /// referenced by \p output pointer.
+    ///
+    /// \param output - Pointer to device memory to store results
+    /// \param size - Number of values to generate
+    ///
+    /// Requirements:
+    /// * The device memory pointed by \p output must have been previously allocated
+    /// and be large enough to store at least \p size values of \p IntType type.
+    /// * \p size must be a multiple of the engine's number of dimensions.
+    ////
+    /// See also: rocrand_generate_long_long()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_QUASI_SOBOL64;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned int DefaultNumDimensions>
+constexpr typename sobol64_engine<DefaultNumDimensions>::dimensions_num_type
+sobol64_engine<DefaultNumDimensions>::default_num_dimensions;
+/// \endcond
+
+/// \brief Scrambled Sobol's quasi-random sequence generator
+///
+/// scrambled_sobol32_engine produces digitally scrambled
+/// <a href="https://en.wikipedia.org/wiki/Sobol_sequence">Sobol sequences</a>;
+/// the scrambling is derived from the generator's seed.
+/// This implementation supports generating sequences in up to 20,000 dimensions.
+/// The engine produces random unsigned integers on the interval [0, 2^32 - 1].
+template<unsigned int DefaultNumDimensions = 1>
+class scrambled_sobol32_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc sobol32_engine::dimensions_num_type
+    typedef unsigned int dimensions_num_type;
+    /// \copydoc sobol32_engine::default_num_dimensions
+    static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
+
+    /// \copydoc sobol32_engine::sobol32_engine(dimensions_num_type, offset_type)
+    scrambled_sobol32_engine(dimensions_num_type num_of_dimensions = DefaultNumDimensions,
+                             offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->dimensions(num_of_dimensions);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    scrambled_sobol32_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~scrambled_sobol32_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc sobol32_engine::dimensions()
+    void dimensions(dimensions_num_type value)
+    {
+        rocrand_status status =
+            rocrand_set_quasi_random_generator_dimensions(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc sobol32_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned int DefaultNumDimensions>
+constexpr typename scrambled_sobol32_engine<DefaultNumDimensions>::dimensions_num_type
+scrambled_sobol32_engine<DefaultNumDimensions>::default_num_dimensions;
+/// \endcond
+
+/// \brief Scrambled Sobol's quasi-random sequence generator
+///
+/// scrambled_sobol64_engine produces digitally scrambled
+/// <a href="https://en.wikipedia.org/wiki/Sobol_sequence">Sobol sequences</a>;
+/// the scrambling is derived from the generator's seed.
+/// This implementation supports generating sequences in up to 20,000 dimensions.
+/// The engine produces random unsigned integers on the interval [0, 2^64 - 1].
+template<unsigned int DefaultNumDimensions = 1>
+class scrambled_sobol64_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc sobol32_engine::dimensions_num_type
+    typedef unsigned int dimensions_num_type;
+    /// \copydoc sobol32_engine::default_num_dimensions
+    static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
+
+    /// \copydoc sobol32_engine::sobol32_engine(dimensions_num_type, offset_type)
+    scrambled_sobol64_engine(dimensions_num_type num_of_dimensions = DefaultNumDimensions,
+                             offset_type offset_value = 0)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+        if(offset_value > 0)
+        {
+            this->offset(offset_value);
+        }
+        this->dimensions(num_of_dimensions);
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    scrambled_sobol64_engine(rocrand_generator& generator)
+        : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~scrambled_sobol64_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc sobol32_engine::dimensions()
+    void dimensions(dimensions_num_type value)
+    {
+        rocrand_status status =
+            rocrand_set_quasi_random_generator_dimensions(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc sobol64_engine::operator()()
+    template<class Generator>
+    void operator()(result_type * output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
+#ifdef ROCRAND_CPP_HAVE_SPAN
+    /// \brief Overload taking the destination range as a span over device memory.
+    ///
+    /// Equivalent to <tt>(*this)(output.data(), output.size())</tt>.
+    void operator()(std::span<result_type> output)
+    {
+        (*this)(output.data(), output.size());
+    }
+#endif // ROCRAND_CPP_HAVE_SPAN
+
+    /// \copydoc philox4x32_10_engine::min()
+    result_type min() const
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    result_type max() const
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned int DefaultNumDimensions>
+constexpr typename scrambled_sobol64_engine<DefaultNumDimensions>::dimensions_num_type
+scrambled_sobol64_engine<DefaultNumDimensions>::default_num_dimensions;
 /// \endcond
 
 /// \typedef philox4x32_10;
@@ -1564,12 +2517,30 @@ typedef xorwow_engine<> xorwow;
 /// \typedef mrg32k3a
 /// \brief Typedef of rocrand_cpp::mrg32k3a_engine PRNG engine with default seed (#ROCRAND_MRG32K3A_DEFAULT_SEED).
 typedef mrg32k3a_engine<> mrg32k3a;
+/// \typedef threefry4x32_20
+/// \brief Typedef of rocrand_cpp::threefry4x32_20_engine PRNG engine with default seed (#ROCRAND_THREEFRY4x32_DEFAULT_SEED).
+typedef threefry4x32_20_engine<> threefry4x32_20;
+/// \typedef mrg31k3p
+/// \brief Typedef of rocrand_cpp::mrg31k3p_engine PRNG engine with default seed (#ROCRAND_MRG31K3P_DEFAULT_SEED).
+typedef mrg31k3p_engine<> mrg31k3p;
 /// \typedef mtgp32
 /// \brief Typedef of rocrand_cpp::mtgp32_engine PRNG engine with default seed (0).
 typedef mtgp32_engine<> mtgp32;
+/// \typedef mt19937
+/// \brief Typedef of rocrand_cpp::mt19937_engine PRNG engine with default seed (0).
+typedef mt19937_engine<> mt19937;
 /// \typedef sobol32
 /// \brief Typedef of rocrand_cpp::sobol32_engine PRNG engine with default number of dimensions (1).
 typedef sobol32_engine<> sobol32;
+/// \typedef sobol64
+/// \brief Typedef of rocrand_cpp::sobol64_engine PRNG engine with default number of dimensions (1).
+typedef sobol64_engine<> sobol64;
+/// \typedef scrambled_sobol32
+/// \brief Typedef of rocrand_cpp::scrambled_sobol32_engine PRNG engine with default number of dimensions (1).
+typedef scrambled_sobol32_engine<> scrambled_sobol32;
+/// \typedef scrambled_sobol64
+/// \brief Typedef of rocrand_cpp::scrambled_sobol64_engine PRNG engine with default number of dimensions (1).
+typedef scrambled_sobol64_engine<> scrambled_sobol64;
 
 /// \typedef default_random_engine
 /// \brief Default random engine.
@@ -21,6 +21,8 @@
 #ifndef ROCRAND_COMMON_H_
 #define ROCRAND_COMMON_H_
 
+#define ROCRAND_2POW16_INV (1.5258789e-05f)
+#define ROCRAND_2POW16_INV_2PI (1.5258789e-05f * 6.2831855f)
 #define ROCRAND_2POW32_INV (2.3283064e-10f)
 #define ROCRAND_2POW32_INV_DOUBLE (2.3283064365386963e-10)
 #define ROCRAND_2POW32_INV_2PI (2.3283064e-10f * 6.2831855f)
@@ -73,6 +75,17 @@ unsigned long long mad_u64_u32(const unsigned int x, const unsigned int y, const
     #endif
 }
 
+// One step of the splitmix64 generator, used to hash seeds and
+// sequence ids into engine states for the fast initialization path
+FQUALIFIERS
+unsigned long long split_mix64(unsigned long long& state)
+{
+    unsigned long long z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
 // This helps access fields of engine's internal state which
 // saves floats and doubles generated using the Box–Muller transform
 template<typename Engine>
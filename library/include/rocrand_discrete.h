@@ -61,10 +61,28 @@ unsigned int discrete_alias(const double x, const rocrand_discrete_distribution_
     return dis.offset + (y < dis.probability[i] ? i : dis.alias[i]);
 }
 
+FQUALIFIERS
+unsigned int discrete_alias_fp32(const double x, const rocrand_discrete_distribution_st& dis)
+{
+    // The index calculation stays in double precision so the fractional
+    // part keeps enough bits for large tables; only the table loads
+    // are single-precision
+    const double nx = dis.size * x;
+    const double fnx = floor(nx);
+    const float y = static_cast<float>(nx - fnx);
+    const unsigned int i = static_cast<unsigned int>(fnx);
+    return dis.offset + (y < dis.probability_fp32[i] ? i : dis.alias[i]);
+}
+
 FQUALIFIERS
 unsigned int discrete_alias(const unsigned int r, const rocrand_discrete_distribution_st& dis)
 {
     const double x = r * ROCRAND_2POW32_INV_DOUBLE;
+    // The branch is uniform across all threads using the distribution
+    if (dis.probability_fp32 != NULL)
+    {
+        return discrete_alias_fp32(x, dis);
+    }
     return discrete_alias(x, dis);
 }
 
@@ -75,6 +93,27 @@ unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st
 
     unsigned int min = 0;
     unsigned int max = dis.size - 1;
+    if (dis.cdf_top != NULL)
+    {
+        // Narrow the search to one segment using the coarse top level
+        unsigned int lo = 0;
+        unsigned int hi = dis.cdf_top_size - 1;
+        while (lo < hi)
+        {
+            const unsigned int center = (lo + hi) / 2;
+            if (x > dis.cdf_top[center])
+            {
+                lo = center + 1;
+            }
+            else
+            {
+                hi = center;
+            }
+        }
+        min = lo * ROCRAND_DISCRETE_CDF_TOP_STRIDE;
+        const unsigned int last = min + ROCRAND_DISCRETE_CDF_TOP_STRIDE - 1;
+        max = last < max ? last : max;
+    }
     do
     {
         const unsigned int center = (min + max) / 2;
@@ -93,9 +132,61 @@ unsigned int discrete_cdf(const double x, const rocrand_discrete_distribution_st
     return dis.offset + min;
 }
 
+FQUALIFIERS
+unsigned int discrete_cdf_fp32(const float x, const rocrand_discrete_distribution_st& dis)
+{
+    // Calculate value using binary search in the single-precision CDF
+
+    unsigned int min = 0;
+    unsigned int max = dis.size - 1;
+    if (dis.cdf_top_fp32 != NULL)
+    {
+        // Narrow the search to one segment using the coarse top level
+        unsigned int lo = 0;
+        unsigned int hi = dis.cdf_top_size - 1;
+        while (lo < hi)
+        {
+            const unsigned int center = (lo + hi) / 2;
+            if (x > dis.cdf_top_fp32[center])
+            {
+                lo = center + 1;
+            }
+            else
+            {
+                hi = center;
+            }
+        }
+        min = lo * ROCRAND_DISCRETE_CDF_TOP_STRIDE;
+        const unsigned int last = min + ROCRAND_DISCRETE_CDF_TOP_STRIDE - 1;
+        max = last < max ? last : max;
+    }
+    do
+    {
+        const unsigned int center = (min + max) / 2;
+        const float p = dis.cdf_fp32[center];
+        if (x > p)
+        {
+            min = center + 1;
+        }
+        else
+        {
+            max = center;
+        }
+    }
+    while (min != max);
+
+    return dis.offset + min;
+}
+
 FQUALIFIERS
 unsigned int discrete_cdf(const unsigned int r, const rocrand_discrete_distribution_st& dis)
 {
+    // The branch is uniform across all threads using the distribution
+    if (dis.cdf_fp32 != NULL)
+    {
+        const float x = r * ROCRAND_2POW32_INV;
+        return discrete_cdf_fp32(x, dis);
+    }
     const double x = r * ROCRAND_2POW32_INV_DOUBLE;
     return discrete_cdf(x, dis);
 }
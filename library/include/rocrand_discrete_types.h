@@ -21,6 +21,10 @@
 #ifndef ROCRAND_DISCRETE_TYPES_H_
 #define ROCRAND_DISCRETE_TYPES_H_
 
+// Number of CDF entries covered by one entry of the coarse top level
+// (see the cdf_top field below)
+#define ROCRAND_DISCRETE_CDF_TOP_STRIDE 256
+
 struct rocrand_discrete_distribution_st
 {
     unsigned int size;
@@ -32,6 +36,21 @@ struct rocrand_discrete_distribution_st
 
     // Cumulative distribution function
     double * cdf;
+
+    // Single-precision tables; when set they are used instead of the
+    // double-precision tables above, halving the table memory (see
+    // rocrand_create_discrete_distribution_fp32())
+    float * probability_fp32;
+    float * cdf_fp32;
+
+    // Coarse top level over the CDF holding every
+    // ROCRAND_DISCRETE_CDF_TOP_STRIDE-th entry. The small table is
+    // shared by all threads and stays hot in cache, so the binary
+    // search descends into a single segment of the full table instead
+    // of walking it with divergent loads.
+    unsigned int cdf_top_size;
+    double * cdf_top;
+    float * cdf_top_fp32;
 };
 
 typedef struct rocrand_discrete_distribution_st * rocrand_discrete_distribution;
@@ -31,8 +31,11 @@
 
 #include "rocrand_common.h"
 #include "rocrand_philox4x32_10.h"
+#include "rocrand_threefry4x32.h"
 #include "rocrand_mrg32k3a.h"
+#include "rocrand_mrg31k3p.h"
 #include "rocrand_xorwow.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_sobol32.h"
 #include "rocrand_mtgp32.h"
 
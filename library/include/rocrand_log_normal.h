@@ -34,8 +34,10 @@
 
 #include "rocrand_philox4x32_10.h"
 #include "rocrand_mrg32k3a.h"
+#include "rocrand_mrg31k3p.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_normal.h"
@@ -95,6 +97,33 @@ float2 rocrand_log_normal2(rocrand_state_philox4x32_10 * state, float mean, floa
     };
 }
 
+/**
+ * \brief Returns two log-normally distributed \p __half values.
+ *
+ * Generates and returns two log-normally distributed \p __half values
+ * packed into a \p __half2, using Philox generator in \p state. Both
+ * values are produced from the two 16-bit halves of one 32-bit draw, so
+ * the position of the generator is incremented by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_log_normal_half2(rocrand_state_philox4x32_10 * state, float mean, float stddev)
+{
+    const unsigned int v = rocrand(state);
+    float2 r = rocrand_device::detail::box_muller_half(
+        (unsigned short)(v), (unsigned short)(v >> 16)
+    );
+    return __halves2half2(
+        __float2half(expf(mean + (stddev * r.x))),
+        __float2half(expf(mean + (stddev * r.y)))
+    );
+}
+
 /**
  * \brief Returns four log-normally distributed \p float values.
  *
@@ -201,6 +230,194 @@ double4 rocrand_log_normal_double4(rocrand_state_philox4x32_10 * state, double m
     };
 }
 
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using ThreeFry
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them, and saves
+ * the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_threefry4x32_20 * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using ThreeFry
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_threefry4x32_20 * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    return float2 {
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns two log-normally distributed \p __half values.
+ *
+ * Generates and returns two log-normally distributed \p __half values
+ * packed into a \p __half2, using ThreeFry generator in \p state. Both
+ * values are produced from the two 16-bit halves of one 32-bit draw, so
+ * the position of the generator is incremented by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_log_normal_half2(rocrand_state_threefry4x32_20 * state, float mean, float stddev)
+{
+    const unsigned int v = rocrand(state);
+    float2 r = rocrand_device::detail::box_muller_half(
+        (unsigned short)(v), (unsigned short)(v >> 16)
+    );
+    return __halves2half2(
+        __float2half(expf(mean + (stddev * r.x))),
+        __float2half(expf(mean + (stddev * r.y)))
+    );
+}
+
+/**
+ * \brief Returns four log-normally distributed \p float values.
+ *
+ * Generates and returns four log-normally distributed \p float values using ThreeFry
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_log_normal4(rocrand_state_threefry4x32_20 * state, float mean, float stddev)
+{
+    float4 r = rocrand_device::detail::normal_distribution4(rocrand4(state));
+    return float4 {
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y)),
+        expf(mean + (stddev * r.z)),
+        expf(mean + (stddev * r.w))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double values.
+ *
+ * Generates and returns a log-normally distributed \p double value using ThreeFry
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_threefry4x32_20 * state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return exp(mean + r.x * stddev);
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using ThreeFry
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_threefry4x32_20 * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns four log-normally distributed \p double values.
+ *
+ * Generates and returns four log-normally distributed \p double values using ThreeFry
+ * generator in \p state, and increments position of the generator by eight.
+ * The function uses the Box-Muller transform method to generate four normally distributed
+ * values, transforms them to log-normally distributed values, and returns them.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Four log-normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_log_normal_double4(rocrand_state_threefry4x32_20 * state, double mean, double stddev)
+{
+    double2 r1, r2;
+    r1 = rocrand_log_normal_double2(state, mean, stddev);
+    r2 = rocrand_log_normal_double2(state, mean, stddev);
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p float value.
  *
@@ -311,6 +528,116 @@ double2 rocrand_log_normal_double2(rocrand_state_mrg32k3a * state, double mean,
     };
 }
 
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using MRG31k3p
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, returns first of them,
+ * and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_mrg31k3p * state, float mean, float stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg31k3p> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return expf(mean + (stddev * bm_helper::get_float(state)));
+    }
+    float2 r = rocrand_device::detail::mrg31k3p_normal_distribution2(state->next(), state->next());
+    bm_helper::save_float(state, r.y);
+    return expf(mean + (stddev * r.x));
+}
+#endif // ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using MRG31k3p
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_log_normal2(rocrand_state_mrg31k3p * state, float mean, float stddev)
+{
+    float2 r = rocrand_device::detail::mrg31k3p_normal_distribution2(state->next(), state->next());
+    return float2 {
+        expf(mean + (stddev * r.x)),
+        expf(mean + (stddev * r.y))
+    };
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using MRG31k3p
+ * generator in \p state, and increments position of the generator by one.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * \p double values, transforms them to log-normally distributed \p double values, returns
+ * first of them, and saves the second to be returned on the next call.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_mrg31k3p * state, double mean, double stddev)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg31k3p> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return exp(mean + (stddev * bm_helper::get_double(state)));
+    }
+    double2 r = rocrand_device::detail::mrg31k3p_normal_distribution_double2(state->next(), state->next());
+    bm_helper::save_double(state, r.y);
+    return exp(mean + r.x * stddev);
+}
+#endif // ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using MRG31k3p
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_log_normal_double2(rocrand_state_mrg31k3p * state, double mean, double stddev)
+{
+    double2 r = rocrand_device::detail::mrg31k3p_normal_distribution_double2(state->next(), state->next());
+    return double2 {
+        exp(mean + (stddev * r.x)),
+        exp(mean + (stddev * r.y))
+    };
+}
+
 /**
  * \brief Returns a log-normally distributed \p float value.
  *
@@ -366,6 +693,33 @@ float2 rocrand_log_normal2(rocrand_state_xorwow * state, float mean, float stdde
     };
 }
 
+/**
+ * \brief Returns two log-normally distributed \p __half values.
+ *
+ * Generates and returns two log-normally distributed \p __half values
+ * packed into a \p __half2, using XORWOW generator in \p state. Both
+ * values are produced from the two 16-bit halves of one 32-bit draw, so
+ * the position of the generator is incremented by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_log_normal_half2(rocrand_state_xorwow * state, float mean, float stddev)
+{
+    const unsigned int v = rocrand(state);
+    float2 r = rocrand_device::detail::box_muller_half(
+        (unsigned short)(v), (unsigned short)(v >> 16)
+    );
+    return __halves2half2(
+        __float2half(expf(mean + (stddev * r.x))),
+        __float2half(expf(mean + (stddev * r.y)))
+    );
+}
+
 /**
  * \brief Returns a log-normally distributed \p double value.
  *
@@ -502,6 +856,45 @@ double rocrand_log_normal_double(rocrand_state_sobol32 * state, double mean, dou
 }
 
 
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using PCG32
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_log_normal(rocrand_state_pcg32 * state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using PCG32
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  - Pointer to a state to use
+ * \param mean   - Mean of the related log-normal distribution
+ * \param stddev - Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_log_normal_double(rocrand_state_pcg32 * state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
 #endif // ROCRAND_LOG_NORMAL_H_
 
 /** @} */ // end of group rocranddevice
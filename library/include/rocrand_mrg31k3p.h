@@ -0,0 +1,566 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MRG31K3P_H_
+#define ROCRAND_MRG31K3P_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+#include "rocrand_mrg31k3p_precomputed.h"
+
+// P. L'Ecuyer and R. Touzin, Fast Combined Multiple Recursive Generators
+// with Multipliers of the Form a = +/- 2^q +/- 2^r, 2000
+//
+// Both component recurrences of MRG31k3p use multipliers that are sums of
+// powers of two, so the transition needs only shifts, masks and additions
+// in 32-bit integer arithmetic - no 32x32 multiplies and no double
+// precision operations, unlike MRG32k3a.
+
+#define ROCRAND_MRG31K3P_POW31 2147483648
+#define ROCRAND_MRG31K3P_M1 2147483647
+#define ROCRAND_MRG31K3P_M2 2147462579
+#define ROCRAND_MRG31K3P_M2C 21069
+#define ROCRAND_MRG31K3P_MASK12 511
+#define ROCRAND_MRG31K3P_MASK13 16777215
+#define ROCRAND_MRG31K3P_MASK2 65535
+#define ROCRAND_MRG31K3P_NORM_DOUBLE (4.656612875245797e-10) // 1/ROCRAND_MRG31K3P_M1
+#define ROCRAND_MRG31K3P_UINT_NORM (2.000000000931323) // 2^32/ROCRAND_MRG31K3P_M1
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_MRG31K3P_DEFAULT_SEED
+ * \brief Default seed for MRG31K3P PRNG.
+ */
+ #define ROCRAND_MRG31K3P_DEFAULT_SEED 12345ULL
+ /** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+namespace detail {
+
+// Maps a value from [0, ROCRAND_MRG31K3P_M1] onto [0, UINT_MAX]. This is an
+// integer computation of (unsigned int)(v * ROCRAND_MRG31K3P_UINT_NORM),
+// bit-exact with the double-precision scaling (including its
+// round-to-nearest crossings and the saturating conversion at the upper
+// bound, verified over the full input range) but free of double
+// operations, which run at a reduced rate on most consumer GPUs.
+__forceinline__ __host__ __device__
+unsigned int mrg31k3p_uint_scale(unsigned int v)
+{
+    // ROCRAND_MRG31K3P_UINT_NORM = 2 + 2097153 * 2^-51
+    const unsigned long long a = (v * 2097153ULL) << 1;
+    unsigned long long r = (static_cast<unsigned long long>(v) << 1) + (a >> 52);
+    const unsigned long long f = a & ((1ULL << 52) - 1);
+    if(f != 0 && r >= 2)
+    {
+        // The double product rounds up across the next integer when the
+        // fraction is within half an ulp of it (ties round up, the
+        // integer's mantissa being even)
+        #if defined(__HIP_DEVICE_COMPILE__)
+        const int n = 64 - __clzll(static_cast<long long>(r));
+        #else
+        const int n = 64 - __builtin_clzll(r);
+        #endif
+        if(((1ULL << 52) - f) <= (1ULL << (n - 2)))
+        {
+            r++;
+        }
+    }
+    // next() returns ROCRAND_MRG31K3P_M1 itself when the two components
+    // are equal; the double product exceeds 2^32 there and its conversion
+    // saturates
+    return r > 0xFFFFFFFFULL ? 0xFFFFFFFFU : static_cast<unsigned int>(r);
+}
+
+} // end namespace detail
+
+class mrg31k3p_engine
+{
+public:
+    struct mrg31k3p_state
+    {
+        unsigned int g1[3];
+        unsigned int g2[3];
+
+        #ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+        // The Box–Muller transform requires two inputs to convert uniformly
+        // distributed real values [0; 1] to normally distributed real values
+        // (with mean = 0, and stddev = 1). Often user wants only one
+        // normally distributed number, to save performance and random
+        // numbers the 2nd value is saved for future requests.
+        unsigned int boxmuller_float_state; // is there a float in boxmuller_float
+        unsigned int boxmuller_double_state; // is there a double in boxmuller_double
+        float boxmuller_float; // normally distributed float
+        double boxmuller_double; // normally distributed double
+        #endif
+
+        FQUALIFIERS
+        ~mrg31k3p_state() { }
+    };
+
+    FQUALIFIERS
+    mrg31k3p_engine()
+    {
+        this->seed(ROCRAND_MRG31K3P_DEFAULT_SEED, 0, 0);
+    }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// New seed value should not be zero. If \p seed_value is equal
+    /// zero, value \p ROCRAND_MRG31K3P_DEFAULT_SEED is used instead.
+    ///
+    /// A subsequence is 2^72 numbers long.
+    FQUALIFIERS
+    mrg31k3p_engine(const unsigned long long seed,
+                    const unsigned long long subsequence,
+                    const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    FQUALIFIERS
+    ~mrg31k3p_engine() { }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// New seed value should not be zero. If \p seed_value is equal
+    /// zero, value \p ROCRAND_MRG31K3P_DEFAULT_SEED is used instead.
+    ///
+    /// A subsequence is 2^72 numbers long.
+    FQUALIFIERS
+    void seed(unsigned long long seed_value,
+              const unsigned long long subsequence,
+              const unsigned long long offset)
+    {
+        if(seed_value == 0)
+        {
+            seed_value = ROCRAND_MRG31K3P_DEFAULT_SEED;
+        }
+        unsigned int x = (unsigned int) seed_value ^ 0x55555555U;
+        unsigned int y = (unsigned int) ((seed_value >> 32) ^ 0xAAAAAAAAU);
+        m_state.g1[0] = mod_mul_m1(x, seed_value);
+        m_state.g1[1] = mod_mul_m1(y, seed_value);
+        m_state.g1[2] = mod_mul_m1(x, seed_value);
+        m_state.g2[0] = mod_mul_m2(y, seed_value);
+        m_state.g2[1] = mod_mul_m2(x, seed_value);
+        m_state.g2[2] = mod_mul_m2(y, seed_value);
+        // Neither component state may be all-zero (the recurrence would
+        // stay at zero forever)
+        if((m_state.g1[0] | m_state.g1[1] | m_state.g1[2]) == 0)
+        {
+            m_state.g1[0] = 1;
+        }
+        if((m_state.g2[0] | m_state.g2[1] | m_state.g2[2]) == 0)
+        {
+            m_state.g2[0] = 1;
+        }
+        this->restart(subsequence, offset);
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        this->discard_impl(offset);
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^72 numbers long.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        this->discard_subsequence_impl(subsequence);
+    }
+
+    /// Advances the internal state to skip \p sequence sequences.
+    /// A sequence is 2^134 numbers long.
+    FQUALIFIERS
+    void discard_sequence(unsigned long long sequence)
+    {
+        this->discard_sequence_impl(sequence);
+    }
+
+    FQUALIFIERS
+    void restart(const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        #ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+        this->discard_subsequence_impl(subsequence);
+        this->discard_impl(offset);
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return this->next();
+    }
+
+    // Returned value is in range (0; ROCRAND_MRG31K3P_M1],
+    // where ROCRAND_MRG31K3P_M1 < UINT_MAX
+    FQUALIFIERS
+    unsigned int next()
+    {
+        // First component: x1(n) = (2^22 * x1(n-2) + (2^7 + 1) * x1(n-3)) mod m1.
+        // The multiplications by 2^22 and 2^7 are carried out as shifts
+        // with the bits shifted out folded back in (2^31 = 1 mod m1).
+        unsigned int p1 = ((m_state.g1[1] & ROCRAND_MRG31K3P_MASK12) << 22)
+            + (m_state.g1[1] >> 9)
+            + ((m_state.g1[0] & ROCRAND_MRG31K3P_MASK13) << 7)
+            + (m_state.g1[0] >> 24);
+        if(p1 >= ROCRAND_MRG31K3P_M1)
+            p1 -= ROCRAND_MRG31K3P_M1;
+        p1 += m_state.g1[0];
+        if(p1 >= ROCRAND_MRG31K3P_M1)
+            p1 -= ROCRAND_MRG31K3P_M1;
+
+        m_state.g1[0] = m_state.g1[1]; m_state.g1[1] = m_state.g1[2];
+        m_state.g1[2] = p1;
+
+        // Second component: x2(n) = (2^15 * x2(n-1) + (2^15 + 1) * x2(n-3)) mod m2,
+        // using 2^31 = 21069 mod m2 to fold the high bits back in.
+        unsigned int p2 = ((m_state.g2[2] & ROCRAND_MRG31K3P_MASK2) << 15)
+            + ROCRAND_MRG31K3P_M2C * (m_state.g2[2] >> 16);
+        if(p2 >= ROCRAND_MRG31K3P_M2)
+            p2 -= ROCRAND_MRG31K3P_M2;
+        unsigned int p3 = ((m_state.g2[0] & ROCRAND_MRG31K3P_MASK2) << 15)
+            + ROCRAND_MRG31K3P_M2C * (m_state.g2[0] >> 16);
+        if(p3 >= ROCRAND_MRG31K3P_M2)
+            p3 -= ROCRAND_MRG31K3P_M2;
+        p3 += m_state.g2[0];
+        if(p3 >= ROCRAND_MRG31K3P_M2)
+            p3 -= ROCRAND_MRG31K3P_M2;
+        p3 += p2;
+        if(p3 >= ROCRAND_MRG31K3P_M2)
+            p3 -= ROCRAND_MRG31K3P_M2;
+
+        m_state.g2[0] = m_state.g2[1]; m_state.g2[1] = m_state.g2[2];
+        m_state.g2[2] = p3;
+
+        // Combination
+        return (m_state.g1[2] <= m_state.g2[2])
+            ? (m_state.g1[2] - m_state.g2[2] + ROCRAND_MRG31K3P_M1)
+            : (m_state.g1[2] - m_state.g2[2]);
+    }
+
+protected:
+    // Advances the internal state to skip \p offset numbers.
+    // DOES NOT CALCULATE NEW ULONGLONG
+    FQUALIFIERS
+    void discard_impl(unsigned long long offset)
+    {
+        discard_state(offset);
+    }
+
+    // DOES NOT CALCULATE NEW ULONGLONG
+    FQUALIFIERS
+    void discard_subsequence_impl(unsigned long long subsequence)
+    {
+        int i = 0;
+
+        while(subsequence > 0) {
+            if (subsequence & 1) {
+                #if defined(__HIP_DEVICE_COMPILE__)
+                mod_mat_vec_m1(d_31k3p_A1P72 + i, m_state.g1);
+                mod_mat_vec_m2(d_31k3p_A2P72 + i, m_state.g2);
+                #else
+                mod_mat_vec_m1(h_31k3p_A1P72 + i, m_state.g1);
+                mod_mat_vec_m2(h_31k3p_A2P72 + i, m_state.g2);
+                #endif
+            }
+            subsequence >>= 1;
+            i += 9;
+        }
+    }
+
+    // DOES NOT CALCULATE NEW ULONGLONG
+    FQUALIFIERS
+    void discard_sequence_impl(unsigned long long sequence)
+    {
+        int i = 0;
+
+        while(sequence > 0) {
+            if (sequence & 1) {
+                #if defined(__HIP_DEVICE_COMPILE__)
+                mod_mat_vec_m1(d_31k3p_A1P134 + i, m_state.g1);
+                mod_mat_vec_m2(d_31k3p_A2P134 + i, m_state.g2);
+                #else
+                mod_mat_vec_m1(h_31k3p_A1P134 + i, m_state.g1);
+                mod_mat_vec_m2(h_31k3p_A2P134 + i, m_state.g2);
+                #endif
+            }
+            sequence >>= 1;
+            i += 9;
+        }
+    }
+
+    // Advances the internal state by offset times.
+    // DOES NOT CALCULATE NEW ULONGLONG
+    FQUALIFIERS
+    void discard_state(unsigned long long offset)
+    {
+        int i = 0;
+
+        while(offset > 0) {
+            if (offset & 1) {
+                #if defined(__HIP_DEVICE_COMPILE__)
+                mod_mat_vec_m1(d_31k3p_A1 + i, m_state.g1);
+                mod_mat_vec_m2(d_31k3p_A2 + i, m_state.g2);
+                #else
+                mod_mat_vec_m1(h_31k3p_A1 + i, m_state.g1);
+                mod_mat_vec_m2(h_31k3p_A2 + i, m_state.g2);
+                #endif
+            }
+            offset >>= 1;
+            i += 9;
+        }
+    }
+
+    // Advances the internal state to the next state
+    // DOES NOT CALCULATE NEW ULONGLONG
+    FQUALIFIERS
+    void discard_state()
+    {
+        discard_state(1);
+    }
+
+private:
+    FQUALIFIERS
+    void mod_mat_vec_m1(const unsigned long long * A,
+                        unsigned int * s)
+    {
+        unsigned long long x[3];
+
+        x[0] = mod_m1(mod_m1(A[0] * s[0])
+                    + mod_m1(A[1] * s[1])
+                    + mod_m1(A[2] * s[2]));
+
+        x[1] = mod_m1(mod_m1(A[3] * s[0])
+                    + mod_m1(A[4] * s[1])
+                    + mod_m1(A[5] * s[2]));
+
+        x[2] = mod_m1(mod_m1(A[6] * s[0])
+                    + mod_m1(A[7] * s[1])
+                    + mod_m1(A[8] * s[2]));
+
+        s[0] = x[0];
+        s[1] = x[1];
+        s[2] = x[2];
+    }
+
+    FQUALIFIERS
+    void mod_mat_vec_m2(const unsigned long long * A,
+                        unsigned int * s)
+    {
+        unsigned long long x[3];
+
+        x[0] = mod_m2(mod_m2(A[0] * s[0])
+                    + mod_m2(A[1] * s[1])
+                    + mod_m2(A[2] * s[2]));
+
+        x[1] = mod_m2(mod_m2(A[3] * s[0])
+                    + mod_m2(A[4] * s[1])
+                    + mod_m2(A[5] * s[2]));
+
+        x[2] = mod_m2(mod_m2(A[6] * s[0])
+                    + mod_m2(A[7] * s[1])
+                    + mod_m2(A[8] * s[2]));
+
+        s[0] = x[0];
+        s[1] = x[1];
+        s[2] = x[2];
+    }
+
+    FQUALIFIERS
+    unsigned long long mod_mul_m1(unsigned int i,
+                                  unsigned long long j)
+    {
+        long long hi, lo, temp1, temp2;
+
+        hi = i / 131072;
+        lo = i - (hi * 131072);
+        temp1 = mod_m1(hi * j) * 131072;
+        temp2 = mod_m1(lo * j);
+        lo = mod_m1(temp1 + temp2);
+
+        if (lo < 0)
+            lo += ROCRAND_MRG31K3P_M1;
+        return lo;
+    }
+
+    FQUALIFIERS
+    unsigned long long mod_m1(unsigned long long p)
+    {
+        // 2^31 = 1 mod m1, so the high bits fold back in with weight 1
+        p = (p >> 31) + (p & (ROCRAND_MRG31K3P_POW31 - 1));
+        p = (p >> 31) + (p & (ROCRAND_MRG31K3P_POW31 - 1));
+        if (p >= ROCRAND_MRG31K3P_M1)
+            p -= ROCRAND_MRG31K3P_M1;
+
+        return p;
+    }
+
+    FQUALIFIERS
+    unsigned long long mod_mul_m2(unsigned int i,
+                                  unsigned long long j)
+    {
+        long long hi, lo, temp1, temp2;
+
+        hi = i / 131072;
+        lo = i - (hi * 131072);
+        temp1 = mod_m2(hi * j) * 131072;
+        temp2 = mod_m2(lo * j);
+        lo = mod_m2(temp1 + temp2);
+
+        if (lo < 0)
+            lo += ROCRAND_MRG31K3P_M2;
+        return lo;
+    }
+
+    FQUALIFIERS
+    unsigned long long mod_m2(unsigned long long p)
+    {
+        // 2^31 = 21069 mod m2
+        p = detail::mad_u64_u32(ROCRAND_MRG31K3P_M2C, (p >> 31), p & (ROCRAND_MRG31K3P_POW31 - 1));
+        p = detail::mad_u64_u32(ROCRAND_MRG31K3P_M2C, (p >> 31), p & (ROCRAND_MRG31K3P_POW31 - 1));
+        p = detail::mad_u64_u32(ROCRAND_MRG31K3P_M2C, (p >> 31), p & (ROCRAND_MRG31K3P_POW31 - 1));
+        if (p >= ROCRAND_MRG31K3P_M2)
+            p -= ROCRAND_MRG31K3P_M2;
+
+        return p;
+    }
+
+protected:
+    // State
+    mrg31k3p_state m_state;
+
+    #ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+    friend struct detail::engine_boxmuller_helper<mrg31k3p_engine>;
+    #endif
+
+}; // mrg31k3p_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::mrg31k3p_engine rocrand_state_mrg31k3p;
+/// \endcond
+
+/**
+ * \brief Initializes MRG31K3P state.
+ *
+ * Initializes the MRG31K3P generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_mrg31k3p * state)
+{
+    *state = rocrand_state_mrg31k3p(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using MRG31K3P generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_mrg31k3p * state)
+{
+    return rocrand_device::detail::mrg31k3p_uint_scale(state->next());
+}
+
+/**
+ * \brief Updates MRG31K3P state to skip ahead by \p offset elements.
+ *
+ * Updates the MRG31K3P state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_mrg31k3p * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates MRG31K3P state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the MRG31K3P state in \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^72 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_mrg31k3p * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates MRG31K3P state to skip ahead by \p sequence sequences.
+ *
+ * Updates the MRG31K3P state in \p state to skip ahead by \p sequence sequences.
+ * Each sequence is 2^134 numbers long.
+ *
+ * \param sequence - Number of sequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_sequence(unsigned long long sequence, rocrand_state_mrg31k3p * state)
+{
+    return state->discard_sequence(sequence);
+}
+
+#endif // ROCRAND_MRG31K3P_H_
+
+/** @} */ // end of group rocranddevice
@@ -0,0 +1,859 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MRG31K3P_PRECOMPUTED_H_
+#define ROCRAND_MRG31K3P_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/mrg31k3p_precomputed_generator
+
+#define MRG313P_DIM 64
+#define MRG313P_N 576
+
+static const __constant__ unsigned long long d_31k3p_A1[MRG313P_N] = 
+    {
+        0, 1, 0, 0, 0, 1, 129, 4194304, 0, 
+        0, 0, 1, 129, 4194304, 0, 0, 129, 4194304, 
+        0, 129, 4194304, 541065216, 8192, 129, 16641, 1082130432, 8192, 
+        8388673, 3170304, 16657, 2148753, 1153433697, 3170304, 408969216, 2154945, 1153433697, 
+        1854761289, 2050484945, 2104058429, 840597819, 2114723322, 2050484945, 372069324, 1721212208, 2114723322, 
+        667011916, 667596721, 629934405, 1804643306, 2031391056, 667596721, 220631129, 1474597190, 2031391056, 
+        1315045259, 1565027687, 621260874, 685757807, 1626637155, 1565027687, 25108805, 47085990, 1626637155, 
+        2051914008, 1072773560, 686639683, 529689580, 186789822, 1072773560, 948835832, 229794953, 186789822, 
+        1133340572, 391879376, 1472516881, 976116713, 133777926, 391879376, 1160315623, 1849297334, 133777926, 
+        876161549, 1634902263, 468588410, 318362774, 315040025, 1634902263, 448994521, 1357549030, 315040025, 
+        609299647, 624776875, 85470327, 288253948, 1108588757, 624776875, 1139321936, 1006700199, 1108588757, 
+        754030956, 2000517263, 1106925817, 1059509691, 1800574616, 2000517263, 368689287, 1663202423, 1800574616, 
+        161160027, 1245759969, 1329155292, 1809824555, 1086502913, 1245759969, 1789246123, 1682234256, 1086502913, 
+        1806649895, 1325970531, 866797547, 147733919, 1720262475, 1325970531, 1398990386, 565559801, 1720262475, 
+        1214224795, 1139568166, 1068345918, 377670014, 1476358256, 1139568166, 975405418, 539279285, 1476358256, 
+        1448125803, 1965916860, 258408198, 1122402837, 400054507, 1965916860, 200204594, 1914771670, 400054507, 
+        847447860, 1086098496, 1408487222, 1306225290, 2949404, 1086098496, 520268929, 1576782032, 2949404, 
+        1996997890, 1518425721, 1755108478, 923210727, 381424493, 1518425721, 455906132, 1433687186, 381424493, 
+        924300230, 1250707970, 2085039616, 534654589, 928372573, 1250707970, 280054605, 545485986, 928372573, 
+        733519514, 201071095, 2146224277, 1985024917, 1362662654, 201071095, 168367491, 1947668898, 1362662654, 
+        1113090973, 581363082, 2042210936, 1452205810, 1620396146, 581363082, 1981393580, 958413413, 1620396146, 
+        864263945, 909956241, 938481596, 805041652, 580884245, 909956241, 1420238151, 1414992990, 580884245, 
+        1586530792, 1275940370, 1458638251, 1333257090, 1232863855, 1275940370, 1387550558, 1411246633, 1232863855, 
+        2051615169, 545475645, 274782294, 1087177574, 265378350, 545475645, 1646881501, 1344095500, 265378350, 
+        1992074766, 414533208, 619330410, 436727951, 1364138796, 414533208, 1935176304, 806636338, 1364138796, 
+        1739676813, 382542847, 463796751, 1847722410, 1803497226, 382542847, 2103387029, 1844275260, 1803497226, 
+        606375036, 1658582521, 1393006903, 1456747786, 1913524296, 1658582521, 1356264156, 1430627077, 1913524296, 
+        1035740173, 1522934925, 1880188197, 2026108949, 120859840, 1522934925, 1037593448, 472996648, 120859840, 
+        492615376, 932904582, 71892866, 684245126, 2111757135, 932904582, 85606846, 1248103941, 2111757135, 
+        2007199226, 665549414, 656774461, 972043236, 1190592709, 665549414, 2104012173, 1401162145, 1190592709, 
+        583913268, 483872066, 20731924, 526934549, 667839840, 483872066, 142470751, 1878445499, 667839840, 
+        1018448863, 1703206865, 589062547, 827140918, 562420240, 1703206865, 670353591, 633335206, 562420240, 
+        1477130056, 1514148312, 1585063407, 462233038, 1408922715, 1514148312, 2051604018, 297418199, 1408922715, 
+        715202453, 613694191, 480296454, 1828700450, 741306356, 613694191, 1857139347, 684854080, 741306356, 
+        908872241, 262485378, 215148577, 1984362669, 1047704485, 262485378, 1648359057, 1456393032, 1047704485, 
+        1312682278, 421346344, 779115651, 1721671217, 1863657812, 421346344, 666587201, 1890266319, 1863657812, 
+        607087348, 1061876039, 154840044, 647012853, 523503690, 1061876039, 1690539270, 2020624237, 523503690, 
+        796024380, 384400534, 1313815529, 1978478775, 702121434, 384400534, 195545005, 460891510, 702121434, 
+        1848811964, 69045171, 1658242117, 1312352040, 2141457694, 69045171, 316892471, 989525486, 2141457694, 
+        1429043452, 80861072, 1502295285, 522563535, 312098455, 80861072, 1841143700, 52959419, 312098455, 
+        880648894, 1737690958, 581496225, 1998569027, 483325749, 1737690958, 823834294, 1255376843, 483325749, 
+        367406846, 988313318, 461110923, 1501250598, 951315709, 988313318, 790882849, 320387170, 951315709, 
+        609591423, 1535933019, 471796266, 732176198, 786673668, 1535933019, 566863927, 1116857731, 786673668, 
+        1723825471, 105641566, 204423191, 600787875, 1820693727, 105641566, 742860132, 995258782, 1820693727, 
+        1382261543, 980119244, 1071033915, 724421627, 1631817342, 980119244, 1881330950, 1581973938, 1631817342, 
+        1555132095, 315191773, 1492376236, 1390489861, 131983533, 315191773, 2005033071, 1244304830, 131983533, 
+        191494342, 518555962, 412586605, 1684064517, 649479311, 518555962, 321726041, 854605130, 649479311, 
+        1371360307, 116435580, 194954746, 1526842117, 1346575254, 116435580, 2135287938, 2047163226, 1346575254, 
+        69530294, 46031599, 779043794, 1712401664, 2025597527, 46031599, 1643108977, 567446578, 2025597527, 
+        1683301222, 452428843, 876845283, 1443891863, 489637171, 452428843, 381262278, 1625130585, 489637171, 
+        960163648, 1763700054, 810914742, 1528786662, 651368970, 1763700054, 2031524031, 819199709, 651368970, 
+        1812237782, 537614029, 744117887, 1501926955, 198884098, 537614029, 632733037, 215325655, 198884098, 
+        499722939, 569072577, 986258115, 525761662, 1319538504, 569072577, 395918435, 262631980, 1319538504, 
+        1586456777, 1236821385, 1046270020, 1824846466, 1873712945, 1236821385, 636168787, 1328139957, 1873712945, 
+        731732719, 1448064655, 7435086, 959126094, 2132644776, 1448064655, 2116746853, 1561739817, 2132644776, 
+        454742127, 581935238, 1275448490, 1324098038, 1170264917, 581935238, 2055201704, 1887271366, 1170264917, 
+        717158625, 714585192, 1912062268, 1842896814, 2046293185, 714585192, 1987176594, 133016457, 2046293185, 
+        149942865, 168318689, 1610338266, 1575206202, 2141188152, 168318689, 238274411, 371769702, 2141188152, 
+        1627940648, 843204119, 482566547, 2121542447, 1171704025, 843204119, 1399149001, 72174675, 1171704025, 
+        2040995230, 1400105905, 2086926958, 778121707, 358961052, 1400105905, 225035397, 449506273, 358961052, 
+        47743705, 130348301, 283150143, 19146448, 1386279708, 130348301, 1782545300, 1147668810, 1386279708, 
+        331011766, 420998971, 78640239, 1554656243, 796733104, 420998971, 621776084, 729200619, 796733104, 
+        806776465, 827140918, 1018448863, 383400860, 670353591, 827140918, 1474479719, 1685250609, 670353591, 
+        1011349101, 1571216288, 672987287, 916014143, 1646003433, 1571216288, 823438334, 516429741, 1646003433, 
+        
+    };
+
+static const unsigned long long h_31k3p_A1[MRG313P_N] = 
+    {
+        0, 1, 0, 0, 0, 1, 129, 4194304, 0, 
+        0, 0, 1, 129, 4194304, 0, 0, 129, 4194304, 
+        0, 129, 4194304, 541065216, 8192, 129, 16641, 1082130432, 8192, 
+        8388673, 3170304, 16657, 2148753, 1153433697, 3170304, 408969216, 2154945, 1153433697, 
+        1854761289, 2050484945, 2104058429, 840597819, 2114723322, 2050484945, 372069324, 1721212208, 2114723322, 
+        667011916, 667596721, 629934405, 1804643306, 2031391056, 667596721, 220631129, 1474597190, 2031391056, 
+        1315045259, 1565027687, 621260874, 685757807, 1626637155, 1565027687, 25108805, 47085990, 1626637155, 
+        2051914008, 1072773560, 686639683, 529689580, 186789822, 1072773560, 948835832, 229794953, 186789822, 
+        1133340572, 391879376, 1472516881, 976116713, 133777926, 391879376, 1160315623, 1849297334, 133777926, 
+        876161549, 1634902263, 468588410, 318362774, 315040025, 1634902263, 448994521, 1357549030, 315040025, 
+        609299647, 624776875, 85470327, 288253948, 1108588757, 624776875, 1139321936, 1006700199, 1108588757, 
+        754030956, 2000517263, 1106925817, 1059509691, 1800574616, 2000517263, 368689287, 1663202423, 1800574616, 
+        161160027, 1245759969, 1329155292, 1809824555, 1086502913, 1245759969, 1789246123, 1682234256, 1086502913, 
+        1806649895, 1325970531, 866797547, 147733919, 1720262475, 1325970531, 1398990386, 565559801, 1720262475, 
+        1214224795, 1139568166, 1068345918, 377670014, 1476358256, 1139568166, 975405418, 539279285, 1476358256, 
+        1448125803, 1965916860, 258408198, 1122402837, 400054507, 1965916860, 200204594, 1914771670, 400054507, 
+        847447860, 1086098496, 1408487222, 1306225290, 2949404, 1086098496, 520268929, 1576782032, 2949404, 
+        1996997890, 1518425721, 1755108478, 923210727, 381424493, 1518425721, 455906132, 1433687186, 381424493, 
+        924300230, 1250707970, 2085039616, 534654589, 928372573, 1250707970, 280054605, 545485986, 928372573, 
+        733519514, 201071095, 2146224277, 1985024917, 1362662654, 201071095, 168367491, 1947668898, 1362662654, 
+        1113090973, 581363082, 2042210936, 1452205810, 1620396146, 581363082, 1981393580, 958413413, 1620396146, 
+        864263945, 909956241, 938481596, 805041652, 580884245, 909956241, 1420238151, 1414992990, 580884245, 
+        1586530792, 1275940370, 1458638251, 1333257090, 1232863855, 1275940370, 1387550558, 1411246633, 1232863855, 
+        2051615169, 545475645, 274782294, 1087177574, 265378350, 545475645, 1646881501, 1344095500, 265378350, 
+        1992074766, 414533208, 619330410, 436727951, 1364138796, 414533208, 1935176304, 806636338, 1364138796, 
+        1739676813, 382542847, 463796751, 1847722410, 1803497226, 382542847, 2103387029, 1844275260, 1803497226, 
+        606375036, 1658582521, 1393006903, 1456747786, 1913524296, 1658582521, 1356264156, 1430627077, 1913524296, 
+        1035740173, 1522934925, 1880188197, 2026108949, 120859840, 1522934925, 1037593448, 472996648, 120859840, 
+        492615376, 932904582, 71892866, 684245126, 2111757135, 932904582, 85606846, 1248103941, 2111757135, 
+        2007199226, 665549414, 656774461, 972043236, 1190592709, 665549414, 2104012173, 1401162145, 1190592709, 
+        583913268, 483872066, 20731924, 526934549, 667839840, 483872066, 142470751, 1878445499, 667839840, 
+        1018448863, 1703206865, 589062547, 827140918, 562420240, 1703206865, 670353591, 633335206, 562420240, 
+        1477130056, 1514148312, 1585063407, 462233038, 1408922715, 1514148312, 2051604018, 297418199, 1408922715, 
+        715202453, 613694191, 480296454, 1828700450, 741306356, 613694191, 1857139347, 684854080, 741306356, 
+        908872241, 262485378, 215148577, 1984362669, 1047704485, 262485378, 1648359057, 1456393032, 1047704485, 
+        1312682278, 421346344, 779115651, 1721671217, 1863657812, 421346344, 666587201, 1890266319, 1863657812, 
+        607087348, 1061876039, 154840044, 647012853, 523503690, 1061876039, 1690539270, 2020624237, 523503690, 
+        796024380, 384400534, 1313815529, 1978478775, 702121434, 384400534, 195545005, 460891510, 702121434, 
+        1848811964, 69045171, 1658242117, 1312352040, 2141457694, 69045171, 316892471, 989525486, 2141457694, 
+        1429043452, 80861072, 1502295285, 522563535, 312098455, 80861072, 1841143700, 52959419, 312098455, 
+        880648894, 1737690958, 581496225, 1998569027, 483325749, 1737690958, 823834294, 1255376843, 483325749, 
+        367406846, 988313318, 461110923, 1501250598, 951315709, 988313318, 790882849, 320387170, 951315709, 
+        609591423, 1535933019, 471796266, 732176198, 786673668, 1535933019, 566863927, 1116857731, 786673668, 
+        1723825471, 105641566, 204423191, 600787875, 1820693727, 105641566, 742860132, 995258782, 1820693727, 
+        1382261543, 980119244, 1071033915, 724421627, 1631817342, 980119244, 1881330950, 1581973938, 1631817342, 
+        1555132095, 315191773, 1492376236, 1390489861, 131983533, 315191773, 2005033071, 1244304830, 131983533, 
+        191494342, 518555962, 412586605, 1684064517, 649479311, 518555962, 321726041, 854605130, 649479311, 
+        1371360307, 116435580, 194954746, 1526842117, 1346575254, 116435580, 2135287938, 2047163226, 1346575254, 
+        69530294, 46031599, 779043794, 1712401664, 2025597527, 46031599, 1643108977, 567446578, 2025597527, 
+        1683301222, 452428843, 876845283, 1443891863, 489637171, 452428843, 381262278, 1625130585, 489637171, 
+        960163648, 1763700054, 810914742, 1528786662, 651368970, 1763700054, 2031524031, 819199709, 651368970, 
+        1812237782, 537614029, 744117887, 1501926955, 198884098, 537614029, 632733037, 215325655, 198884098, 
+        499722939, 569072577, 986258115, 525761662, 1319538504, 569072577, 395918435, 262631980, 1319538504, 
+        1586456777, 1236821385, 1046270020, 1824846466, 1873712945, 1236821385, 636168787, 1328139957, 1873712945, 
+        731732719, 1448064655, 7435086, 959126094, 2132644776, 1448064655, 2116746853, 1561739817, 2132644776, 
+        454742127, 581935238, 1275448490, 1324098038, 1170264917, 581935238, 2055201704, 1887271366, 1170264917, 
+        717158625, 714585192, 1912062268, 1842896814, 2046293185, 714585192, 1987176594, 133016457, 2046293185, 
+        149942865, 168318689, 1610338266, 1575206202, 2141188152, 168318689, 238274411, 371769702, 2141188152, 
+        1627940648, 843204119, 482566547, 2121542447, 1171704025, 843204119, 1399149001, 72174675, 1171704025, 
+        2040995230, 1400105905, 2086926958, 778121707, 358961052, 1400105905, 225035397, 449506273, 358961052, 
+        47743705, 130348301, 283150143, 19146448, 1386279708, 130348301, 1782545300, 1147668810, 1386279708, 
+        331011766, 420998971, 78640239, 1554656243, 796733104, 420998971, 621776084, 729200619, 796733104, 
+        806776465, 827140918, 1018448863, 383400860, 670353591, 827140918, 1474479719, 1685250609, 670353591, 
+        1011349101, 1571216288, 672987287, 916014143, 1646003433, 1571216288, 823438334, 516429741, 1646003433, 
+        
+    };
+
+static const __constant__ unsigned long long d_31k3p_A2[MRG313P_N] = 
+    {
+        0, 1, 0, 0, 0, 1, 32769, 0, 32768, 
+        0, 0, 1, 32769, 0, 32768, 1073774592, 32769, 1073741824, 
+        1073774592, 32769, 1073741824, 1418936320, 1073774592, 345227265, 2066843192, 1418936320, 647927940, 
+        565536787, 2135609866, 1873224312, 617121792, 565536787, 879507346, 1628410894, 617121792, 1314440335, 
+        1941766342, 1865965032, 985989666, 1320864099, 1941766342, 53376886, 1072638028, 1320864099, 813564905, 
+        1476787835, 1877659175, 5030508, 1637560648, 1476787835, 1362726736, 855544258, 1637560648, 969605357, 
+        1045985094, 130701240, 868697656, 1737004819, 1045985094, 999008403, 586803631, 1737004819, 633780322, 
+        2107617810, 41528283, 1363330341, 1307913292, 2107617810, 2133573813, 141093694, 1307913292, 115137691, 
+        233031422, 1696576368, 1067943171, 379583115, 233031422, 1008216312, 1676012592, 379583115, 900827702, 
+        310179625, 328363064, 390911161, 153551074, 310179625, 91002977, 1398493661, 153551074, 1617670309, 
+        670277159, 1944237068, 1745128153, 1323429466, 670277159, 1522538381, 62109082, 1323429466, 1357310439, 
+        1788557010, 438618808, 1655905884, 295466624, 1788557010, 1225642127, 1221707205, 295466624, 1784622088, 
+        1281856862, 78995997, 1144550175, 330742340, 1281856862, 1412650741, 448778905, 330742340, 317985026, 
+        1910526032, 1773241040, 1554881186, 1204434680, 1910526032, 1422794534, 2141494556, 1204434680, 481763475, 
+        595721286, 755452977, 1005276946, 1991744193, 595721286, 1741920224, 1428470436, 1991744193, 282271498, 
+        1439849319, 449837709, 1774051695, 2087979925, 1439849319, 763765939, 1317159425, 2087979925, 1993242805, 
+        766132180, 1850475831, 325198558, 722230104, 766132180, 100044798, 1340090108, 722230104, 2006177490, 
+        812253577, 1586273954, 1524985129, 783478871, 812253577, 844767696, 1399986914, 783478871, 1367472795, 
+        13488160, 2039542529, 616819112, 627687580, 13488160, 2050410997, 108788941, 627687580, 219328683, 
+        745737092, 773154801, 1508575166, 2058508653, 745737092, 1323088288, 1158102041, 2058508653, 580750845, 
+        401449229, 1952222894, 1555681549, 1661978879, 401449229, 2058520224, 1702151287, 1661978879, 45080292, 
+        858443739, 795175789, 592491377, 140756174, 858443739, 343440586, 1500648674, 140756174, 2015651827, 
+        568359628, 201571276, 1181628951, 2048795949, 568359628, 1068738274, 664762374, 2048795949, 164383728, 
+        578963250, 431712934, 1535538612, 869088079, 578963250, 1912724980, 94576347, 869088079, 908277196, 
+        1308679528, 682655760, 1584619174, 740552586, 1308679528, 1986051751, 2076371924, 740552586, 1398999701, 
+        1257506131, 1388717897, 790833727, 1399459270, 1257506131, 1997343440, 582702598, 1399459270, 1990327868, 
+        885708082, 703010240, 1506983307, 1433982978, 885708082, 630009911, 1237001632, 1433982978, 1492699803, 
+        228461275, 1635798751, 380787265, 1260302795, 228461275, 367851702, 424966911, 1260302795, 285576484, 
+        308107099, 1835447851, 831514667, 898920571, 308107099, 1902853755, 891253751, 898920571, 1443969674, 
+        1247469245, 2092425680, 1451045649, 198447863, 1247469245, 839827894, 587308601, 198447863, 994949952, 
+        2074507841, 1855152345, 2068367606, 124162616, 2074507841, 2058409934, 235520856, 124162616, 251618763, 
+        434861827, 1150753916, 2082965909, 1759261085, 434861827, 827049092, 593948768, 1759261085, 201761503, 
+        495118246, 864887505, 1847920968, 372397750, 495118246, 1536826866, 134631825, 372397750, 1240385784, 
+        576542156, 1743522686, 1130366221, 1536133357, 576542156, 1827243, 1895436234, 1536133357, 322688568, 
+        42271783, 2106477822, 265568951, 910585211, 42271783, 604031503, 345731164, 910585211, 1931434023, 
+        702982709, 918972396, 912566629, 479453126, 702982709, 485858893, 1969966590, 479453126, 39627827, 
+        463100699, 34579485, 1215571943, 1941084875, 463100699, 760092417, 1197421431, 1941084875, 900429713, 
+        2130774469, 263024791, 287075064, 1276676196, 2130774469, 1252625923, 699135781, 1276676196, 1577284327, 
+        430809419, 668555290, 682204778, 82922892, 430809419, 69273404, 152229673, 82922892, 513765688, 
+        944774143, 56142418, 1786947956, 1635428571, 944774143, 2052085612, 1297683401, 1635428571, 190371932, 
+        1396862975, 1610590556, 523734705, 1889079356, 1396862975, 828472628, 2145085793, 1889079356, 566013561, 
+        1961068818, 1923272181, 2119704107, 906764528, 1961068818, 710332602, 542141157, 906764528, 1792877373, 
+        268009167, 879715687, 2034889164, 422474587, 268009167, 1414763689, 969169389, 422474587, 1969877446, 
+        1280061087, 1958671378, 717593980, 121890570, 1280061087, 1362967968, 170625350, 121890570, 87718469, 
+        706866319, 1158615140, 489036658, 876481504, 706866319, 1546059986, 2049980045, 876481504, 1210786378, 
+        1690141580, 903957597, 154790430, 20989072, 1690141580, 770156239, 269567383, 20989072, 1189552724, 
+        2047235923, 557991075, 1691445540, 969736270, 2047235923, 1983744384, 1627452966, 969736270, 1690944505, 
+        1296581262, 1938279769, 1868127450, 1100132076, 1296581262, 1170284395, 1810066552, 1100132076, 1936363419, 
+        1504314152, 1338450694, 781308084, 635737758, 1504314152, 1192880368, 1382916034, 635737758, 1694349818, 
+        537200131, 1122859035, 2000891525, 886920697, 537200131, 8888207, 1350207018, 886920697, 1878518942, 
+        416790722, 1200659101, 507253722, 836854758, 416790722, 1530260137, 1843209703, 836854758, 729740288, 
+        706222760, 2145574203, 682375558, 1384287554, 706222760, 700023620, 2026197481, 1384287554, 2032396621, 
+        1020435098, 884921781, 1966585721, 1990420817, 1020435098, 908756877, 190519420, 1990420817, 302197641, 
+        574607615, 816764253, 1183720578, 1870518584, 574607615, 1503562259, 997715174, 1870518584, 68760530, 
+        1999480332, 2033388183, 610230128, 1606991363, 1999480332, 882686839, 591550640, 1606991363, 1708344133, 
+        1256158274, 1982451729, 1473267489, 396108542, 1256158274, 905292782, 491107052, 396108542, 841972544, 
+        1311413013, 57025069, 1112388734, 836608500, 1311413013, 1928707414, 1989549396, 836608500, 1372254995, 
+        55053420, 75265500, 1820803489, 809236105, 55053420, 1211160695, 1268891956, 809236105, 112784681, 
+        710532716, 289764289, 602888782, 1554233137, 710532716, 1241108644, 1242834134, 1554233137, 712258206, 
+        1364712746, 1975896148, 641259069, 497096546, 1364712746, 1831733625, 352611996, 497096546, 2033053696, 
+        901938803, 84873083, 44749841, 1838060851, 901938803, 1878184093, 2084491956, 1838060851, 1108246666, 
+        317050197, 923159877, 1148771268, 1214133801, 317050197, 988522410, 565311654, 1214133801, 2041302020, 
+        107899838, 603388854, 984329288, 598501892, 107899838, 217561458, 1843117501, 598501892, 1733455881, 
+        1886789292, 2075773710, 1916857550, 224620200, 1886789292, 383536360, 1151968532, 224620200, 507758885, 
+        
+    };
+
+static const unsigned long long h_31k3p_A2[MRG313P_N] = 
+    {
+        0, 1, 0, 0, 0, 1, 32769, 0, 32768, 
+        0, 0, 1, 32769, 0, 32768, 1073774592, 32769, 1073741824, 
+        1073774592, 32769, 1073741824, 1418936320, 1073774592, 345227265, 2066843192, 1418936320, 647927940, 
+        565536787, 2135609866, 1873224312, 617121792, 565536787, 879507346, 1628410894, 617121792, 1314440335, 
+        1941766342, 1865965032, 985989666, 1320864099, 1941766342, 53376886, 1072638028, 1320864099, 813564905, 
+        1476787835, 1877659175, 5030508, 1637560648, 1476787835, 1362726736, 855544258, 1637560648, 969605357, 
+        1045985094, 130701240, 868697656, 1737004819, 1045985094, 999008403, 586803631, 1737004819, 633780322, 
+        2107617810, 41528283, 1363330341, 1307913292, 2107617810, 2133573813, 141093694, 1307913292, 115137691, 
+        233031422, 1696576368, 1067943171, 379583115, 233031422, 1008216312, 1676012592, 379583115, 900827702, 
+        310179625, 328363064, 390911161, 153551074, 310179625, 91002977, 1398493661, 153551074, 1617670309, 
+        670277159, 1944237068, 1745128153, 1323429466, 670277159, 1522538381, 62109082, 1323429466, 1357310439, 
+        1788557010, 438618808, 1655905884, 295466624, 1788557010, 1225642127, 1221707205, 295466624, 1784622088, 
+        1281856862, 78995997, 1144550175, 330742340, 1281856862, 1412650741, 448778905, 330742340, 317985026, 
+        1910526032, 1773241040, 1554881186, 1204434680, 1910526032, 1422794534, 2141494556, 1204434680, 481763475, 
+        595721286, 755452977, 1005276946, 1991744193, 595721286, 1741920224, 1428470436, 1991744193, 282271498, 
+        1439849319, 449837709, 1774051695, 2087979925, 1439849319, 763765939, 1317159425, 2087979925, 1993242805, 
+        766132180, 1850475831, 325198558, 722230104, 766132180, 100044798, 1340090108, 722230104, 2006177490, 
+        812253577, 1586273954, 1524985129, 783478871, 812253577, 844767696, 1399986914, 783478871, 1367472795, 
+        13488160, 2039542529, 616819112, 627687580, 13488160, 2050410997, 108788941, 627687580, 219328683, 
+        745737092, 773154801, 1508575166, 2058508653, 745737092, 1323088288, 1158102041, 2058508653, 580750845, 
+        401449229, 1952222894, 1555681549, 1661978879, 401449229, 2058520224, 1702151287, 1661978879, 45080292, 
+        858443739, 795175789, 592491377, 140756174, 858443739, 343440586, 1500648674, 140756174, 2015651827, 
+        568359628, 201571276, 1181628951, 2048795949, 568359628, 1068738274, 664762374, 2048795949, 164383728, 
+        578963250, 431712934, 1535538612, 869088079, 578963250, 1912724980, 94576347, 869088079, 908277196, 
+        1308679528, 682655760, 1584619174, 740552586, 1308679528, 1986051751, 2076371924, 740552586, 1398999701, 
+        1257506131, 1388717897, 790833727, 1399459270, 1257506131, 1997343440, 582702598, 1399459270, 1990327868, 
+        885708082, 703010240, 1506983307, 1433982978, 885708082, 630009911, 1237001632, 1433982978, 1492699803, 
+        228461275, 1635798751, 380787265, 1260302795, 228461275, 367851702, 424966911, 1260302795, 285576484, 
+        308107099, 1835447851, 831514667, 898920571, 308107099, 1902853755, 891253751, 898920571, 1443969674, 
+        1247469245, 2092425680, 1451045649, 198447863, 1247469245, 839827894, 587308601, 198447863, 994949952, 
+        2074507841, 1855152345, 2068367606, 124162616, 2074507841, 2058409934, 235520856, 124162616, 251618763, 
+        434861827, 1150753916, 2082965909, 1759261085, 434861827, 827049092, 593948768, 1759261085, 201761503, 
+        495118246, 864887505, 1847920968, 372397750, 495118246, 1536826866, 134631825, 372397750, 1240385784, 
+        576542156, 1743522686, 1130366221, 1536133357, 576542156, 1827243, 1895436234, 1536133357, 322688568, 
+        42271783, 2106477822, 265568951, 910585211, 42271783, 604031503, 345731164, 910585211, 1931434023, 
+        702982709, 918972396, 912566629, 479453126, 702982709, 485858893, 1969966590, 479453126, 39627827, 
+        463100699, 34579485, 1215571943, 1941084875, 463100699, 760092417, 1197421431, 1941084875, 900429713, 
+        2130774469, 263024791, 287075064, 1276676196, 2130774469, 1252625923, 699135781, 1276676196, 1577284327, 
+        430809419, 668555290, 682204778, 82922892, 430809419, 69273404, 152229673, 82922892, 513765688, 
+        944774143, 56142418, 1786947956, 1635428571, 944774143, 2052085612, 1297683401, 1635428571, 190371932, 
+        1396862975, 1610590556, 523734705, 1889079356, 1396862975, 828472628, 2145085793, 1889079356, 566013561, 
+        1961068818, 1923272181, 2119704107, 906764528, 1961068818, 710332602, 542141157, 906764528, 1792877373, 
+        268009167, 879715687, 2034889164, 422474587, 268009167, 1414763689, 969169389, 422474587, 1969877446, 
+        1280061087, 1958671378, 717593980, 121890570, 1280061087, 1362967968, 170625350, 121890570, 87718469, 
+        706866319, 1158615140, 489036658, 876481504, 706866319, 1546059986, 2049980045, 876481504, 1210786378, 
+        1690141580, 903957597, 154790430, 20989072, 1690141580, 770156239, 269567383, 20989072, 1189552724, 
+        2047235923, 557991075, 1691445540, 969736270, 2047235923, 1983744384, 1627452966, 969736270, 1690944505, 
+        1296581262, 1938279769, 1868127450, 1100132076, 1296581262, 1170284395, 1810066552, 1100132076, 1936363419, 
+        1504314152, 1338450694, 781308084, 635737758, 1504314152, 1192880368, 1382916034, 635737758, 1694349818, 
+        537200131, 1122859035, 2000891525, 886920697, 537200131, 8888207, 1350207018, 886920697, 1878518942, 
+        416790722, 1200659101, 507253722, 836854758, 416790722, 1530260137, 1843209703, 836854758, 729740288, 
+        706222760, 2145574203, 682375558, 1384287554, 706222760, 700023620, 2026197481, 1384287554, 2032396621, 
+        1020435098, 884921781, 1966585721, 1990420817, 1020435098, 908756877, 190519420, 1990420817, 302197641, 
+        574607615, 816764253, 1183720578, 1870518584, 574607615, 1503562259, 997715174, 1870518584, 68760530, 
+        1999480332, 2033388183, 610230128, 1606991363, 1999480332, 882686839, 591550640, 1606991363, 1708344133, 
+        1256158274, 1982451729, 1473267489, 396108542, 1256158274, 905292782, 491107052, 396108542, 841972544, 
+        1311413013, 57025069, 1112388734, 836608500, 1311413013, 1928707414, 1989549396, 836608500, 1372254995, 
+        55053420, 75265500, 1820803489, 809236105, 55053420, 1211160695, 1268891956, 809236105, 112784681, 
+        710532716, 289764289, 602888782, 1554233137, 710532716, 1241108644, 1242834134, 1554233137, 712258206, 
+        1364712746, 1975896148, 641259069, 497096546, 1364712746, 1831733625, 352611996, 497096546, 2033053696, 
+        901938803, 84873083, 44749841, 1838060851, 901938803, 1878184093, 2084491956, 1838060851, 1108246666, 
+        317050197, 923159877, 1148771268, 1214133801, 317050197, 988522410, 565311654, 1214133801, 2041302020, 
+        107899838, 603388854, 984329288, 598501892, 107899838, 217561458, 1843117501, 598501892, 1733455881, 
+        1886789292, 2075773710, 1916857550, 224620200, 1886789292, 383536360, 1151968532, 224620200, 507758885, 
+        
+    };
+
+static const __constant__ unsigned long long d_31k3p_A1P72[MRG313P_N] = 
+    {
+        358115744, 1884998244, 601897748, 335398200, 1516919229, 1884998244, 499121365, 758510237, 1516919229, 
+        1964690609, 1530165711, 920769984, 667727351, 1698053532, 1530165711, 1970364842, 465195060, 1698053532, 
+        216206963, 967297001, 1957442102, 1254444459, 446522508, 967297001, 227261603, 1159864719, 446522508, 
+        40625659, 21614372, 687208484, 603064909, 192962807, 21614372, 640770341, 1827843892, 192962807, 
+        2111268472, 188333479, 640258125, 988919539, 287996737, 188333479, 672698674, 615994322, 287996737, 
+        643313484, 1031417848, 900136208, 153453894, 1785922250, 1031417848, 2056399925, 121913950, 1785922250, 
+        329038958, 1626105692, 822858370, 922031027, 875905623, 1626105692, 1461720509, 237341159, 875905623, 
+        587585488, 1686055074, 56391795, 832090614, 1070040588, 1686055074, 605256199, 1514860938, 1070040588, 
+        444036913, 154176297, 771665648, 760620830, 1452177032, 154176297, 561389490, 2006630243, 1452177032, 
+        1650142106, 858842645, 1711015370, 1677650736, 1426991517, 858842645, 1269035208, 1767408547, 1426991517, 
+        1390761040, 2024456490, 2016433423, 274390280, 383872123, 2024456490, 1309365923, 1528246888, 383872123, 
+        1965072301, 1469758778, 1364484436, 2072316837, 1246317022, 1469758778, 620321426, 1244715268, 1246317022, 
+        421032213, 1337947838, 1679116003, 1857599687, 1376418744, 1337947838, 796579342, 509646979, 1376418744, 
+        1044519103, 1872732104, 1033193939, 138032017, 857793380, 1872732104, 1064272952, 2054292320, 857793380, 
+        1755230141, 977617553, 736748304, 551250748, 750036143, 977617553, 1558612811, 1161334237, 750036143, 
+        1133471162, 1531283510, 681042847, 1955181383, 727953836, 1531283510, 2114560913, 37180940, 727953836, 
+        183272355, 2126723282, 834603155, 289624645, 801465127, 2126723282, 1616880209, 1174582241, 801465127, 
+        1592213246, 749403583, 116758430, 29451941, 1181399498, 749403583, 36298092, 1905769507, 1181399498, 
+        2081963460, 718413245, 1736447282, 663400090, 1221328335, 718413245, 333511784, 383784873, 1221328335, 
+        1634173369, 896036145, 453441652, 511914639, 2121598261, 896036145, 1772029414, 1792927429, 2121598261, 
+        1806089182, 1561011545, 1277688874, 1613107574, 1984745436, 1561011545, 1654510134, 915707657, 1984745436, 
+        1069547487, 0, 16641, 2146689, 0, 0, 0, 2146689, 0, 
+        809509920, 1363313297, 2142748478, 1536646846, 0, 1363313297, 1921239906, 0, 0, 
+        792612182, 1972264774, 2020830546, 841619147, 66750221, 1972264774, 1019085500, 65330683, 66750221, 
+        297558722, 1787676628, 1482854989, 162248998, 623416331, 1787676628, 829534783, 2128674825, 623416331, 
+        1941425310, 1590800661, 1412926708, 1878918984, 820111461, 1590800661, 1202338804, 896364577, 820111461, 
+        424167695, 1979932868, 242538570, 1222704472, 735019899, 1979932868, 2008269626, 2048655112, 735019899, 
+        222334677, 216997100, 1438977317, 944480251, 1454076251, 216997100, 75338489, 1934759817, 1454076251, 
+        2114493292, 557882655, 1782452277, 155593504, 192789109, 557882655, 1099902144, 1360448366, 192789109, 
+        99230990, 1900716266, 1029980306, 1870957007, 713611054, 1900716266, 379262556, 708652832, 713611054, 
+        148750170, 912846520, 805494327, 829553127, 381010121, 912846520, 1793084142, 1603087966, 381010121, 
+        994222150, 1726369694, 1495820898, 1834851259, 1408185467, 1726369694, 1510874885, 1427181283, 1408185467, 
+        895715087, 1515627404, 292866869, 1272604102, 44843381, 1515627404, 94923239, 789025048, 44843381, 
+        565366555, 991935531, 1091048565, 1158827830, 1058231077, 991935531, 1258148326, 1341120276, 1058231077, 
+        324593289, 1345155578, 1114495245, 2035965903, 1455037813, 1345155578, 1726377802, 2013427336, 1455037813, 
+        446437689, 1177952078, 510123717, 1381450083, 1273711912, 1177952078, 1631962772, 637164659, 1273711912, 
+        1016544012, 75084919, 2140871404, 1294504300, 2010581145, 75084919, 1096019963, 1793773126, 2010581145, 
+        405362780, 1820279411, 1546241796, 1896696160, 1498901823, 1820279411, 740326496, 235112706, 1498901823, 
+        691245919, 652020090, 1853614974, 745646829, 149606741, 652020090, 358729377, 184883570, 149606741, 
+        1987964137, 80289028, 401603076, 267189276, 2005525734, 80289028, 1767350024, 1357865130, 2005525734, 
+        1713907939, 927809050, 881315413, 2020538633, 2072145098, 927809050, 1575766865, 2131402664, 2072145098, 
+        1336242501, 232186272, 1334168973, 309105757, 856503340, 232186272, 2034741677, 2054389709, 856503340, 
+        1654383271, 774904812, 1856122987, 1069180506, 2106799039, 774904812, 1178472986, 986807912, 2106799039, 
+        534662389, 951352354, 644369407, 1519274917, 531726619, 951352354, 317885787, 1663739363, 531726619, 
+        894788528, 308272393, 1615809872, 133559729, 159746903, 308272393, 1112433051, 1245652383, 159746903, 
+        1225818791, 379928477, 586004947, 432710518, 1038219652, 379928477, 1766133299, 18216470, 1038219652, 
+        1702867733, 1131754520, 1416347084, 172663841, 1487530228, 1131754520, 2114928731, 275537595, 1487530228, 
+        642224276, 1849088274, 1184906094, 381547189, 32170162, 1849088274, 161702529, 1534397985, 32170162, 
+        1323593069, 76877160, 239310746, 806315176, 896241465, 76877160, 1327219052, 168931119, 896241465, 
+        1095350814, 1662124010, 1682062521, 90216862, 1874582332, 1662124010, 1813116237, 1188510, 1874582332, 
+        1940467875, 316580111, 897309151, 1936247188, 1803808400, 316580111, 36645026, 926038245, 1803808400, 
+        2105614532, 913656499, 1805780984, 1017513060, 2075587016, 913656499, 1897571433, 1770077961, 2075587016, 
+        511670826, 552427257, 26313033, 1246897610, 1891648234, 552427257, 396155802, 144874618, 1891648234, 
+        1426776947, 1865876727, 1783073521, 235733980, 293603129, 1865876727, 179929319, 1275371358, 293603129, 
+        868259371, 1613933485, 1123821876, 1091617655, 14816320, 1613933485, 2038989453, 746642637, 14816320, 
+        563402321, 1121404358, 1010170440, 1462967940, 867365198, 1121404358, 779757833, 1221888551, 867365198, 
+        171135912, 174716954, 1437189608, 713865790, 73279627, 174716954, 1063650596, 823258938, 73279627, 
+        72146285, 1890312047, 494273905, 1484307982, 1620809839, 1890312047, 1184601952, 879825918, 1620809839, 
+        1990751391, 1991272021, 805652307, 849932547, 1266710339, 1991272021, 1323536716, 1210337590, 1266710339, 
+        304184685, 1848374929, 952601221, 478989630, 863887666, 1848374929, 69681024, 1090773817, 863887666, 
+        1208769033, 477828468, 1179500066, 1831653224, 1353679080, 477828468, 1510330256, 1245383923, 1353679080, 
+        1379455617, 2100061018, 1332542957, 99349693, 1302366464, 2100061018, 324931800, 1554680558, 1302366464, 
+        102237247, 828554832, 1143731069, 1512419905, 1702500920, 828554832, 1656874625, 1849582496, 1702500920, 
+        765993804, 770918242, 575939555, 1281758597, 645483870, 770918242, 664205456, 620564265, 645483870, 
+        
+    };
+
+static const unsigned long long h_31k3p_A1P72[MRG313P_N] = 
+    {
+        358115744, 1884998244, 601897748, 335398200, 1516919229, 1884998244, 499121365, 758510237, 1516919229, 
+        1964690609, 1530165711, 920769984, 667727351, 1698053532, 1530165711, 1970364842, 465195060, 1698053532, 
+        216206963, 967297001, 1957442102, 1254444459, 446522508, 967297001, 227261603, 1159864719, 446522508, 
+        40625659, 21614372, 687208484, 603064909, 192962807, 21614372, 640770341, 1827843892, 192962807, 
+        2111268472, 188333479, 640258125, 988919539, 287996737, 188333479, 672698674, 615994322, 287996737, 
+        643313484, 1031417848, 900136208, 153453894, 1785922250, 1031417848, 2056399925, 121913950, 1785922250, 
+        329038958, 1626105692, 822858370, 922031027, 875905623, 1626105692, 1461720509, 237341159, 875905623, 
+        587585488, 1686055074, 56391795, 832090614, 1070040588, 1686055074, 605256199, 1514860938, 1070040588, 
+        444036913, 154176297, 771665648, 760620830, 1452177032, 154176297, 561389490, 2006630243, 1452177032, 
+        1650142106, 858842645, 1711015370, 1677650736, 1426991517, 858842645, 1269035208, 1767408547, 1426991517, 
+        1390761040, 2024456490, 2016433423, 274390280, 383872123, 2024456490, 1309365923, 1528246888, 383872123, 
+        1965072301, 1469758778, 1364484436, 2072316837, 1246317022, 1469758778, 620321426, 1244715268, 1246317022, 
+        421032213, 1337947838, 1679116003, 1857599687, 1376418744, 1337947838, 796579342, 509646979, 1376418744, 
+        1044519103, 1872732104, 1033193939, 138032017, 857793380, 1872732104, 1064272952, 2054292320, 857793380, 
+        1755230141, 977617553, 736748304, 551250748, 750036143, 977617553, 1558612811, 1161334237, 750036143, 
+        1133471162, 1531283510, 681042847, 1955181383, 727953836, 1531283510, 2114560913, 37180940, 727953836, 
+        183272355, 2126723282, 834603155, 289624645, 801465127, 2126723282, 1616880209, 1174582241, 801465127, 
+        1592213246, 749403583, 116758430, 29451941, 1181399498, 749403583, 36298092, 1905769507, 1181399498, 
+        2081963460, 718413245, 1736447282, 663400090, 1221328335, 718413245, 333511784, 383784873, 1221328335, 
+        1634173369, 896036145, 453441652, 511914639, 2121598261, 896036145, 1772029414, 1792927429, 2121598261, 
+        1806089182, 1561011545, 1277688874, 1613107574, 1984745436, 1561011545, 1654510134, 915707657, 1984745436, 
+        1069547487, 0, 16641, 2146689, 0, 0, 0, 2146689, 0, 
+        809509920, 1363313297, 2142748478, 1536646846, 0, 1363313297, 1921239906, 0, 0, 
+        792612182, 1972264774, 2020830546, 841619147, 66750221, 1972264774, 1019085500, 65330683, 66750221, 
+        297558722, 1787676628, 1482854989, 162248998, 623416331, 1787676628, 829534783, 2128674825, 623416331, 
+        1941425310, 1590800661, 1412926708, 1878918984, 820111461, 1590800661, 1202338804, 896364577, 820111461, 
+        424167695, 1979932868, 242538570, 1222704472, 735019899, 1979932868, 2008269626, 2048655112, 735019899, 
+        222334677, 216997100, 1438977317, 944480251, 1454076251, 216997100, 75338489, 1934759817, 1454076251, 
+        2114493292, 557882655, 1782452277, 155593504, 192789109, 557882655, 1099902144, 1360448366, 192789109, 
+        99230990, 1900716266, 1029980306, 1870957007, 713611054, 1900716266, 379262556, 708652832, 713611054, 
+        148750170, 912846520, 805494327, 829553127, 381010121, 912846520, 1793084142, 1603087966, 381010121, 
+        994222150, 1726369694, 1495820898, 1834851259, 1408185467, 1726369694, 1510874885, 1427181283, 1408185467, 
+        895715087, 1515627404, 292866869, 1272604102, 44843381, 1515627404, 94923239, 789025048, 44843381, 
+        565366555, 991935531, 1091048565, 1158827830, 1058231077, 991935531, 1258148326, 1341120276, 1058231077, 
+        324593289, 1345155578, 1114495245, 2035965903, 1455037813, 1345155578, 1726377802, 2013427336, 1455037813, 
+        446437689, 1177952078, 510123717, 1381450083, 1273711912, 1177952078, 1631962772, 637164659, 1273711912, 
+        1016544012, 75084919, 2140871404, 1294504300, 2010581145, 75084919, 1096019963, 1793773126, 2010581145, 
+        405362780, 1820279411, 1546241796, 1896696160, 1498901823, 1820279411, 740326496, 235112706, 1498901823, 
+        691245919, 652020090, 1853614974, 745646829, 149606741, 652020090, 358729377, 184883570, 149606741, 
+        1987964137, 80289028, 401603076, 267189276, 2005525734, 80289028, 1767350024, 1357865130, 2005525734, 
+        1713907939, 927809050, 881315413, 2020538633, 2072145098, 927809050, 1575766865, 2131402664, 2072145098, 
+        1336242501, 232186272, 1334168973, 309105757, 856503340, 232186272, 2034741677, 2054389709, 856503340, 
+        1654383271, 774904812, 1856122987, 1069180506, 2106799039, 774904812, 1178472986, 986807912, 2106799039, 
+        534662389, 951352354, 644369407, 1519274917, 531726619, 951352354, 317885787, 1663739363, 531726619, 
+        894788528, 308272393, 1615809872, 133559729, 159746903, 308272393, 1112433051, 1245652383, 159746903, 
+        1225818791, 379928477, 586004947, 432710518, 1038219652, 379928477, 1766133299, 18216470, 1038219652, 
+        1702867733, 1131754520, 1416347084, 172663841, 1487530228, 1131754520, 2114928731, 275537595, 1487530228, 
+        642224276, 1849088274, 1184906094, 381547189, 32170162, 1849088274, 161702529, 1534397985, 32170162, 
+        1323593069, 76877160, 239310746, 806315176, 896241465, 76877160, 1327219052, 168931119, 896241465, 
+        1095350814, 1662124010, 1682062521, 90216862, 1874582332, 1662124010, 1813116237, 1188510, 1874582332, 
+        1940467875, 316580111, 897309151, 1936247188, 1803808400, 316580111, 36645026, 926038245, 1803808400, 
+        2105614532, 913656499, 1805780984, 1017513060, 2075587016, 913656499, 1897571433, 1770077961, 2075587016, 
+        511670826, 552427257, 26313033, 1246897610, 1891648234, 552427257, 396155802, 144874618, 1891648234, 
+        1426776947, 1865876727, 1783073521, 235733980, 293603129, 1865876727, 179929319, 1275371358, 293603129, 
+        868259371, 1613933485, 1123821876, 1091617655, 14816320, 1613933485, 2038989453, 746642637, 14816320, 
+        563402321, 1121404358, 1010170440, 1462967940, 867365198, 1121404358, 779757833, 1221888551, 867365198, 
+        171135912, 174716954, 1437189608, 713865790, 73279627, 174716954, 1063650596, 823258938, 73279627, 
+        72146285, 1890312047, 494273905, 1484307982, 1620809839, 1890312047, 1184601952, 879825918, 1620809839, 
+        1990751391, 1991272021, 805652307, 849932547, 1266710339, 1991272021, 1323536716, 1210337590, 1266710339, 
+        304184685, 1848374929, 952601221, 478989630, 863887666, 1848374929, 69681024, 1090773817, 863887666, 
+        1208769033, 477828468, 1179500066, 1831653224, 1353679080, 477828468, 1510330256, 1245383923, 1353679080, 
+        1379455617, 2100061018, 1332542957, 99349693, 1302366464, 2100061018, 324931800, 1554680558, 1302366464, 
+        102237247, 828554832, 1143731069, 1512419905, 1702500920, 828554832, 1656874625, 1849582496, 1702500920, 
+        765993804, 770918242, 575939555, 1281758597, 645483870, 770918242, 664205456, 620564265, 645483870, 
+        
+    };
+
+static const __constant__ unsigned long long d_31k3p_A2P72[MRG313P_N] = 
+    {
+        1407477216, 1639496704, 2002613992, 1496414766, 1407477216, 1133297478, 954677935, 1496414766, 1228857673, 
+        420160462, 92797448, 237875349, 1795612190, 420160462, 1650534289, 365601547, 1795612190, 1282690299, 
+        1792497038, 738202147, 1464608251, 106598948, 1792497038, 1527655423, 240377218, 106598948, 505218833, 
+        292471243, 1077723122, 1396183817, 2004716257, 292471243, 1686255562, 548890929, 2004716257, 1302569189, 
+        63091677, 842148833, 326135665, 1365813281, 63091677, 1881826449, 1182951296, 1365813281, 1511679103, 
+        26967032, 860991881, 1317903938, 921680632, 26967032, 464768575, 196823907, 921680632, 1906484943, 
+        1143007602, 2018459512, 457543768, 1815469593, 1143007602, 1228922758, 1351575494, 1815469593, 1265660338, 
+        217129940, 1829279479, 682064366, 1924149801, 217129940, 923902335, 428176873, 1924149801, 1868867057, 
+        517271518, 1853392161, 1814855550, 1320317703, 517271518, 1358854314, 660439901, 1320317703, 1966319684, 
+        736570376, 94332279, 918579860, 2107925076, 736570376, 1283677495, 330836203, 2107925076, 1931191663, 
+        1403520183, 2058917917, 595102217, 1944331553, 1403520183, 1260684674, 638450083, 1944331553, 781285592, 
+        1869116515, 2085637800, 1870447309, 1958401382, 1869116515, 26129294, 1540728644, 1958401382, 1236253286, 
+        801770863, 1534126837, 435043770, 1092699728, 801770863, 44320216, 644454700, 1092699728, 1401905347, 
+        1648735306, 1649849982, 1666167242, 1545744602, 1648735306, 1529427342, 322901296, 1545744602, 442209260, 
+        1717174003, 311010312, 1824020089, 988335134, 1717174003, 1622787936, 1669493586, 988335134, 1763879653, 
+        865352230, 660209122, 1759619881, 1613634339, 865352230, 514223580, 1601098186, 1613634339, 1952226836, 
+        1185234230, 198116144, 171226633, 1753280429, 1185234230, 1780169940, 715267904, 1753280429, 120332194, 
+        657643533, 1440124191, 767817185, 929759701, 657643533, 1602066707, 1253715449, 929759701, 309292275, 
+        736520689, 2004232106, 1364226996, 625924881, 736520689, 1265929991, 725236536, 625924881, 195827234, 
+        1605537728, 1619394444, 1358459938, 621908231, 1605537728, 882842737, 1405247044, 621908231, 2127942035, 
+        1947979307, 919984545, 1900657142, 1924170040, 1947979307, 943497443, 448959804, 1924170040, 1453441668, 
+        877134442, 2062660782, 669895258, 435226864, 877134442, 1827992388, 161383746, 435226864, 1357988379, 
+        1484932942, 1380965837, 1582518977, 637999621, 1484932942, 436446481, 1961422328, 637999621, 862446210, 
+        1932221805, 1802569440, 1477140493, 610284457, 1932221805, 935713404, 921832714, 610284457, 1918341115, 
+        2075199547, 604894683, 910095642, 1111258125, 2075199547, 806057166, 2045013533, 1111258125, 1166693335, 
+        1956592310, 116335181, 180114152, 933479796, 1956592310, 869700825, 250448516, 933479796, 1337340001, 
+        264650108, 61230582, 1488423039, 964470743, 264650108, 1684740865, 305424253, 964470743, 1032796075, 
+        1955626538, 518048525, 740286143, 699327583, 1955626538, 477089965, 233487965, 699327583, 1712024538, 
+        1118635203, 99037988, 425489461, 1537084641, 1118635203, 1210633168, 1162060325, 1537084641, 1070062360, 
+        1876325521, 926990499, 1104402037, 1110969145, 1876325521, 933557607, 1144785928, 1110969145, 2087553842, 
+        975133878, 961021402, 1128052279, 871758224, 975133878, 704727347, 1545321856, 871758224, 1815728387, 
+        976286259, 1756058808, 859771158, 1279502601, 976286259, 28327672, 565649640, 1279502601, 1513608227, 
+        471441576, 984257739, 1263470614, 1737489625, 471441576, 1458276750, 933512842, 1737489625, 2094140247, 
+        347885148, 1512761842, 1624395424, 658703383, 347885148, 547069801, 2060162056, 658703383, 1860977403, 
+        1630810561, 1586204807, 1407141665, 308724097, 1630810561, 487787239, 736059294, 308724097, 1879082616, 
+        1903157856, 1326872994, 1670262955, 468021422, 1903157856, 124631461, 1721982830, 468021422, 1353046646, 
+        100643509, 568958105, 991629940, 1465221011, 100643509, 1042549176, 1459241612, 1465221011, 517335945, 
+        766248926, 1410785686, 827266830, 1286617553, 766248926, 1870136409, 360369598, 1286617553, 1403944694, 
+        659847991, 2113729237, 1162970729, 516891667, 659847991, 1467650175, 1004127870, 516891667, 196325686, 
+        1472519814, 1384007859, 150401617, 83968668, 1472519814, 1317574910, 877074995, 83968668, 1032019899, 
+        639449994, 857570799, 1701008257, 800873109, 639449994, 2104898230, 1059523969, 800873109, 1741538312, 
+        2089429352, 1616084871, 591367390, 1963152593, 2089429352, 840407495, 253090559, 1963152593, 1502112416, 
+        1578256903, 1973320061, 719716367, 951587645, 1578256903, 57728760, 1946666920, 951587645, 1319732484, 
+        1207534699, 737280926, 619897924, 586536795, 1207534699, 703919797, 852266854, 586536795, 1355881756, 
+        763551522, 465327219, 331389193, 1721665993, 763551522, 1855604019, 885174226, 1721665993, 1940584308, 
+        1831750831, 1464210176, 446609909, 2632136, 1831750831, 1020232403, 298184035, 2632136, 1109702463, 
+        1281476674, 687609158, 212021293, 684307252, 1281476674, 1159895117, 662903252, 684307252, 784484809, 
+        1704220561, 1489131816, 354789768, 1890967465, 1704220561, 877846934, 904934541, 1890967465, 1731308168, 
+        2030447772, 1491811284, 1492152019, 754049360, 2030447772, 753708625, 310811546, 754049360, 1587550693, 
+        38690287, 170899366, 1721349286, 1642652920, 38690287, 92203000, 2067720926, 1642652920, 2014208213, 
+        85650285, 1807372820, 2020052636, 1718293988, 85650285, 1505614172, 1665512322, 1718293988, 245548435, 
+        655180719, 2133235251, 411320890, 1099098606, 655180719, 673550388, 2099739989, 1099098606, 2081370320, 
+        1446281823, 1990634946, 1860820163, 15990642, 1446281823, 145805425, 1941196129, 15990642, 1094209948, 
+        1885349336, 1667122602, 1799466284, 1683166214, 1885349336, 1550822532, 1349081652, 1683166214, 1683608456, 
+        1746137315, 2002038912, 1893433983, 1449356459, 1746137315, 1557961388, 1208832805, 1449356459, 1397008732, 
+        1456908682, 1272394894, 464594653, 939961626, 1456908682, 1747761867, 1729100372, 939961626, 1438247187, 
+        530440338, 999618971, 674067403, 1862103892, 530440338, 40192881, 685956562, 1862103892, 1176204019, 
+        2022848714, 1518007620, 711653837, 888439292, 2022848714, 1694793075, 1144519156, 888439292, 1472574795, 
+        227210760, 1052512157, 2069786788, 1532623415, 227210760, 515348784, 1966044219, 1532623415, 1677906195, 
+        439007422, 984587578, 631706404, 995353695, 439007422, 1348234869, 560784494, 995353695, 1799019626, 
+        452452800, 1229617806, 690969104, 1668598579, 452452800, 59784702, 599027790, 1668598579, 991695888, 
+        1164680766, 1730497642, 1186341548, 1858581354, 1164680766, 255274869, 735437056, 1858581354, 1644842953, 
+        1431130166, 1178684362, 1401213391, 1464208080, 1431130166, 1241679051, 607337906, 1464208080, 796789021, 
+        1370017681, 1155666658, 586645827, 1859560334, 1370017681, 281118586, 1507943303, 1859560334, 449379819, 
+        
+    };
+
+static const unsigned long long h_31k3p_A2P72[MRG313P_N] = 
+    {
+        1407477216, 1639496704, 2002613992, 1496414766, 1407477216, 1133297478, 954677935, 1496414766, 1228857673, 
+        420160462, 92797448, 237875349, 1795612190, 420160462, 1650534289, 365601547, 1795612190, 1282690299, 
+        1792497038, 738202147, 1464608251, 106598948, 1792497038, 1527655423, 240377218, 106598948, 505218833, 
+        292471243, 1077723122, 1396183817, 2004716257, 292471243, 1686255562, 548890929, 2004716257, 1302569189, 
+        63091677, 842148833, 326135665, 1365813281, 63091677, 1881826449, 1182951296, 1365813281, 1511679103, 
+        26967032, 860991881, 1317903938, 921680632, 26967032, 464768575, 196823907, 921680632, 1906484943, 
+        1143007602, 2018459512, 457543768, 1815469593, 1143007602, 1228922758, 1351575494, 1815469593, 1265660338, 
+        217129940, 1829279479, 682064366, 1924149801, 217129940, 923902335, 428176873, 1924149801, 1868867057, 
+        517271518, 1853392161, 1814855550, 1320317703, 517271518, 1358854314, 660439901, 1320317703, 1966319684, 
+        736570376, 94332279, 918579860, 2107925076, 736570376, 1283677495, 330836203, 2107925076, 1931191663, 
+        1403520183, 2058917917, 595102217, 1944331553, 1403520183, 1260684674, 638450083, 1944331553, 781285592, 
+        1869116515, 2085637800, 1870447309, 1958401382, 1869116515, 26129294, 1540728644, 1958401382, 1236253286, 
+        801770863, 1534126837, 435043770, 1092699728, 801770863, 44320216, 644454700, 1092699728, 1401905347, 
+        1648735306, 1649849982, 1666167242, 1545744602, 1648735306, 1529427342, 322901296, 1545744602, 442209260, 
+        1717174003, 311010312, 1824020089, 988335134, 1717174003, 1622787936, 1669493586, 988335134, 1763879653, 
+        865352230, 660209122, 1759619881, 1613634339, 865352230, 514223580, 1601098186, 1613634339, 1952226836, 
+        1185234230, 198116144, 171226633, 1753280429, 1185234230, 1780169940, 715267904, 1753280429, 120332194, 
+        657643533, 1440124191, 767817185, 929759701, 657643533, 1602066707, 1253715449, 929759701, 309292275, 
+        736520689, 2004232106, 1364226996, 625924881, 736520689, 1265929991, 725236536, 625924881, 195827234, 
+        1605537728, 1619394444, 1358459938, 621908231, 1605537728, 882842737, 1405247044, 621908231, 2127942035, 
+        1947979307, 919984545, 1900657142, 1924170040, 1947979307, 943497443, 448959804, 1924170040, 1453441668, 
+        877134442, 2062660782, 669895258, 435226864, 877134442, 1827992388, 161383746, 435226864, 1357988379, 
+        1484932942, 1380965837, 1582518977, 637999621, 1484932942, 436446481, 1961422328, 637999621, 862446210, 
+        1932221805, 1802569440, 1477140493, 610284457, 1932221805, 935713404, 921832714, 610284457, 1918341115, 
+        2075199547, 604894683, 910095642, 1111258125, 2075199547, 806057166, 2045013533, 1111258125, 1166693335, 
+        1956592310, 116335181, 180114152, 933479796, 1956592310, 869700825, 250448516, 933479796, 1337340001, 
+        264650108, 61230582, 1488423039, 964470743, 264650108, 1684740865, 305424253, 964470743, 1032796075, 
+        1955626538, 518048525, 740286143, 699327583, 1955626538, 477089965, 233487965, 699327583, 1712024538, 
+        1118635203, 99037988, 425489461, 1537084641, 1118635203, 1210633168, 1162060325, 1537084641, 1070062360, 
+        1876325521, 926990499, 1104402037, 1110969145, 1876325521, 933557607, 1144785928, 1110969145, 2087553842, 
+        975133878, 961021402, 1128052279, 871758224, 975133878, 704727347, 1545321856, 871758224, 1815728387, 
+        976286259, 1756058808, 859771158, 1279502601, 976286259, 28327672, 565649640, 1279502601, 1513608227, 
+        471441576, 984257739, 1263470614, 1737489625, 471441576, 1458276750, 933512842, 1737489625, 2094140247, 
+        347885148, 1512761842, 1624395424, 658703383, 347885148, 547069801, 2060162056, 658703383, 1860977403, 
+        1630810561, 1586204807, 1407141665, 308724097, 1630810561, 487787239, 736059294, 308724097, 1879082616, 
+        1903157856, 1326872994, 1670262955, 468021422, 1903157856, 124631461, 1721982830, 468021422, 1353046646, 
+        100643509, 568958105, 991629940, 1465221011, 100643509, 1042549176, 1459241612, 1465221011, 517335945, 
+        766248926, 1410785686, 827266830, 1286617553, 766248926, 1870136409, 360369598, 1286617553, 1403944694, 
+        659847991, 2113729237, 1162970729, 516891667, 659847991, 1467650175, 1004127870, 516891667, 196325686, 
+        1472519814, 1384007859, 150401617, 83968668, 1472519814, 1317574910, 877074995, 83968668, 1032019899, 
+        639449994, 857570799, 1701008257, 800873109, 639449994, 2104898230, 1059523969, 800873109, 1741538312, 
+        2089429352, 1616084871, 591367390, 1963152593, 2089429352, 840407495, 253090559, 1963152593, 1502112416, 
+        1578256903, 1973320061, 719716367, 951587645, 1578256903, 57728760, 1946666920, 951587645, 1319732484, 
+        1207534699, 737280926, 619897924, 586536795, 1207534699, 703919797, 852266854, 586536795, 1355881756, 
+        763551522, 465327219, 331389193, 1721665993, 763551522, 1855604019, 885174226, 1721665993, 1940584308, 
+        1831750831, 1464210176, 446609909, 2632136, 1831750831, 1020232403, 298184035, 2632136, 1109702463, 
+        1281476674, 687609158, 212021293, 684307252, 1281476674, 1159895117, 662903252, 684307252, 784484809, 
+        1704220561, 1489131816, 354789768, 1890967465, 1704220561, 877846934, 904934541, 1890967465, 1731308168, 
+        2030447772, 1491811284, 1492152019, 754049360, 2030447772, 753708625, 310811546, 754049360, 1587550693, 
+        38690287, 170899366, 1721349286, 1642652920, 38690287, 92203000, 2067720926, 1642652920, 2014208213, 
+        85650285, 1807372820, 2020052636, 1718293988, 85650285, 1505614172, 1665512322, 1718293988, 245548435, 
+        655180719, 2133235251, 411320890, 1099098606, 655180719, 673550388, 2099739989, 1099098606, 2081370320, 
+        1446281823, 1990634946, 1860820163, 15990642, 1446281823, 145805425, 1941196129, 15990642, 1094209948, 
+        1885349336, 1667122602, 1799466284, 1683166214, 1885349336, 1550822532, 1349081652, 1683166214, 1683608456, 
+        1746137315, 2002038912, 1893433983, 1449356459, 1746137315, 1557961388, 1208832805, 1449356459, 1397008732, 
+        1456908682, 1272394894, 464594653, 939961626, 1456908682, 1747761867, 1729100372, 939961626, 1438247187, 
+        530440338, 999618971, 674067403, 1862103892, 530440338, 40192881, 685956562, 1862103892, 1176204019, 
+        2022848714, 1518007620, 711653837, 888439292, 2022848714, 1694793075, 1144519156, 888439292, 1472574795, 
+        227210760, 1052512157, 2069786788, 1532623415, 227210760, 515348784, 1966044219, 1532623415, 1677906195, 
+        439007422, 984587578, 631706404, 995353695, 439007422, 1348234869, 560784494, 995353695, 1799019626, 
+        452452800, 1229617806, 690969104, 1668598579, 452452800, 59784702, 599027790, 1668598579, 991695888, 
+        1164680766, 1730497642, 1186341548, 1858581354, 1164680766, 255274869, 735437056, 1858581354, 1644842953, 
+        1431130166, 1178684362, 1401213391, 1464208080, 1431130166, 1241679051, 607337906, 1464208080, 796789021, 
+        1370017681, 1155666658, 586645827, 1859560334, 1370017681, 281118586, 1507943303, 1859560334, 449379819, 
+        
+    };
+
+static const __constant__ unsigned long long d_31k3p_A1P134[MRG313P_N] = 
+    {
+        102237247, 828554832, 1143731069, 1512419905, 1702500920, 828554832, 1656874625, 1849582496, 1702500920, 
+        765993804, 770918242, 575939555, 1281758597, 645483870, 770918242, 664205456, 620564265, 645483870, 
+        307717124, 1198818281, 1792586313, 1462884148, 617402461, 1198818281, 28735665, 1368756598, 617402461, 
+        803138895, 384964382, 614575463, 1970823435, 162610726, 384964382, 268281397, 1023662615, 162610726, 
+        896994421, 2090054205, 1381578739, 2129998277, 845166865, 2090054205, 1181536570, 242449311, 845166865, 
+        254012310, 509978839, 1796261914, 1937036677, 366572538, 509978839, 1362760821, 692324442, 366572538, 
+        2111868835, 296613425, 277723253, 1466561285, 455661184, 296613425, 1755909826, 1672661504, 455661184, 
+        606472042, 562526511, 1731447514, 18430018, 1524212047, 562526511, 1698959568, 1290402814, 1524212047, 
+        646236129, 1597450376, 47162608, 1789009138, 1652961203, 1597450376, 2060152039, 215070855, 1652961203, 
+        865722141, 696542619, 71313185, 609466277, 2078015280, 696542619, 1807168324, 187202008, 2078015280, 
+        1978416087, 1540730869, 63309908, 1724527191, 183377628, 1540730869, 1185786577, 1681399087, 183377628, 
+        925130648, 1325132980, 339734121, 876028669, 1366196111, 1325132980, 1290946307, 1633591539, 1366196111, 
+        214818437, 2133229752, 7948648, 1025375592, 1724783401, 2133229752, 308731192, 1801293992, 1724783401, 
+        1485136643, 363750817, 2061668273, 1814718636, 1157813323, 363750817, 1826698806, 1416970207, 1157813323, 
+        2131054317, 1172406852, 1426853685, 1528015370, 1282397429, 1172406852, 916628618, 1815517899, 1282397429, 
+        1506700134, 1960200740, 1209626772, 1423031004, 2129819678, 1960200740, 1610308761, 1577854465, 2129819678, 
+        769959675, 1708049365, 425164493, 1159128422, 1630622394, 1708049365, 1295036091, 982109384, 1630622394, 
+        504975057, 1940157879, 787148714, 610452697, 145802313, 1940157879, 1172263339, 308057876, 145802313, 
+        991210125, 2087511692, 1964303825, 2139606726, 797914368, 2087511692, 853552393, 583402810, 797914368, 
+        1946334206, 541736582, 1594166893, 1636582732, 259143302, 541736582, 1164542374, 52193900, 259143302, 
+        960151042, 380019189, 212304412, 1617465384, 1078006211, 380019189, 1777835147, 1572070265, 1078006211, 
+        653956479, 281606920, 180784926, 1846418984, 1853880518, 281606920, 1967554328, 806781606, 1853880518, 
+        1587101226, 551715798, 1990514045, 1225757812, 1041535125, 551715798, 304377591, 1050674614, 1041535125, 
+        1435202391, 1987881783, 1034446472, 299608774, 2007648138, 1987881783, 886196014, 1607919899, 2007648138, 
+        788841984, 356512369, 33250922, 2141885291, 1233503151, 356512369, 892939014, 469054309, 1233503151, 
+        1422096882, 1648252672, 1042088829, 1285472827, 874678388, 1648252672, 23713635, 214950247, 874678388, 
+        656029879, 1721716023, 1397449316, 2029819063, 1078189672, 1721716023, 910551326, 1190126686, 1078189672, 
+        519979488, 639660086, 601265364, 253820664, 1410346282, 639660086, 911772508, 481562416, 1410346282, 
+        2029813495, 1026747356, 1120085706, 609651725, 731766923, 1026747356, 1453906457, 460662147, 731766923, 
+        458190290, 260687447, 1448966402, 85588569, 1543150734, 260687447, 1416425958, 451002172, 1543150734, 
+        1375017592, 639697489, 1501814947, 460599933, 2061622376, 639697489, 916597495, 801587966, 2061622376, 
+        835563796, 1270361954, 2030482250, 2086688963, 76166254, 1270361954, 667934894, 1426470107, 76166254, 
+        1471666195, 396699230, 1874865881, 1339530185, 238008363, 396699230, 1782076789, 1734569564, 238008363, 
+        2027330179, 1805240935, 1240887723, 1160726389, 1673237948, 1805240935, 947846739, 1596265562, 1673237948, 
+        1733629950, 1479278255, 864592395, 2010752958, 1781455951, 1479278255, 1848333959, 600161726, 1781455951, 
+        196661962, 398622196, 242006792, 1154105110, 1304430887, 398622196, 2030139403, 1104552021, 1304430887, 
+        1527271306, 2020240256, 375546022, 1200796604, 76775611, 2020240256, 765471737, 667871474, 76775611, 
+        1096892474, 1134067588, 1253134865, 593124060, 1170643171, 1134067588, 265830856, 75245340, 1170643171, 
+        526445385, 1922614678, 1930596721, 2086357604, 2077914257, 1922614678, 1056674057, 1645516487, 2077914257, 
+        93642908, 2040467937, 379236419, 1676857817, 375401972, 2040467937, 1227358939, 1550819682, 375401972, 
+        232840996, 264979615, 1325589187, 1349797010, 1053319317, 264979615, 1970115630, 2017208884, 1053319317, 
+        256014829, 1474965629, 527617366, 1490647157, 1691497299, 1474965629, 1292005205, 2017815949, 1691497299, 
+        1737743605, 1949461875, 1892201859, 1428387700, 1217151312, 1949461875, 224995176, 840798379, 1217151312, 
+        257826029, 651680494, 1478568101, 1756724093, 952774017, 651680494, 314921493, 608757611, 952774017, 
+        409891068, 1309337814, 306010275, 820619829, 1094160296, 1309337814, 1400853540, 1720758185, 1094160296, 
+        772341819, 1825466063, 2094462794, 1750244551, 13069239, 1825466063, 1409404604, 474547195, 13069239, 
+        1021083206, 627809515, 1699049246, 134020740, 76488958, 627809515, 1530532496, 1120908370, 76488958, 
+        590939492, 669094268, 1330863964, 2030243243, 2053156627, 669094268, 413814692, 1477901940, 2053156627, 
+        1690675511, 121663542, 763903604, 1906800801, 31223127, 121663542, 662211389, 2133530841, 31223127, 
+        1298806606, 812629275, 426987180, 1394255045, 2021060853, 812629275, 1749961419, 435346596, 2021060853, 
+        1409381719, 2124539952, 292274947, 1196246164, 348793657, 2124539952, 1335230639, 1401722248, 348793657, 
+        941294890, 363918986, 744648143, 1570329979, 737228385, 363918986, 1848392607, 2371063, 737228385, 
+        0, 683794320, 0, 0, 0, 683794320, 162637753, 1679057135, 0, 
+        0, 0, 1733722719, 311931463, 401845057, 0, 0, 311931463, 401845057, 
+        0, 1924126889, 1653592841, 712595436, 1114720233, 1924126889, 1251749276, 1425190872, 1114720233, 
+        156839371, 1171043484, 499040364, 2099181193, 610798891, 1171043484, 740754146, 608296164, 610798891, 
+        2067823641, 558457015, 2064584680, 43451492, 1971192737, 558457015, 1173994584, 812099860, 1971192737, 
+        116025045, 1346822707, 453561420, 527364711, 435678011, 1346822707, 1941437443, 743904728, 435678011, 
+        621151386, 1843931469, 1914827994, 52191821, 1539249556, 1843931469, 1643958331, 1452496481, 1539249556, 
+        2138707000, 1413142543, 639935544, 947306590, 227354251, 1413142543, 1906761699, 1012981194, 227354251, 
+        2103341706, 128484366, 121565844, 649608347, 576852484, 128484366, 1542097685, 708579549, 576852484, 
+        1411023587, 1060374612, 956150377, 936830754, 1853292988, 1060374612, 1496855187, 1291223334, 1853292988, 
+        1958274630, 1627192017, 88402169, 666461566, 855345339, 1627192017, 1601856434, 1546249211, 855345339, 
+        828831042, 1469438198, 1979088959, 1899405365, 1096937602, 1469438198, 578966606, 786590498, 1096937602, 
+        
+    };
+
+static const unsigned long long h_31k3p_A1P134[MRG313P_N] = 
+    {
+        102237247, 828554832, 1143731069, 1512419905, 1702500920, 828554832, 1656874625, 1849582496, 1702500920, 
+        765993804, 770918242, 575939555, 1281758597, 645483870, 770918242, 664205456, 620564265, 645483870, 
+        307717124, 1198818281, 1792586313, 1462884148, 617402461, 1198818281, 28735665, 1368756598, 617402461, 
+        803138895, 384964382, 614575463, 1970823435, 162610726, 384964382, 268281397, 1023662615, 162610726, 
+        896994421, 2090054205, 1381578739, 2129998277, 845166865, 2090054205, 1181536570, 242449311, 845166865, 
+        254012310, 509978839, 1796261914, 1937036677, 366572538, 509978839, 1362760821, 692324442, 366572538, 
+        2111868835, 296613425, 277723253, 1466561285, 455661184, 296613425, 1755909826, 1672661504, 455661184, 
+        606472042, 562526511, 1731447514, 18430018, 1524212047, 562526511, 1698959568, 1290402814, 1524212047, 
+        646236129, 1597450376, 47162608, 1789009138, 1652961203, 1597450376, 2060152039, 215070855, 1652961203, 
+        865722141, 696542619, 71313185, 609466277, 2078015280, 696542619, 1807168324, 187202008, 2078015280, 
+        1978416087, 1540730869, 63309908, 1724527191, 183377628, 1540730869, 1185786577, 1681399087, 183377628, 
+        925130648, 1325132980, 339734121, 876028669, 1366196111, 1325132980, 1290946307, 1633591539, 1366196111, 
+        214818437, 2133229752, 7948648, 1025375592, 1724783401, 2133229752, 308731192, 1801293992, 1724783401, 
+        1485136643, 363750817, 2061668273, 1814718636, 1157813323, 363750817, 1826698806, 1416970207, 1157813323, 
+        2131054317, 1172406852, 1426853685, 1528015370, 1282397429, 1172406852, 916628618, 1815517899, 1282397429, 
+        1506700134, 1960200740, 1209626772, 1423031004, 2129819678, 1960200740, 1610308761, 1577854465, 2129819678, 
+        769959675, 1708049365, 425164493, 1159128422, 1630622394, 1708049365, 1295036091, 982109384, 1630622394, 
+        504975057, 1940157879, 787148714, 610452697, 145802313, 1940157879, 1172263339, 308057876, 145802313, 
+        991210125, 2087511692, 1964303825, 2139606726, 797914368, 2087511692, 853552393, 583402810, 797914368, 
+        1946334206, 541736582, 1594166893, 1636582732, 259143302, 541736582, 1164542374, 52193900, 259143302, 
+        960151042, 380019189, 212304412, 1617465384, 1078006211, 380019189, 1777835147, 1572070265, 1078006211, 
+        653956479, 281606920, 180784926, 1846418984, 1853880518, 281606920, 1967554328, 806781606, 1853880518, 
+        1587101226, 551715798, 1990514045, 1225757812, 1041535125, 551715798, 304377591, 1050674614, 1041535125, 
+        1435202391, 1987881783, 1034446472, 299608774, 2007648138, 1987881783, 886196014, 1607919899, 2007648138, 
+        788841984, 356512369, 33250922, 2141885291, 1233503151, 356512369, 892939014, 469054309, 1233503151, 
+        1422096882, 1648252672, 1042088829, 1285472827, 874678388, 1648252672, 23713635, 214950247, 874678388, 
+        656029879, 1721716023, 1397449316, 2029819063, 1078189672, 1721716023, 910551326, 1190126686, 1078189672, 
+        519979488, 639660086, 601265364, 253820664, 1410346282, 639660086, 911772508, 481562416, 1410346282, 
+        2029813495, 1026747356, 1120085706, 609651725, 731766923, 1026747356, 1453906457, 460662147, 731766923, 
+        458190290, 260687447, 1448966402, 85588569, 1543150734, 260687447, 1416425958, 451002172, 1543150734, 
+        1375017592, 639697489, 1501814947, 460599933, 2061622376, 639697489, 916597495, 801587966, 2061622376, 
+        835563796, 1270361954, 2030482250, 2086688963, 76166254, 1270361954, 667934894, 1426470107, 76166254, 
+        1471666195, 396699230, 1874865881, 1339530185, 238008363, 396699230, 1782076789, 1734569564, 238008363, 
+        2027330179, 1805240935, 1240887723, 1160726389, 1673237948, 1805240935, 947846739, 1596265562, 1673237948, 
+        1733629950, 1479278255, 864592395, 2010752958, 1781455951, 1479278255, 1848333959, 600161726, 1781455951, 
+        196661962, 398622196, 242006792, 1154105110, 1304430887, 398622196, 2030139403, 1104552021, 1304430887, 
+        1527271306, 2020240256, 375546022, 1200796604, 76775611, 2020240256, 765471737, 667871474, 76775611, 
+        1096892474, 1134067588, 1253134865, 593124060, 1170643171, 1134067588, 265830856, 75245340, 1170643171, 
+        526445385, 1922614678, 1930596721, 2086357604, 2077914257, 1922614678, 1056674057, 1645516487, 2077914257, 
+        93642908, 2040467937, 379236419, 1676857817, 375401972, 2040467937, 1227358939, 1550819682, 375401972, 
+        232840996, 264979615, 1325589187, 1349797010, 1053319317, 264979615, 1970115630, 2017208884, 1053319317, 
+        256014829, 1474965629, 527617366, 1490647157, 1691497299, 1474965629, 1292005205, 2017815949, 1691497299, 
+        1737743605, 1949461875, 1892201859, 1428387700, 1217151312, 1949461875, 224995176, 840798379, 1217151312, 
+        257826029, 651680494, 1478568101, 1756724093, 952774017, 651680494, 314921493, 608757611, 952774017, 
+        409891068, 1309337814, 306010275, 820619829, 1094160296, 1309337814, 1400853540, 1720758185, 1094160296, 
+        772341819, 1825466063, 2094462794, 1750244551, 13069239, 1825466063, 1409404604, 474547195, 13069239, 
+        1021083206, 627809515, 1699049246, 134020740, 76488958, 627809515, 1530532496, 1120908370, 76488958, 
+        590939492, 669094268, 1330863964, 2030243243, 2053156627, 669094268, 413814692, 1477901940, 2053156627, 
+        1690675511, 121663542, 763903604, 1906800801, 31223127, 121663542, 662211389, 2133530841, 31223127, 
+        1298806606, 812629275, 426987180, 1394255045, 2021060853, 812629275, 1749961419, 435346596, 2021060853, 
+        1409381719, 2124539952, 292274947, 1196246164, 348793657, 2124539952, 1335230639, 1401722248, 348793657, 
+        941294890, 363918986, 744648143, 1570329979, 737228385, 363918986, 1848392607, 2371063, 737228385, 
+        0, 683794320, 0, 0, 0, 683794320, 162637753, 1679057135, 0, 
+        0, 0, 1733722719, 311931463, 401845057, 0, 0, 311931463, 401845057, 
+        0, 1924126889, 1653592841, 712595436, 1114720233, 1924126889, 1251749276, 1425190872, 1114720233, 
+        156839371, 1171043484, 499040364, 2099181193, 610798891, 1171043484, 740754146, 608296164, 610798891, 
+        2067823641, 558457015, 2064584680, 43451492, 1971192737, 558457015, 1173994584, 812099860, 1971192737, 
+        116025045, 1346822707, 453561420, 527364711, 435678011, 1346822707, 1941437443, 743904728, 435678011, 
+        621151386, 1843931469, 1914827994, 52191821, 1539249556, 1843931469, 1643958331, 1452496481, 1539249556, 
+        2138707000, 1413142543, 639935544, 947306590, 227354251, 1413142543, 1906761699, 1012981194, 227354251, 
+        2103341706, 128484366, 121565844, 649608347, 576852484, 128484366, 1542097685, 708579549, 576852484, 
+        1411023587, 1060374612, 956150377, 936830754, 1853292988, 1060374612, 1496855187, 1291223334, 1853292988, 
+        1958274630, 1627192017, 88402169, 666461566, 855345339, 1627192017, 1601856434, 1546249211, 855345339, 
+        828831042, 1469438198, 1979088959, 1899405365, 1096937602, 1469438198, 578966606, 786590498, 1096937602, 
+        
+    };
+
+static const __constant__ unsigned long long d_31k3p_A2P134[MRG313P_N] = 
+    {
+        1431130166, 1178684362, 1401213391, 1464208080, 1431130166, 1241679051, 607337906, 1464208080, 796789021, 
+        1370017681, 1155666658, 586645827, 1859560334, 1370017681, 281118586, 1507943303, 1859560334, 449379819, 
+        1683576802, 965279267, 659653144, 1963018101, 1683576802, 121181645, 343016434, 1963018101, 1905411591, 
+        547080895, 1813170690, 1469275547, 579378463, 547080895, 923273606, 1299982062, 579378463, 923789351, 
+        1645300628, 1230857558, 421282912, 1130285516, 1645300628, 1939860162, 237847599, 1130285516, 2090750644, 
+        1886478959, 617935832, 819379249, 513985244, 1886478959, 312541827, 434089712, 513985244, 2008026844, 
+        1847875345, 1381583354, 1948301741, 1984739738, 1847875345, 1418021351, 346366517, 1984739738, 776220511, 
+        247645845, 434395207, 2052114933, 111040671, 247645845, 640783524, 2093663073, 111040671, 1700525394, 
+        1125948697, 232680739, 1722880835, 290880205, 1125948697, 948142688, 199150100, 290880205, 376956109, 
+        510016459, 2084583828, 1721382636, 588036491, 510016459, 951237683, 688300042, 588036491, 247078818, 
+        1928005687, 1150476669, 1749832311, 856677280, 1928005687, 257321638, 1234670468, 856677280, 757891938, 
+        1319390754, 547462804, 947038455, 521402766, 1319390754, 121827115, 19797074, 521402766, 1217360713, 
+        866373543, 1292015357, 1779472094, 1469640699, 866373543, 982183962, 1164579305, 1469640699, 1048768886, 
+        525111636, 820456512, 1720397448, 516349604, 525111636, 1763871247, 1341579158, 516349604, 102819547, 
+        1934420248, 454168111, 934400507, 848762501, 1934420248, 368530105, 1180929028, 848762501, 599356592, 
+        208328819, 652304983, 413622556, 1361201495, 208328819, 1599883922, 592298891, 1361201495, 1348206367, 
+        1312445885, 897455363, 1708497864, 1417070886, 1312445885, 606028385, 1357680052, 1417070886, 2064097552, 
+        921192574, 293578012, 1785648525, 2003625712, 921192574, 511555199, 59424357, 2003625712, 469061732, 
+        1966582312, 1936444732, 156855701, 1126514522, 1966582312, 758640974, 879262502, 1126514522, 2087203840, 
+        1726153568, 1281623208, 2042540727, 2050883370, 1726153568, 1289965851, 237566383, 2050883370, 673754100, 
+        276546076, 903528471, 215493282, 642398106, 276546076, 1330433295, 1330827576, 642398106, 276940357, 
+        275844141, 461075138, 1942292534, 488130244, 275844141, 1154375427, 175038278, 488130244, 1443969571, 
+        1658748191, 43281146, 499722452, 1002864713, 1658748191, 546423407, 205640281, 1002864713, 1317965065, 
+        234599023, 1348733313, 1884846131, 1351632120, 234599023, 815519302, 727674162, 1351632120, 146753883, 
+        683248980, 523574641, 781723214, 1354357254, 683248980, 1096208681, 1055708756, 1354357254, 642749055, 
+        1992916504, 1773802580, 527572287, 942511753, 1992916504, 41279467, 1932891932, 942511753, 1737066390, 
+        727543826, 939918257, 1093306140, 430696203, 727543826, 277308320, 1202166331, 430696203, 1652401837, 
+        41186257, 1221965078, 1607117043, 1393557250, 41186257, 1008405285, 1426081092, 1393557250, 458862064, 
+        328668658, 503866845, 1655163813, 1748092973, 328668658, 596796005, 1614043471, 1748092973, 1345916124, 
+        1559622426, 407649922, 963798460, 2127048966, 1559622426, 1570900428, 10643923, 2127048966, 2146828500, 
+        583235664, 662093709, 1479940899, 35897774, 583235664, 1365513163, 1970542303, 35897774, 1188264804, 
+        1173480671, 284241421, 1277600139, 895977286, 1173480671, 2050081147, 37247186, 895977286, 1308109289, 
+        1080033399, 230214451, 401912906, 2043482286, 1080033399, 1871783831, 658176641, 2043482286, 2013888788, 
+        961706715, 652578229, 1195401760, 255369901, 961706715, 1860008949, 1350332603, 255369901, 452030369, 
+        449281688, 137586385, 1574920235, 740482187, 449281688, 1450610916, 984920239, 740482187, 2131053590, 
+        1932152242, 556119073, 1002347892, 497927143, 1932152242, 51698324, 1901866904, 497927143, 1634858243, 
+        2043517772, 1419075454, 655613324, 577373840, 2043517772, 1340835970, 769534590, 577373840, 1472216392, 
+        1708874033, 1253175942, 1336633796, 506099840, 1708874033, 422641986, 569067263, 506099840, 1855299310, 
+        1571790153, 655582529, 670676362, 261672892, 1571790153, 246579059, 1394962173, 261672892, 572710688, 
+        218800583, 2112384300, 436735778, 704082826, 218800583, 232268769, 607911385, 704082826, 594443199, 
+        79410394, 1336143299, 2011893649, 641808781, 79410394, 2113521010, 154341361, 641808781, 267693324, 
+        943133393, 1568865996, 77451914, 1868464067, 943133393, 1212415570, 1588101830, 1868464067, 1318819653, 
+        1738144987, 1658603292, 1655902374, 180447434, 1738144987, 183148352, 1577900962, 180447434, 985435018, 
+        410014004, 73387925, 82459631, 611723857, 410014004, 602652151, 242459635, 611723857, 49821488, 
+        796191947, 1704189630, 1886773167, 74797434, 796191947, 2039676476, 533133248, 74797434, 1437111298, 
+        1283725929, 539651165, 2060960811, 74168688, 1283725929, 700321621, 1054079355, 74168688, 1637483663, 
+        1970136332, 2082550624, 420940767, 655848906, 1970136332, 169996184, 87023570, 655848906, 1887163718, 
+        203308479, 1393513714, 1713948855, 1801200908, 203308479, 1480765767, 1296446318, 1801200908, 18989030, 
+        528657125, 463916803, 184581514, 1297009802, 528657125, 1576345091, 187411713, 1297009802, 1287186326, 
+        437860824, 1799758446, 1930908628, 1107403276, 437860824, 976253094, 87597923, 1107403276, 1696668232, 
+        436158870, 1425946396, 2051989542, 297028150, 436158870, 1818447583, 917205235, 297028150, 1682379101, 
+        1235082597, 1717576004, 973776701, 542253708, 1235082597, 1286053011, 865467163, 542253708, 814496749, 
+        659028730, 436562121, 1576361510, 725445924, 659028730, 1733109114, 457192432, 725445924, 1530574627, 
+        1918839576, 2006204383, 1609385463, 566221965, 1918839576, 963040885, 924162160, 566221965, 1879960851, 
+        1851778774, 359191535, 458053542, 1340553167, 1851778774, 1241691160, 1004137727, 1340553167, 1614225341, 
+        785337752, 1465573754, 768798741, 882429580, 785337752, 1579204593, 1549541854, 882429580, 755675013, 
+        1798956443, 429030009, 1731012316, 466021298, 1798956443, 1311501570, 1573816382, 466021298, 2061271255, 
+        288101813, 74480404, 514518411, 525102330, 288101813, 85064323, 66372845, 525102330, 269410335, 
+        30390893, 1328611500, 554252338, 1203833319, 30390893, 1978192481, 84000195, 1203833319, 283661186, 
+        7513244, 338794398, 176426220, 341540512, 7513244, 503908690, 744092679, 341540512, 247697233, 
+        1392809121, 246382646, 2110151132, 1394863287, 1392809121, 1678557380, 1687749293, 1394863287, 1402001034, 
+        1180626410, 946920610, 1908070020, 26035216, 1180626410, 1212348385, 1533979144, 26035216, 1502257169, 
+        1783869700, 976073046, 1123436733, 2094774459, 1783869700, 1947410772, 705590104, 2094774459, 542049032, 
+        2124740898, 496048166, 1786241326, 2101958470, 2124740898, 811765310, 118477317, 2101958470, 1431452905, 
+        
+    };
+
+static const unsigned long long h_31k3p_A2P134[MRG313P_N] = 
+    {
+        1431130166, 1178684362, 1401213391, 1464208080, 1431130166, 1241679051, 607337906, 1464208080, 796789021, 
+        1370017681, 1155666658, 586645827, 1859560334, 1370017681, 281118586, 1507943303, 1859560334, 449379819, 
+        1683576802, 965279267, 659653144, 1963018101, 1683576802, 121181645, 343016434, 1963018101, 1905411591, 
+        547080895, 1813170690, 1469275547, 579378463, 547080895, 923273606, 1299982062, 579378463, 923789351, 
+        1645300628, 1230857558, 421282912, 1130285516, 1645300628, 1939860162, 237847599, 1130285516, 2090750644, 
+        1886478959, 617935832, 819379249, 513985244, 1886478959, 312541827, 434089712, 513985244, 2008026844, 
+        1847875345, 1381583354, 1948301741, 1984739738, 1847875345, 1418021351, 346366517, 1984739738, 776220511, 
+        247645845, 434395207, 2052114933, 111040671, 247645845, 640783524, 2093663073, 111040671, 1700525394, 
+        1125948697, 232680739, 1722880835, 290880205, 1125948697, 948142688, 199150100, 290880205, 376956109, 
+        510016459, 2084583828, 1721382636, 588036491, 510016459, 951237683, 688300042, 588036491, 247078818, 
+        1928005687, 1150476669, 1749832311, 856677280, 1928005687, 257321638, 1234670468, 856677280, 757891938, 
+        1319390754, 547462804, 947038455, 521402766, 1319390754, 121827115, 19797074, 521402766, 1217360713, 
+        866373543, 1292015357, 1779472094, 1469640699, 866373543, 982183962, 1164579305, 1469640699, 1048768886, 
+        525111636, 820456512, 1720397448, 516349604, 525111636, 1763871247, 1341579158, 516349604, 102819547, 
+        1934420248, 454168111, 934400507, 848762501, 1934420248, 368530105, 1180929028, 848762501, 599356592, 
+        208328819, 652304983, 413622556, 1361201495, 208328819, 1599883922, 592298891, 1361201495, 1348206367, 
+        1312445885, 897455363, 1708497864, 1417070886, 1312445885, 606028385, 1357680052, 1417070886, 2064097552, 
+        921192574, 293578012, 1785648525, 2003625712, 921192574, 511555199, 59424357, 2003625712, 469061732, 
+        1966582312, 1936444732, 156855701, 1126514522, 1966582312, 758640974, 879262502, 1126514522, 2087203840, 
+        1726153568, 1281623208, 2042540727, 2050883370, 1726153568, 1289965851, 237566383, 2050883370, 673754100, 
+        276546076, 903528471, 215493282, 642398106, 276546076, 1330433295, 1330827576, 642398106, 276940357, 
+        275844141, 461075138, 1942292534, 488130244, 275844141, 1154375427, 175038278, 488130244, 1443969571, 
+        1658748191, 43281146, 499722452, 1002864713, 1658748191, 546423407, 205640281, 1002864713, 1317965065, 
+        234599023, 1348733313, 1884846131, 1351632120, 234599023, 815519302, 727674162, 1351632120, 146753883, 
+        683248980, 523574641, 781723214, 1354357254, 683248980, 1096208681, 1055708756, 1354357254, 642749055, 
+        1992916504, 1773802580, 527572287, 942511753, 1992916504, 41279467, 1932891932, 942511753, 1737066390, 
+        727543826, 939918257, 1093306140, 430696203, 727543826, 277308320, 1202166331, 430696203, 1652401837, 
+        41186257, 1221965078, 1607117043, 1393557250, 41186257, 1008405285, 1426081092, 1393557250, 458862064, 
+        328668658, 503866845, 1655163813, 1748092973, 328668658, 596796005, 1614043471, 1748092973, 1345916124, 
+        1559622426, 407649922, 963798460, 2127048966, 1559622426, 1570900428, 10643923, 2127048966, 2146828500, 
+        583235664, 662093709, 1479940899, 35897774, 583235664, 1365513163, 1970542303, 35897774, 1188264804, 
+        1173480671, 284241421, 1277600139, 895977286, 1173480671, 2050081147, 37247186, 895977286, 1308109289, 
+        1080033399, 230214451, 401912906, 2043482286, 1080033399, 1871783831, 658176641, 2043482286, 2013888788, 
+        961706715, 652578229, 1195401760, 255369901, 961706715, 1860008949, 1350332603, 255369901, 452030369, 
+        449281688, 137586385, 1574920235, 740482187, 449281688, 1450610916, 984920239, 740482187, 2131053590, 
+        1932152242, 556119073, 1002347892, 497927143, 1932152242, 51698324, 1901866904, 497927143, 1634858243, 
+        2043517772, 1419075454, 655613324, 577373840, 2043517772, 1340835970, 769534590, 577373840, 1472216392, 
+        1708874033, 1253175942, 1336633796, 506099840, 1708874033, 422641986, 569067263, 506099840, 1855299310, 
+        1571790153, 655582529, 670676362, 261672892, 1571790153, 246579059, 1394962173, 261672892, 572710688, 
+        218800583, 2112384300, 436735778, 704082826, 218800583, 232268769, 607911385, 704082826, 594443199, 
+        79410394, 1336143299, 2011893649, 641808781, 79410394, 2113521010, 154341361, 641808781, 267693324, 
+        943133393, 1568865996, 77451914, 1868464067, 943133393, 1212415570, 1588101830, 1868464067, 1318819653, 
+        1738144987, 1658603292, 1655902374, 180447434, 1738144987, 183148352, 1577900962, 180447434, 985435018, 
+        410014004, 73387925, 82459631, 611723857, 410014004, 602652151, 242459635, 611723857, 49821488, 
+        796191947, 1704189630, 1886773167, 74797434, 796191947, 2039676476, 533133248, 74797434, 1437111298, 
+        1283725929, 539651165, 2060960811, 74168688, 1283725929, 700321621, 1054079355, 74168688, 1637483663, 
+        1970136332, 2082550624, 420940767, 655848906, 1970136332, 169996184, 87023570, 655848906, 1887163718, 
+        203308479, 1393513714, 1713948855, 1801200908, 203308479, 1480765767, 1296446318, 1801200908, 18989030, 
+        528657125, 463916803, 184581514, 1297009802, 528657125, 1576345091, 187411713, 1297009802, 1287186326, 
+        437860824, 1799758446, 1930908628, 1107403276, 437860824, 976253094, 87597923, 1107403276, 1696668232, 
+        436158870, 1425946396, 2051989542, 297028150, 436158870, 1818447583, 917205235, 297028150, 1682379101, 
+        1235082597, 1717576004, 973776701, 542253708, 1235082597, 1286053011, 865467163, 542253708, 814496749, 
+        659028730, 436562121, 1576361510, 725445924, 659028730, 1733109114, 457192432, 725445924, 1530574627, 
+        1918839576, 2006204383, 1609385463, 566221965, 1918839576, 963040885, 924162160, 566221965, 1879960851, 
+        1851778774, 359191535, 458053542, 1340553167, 1851778774, 1241691160, 1004137727, 1340553167, 1614225341, 
+        785337752, 1465573754, 768798741, 882429580, 785337752, 1579204593, 1549541854, 882429580, 755675013, 
+        1798956443, 429030009, 1731012316, 466021298, 1798956443, 1311501570, 1573816382, 466021298, 2061271255, 
+        288101813, 74480404, 514518411, 525102330, 288101813, 85064323, 66372845, 525102330, 269410335, 
+        30390893, 1328611500, 554252338, 1203833319, 30390893, 1978192481, 84000195, 1203833319, 283661186, 
+        7513244, 338794398, 176426220, 341540512, 7513244, 503908690, 744092679, 341540512, 247697233, 
+        1392809121, 246382646, 2110151132, 1394863287, 1392809121, 1678557380, 1687749293, 1394863287, 1402001034, 
+        1180626410, 946920610, 1908070020, 26035216, 1180626410, 1212348385, 1533979144, 26035216, 1502257169, 
+        1783869700, 976073046, 1123436733, 2094774459, 1783869700, 1947410772, 705590104, 2094774459, 542049032, 
+        2124740898, 496048166, 1786241326, 2101958470, 2124740898, 811765310, 118477317, 2101958470, 1431452905, 
+        
+    };
+
+
+#endif // ROCRAND_MRG31K3P_PRECOMPUTED_H_
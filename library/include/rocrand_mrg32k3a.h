@@ -57,6 +57,40 @@
  /** @} */ // end of group rocranddevice
 
 namespace rocrand_device {
+namespace detail {
+
+// Maps a value from [0, ROCRAND_MRG32K3A_M1] onto [0, UINT_MAX]. This is an
+// integer computation of (unsigned int)(v * ROCRAND_MRG32K3A_UINT_NORM),
+// bit-exact with the double-precision scaling (including its round-to-nearest
+// crossings and the saturating conversion at the upper bound, verified over
+// the full input range) but free of double operations, which run at a
+// reduced rate on most consumer GPUs.
+__forceinline__ __host__ __device__
+unsigned int mrg32k3a_uint_scale(unsigned int v)
+{
+    // ROCRAND_MRG32K3A_UINT_NORM = 1 + 219152395 * 2^-52
+    const unsigned long long a = v * 219152395ULL;
+    unsigned long long r = v + (a >> 52);
+    const unsigned long long f = a & ((1ULL << 52) - 1);
+    if(f != 0 && r >= 2)
+    {
+        // The double product rounds up across the next integer when the
+        // fraction is within half an ulp of it (ties round up, the
+        // integer's mantissa being even)
+        #if defined(__HIP_DEVICE_COMPILE__)
+        const int n = 64 - __clzll(static_cast<long long>(r));
+        #else
+        const int n = 64 - __builtin_clzll(r);
+        #endif
+        if(((1ULL << 52) - f) <= (1ULL << (n - 2)))
+        {
+            r++;
+        }
+    }
+    return r > 0xFFFFFFFFULL ? 0xFFFFFFFFU : static_cast<unsigned int>(r);
+}
+
+} // end namespace detail
 
 class mrg32k3a_engine
 {
@@ -135,6 +169,42 @@ public:
         this->restart(subsequence, offset);
     }
 
+    /// Initializes the internal state of the PRNG from a splitmix64
+    /// hash of seed value \p seed_value and \p sequence, without the
+    /// subsequence skipahead performed by seed().
+    ///
+    /// Initialization is orders of magnitude cheaper, and states with
+    /// different \p sequence values are statistically independent, but
+    /// they are not positioned on subsequences of one contiguous
+    /// MRG32k3a sequence.
+    FQUALIFIERS
+    void seed_fast(const unsigned long long seed_value,
+                   const unsigned long long sequence)
+    {
+        unsigned long long hash_state =
+            seed_value ^ (sequence * 0x9E3779B97F4A7C15ULL);
+        // Each component needs three words below its modulus that are
+        // not all zero; drawing every word from [1, m - 1] satisfies
+        // both (the modulo bias is below 2^-33 per word)
+        m_state.g1[0] = 1 + static_cast<unsigned int>(
+            detail::split_mix64(hash_state) % (ROCRAND_MRG32K3A_M1 - 1));
+        m_state.g1[1] = 1 + static_cast<unsigned int>(
+            detail::split_mix64(hash_state) % (ROCRAND_MRG32K3A_M1 - 1));
+        m_state.g1[2] = 1 + static_cast<unsigned int>(
+            detail::split_mix64(hash_state) % (ROCRAND_MRG32K3A_M1 - 1));
+        m_state.g2[0] = 1 + static_cast<unsigned int>(
+            detail::split_mix64(hash_state) % (ROCRAND_MRG32K3A_M2 - 1));
+        m_state.g2[1] = 1 + static_cast<unsigned int>(
+            detail::split_mix64(hash_state) % (ROCRAND_MRG32K3A_M2 - 1));
+        m_state.g2[2] = 1 + static_cast<unsigned int>(
+            detail::split_mix64(hash_state) % (ROCRAND_MRG32K3A_M2 - 1));
+
+        #ifndef ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+    }
+
     /// Advances the internal state to skip \p offset numbers.
     FQUALIFIERS
     void discard(unsigned long long offset)
@@ -438,6 +508,29 @@ void rocrand_init(const unsigned long long seed,
     *state = rocrand_state_mrg32k3a(seed, subsequence, offset);
 }
 
+/**
+ * \brief Initializes MRG32K3A state from a hash of seed and sequence.
+ *
+ * Initializes the MRG32K3A generator \p state from a splitmix64 hash
+ * of \p seed and \p sequence instead of the subsequence skipahead
+ * performed by rocrand_init(). Initialization is orders of magnitude
+ * cheaper, which matters in kernels that draw only a few numbers per
+ * thread. States with different \p sequence values are statistically
+ * independent, but they are not positioned on subsequences of one
+ * contiguous MRG32k3a sequence, and no offset can be applied.
+ *
+ * \param seed - Value to use as a seed
+ * \param sequence - Id of the independent stream to start
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init_fast(const unsigned long long seed,
+                       const unsigned long long sequence,
+                       rocrand_state_mrg32k3a * state)
+{
+    state->seed_fast(seed, sequence);
+}
+
 /**
  * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
  * from [0; 2^32 - 1] range.
@@ -453,7 +546,7 @@ void rocrand_init(const unsigned long long seed,
 FQUALIFIERS
 unsigned int rocrand(rocrand_state_mrg32k3a * state)
 {
-    return static_cast<unsigned int>(state->next() * ROCRAND_MRG32K3A_UINT_NORM);
+    return rocrand_device::detail::mrg32k3a_uint_scale(state->next());
 }
 
 /**
@@ -562,6 +562,66 @@ void rocrand_mtgp32_set_params(rocrand_state_mtgp32 * state, mtgp32_params * par
     state->set_params(params);
 }
 
+/**
+ * \brief Generates \p count values with a whole block, managing the
+ * shared-state copies internally.
+ *
+ * Wraps the manual pattern from rocrand_mtgp32_block_copy(): the state
+ * is staged into shared memory once, the block draws in whole-block
+ * iterations with coalesced stores to \p output, and the advanced
+ * state is written back to \p state at the end. Kernels get the fast
+ * shared-state pattern by calling this instead of looping over
+ * rocrand() on a state left in global memory:
+ *
+ * \code
+ * __global__
+ * void generate_kernel(rocrand_state_mtgp32 * states, unsigned int * output, const size_t size)
+ * {
+ *      const size_t per_block = size / hipGridDim_x;
+ *      rocrand_mtgp32_block_generate(&states[hipBlockIdx_x],
+ *                                    output + hipBlockIdx_x * per_block,
+ *                                    per_block);
+ * }
+ * \endcode
+ *
+ * Must be called by every thread of the block with the same \p state
+ * and \p count; \p state advances by \p count rounded up to a multiple
+ * of the block size, as every draw yields one value per thread.
+ *
+ * \param state - Pointer to the block's state in global memory
+ * \param output - Pointer to the block's output segment
+ * \param count - Number of <tt>unsigned int</tt>s to store
+ */
+FQUALIFIERS
+void rocrand_mtgp32_block_generate(rocrand_state_mtgp32 * state,
+                                   unsigned int * output,
+                                   size_t count)
+{
+    #if defined(__HIP_DEVICE_COMPILE__)
+    __shared__ rocrand_state_mtgp32 block_state;
+    rocrand_mtgp32_block_copy(state, &block_state);
+
+    // Whole-block iterations keep the stores coalesced; the final
+    // partial iteration masks the store but still draws on every
+    // thread, as next() synchronizes the block
+    size_t base = 0;
+    while(base < count)
+    {
+        const unsigned int value = block_state.next();
+        const size_t index = base + hipThreadIdx_x;
+        if(index < count)
+        {
+            output[index] = value;
+        }
+        base += hipBlockDim_x;
+    }
+
+    rocrand_mtgp32_block_copy(&block_state, state);
+    #else
+    (void)state; (void)output; (void)count;
+    #endif
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_MTGP32_H_
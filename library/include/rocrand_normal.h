@@ -34,11 +34,14 @@
 
 #include "rocrand_philox4x32_10.h"
 #include "rocrand_mrg32k3a.h"
+#include "rocrand_mrg31k3p.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
+#include "rocrand_ziggurat_precomputed.h"
 
 namespace rocrand_device {
 namespace detail {
@@ -84,6 +87,59 @@ double2 box_muller_double(uint4 v)
     return result;
 }
 
+// Hybrid-precision variant of box_muller_double: the two uniforms are
+// built with the full 53-bit mantissa granularity of the draws, but the
+// transcendentals (log, sqrt, sin, cos) are evaluated in single
+// precision. Keeping the 53-bit uniforms preserves the tail range of
+// the distribution (values out to ~8.5 sigma, where a 24-bit uniform
+// stops near 6.6 sigma); the float transcendentals limit the accuracy
+// of each value to roughly single precision. Intended for GPUs with a
+// reduced double-precision rate.
+FQUALIFIERS
+double2 box_muller_double_fast(uint4 v)
+{
+    double2 result;
+    unsigned long long v1 = (unsigned long long)v.x ^
+        ((unsigned long long)v.y << (53 - 32));
+    double u = ROCRAND_2POW53_INV_DOUBLE + (v1 * ROCRAND_2POW53_INV_DOUBLE);
+    unsigned long long v2 = (unsigned long long)v.z ^
+        ((unsigned long long)v.w << (53 - 32));
+    double w = (ROCRAND_2POW53_INV_DOUBLE * 2.0) +
+        (v2 * (ROCRAND_2POW53_INV_DOUBLE * 2.0));
+    float s = sqrtf(-2.0f * logf(static_cast<float>(u)));
+    float sw, cw;
+    #ifdef __HIP_DEVICE_COMPILE__
+        __sincosf(static_cast<float>(w) * ROCRAND_PI, &sw, &cw);
+    #else
+        sw = sinf(static_cast<float>(w) * ROCRAND_PI);
+        cw = cosf(static_cast<float>(w) * ROCRAND_PI);
+    #endif
+    result.x = static_cast<double>(s * sw);
+    result.y = static_cast<double>(s * cw);
+    return result;
+}
+
+// 16-bit variant of box_muller for packed half-precision output:
+// the two halves of one 32-bit draw feed the transform. The result is
+// computed in float and converted by the callers.
+FQUALIFIERS
+float2 box_muller_half(unsigned short x, unsigned short y)
+{
+    float2 result;
+    float u = ROCRAND_2POW16_INV + (x * ROCRAND_2POW16_INV);
+    float v = ROCRAND_2POW16_INV_2PI + (y * ROCRAND_2POW16_INV_2PI);
+    float s = sqrtf(-2.0f * logf(u));
+    #ifdef __HIP_DEVICE_COMPILE__
+        __sincosf(v, &result.x, &result.y);
+        result.x *= s;
+        result.y *= s;
+    #else
+        result.x = sinf(v) * s;
+        result.y = cosf(v) * s;
+    #endif
+    return result;
+}
+
 FQUALIFIERS
 float2 mrg_box_muller(float x, float y)
 {
@@ -217,6 +273,12 @@ double2 normal_distribution_double2(uint4 v)
     return ::rocrand_device::detail::box_muller_double(v);
 }
 
+FQUALIFIERS
+double2 normal_distribution_double2_fast(uint4 v)
+{
+    return ::rocrand_device::detail::box_muller_double_fast(v);
+}
+
 FQUALIFIERS
 float2 mrg_normal_distribution2(unsigned int v1, unsigned int v2)
 {
@@ -233,6 +295,107 @@ double2 mrg_normal_distribution_double2(unsigned int v1, unsigned int v2)
     return ::rocrand_device::detail::mrg_box_muller_double(x, y);
 }
 
+FQUALIFIERS
+float2 mrg31k3p_normal_distribution2(unsigned int v1, unsigned int v2)
+{
+    float x = rocrand_device::detail::mrg31k3p_uniform_distribution(v1);
+    float y = rocrand_device::detail::mrg31k3p_uniform_distribution(v2);
+    return ::rocrand_device::detail::mrg_box_muller(x, y);
+}
+
+FQUALIFIERS
+double2 mrg31k3p_normal_distribution_double2(unsigned int v1, unsigned int v2)
+{
+    double x = rocrand_device::detail::mrg31k3p_uniform_distribution(v1);
+    double y = rocrand_device::detail::mrg31k3p_uniform_distribution(v2);
+    return ::rocrand_device::detail::mrg_box_muller_double(x, y);
+}
+
+
+// Ziggurat sampling of the standard normal distribution (Marsaglia
+// and Tsang, 2000; tables in rocrand_ziggurat_precomputed.h). One
+// 32-bit draw yields a candidate; ~98.8% of candidates are accepted
+// with just a table lookup and a multiply, so no transcendental
+// functions are evaluated on the fast path. The number of draws per
+// value varies, which makes the method unsuitable for quasi-random
+// generators.
+template<class StateType>
+FQUALIFIERS
+float normal_ziggurat(StateType * state)
+{
+    while(true)
+    {
+        const int hz = (int)rocrand(state);
+        const unsigned int iz = hz & (ZIG_NORM_N - 1);
+        const unsigned int az = (hz < 0) ? -(unsigned int)hz : (unsigned int)hz;
+        if(az < d_zig_norm_kn[iz])
+        {
+            // Candidate lies inside the rectangular part of the layer
+            return hz * d_zig_norm_wn[iz];
+        }
+        if(iz == 0)
+        {
+            // Base layer: sample the tail beyond ZIG_NORM_R
+            float x, y;
+            do
+            {
+                x = -logf(::rocrand_device::detail::uniform_distribution(rocrand(state)))
+                    * (1.0f / ZIG_NORM_R_FLOAT);
+                y = -logf(::rocrand_device::detail::uniform_distribution(rocrand(state)));
+            } while(y + y < x * x);
+            return (hz > 0) ? (ZIG_NORM_R_FLOAT + x) : -(ZIG_NORM_R_FLOAT + x);
+        }
+        // Wedge of the layer: accept against the density
+        const float x = hz * d_zig_norm_wn[iz];
+        const float u = ::rocrand_device::detail::uniform_distribution(rocrand(state));
+        if(d_zig_norm_fn[iz] + u * (d_zig_norm_fn[iz - 1] - d_zig_norm_fn[iz])
+            < expf(-0.5f * x * x))
+        {
+            return x;
+        }
+    }
+}
+
+template<class StateType>
+FQUALIFIERS
+double normal_ziggurat_double(StateType * state)
+{
+    while(true)
+    {
+        const unsigned long long v =
+            ((unsigned long long)rocrand(state) << 32) | rocrand(state);
+        const long long hz = (long long)v;
+        const unsigned int iz = (unsigned int)v & (ZIG_NORM_N - 1);
+        const unsigned long long az =
+            (hz < 0) ? -(unsigned long long)hz : (unsigned long long)hz;
+        if(az < d_zig_norm_kn_d[iz])
+        {
+            // Candidate lies inside the rectangular part of the layer
+            return hz * d_zig_norm_wn_d[iz];
+        }
+        if(iz == 0)
+        {
+            // Base layer: sample the tail beyond ZIG_NORM_R
+            double x, y;
+            do
+            {
+                x = -log(::rocrand_device::detail::uniform_distribution_double(rocrand(state)))
+                    * (1.0 / ZIG_NORM_R);
+                y = -log(::rocrand_device::detail::uniform_distribution_double(rocrand(state)));
+            } while(y + y < x * x);
+            return (hz > 0) ? (ZIG_NORM_R + x) : -(ZIG_NORM_R + x);
+        }
+        // Wedge of the layer: accept against the density
+        const double x = hz * d_zig_norm_wn_d[iz];
+        const double u = ::rocrand_device::detail::uniform_distribution_double(rocrand(state));
+        if(d_zig_norm_fn_d[iz] + u * (d_zig_norm_fn_d[iz - 1] - d_zig_norm_fn_d[iz])
+            < exp(-0.5 * x * x))
+        {
+            return x;
+        }
+    }
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -286,6 +449,29 @@ float2 rocrand_normal2(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Returns two normally distributed \p __half values.
+ *
+ * Generates and returns two normally distributed \p __half values with
+ * mean \p 0.0 and standard deviation \p 1.0, packed into a \p __half2,
+ * using Philox generator in \p state. Both values are produced from the
+ * two 16-bit halves of one 32-bit draw, so the position of the
+ * generator is incremented by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_normal_half2(rocrand_state_philox4x32_10 * state)
+{
+    const unsigned int v = rocrand(state);
+    float2 r = rocrand_device::detail::box_muller_half(
+        (unsigned short)(v), (unsigned short)(v >> 16)
+    );
+    return __halves2half2(__float2half(r.x), __float2half(r.y));
+}
+
 /**
  * \brief Returns four normally distributed \p float values.
  *
@@ -381,6 +567,253 @@ double4 rocrand_normal_double4(rocrand_state_philox4x32_10 * state)
     };
 }
 
+/**
+ * \brief Returns a normally distributed \p double value generated with
+ * a hybrid-precision transform.
+ *
+ * Behaves like rocrand_normal_double() but evaluates the transcendental
+ * functions of the Box-Muller transform (log, sqrt, sin, cos) in single
+ * precision. The uniform inputs keep full 53-bit mantissa granularity,
+ * so the distribution reaches the same tail range as the full-precision
+ * variant, while each value is accurate to roughly single precision.
+ * Substantially faster on GPUs with a reduced double-precision rate.
+ * Increments position of the generator by two.
+ *
+ * The second generated value is cached in \p state in the same slot
+ * that rocrand_normal_double() uses, so calls to the two variants on
+ * one state must not be interleaved.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double_fast(rocrand_state_philox4x32_10 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_philox4x32_10> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2_fast(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values generated
+ * with a hybrid-precision transform.
+ *
+ * Behaves like rocrand_normal_double2() but evaluates the
+ * transcendental functions of the Box-Muller transform in single
+ * precision (see rocrand_normal_double_fast()). Increments position of
+ * the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2_fast(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::normal_distribution_double2_fast(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values generated
+ * with a hybrid-precision transform.
+ *
+ * Behaves like rocrand_normal_double4() but evaluates the
+ * transcendental functions of the Box-Muller transform in single
+ * precision (see rocrand_normal_double_fast()). Increments position of
+ * the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4_fast(rocrand_state_philox4x32_10 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2_fast(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2_fast(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using ThreeFry
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_normal(rocrand_state_threefry4x32_20 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using ThreeFry
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p __half values.
+ *
+ * Generates and returns two normally distributed \p __half values with
+ * mean \p 0.0 and standard deviation \p 1.0, packed into a \p __half2,
+ * using ThreeFry generator in \p state. Both values are produced from
+ * the two 16-bit halves of one 32-bit draw, so the position of the
+ * generator is incremented by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_normal_half2(rocrand_state_threefry4x32_20 * state)
+{
+    const unsigned int v = rocrand(state);
+    float2 r = rocrand_device::detail::box_muller_half(
+        (unsigned short)(v), (unsigned short)(v >> 16)
+    );
+    return __halves2half2(__float2half(r.x), __float2half(r.y));
+}
+
+/**
+ * \brief Returns four normally distributed \p float values.
+ *
+ * Generates and returns four normally distributed \p float values using ThreeFry
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p float value as \p float4
+ */
+FQUALIFIERS
+float4 rocrand_normal4(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::normal_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using ThreeFry
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_threefry4x32_20 * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_threefry4x32_20> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using ThreeFry
+ * generator in \p state, and increments position of the generator by four.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double values as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four normally distributed \p double values.
+ *
+ * Generates and returns four normally distributed \p double values using ThreeFry
+ * generator in \p state, and increments position of the generator by eight.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate four normally
+ * distributed values, and returns them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four normally distributed \p double values as \p double4
+ */
+FQUALIFIERS
+double4 rocrand_normal_double4(rocrand_state_threefry4x32_20 * state)
+{
+    double2 r1, r2;
+    r1 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    r2 = rocrand_device::detail::normal_distribution_double2(rocrand4(state));
+    return double4 {
+        r1.x, r1.y, r2.x, r2.y
+    };
+}
+
 /**
  * \brief Returns a normally distributed \p float value.
  *
@@ -481,6 +914,106 @@ double2 rocrand_normal_double2(rocrand_state_mrg32k3a * state)
     return rocrand_device::detail::mrg_normal_distribution_double2(rocrand(state), rocrand(state));
 }
 
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using MRG31k3p
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+#ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+FQUALIFIERS
+float rocrand_normal(rocrand_state_mrg31k3p * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg31k3p> bm_helper;
+
+    if(bm_helper::has_float(state))
+    {
+        return bm_helper::get_float(state);
+    }
+    float2 r = rocrand_device::detail::mrg31k3p_normal_distribution2(state->next(), state->next());
+    bm_helper::save_float(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using MRG31k3p
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_mrg31k3p * state)
+{
+    return rocrand_device::detail::mrg31k3p_normal_distribution2(state->next(), state->next());
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using MRG31k3p
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, returns first of them, and saves the second to be returned on the next call.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+#ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_mrg31k3p * state)
+{
+    typedef rocrand_device::detail::engine_boxmuller_helper<rocrand_state_mrg31k3p> bm_helper;
+
+    if(bm_helper::has_double(state))
+    {
+        return bm_helper::get_double(state);
+    }
+    double2 r = rocrand_device::detail::mrg31k3p_normal_distribution_double2(state->next(), state->next());
+    bm_helper::save_double(state, r.y);
+    return r.x;
+}
+#endif // ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using MRG31k3p
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+FQUALIFIERS
+double2 rocrand_normal_double2(rocrand_state_mrg31k3p * state)
+{
+    return rocrand_device::detail::mrg31k3p_normal_distribution_double2(state->next(), state->next());
+}
+
 /**
  * \brief Returns a normally distributed \p float value.
  *
@@ -509,6 +1042,29 @@ float rocrand_normal(rocrand_state_xorwow * state)
     bm_helper::save_float(state, r.y);
     return r.x;
 }
+
+/**
+ * \brief Returns two normally distributed \p __half values.
+ *
+ * Generates and returns two normally distributed \p __half values with
+ * mean \p 0.0 and standard deviation \p 1.0, packed into a \p __half2,
+ * using XORWOW generator in \p state. Both values are produced from the
+ * two 16-bit halves of one 32-bit draw, so the position of the
+ * generator is incremented by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_normal_half2(rocrand_state_xorwow * state)
+{
+    const unsigned int v = rocrand(state);
+    float2 r = rocrand_device::detail::box_muller_half(
+        (unsigned short)(v), (unsigned short)(v >> 16)
+    );
+    return __halves2half2(__float2half(r.x), __float2half(r.y));
+}
 #endif // ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
 
 /**
@@ -657,6 +1213,150 @@ double rocrand_normal_double(rocrand_state_sobol32 * state)
     return rocrand_device::detail::normal_distribution_double(rocrand(state));
 }
 
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using PCG32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * PCG32 keeps no Box-Muller cache in its 8-byte state, so the value is
+ * computed with the inverse CDF from a single draw.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using PCG32
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two normally distributed \p float values as \p float2
+ */
+FQUALIFIERS
+float2 rocrand_normal2(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution2(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using PCG32
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * PCG32 keeps no Box-Muller cache in its 8-byte state, so the value is
+ * computed with the inverse CDF from a single draw.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_double(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+
+/**
+ * \brief Returns a normally distributed \p float value (ziggurat method).
+ *
+ * Generates and returns a normally distributed \p float value using Philox
+ * generator in \p state. Used normal distribution has mean value equal to
+ * 0.0f, and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method instead of the Box-Muller transform,
+ * trading table lookups for transcendental function evaluations; unlike
+ * rocrand_normal(), the number of values the generator advances by varies
+ * per call (one draw per call for ~98.8% of calls).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::normal_ziggurat(state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value (ziggurat method).
+ *
+ * Generates and returns a normally distributed \p double value using Philox
+ * generator in \p state. Used normal distribution has mean value equal to
+ * 0.0, and standard deviation equal to 1.0.
+ * The function uses the ziggurat method instead of the Box-Muller transform;
+ * unlike rocrand_normal_double(), the number of values the generator
+ * advances by varies per call (two draws per call for ~98.8% of calls).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_ziggurat_double(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::normal_ziggurat_double(state);
+}
+
+/**
+ * \brief Returns a normally distributed \p float value (ziggurat method).
+ *
+ * Generates and returns a normally distributed \p float value using XORWOW
+ * generator in \p state. Used normal distribution has mean value equal to
+ * 0.0f, and standard deviation equal to 1.0f.
+ * The function uses the ziggurat method instead of the Box-Muller transform,
+ * trading table lookups for transcendental function evaluations; unlike
+ * rocrand_normal(), the number of values the generator advances by varies
+ * per call (one draw per call for ~98.8% of calls).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+FQUALIFIERS
+float rocrand_normal_ziggurat(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_ziggurat(state);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value (ziggurat method).
+ *
+ * Generates and returns a normally distributed \p double value using XORWOW
+ * generator in \p state. Used normal distribution has mean value equal to
+ * 0.0, and standard deviation equal to 1.0.
+ * The function uses the ziggurat method instead of the Box-Muller transform;
+ * unlike rocrand_normal_double(), the number of values the generator
+ * advances by varies per call (two draws per call for ~98.8% of calls).
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+FQUALIFIERS
+double rocrand_normal_ziggurat_double(rocrand_state_xorwow * state)
+{
+    return rocrand_device::detail::normal_ziggurat_double(state);
+}
+
 #endif // ROCRAND_NORMAL_H_
 
 /** @} */ // end of group rocranddevice
@@ -0,0 +1,251 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_PCG32_H_
+#define ROCRAND_PCG32_H_
+
+#ifndef FQUALIFIERS
+#define FQUALIFIERS __forceinline__ __device__
+#endif // FQUALIFIERS_
+
+#include "rocrand_common.h"
+
+// M. E. O'Neill, PCG: A Family of Simple Fast Space-Efficient Statistically
+// Good Algorithms for Random Number Generation, 2014
+// http://www.pcg-random.org
+//
+// PCG32 (XSH RR variant) keeps its whole state in a single 64-bit word
+// and generates one 32-bit output per 64-bit multiply-add, so it is the
+// cheapest engine to embed in register-constrained kernels. Unlike
+// XORWOW and Philox it carries no Box-Muller cache; the scalar normal
+// overloads use the inverse CDF instead.
+
+#define ROCRAND_PCG32_MULTIPLIER 6364136223846793005ULL
+#define ROCRAND_PCG32_INCREMENT  1442695040888963407ULL
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+ /**
+ * \def ROCRAND_PCG32_DEFAULT_SEED
+ * \brief Default seed for PCG32 PRNG.
+ */
+#define ROCRAND_PCG32_DEFAULT_SEED 0xcafef00dd15ea5e5ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device {
+
+class pcg32_engine
+{
+public:
+    // The whole state is one 64-bit word
+    typedef unsigned long long pcg32_state;
+
+    FQUALIFIERS
+    pcg32_engine()
+    {
+        this->seed(ROCRAND_PCG32_DEFAULT_SEED, 0, 0);
+    }
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^32 numbers long.
+    FQUALIFIERS
+    pcg32_engine(const unsigned long long seed,
+                 const unsigned long long subsequence,
+                 const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    FQUALIFIERS
+    ~pcg32_engine() { }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// A subsequence is 2^32 numbers long.
+    FQUALIFIERS
+    void seed(unsigned long long seed_value,
+              const unsigned long long subsequence,
+              const unsigned long long offset)
+    {
+        m_state = 0;
+        this->discard_state();
+        m_state += seed_value;
+        this->discard_state();
+        this->discard_subsequence(subsequence);
+        this->discard(offset);
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    FQUALIFIERS
+    void discard(unsigned long long offset)
+    {
+        // O(log2(offset)) advance of the underlying LCG
+        //
+        // F. Brown, Random number generation with arbitrary strides,
+        // Transactions of the American Nuclear Society, 1994
+        unsigned long long cur_mult = ROCRAND_PCG32_MULTIPLIER;
+        unsigned long long cur_plus = ROCRAND_PCG32_INCREMENT;
+        unsigned long long acc_mult = 1;
+        unsigned long long acc_plus = 0;
+        while(offset > 0)
+        {
+            if(offset & 1)
+            {
+                acc_mult *= cur_mult;
+                acc_plus = acc_plus * cur_mult + cur_plus;
+            }
+            cur_plus = (cur_mult + 1) * cur_plus;
+            cur_mult *= cur_mult;
+            offset >>= 1;
+        }
+        m_state = acc_mult * m_state + acc_plus;
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^32 numbers long.
+    FQUALIFIERS
+    void discard_subsequence(unsigned long long subsequence)
+    {
+        // The period is 2^64, so a subsequence is simply a
+        // 2^32 elements long block of the single sequence
+        this->discard(subsequence << 32);
+    }
+
+    FQUALIFIERS
+    unsigned int operator()()
+    {
+        return this->next();
+    }
+
+    FQUALIFIERS
+    unsigned int next()
+    {
+        const unsigned long long state = m_state;
+        this->discard_state();
+        // XSH RR output function: xorshift to mix the high bits,
+        // then a random rotation chosen by the top 5 state bits
+        const unsigned int xorshifted =
+            static_cast<unsigned int>(((state >> 18) ^ state) >> 27);
+        const unsigned int rot = static_cast<unsigned int>(state >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+    }
+
+protected:
+    // Advances the internal state to the next state
+    FQUALIFIERS
+    void discard_state()
+    {
+        m_state = m_state * ROCRAND_PCG32_MULTIPLIER + ROCRAND_PCG32_INCREMENT;
+    }
+
+protected:
+    // State
+    pcg32_state m_state;
+
+}; // pcg32_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::pcg32_engine rocrand_state_pcg32;
+/// \endcond
+
+/**
+ * \brief Initializes PCG32 state.
+ *
+ * Initializes the PCG32 generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed - Value to use as a seed
+ * \param subsequence - Subsequence to start at
+ * \param offset - Absolute offset into subsequence
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_pcg32 * state)
+{
+    *state = rocrand_state_pcg32(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using PCG32 generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand(rocrand_state_pcg32 * state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p offset elements.
+ *
+ * Updates the PCG32 state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset - Number of elements to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead(unsigned long long offset, rocrand_state_pcg32 * state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates PCG32 state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the PCG32 state in \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^32 numbers long.
+ *
+ * \param subsequence - Number of subsequences to skip
+ * \param state - Pointer to state to update
+ */
+FQUALIFIERS
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_pcg32 * state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_PCG32_H_
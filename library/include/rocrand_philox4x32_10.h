@@ -90,10 +90,17 @@ unsigned int mulhilo32(unsigned int x, unsigned int y, unsigned int& z)
 
 } // end detail namespace
 
-class philox4x32_10_engine
+// Counter-based PHILOX-4x32 engine with a compile-time round count.
+// 10 rounds is the default; Random123 reports that 7 rounds already
+// pass the BigCrush battery, which makes philox4x32_engine<7> a faster
+// choice where statistical headroom is not needed.
+template<unsigned int Rounds>
+class philox4x32_engine
 {
+    static_assert(Rounds > 0 && Rounds <= 16, "Rounds must be in range (0; 16]");
+
 public:
-    struct philox4x32_10_state
+    struct philox4x32_state
     {
         uint4 counter;
         uint4 result;
@@ -113,11 +120,11 @@ public:
         #endif
 
         FQUALIFIERS
-        ~philox4x32_10_state() { }
+        ~philox4x32_state() { }
     };
 
     FQUALIFIERS
-    philox4x32_10_engine()
+    philox4x32_engine()
     {
         this->seed(ROCRAND_PHILOX4x32_DEFAULT_SEED, 0, 0);
     }
@@ -128,15 +135,15 @@ public:
     ///
     /// A subsequence is 4 * 2^64 numbers long.
     FQUALIFIERS
-    philox4x32_10_engine(const unsigned long long seed,
-                         const unsigned long long subsequence,
-                         const unsigned long long offset)
+    philox4x32_engine(const unsigned long long seed,
+                      const unsigned long long subsequence,
+                      const unsigned long long offset)
     {
         this->seed(seed, subsequence, offset);
     }
 
     FQUALIFIERS
-    ~philox4x32_10_engine() { }
+    ~philox4x32_engine() { }
 
     /// Reinitializes the internal state of the PRNG using new
     /// seed value \p seed_value, skips \p subsequence subsequences
@@ -153,12 +160,27 @@ public:
         this->restart(subsequence, offset);
     }
 
+    /// Replaces the key derived from seed value \p seed_value without
+    /// moving the counter. As Philox is counter-based, the engine keeps
+    /// its position in the output sequence but switches to the
+    /// statistically independent stream keyed by the new seed; unlike
+    /// seed() no skip-ahead has to be replayed, which makes per-shard
+    /// reseeding O(1).
+    FQUALIFIERS
+    void rekey(const unsigned long long seed_value)
+    {
+        m_state.key.x = static_cast<unsigned int>(seed_value);
+        m_state.key.y = static_cast<unsigned int>(seed_value >> 32);
+        m_state.substate = 0;
+        m_state.result = this->run_rounds(m_state.counter, m_state.key);
+    }
+
     /// Advances the internal state to skip \p offset numbers.
     FQUALIFIERS
     void discard(unsigned long long offset)
     {
         this->discard_impl(offset);
-        this->m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        this->m_state.result = this->run_rounds(m_state.counter, m_state.key);
     }
 
     /// Advances the internal state to skip \p subsequence subsequences.
@@ -167,7 +189,7 @@ public:
     void discard_subsequence(unsigned long long subsequence)
     {
         this->discard_subsequence_impl(subsequence);
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->run_rounds(m_state.counter, m_state.key);
     }
 
     FQUALIFIERS
@@ -183,7 +205,7 @@ public:
         #endif
         this->discard_subsequence_impl(subsequence);
         this->discard_impl(offset);
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->run_rounds(m_state.counter, m_state.key);
     }
 
     FQUALIFIERS
@@ -201,7 +223,7 @@ public:
         {
             m_state.substate = 0;
             this->discard_state();
-            m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+            m_state.result = this->run_rounds(m_state.counter, m_state.key);
         }
         return ret;
     }
@@ -211,7 +233,7 @@ public:
     {
         uint4 ret = m_state.result;
         this->discard_state();
-        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        m_state.result = this->run_rounds(m_state.counter, m_state.key);
         switch(m_state.substate)
         {
             case 0:
@@ -231,6 +253,29 @@ public:
         return ret;
     }
 
+    /// Computes the value for lane \p lane_id of a warp sharing this
+    /// state: the first word of the block keyed by the current counter
+    /// with the lane added to the subsequence field. Does not advance
+    /// the state; see rocrand_warp().
+    FQUALIFIERS
+    unsigned int next_lane(unsigned int lane_id)
+    {
+        uint4 counter = m_state.counter;
+        counter.z += lane_id;
+        counter.w += counter.z < m_state.counter.z ? 1 : 0;
+        return this->run_rounds(counter, m_state.key).x;
+    }
+
+    /// Advances the internal state by one block of four values without
+    /// recomputing the cached result; called from a single lane per
+    /// rocrand_warp() call, which derives values directly from the
+    /// counter and never reads the cache.
+    FQUALIFIERS
+    void discard_block()
+    {
+        this->discard_state();
+    }
+
 protected:
     // Advances the internal state to skip \p offset numbers.
     // DOES NOT CALCULATE NEW 4 UINTs (m_state.result)
@@ -284,20 +329,17 @@ protected:
         m_state.counter.w += add;
     }
 
-    // 10 Philox4x32 rounds
+    // Rounds Philox4x32 rounds; the trip count is a compile-time
+    // constant, so the loop is fully unrolled
     FQUALIFIERS
-    uint4 ten_rounds(uint4 counter, uint2 key)
+    uint4 run_rounds(uint4 counter, uint2 key)
     {
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 1
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 2
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 3
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 4
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 5
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 6
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 7
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 8
-        counter = this->single_round(counter, key); key = this->bumpkey(key); // 9
-        return this->single_round(counter, key);                        // 10
+        for(unsigned int round = 0; round < Rounds - 1; round++)
+        {
+            counter = this->single_round(counter, key);
+            key = this->bumpkey(key);
+        }
+        return this->single_round(counter, key);
     }
 
 private:
@@ -328,13 +370,15 @@ private:
 
 protected:
     // State
-    philox4x32_10_state m_state;
+    philox4x32_state m_state;
 
     #ifndef ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
-    friend struct detail::engine_boxmuller_helper<philox4x32_10_engine>;
+    friend struct detail::engine_boxmuller_helper<philox4x32_engine<Rounds> >;
     #endif
 
-}; // philox4x32_10_engine class
+}; // philox4x32_engine class
+
+typedef philox4x32_engine<10> philox4x32_10_engine;
 
 } // end namespace rocrand_device
 
@@ -403,6 +447,56 @@ uint4 rocrand4(rocrand_state_philox4x32_10 * state)
     return state->next4();
 }
 
+/**
+ * \brief Returns one uniformly distributed random <tt>unsigned int</tt>
+ * per active lane from a single warp-shared Philox state.
+ *
+ * Generates one value for every lane that executes the call from the
+ * single Philox generator in \p state, which all lanes of the warp
+ * share (typically in shared memory): each lane's value comes from the
+ * counter block keyed by (current counter, lane id), and one lane then
+ * advances the shared counter by one block. The per-lane streams are
+ * disjoint subsequences, so a lane's output does not depend on which
+ * other lanes are active. Compared with one state per thread this cuts
+ * the state memory by the warp size.
+ *
+ * All calling lanes must pass the same \p state and must belong to the
+ * same warp. The state advances by one block of four values per call
+ * and its cached result words are bypassed, so a state used with this
+ * function should not be mixed with the scalar rocrand() calls without
+ * reinitialization.
+ *
+ * \param state - Pointer to the warp-shared state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_warp(rocrand_state_philox4x32_10 * state)
+{
+#if defined(__HIP_PLATFORM_NVCC__)
+    const unsigned int lane_id = threadIdx.x & (warpSize - 1);
+    const unsigned long long active = __activemask();
+#else
+    const unsigned int lane_id = __lane_id();
+    const unsigned long long active = __ballot(1);
+#endif
+    const unsigned int value = state->next_lane(lane_id);
+    // Exactly one active lane advances the shared state; on platforms
+    // with independent thread scheduling the warp converges around the
+    // update so no lane can read a half-advanced counter
+#if defined(__HIP_PLATFORM_NVCC__)
+    __syncwarp(active);
+#endif
+    if(lane_id == static_cast<unsigned int>(__ffsll(active) - 1))
+    {
+        state->discard_block();
+    }
+#if defined(__HIP_PLATFORM_NVCC__)
+    __syncwarp(active);
+#endif
+    return value;
+}
+
 /**
  * \brief Updates Philox state to skip ahead by \p offset elements.
  *
@@ -34,8 +34,10 @@
 
 #include "rocrand_philox4x32_10.h"
 #include "rocrand_mrg32k3a.h"
+#include "rocrand_mrg31k3p.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_mtgp32.h"
 
 #include "rocrand_uniform.h"
@@ -44,9 +46,34 @@
 namespace rocrand_device {
 namespace detail {
 
+constexpr double lambda_threshold_tiny  = 10.0;
 constexpr double lambda_threshold_small = 64.0;
 constexpr double lambda_threshold_huge  = 4000.0;
 
+template<class State>
+FQUALIFIERS
+unsigned int poisson_distribution_tiny(State& state, double lambda)
+{
+    // Knuth's method on single-precision uniforms
+
+    // The product is so short that the accumulated rounding stays well
+    // below the 2^-24 resolution of the uniforms themselves, and every
+    // step consumes a single 32-bit draw instead of the two draws
+    // needed for a double
+    const float limit = expf(static_cast<float>(-lambda));
+    unsigned int k = 0;
+    float product = 1.0f;
+
+    do
+    {
+        k++;
+        product *= rocrand_uniform(state);
+    }
+    while (product > limit);
+
+    return k - 1;
+}
+
 template<class State>
 FQUALIFIERS
 unsigned int poisson_distribution_small(State& state, double lambda)
@@ -147,7 +174,11 @@ template<class State>
 FQUALIFIERS
 unsigned int poisson_distribution(State& state, double lambda)
 {
-    if (lambda < lambda_threshold_small)
+    if (lambda < lambda_threshold_tiny)
+    {
+        return poisson_distribution_tiny(state, lambda);
+    }
+    else if (lambda < lambda_threshold_small)
     {
         return poisson_distribution_small(state, lambda);
     }
@@ -257,6 +288,47 @@ uint4 rocrand_poisson4(rocrand_state_philox4x32_10 * state, double lambda)
 }
 #endif // ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using ThreeFry generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using ThreeFry generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_threefry4x32_20 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution(state, lambda);
+}
+
+/**
+ * \brief Returns four Poisson-distributed <tt>unsigned int</tt> values using ThreeFry generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using ThreeFry generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Four Poisson-distributed <tt>unsigned int</tt> values as \p uint4
+ */
+FQUALIFIERS
+uint4 rocrand_poisson4(rocrand_state_threefry4x32_20 * state, double lambda)
+{
+    return uint4 {
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda),
+        rocrand_device::detail::poisson_distribution(state, lambda)
+    };
+}
+#endif // ROCRAND_DETAIL_THREEFRY_BM_NOT_IN_STATE
+
 /**
  * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using MRG32k3a generator.
  *
@@ -276,6 +348,25 @@ unsigned int rocrand_poisson(rocrand_state_mrg32k3a * state, double lambda)
 }
 #endif // ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using MRG31k3p generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using MRG31k3p generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+#ifndef ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_mrg31k3p * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution(state, lambda);
+}
+#endif // ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
+
 /**
  * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using XORWOW generator.
  *
@@ -329,6 +420,24 @@ unsigned int rocrand_poisson(rocrand_state_sobol32 * state, double lambda)
     return rocrand_device::detail::poisson_distribution_inv(state, lambda);
 }
 
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using PCG32 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using PCG32 generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state - Pointer to a state to use
+ * \param lambda - Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+FQUALIFIERS
+unsigned int rocrand_poisson(rocrand_state_pcg32 * state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution(state, lambda);
+}
+
 #endif // ROCRAND_POISSON_H_
 
 /** @} */ // end of group rocranddevice
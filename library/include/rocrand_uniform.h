@@ -30,10 +30,14 @@
 #define FQUALIFIERS __forceinline__ __device__
 #endif // FQUALIFIERS
 
+#include <hip/hip_fp16.h>
+
 #include "rocrand_philox4x32_10.h"
 #include "rocrand_mrg32k3a.h"
+#include "rocrand_mrg31k3p.h"
 #include "rocrand_xorwow.h"
 #include "rocrand_sobol32.h"
+#include "rocrand_pcg32.h"
 #include "rocrand_mtgp32.h"
 
 namespace rocrand_device {
@@ -59,6 +63,15 @@ float uniform_distribution(unsigned int v)
     return ROCRAND_2POW32_INV + (v * ROCRAND_2POW32_INV);
 }
 
+// For an unsigned short between 0 and USHRT_MAX, returns a
+// half-precision value between 0.0 and 1.0, excluding 0.0 and
+// including 1.0.
+FQUALIFIERS
+__half uniform_distribution_half(unsigned short v)
+{
+    return __float2half(ROCRAND_2POW16_INV + (v * ROCRAND_2POW16_INV));
+}
+
 FQUALIFIERS
 float4 uniform_distribution4(uint4 v)
 {
@@ -144,6 +157,23 @@ double mrg_uniform_distribution_double(unsigned int v)
     return ret;
 }
 
+// For unsigned integer produced by the raw MRG31K3P recurrence (value from
+// (0; ROCRAND_MRG31K3P_M1] range), returns value between
+// 0.0f and 1.0f, excluding 0.0f and including 1.0f.
+FQUALIFIERS
+float mrg31k3p_uniform_distribution(unsigned int v)
+{
+    double ret = static_cast<double>(v) * ROCRAND_MRG31K3P_NORM_DOUBLE;
+    return static_cast<float>(ret);
+}
+
+FQUALIFIERS
+double mrg31k3p_uniform_distribution_double(unsigned int v)
+{
+    double ret = static_cast<double>(v) * ROCRAND_MRG31K3P_NORM_DOUBLE;
+    return ret;
+}
+
 } // end namespace detail
 } // end namespace rocrand_device
 
@@ -165,6 +195,30 @@ float rocrand_uniform(rocrand_state_philox4x32_10 * state)
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
+/**
+ * \brief Returns two uniformly distributed random <tt>__half</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p __half values from
+ * (0; 1] range (excluding \p 0.0, including \p 1.0) packed into a
+ * \p __half2, using Philox generator in \p state. Both values are
+ * produced from one 32-bit draw, so the position of the generator is
+ * incremented by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_uniform_half2(rocrand_state_philox4x32_10 * state)
+{
+    const unsigned int v = rocrand(state);
+    return __halves2half2(
+        rocrand_device::detail::uniform_distribution_half((unsigned short)(v)),
+        rocrand_device::detail::uniform_distribution_half((unsigned short)(v >> 16))
+    );
+}
+
 /**
  * \brief Returns two uniformly distributed random <tt>float</tt> values
  * from (0; 1] range.
@@ -254,6 +308,141 @@ double2 rocrand_uniform_double2(rocrand_state_philox4x32_10 * state)
  */
 FQUALIFIERS
 double4 rocrand_uniform_double4(rocrand_state_philox4x32_10 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using ThreeFry generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>__half</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p __half values from
+ * (0; 1] range (excluding \p 0.0, including \p 1.0) packed into a
+ * \p __half2, using ThreeFry generator in \p state. Both values are
+ * produced from one 32-bit draw, so the position of the generator is
+ * incremented by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_uniform_half2(rocrand_state_threefry4x32_20 * state)
+{
+    const unsigned int v = rocrand(state);
+    return __halves2half2(
+        rocrand_device::detail::uniform_distribution_half((unsigned short)(v)),
+        rocrand_device::detail::uniform_distribution_half((unsigned short)(v >> 16))
+    );
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using ThreeFry generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p float values from (0; 1] range as \p float2.
+ */
+FQUALIFIERS
+float2 rocrand_uniform2(rocrand_state_threefry4x32_20 * state)
+{
+    return float2 {
+        rocrand_device::detail::uniform_distribution(rocrand(state)),
+        rocrand_device::detail::uniform_distribution(rocrand(state))
+    };
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>float</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p float values from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using ThreeFry generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p float values from (0; 1] range as \p float4.
+ */
+FQUALIFIERS
+float4 rocrand_uniform4(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution4(rocrand4(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using ThreeFry generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
+/**
+ * \brief Returns two uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using ThreeFry generator in \p state, and
+ * increments position of the generator by four.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p double values from (0; 1] range as \p double2.
+ */
+FQUALIFIERS
+double2 rocrand_uniform_double2(rocrand_state_threefry4x32_20 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double2(rocrand4(state));
+}
+
+/**
+ * \brief Returns four uniformly distributed random <tt>double</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns four uniformly distributed \p double values from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using ThreeFry generator in \p state, and
+ * increments position of the generator by eight.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Four uniformly distributed \p double values from (0; 1] range as \p double4.
+ */
+FQUALIFIERS
+double4 rocrand_uniform_double4(rocrand_state_threefry4x32_20 * state)
 {
     return rocrand_device::detail::uniform_distribution_double4(rocrand4(state), rocrand4(state));
 }
@@ -297,6 +486,45 @@ double rocrand_uniform_double(rocrand_state_mrg32k3a * state)
     return rocrand_device::detail::mrg_uniform_distribution_double(rocrand(state));
 }
 
+ /**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using MRG31K3P generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_mrg31k3p * state)
+{
+    return rocrand_device::detail::mrg31k3p_uniform_distribution(state->next());
+}
+
+ /**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using MRG31K3P generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_mrg31k3p * state)
+{
+    return rocrand_device::detail::mrg31k3p_uniform_distribution_double(state->next());
+}
+
  /**
  * \brief Returns a uniformly distributed random <tt>float</tt> value
  * from (0; 1] range.
@@ -315,6 +543,30 @@ float rocrand_uniform(rocrand_state_xorwow * state)
     return rocrand_device::detail::uniform_distribution(rocrand(state));
 }
 
+/**
+ * \brief Returns two uniformly distributed random <tt>__half</tt> values
+ * from (0; 1] range.
+ *
+ * Generates and returns two uniformly distributed \p __half values from
+ * (0; 1] range (excluding \p 0.0, including \p 1.0) packed into a
+ * \p __half2, using XORWOW generator in \p state. Both values are
+ * produced from one 32-bit draw, so the position of the generator is
+ * incremented by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Two uniformly distributed \p __half values as a \p __half2
+ */
+FQUALIFIERS
+__half2 rocrand_uniform_half2(rocrand_state_xorwow * state)
+{
+    const unsigned int v = rocrand(state);
+    return __halves2half2(
+        rocrand_device::detail::uniform_distribution_half((unsigned short)(v)),
+        rocrand_device::detail::uniform_distribution_half((unsigned short)(v >> 16))
+    );
+}
+
  /**
  * \brief Returns a uniformly distributed random <tt>double</tt> value
  * from (0; 1] range.
@@ -411,6 +663,43 @@ double rocrand_uniform_double(rocrand_state_sobol32 * state)
     return rocrand_device::detail::uniform_distribution_double(rocrand(state));
 }
 
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using PCG32 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+FQUALIFIERS
+float rocrand_uniform(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG32 generator in \p state, and
+ * increments position of the generator by two.
+ *
+ * \param state - Pointer to a state to use
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+FQUALIFIERS
+double rocrand_uniform_double(rocrand_state_pcg32 * state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state), rocrand(state));
+}
+
 #endif // ROCRAND_UNIFORM_H_
 
 /** @} */ // end of group rocranddevice
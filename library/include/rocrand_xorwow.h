@@ -142,6 +142,42 @@ public:
         #endif
     }
 
+    /// Initializes the internal state of the PRNG from a splitmix64
+    /// hash of seed value \p seed_value and \p sequence, without the
+    /// subsequence skipahead performed by the constructor.
+    ///
+    /// Initialization is orders of magnitude cheaper, and states with
+    /// different \p sequence values are statistically independent, but
+    /// they are not positioned on subsequences of one contiguous
+    /// XORWOW sequence.
+    FQUALIFIERS
+    void seed_fast(const unsigned long long seed_value,
+                   const unsigned long long sequence)
+    {
+        unsigned long long hash_state =
+            seed_value ^ (sequence * 0x9E3779B97F4A7C15ULL);
+        unsigned long long v = detail::split_mix64(hash_state);
+        m_state.x[0] = static_cast<unsigned int>(v);
+        m_state.x[1] = static_cast<unsigned int>(v >> 32);
+        v = detail::split_mix64(hash_state);
+        m_state.x[2] = static_cast<unsigned int>(v);
+        m_state.x[3] = static_cast<unsigned int>(v >> 32);
+        v = detail::split_mix64(hash_state);
+        m_state.x[4] = static_cast<unsigned int>(v);
+        m_state.d = static_cast<unsigned int>(v >> 32);
+        // An all-zero xorshift state maps to itself and must be avoided
+        if((m_state.x[0] | m_state.x[1] | m_state.x[2]
+            | m_state.x[3] | m_state.x[4]) == 0)
+        {
+            m_state.x[0] = 1;
+        }
+
+        #ifndef ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
+        m_state.boxmuller_float_state = 0;
+        m_state.boxmuller_double_state = 0;
+        #endif
+    }
+
     FQUALIFIERS
     ~xorwow_engine() { }
 
@@ -268,6 +304,29 @@ void rocrand_init(const unsigned long long seed,
     *state = rocrand_state_xorwow(seed, subsequence, offset);
 }
 
+/**
+ * \brief Initializes XORWOW state from a hash of seed and sequence.
+ *
+ * Initializes the XORWOW generator \p state from a splitmix64 hash of
+ * \p seed and \p sequence instead of the subsequence skipahead
+ * performed by rocrand_init(). Initialization is orders of magnitude
+ * cheaper, which matters in kernels that draw only a few numbers per
+ * thread. States with different \p sequence values are statistically
+ * independent, but they are not positioned on subsequences of one
+ * contiguous XORWOW sequence, and no offset can be applied.
+ *
+ * \param seed - Value to use as a seed
+ * \param sequence - Id of the independent stream to start
+ * \param state - Pointer to state to initialize
+ */
+FQUALIFIERS
+void rocrand_init_fast(const unsigned long long seed,
+                       const unsigned long long sequence,
+                       rocrand_state_xorwow * state)
+{
+    state->seed_fast(seed, sequence);
+}
+
 /**
  * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
  * from [0; 2^32 - 1] range.
@@ -0,0 +1,222 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_ZIGGURAT_PRECOMPUTED_H_
+#define ROCRAND_ZIGGURAT_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/ziggurat_precomputed_generator
+
+#define ZIG_NORM_N 128
+#define ZIG_NORM_R 3.442619855899
+#define ZIG_NORM_R_FLOAT 3.442619855899f
+
+static const __device__ unsigned int d_zig_norm_kn[ZIG_NORM_N] = 
+    {
+        1991057938U, 0U, 1611602771U, 1826899878U, 1918584482U, 1969227037U, 2001281515U, 2023368125U, 
+        2039498179U, 2051788381U, 2061460127U, 2069267110U, 2075699398U, 2081089314U, 2085670119U, 2089610331U, 
+        2093034710U, 2096037586U, 2098691595U, 2101053571U, 2103168620U, 2105072996U, 2106796166U, 2108362327U, 
+        2109791536U, 2111100552U, 2112303493U, 2113412330U, 2114437283U, 2115387130U, 2116269447U, 2117090813U, 
+        2117856962U, 2118572919U, 2119243101U, 2119871411U, 2120461303U, 2121015852U, 2121537798U, 2122029592U, 
+        2122493434U, 2122931299U, 2123344971U, 2123736059U, 2124106020U, 2124456175U, 2124787725U, 2125101763U, 
+        2125399283U, 2125681194U, 2125948325U, 2126201433U, 2126441213U, 2126668298U, 2126883268U, 2127086657U, 
+        2127278949U, 2127460589U, 2127631985U, 2127793506U, 2127945490U, 2128088244U, 2128222044U, 2128347141U, 
+        2128463758U, 2128572095U, 2128672327U, 2128764606U, 2128849065U, 2128925811U, 2128994934U, 2129056501U, 
+        2129110560U, 2129157136U, 2129196237U, 2129227847U, 2129251929U, 2129268426U, 2129277255U, 2129278312U, 
+        2129271467U, 2129256561U, 2129233410U, 2129201800U, 2129161480U, 2129112170U, 2129053545U, 2128985244U, 
+        2128906855U, 2128817916U, 2128717911U, 2128606255U, 2128482298U, 2128345305U, 2128194452U, 2128028813U, 
+        2127847342U, 2127648860U, 2127432031U, 2127195339U, 2126937058U, 2126655214U, 2126347546U, 2126011445U, 
+        2125643893U, 2125241376U, 2124799783U, 2124314271U, 2123779094U, 2123187386U, 2122530867U, 2121799464U, 
+        2120980787U, 2120059418U, 2119015917U, 2117825402U, 2116455471U, 2114863093U, 2112989789U, 2110753906U, 
+        2108037662U, 2104664315U, 2100355223U, 2094642347U, 2086670106U, 2074676188U, 2054300022U, 2010539237U, 
+        
+    };
+
+static const __device__ float d_zig_norm_wn[ZIG_NORM_N] = 
+    {
+        1.7290405215427980e-09f, 1.2680928447002762e-10f, 1.6897517773184551e-10f, 1.9862688442479051e-10f, 
+        2.2232431792499955e-10f, 2.4244936125448931e-10f, 2.6016131900632064e-10f, 2.7611988711703956e-10f, 
+        2.9073962817715979e-10f, 3.0429970414376596e-10f, 3.1699795213954273e-10f, 3.2898020527113064e-10f, 
+        3.4035738121834064e-10f, 3.5121602213664708e-10f, 3.6162509950565170e-10f, 3.7164057634959785e-10f, 
+        3.8130856431105979e-10f, 3.9066756809948822e-10f, 3.9975011869976912e-10f, 4.0858398615984403e-10f, 
+        4.1719309640160654e-10f, 4.2559823534592626e-10f, 4.3381759739255105e-10f, 4.4186721812528858e-10f, 
+        4.4976131962665818e-10f, 4.5751258894588287e-10f, 4.6513240481400098e-10f, 4.7263102384811756e-10f, 
+        4.8001773472325670e-10f, 4.8730098677987483e-10f, 4.9448849805389729e-10f, 5.0158734661196158e-10f, 
+        5.0860404824245599e-10f, 5.1554462291953900e-10f, 5.2241465197063155e-10f, 5.2921932750063053e-10f, 
+        5.3596349533128897e-10f, 5.4265169248206189e-10f, 5.4928818003460213e-10f, 5.5587697207607733e-10f, 
+        5.6242186129835884e-10f, 5.6892644173465501e-10f, 5.7539412903756027e-10f, 5.8182817863908979e-10f, 
+        5.8823170208121699e-10f, 5.9460768176249956e-10f, 6.0095898431083022e-10f, 6.0728837276278847e-10f, 
+        6.1359851770541355e-10f, 6.1989200751559216e-10f, 6.2617135781494294e-10f, 6.3243902024354019e-10f, 
+        6.3869739064357364e-10f, 6.4494881673373833e-10f, 6.5119560534646982e-10f, 6.5744002929285993e-10f, 
+        6.6368433391398755e-10f, 6.6993074337233023e-10f, 6.7618146673274439e-10f, 6.8243870387911370e-10f, 
+        6.8870465131007329e-10f, 6.9498150785516670e-10f, 7.0127148035131547e-10f, 7.0757678931855602e-10f, 
+        7.1389967467358490e-10f, 7.2024240151974857e-10f, 7.2660726605270474e-10f, 7.3299660162208640e-10f, 
+        7.3941278499112283e-10f, 7.4585824283835391e-10f, 7.5233545854834884e-10f, 7.5884697934176525e-10f, 
+        7.6539542379922632e-10f, 7.7198348983844004e-10f, 7.7861396320983810e-10f, 7.8528972658289975e-10f, 
+        7.9201376930340978e-10f, 7.9878919791135359e-10f, 8.0561924752021698e-10f, 8.1250729417139681e-10f, 
+        8.1945686829257451e-10f, 8.2647166940666245e-10f, 8.3355558225878450e-10f, 8.4071269455329910e-10f, 
+        8.4794731652183716e-10f, 8.5526400257760939e-10f, 8.6266757535193633e-10f, 8.7016315245744244e-10f, 
+        8.7775617638032838e-10f, 8.8545244797372776e-10f, 8.9325816410803695e-10f, 9.0117996013566053e-10f, 
+        9.0922495795113810e-10f, 9.1740082057860052e-10f, 9.2571581440401260e-10f, 9.3417888039884721e-10f, 
+        9.4279971596663144e-10f, 9.5158886939988827e-10f, 9.6055784938312528e-10f, 9.6971925254539440e-10f, 
+        9.7908691279089008e-10f, 9.8867607706877244e-10f, 9.9850361345354251e-10f, 1.0085882589914473e-09f, 
+        1.0189509168621382e-09f, 1.0296150152006668e-09f, 1.0406069436999874e-09f, 1.0519565892728039e-09f, 
+        1.0636979991930871e-09f, 1.0758702101645819e-09f, 1.0885182960607283e-09f, 1.1016947078135044e-09f, 
+        1.1154610095597163e-09f, 1.1298901613493216e-09f, 1.1450695700067237e-09f, 1.1611052426022348e-09f, 
+        1.1781275609456131e-09f, 1.1962995053850756e-09f, 1.2158286983295564e-09f, 1.2369856290804966e-09f, 
+        1.2601323300608525e-09f, 1.2857696844205153e-09f, 1.3146201849677183e-09f, 1.3477839562210855e-09f, 
+        1.3870635315067043e-09f, 1.4357403191816380e-09f, 1.5008659030222993e-09f, 1.6030947938091123e-09f, 
+        
+    };
+
+static const __device__ float d_zig_norm_fn[ZIG_NORM_N] = 
+    {
+        1.0000000000000000f, 0.96359969312708615f, 0.93628268168505957f, 0.91304364797174020f, 
+        0.89228165078402610f, 0.87324304891006954f, 0.85550060786945059f, 0.83878360529598961f, 
+        0.82290721138140899f, 0.80773829468296054f, 0.79317701177130506f, 0.77914608592968770f, 
+        0.76558417389770450f, 0.75244155917461142f, 0.73967724367264731f, 0.72725691834418482f, 
+        0.71515150741049860f, 0.70333609901615812f, 0.69178914343667508f, 0.68049184099733406f, 
+        0.66942766734889037f, 0.65858200005008805f, 0.64794182111022247f, 0.63749547733504230f, 
+        0.62723248524992725f, 0.61714337081888093f, 0.60721953662512029f, 0.59745315094451668f, 
+        0.58783705443470657f, 0.57836468111976314f, 0.56902999106795094f, 0.55982741270408687f, 
+        0.55075179311460454f, 0.54179835502542550f, 0.53296265938383613f, 0.52424057267298407f, 
+        0.51562823824400184f, 0.50712205107556896f, 0.49871863547097950f, 0.49041482528384411f, 
+        0.48220764632948521f, 0.47409430069301695f, 0.46607215268945612f, 0.45813871626787206f, 
+        0.45029164368203922f, 0.44252871527546844f, 0.43484783024999091f, 0.42724699830499607f, 
+        0.41972433204957438f, 0.41227804010266100f, 0.40490642080722294f, 0.39760785649387331f, 
+        0.39038080823731458f, 0.38322381105590120f, 0.37613546951056259f, 0.36911445366447221f, 
+        0.36215949536931757f, 0.35526938484791709f, 0.34844296754632659f, 0.34167914123155041f, 
+        0.33497685331358917f, 0.32833509837285030f, 0.32175291587598492f, 0.31522938806501088f, 
+        0.30876363800618112f, 0.30235482778648354f, 0.29600215684693298f, 0.28970486044295984f, 
+        0.28346220822323298f, 0.27727350291918812f, 0.27113807913838461f, 0.26505530225558921f, 
+        0.25902456739620483f, 0.25304529850732577f, 0.24711694751232141f, 0.24123899354543982f, 
+        0.23541094226347908f, 0.22963232523211613f, 0.22390269938500842f, 0.21822164655430540f, 
+        0.21258877307173030f, 0.20700370943992652f, 0.20146611007431367f, 0.19597565311627774f, 
+        0.19053204031913715f, 0.18513499700899219f, 0.17978427212329545f, 0.17447963833078950f, 
+        0.16922089223736500f, 0.16400785468342038f, 0.15884037113947930f, 0.15371831220818166f, 
+        0.14864157424234226f, 0.14361008009062776f, 0.13862377998459460f, 0.13368265258343937f, 
+        0.12878670619594321f, 0.12393598020286782f, 0.11913054670765083f, 0.11437051244886601f, 
+        0.10965602101484027f, 0.10498725540942132f, 0.10036444102865587f, 0.095787849121731439f, 
+        0.091257800826830257f, 0.086774671894780178f, 0.082338898242235656f, 0.077950982513973394f, 
+        0.073611501884113403f, 0.069321117393577908f, 0.065080585213068073f, 0.060890770348040406f, 
+        0.056752663481049848f, 0.052667401903051012f, 0.048636295859867805f, 0.044660862200491425f, 
+        0.040742868074444175f, 0.036884388786656203f, 0.033087886146225751f, 0.029356317440006850f, 
+        0.025693291935934271f, 0.022103304615927098f, 0.018592102737011288f, 0.015167298010546568f, 
+        0.011839478657884862f, 0.0086244844128598851f, 0.0055489952207713449f, 0.0026696290838809228f, 
+        
+    };
+
+static const __device__ unsigned long long d_zig_norm_kn_d[ZIG_NORM_N] = 
+    {
+        8551528729039362048ULL, 0ULL, 6921781199428723712ULL, 7846475232835860480ULL, 8240257605059745792ULL, 8457765722508300288ULL, 8595438658940800000ULL, 8690299926774356992ULL, 
+        8759577982616648704ULL, 8812363995161337856ULL, 8853903828335440896ULL, 8887434564929008640ULL, 8915061031187010560ULL, 8938210544520612864ULL, 8957884952949432320ULL, 8974808034598676480ULL, 
+        8989515632455599104ULL, 9002412886713534464ULL, 9013811765797381120ULL, 9023956374791454720ULL, 9033040443760450560ULL, 9041219675621637120ULL, 9048620633229658112ULL, 9055347246311101440ULL, 
+        9061485649861192704ULL, 9067107832510610432ULL, 9072274422763393024ULL, 9077036841693056000ULL, 9081438983965869056ULL, 9085518543472210944ULL, 9089308068207780864ULL, 9092835806771264512ULL, 
+        9096126392953011200ULL, 9099201403411274752ULL, 9102079815047434240ULL, 9104778382500404224ULL, 9107311951563516928ULL, 9109693720852012032ULL, 9111935461410573312ULL, 9114047701930398720ULL, 
+        9116039885686704128ULL, 9117920504096542720ULL, 9119697210848959488ULL, 9121376919813022720ULL, 9122965889337576448ULL, 9124469795084907520ULL, 9125893793162227712ULL, 9127242575010153472ULL, 
+        9128520415260326912ULL, 9129731213573194752ULL, 9130878531302635520ULL, 9131965623698756608ULL, 9132995468248813568ULL, 9133970789663568896ULL, 9134894081939592192ULL, 9135767627863511040ULL, 
+        9136593516270356480ULL, 9137373657322574848ULL, 9138109796037776384ULL, 9138803524260544512ULL, 9139456291245712384ULL, 9140069412996431872ULL, 9140644080479734784ULL, 9141181366824199168ULL, 
+        9141682233588683776ULL, 9142147536177124352ULL, 9142578028462106624ULL, 9142974366668713984ULL, 9143337112560068608ULL, 9143666735956516864ULL, 9143963616611607552ULL, 9144228045459447808ULL, 
+        9144460225239755776ULL, 9144660270498537472ULL, 9144828206953819136ULL, 9144963970206961664ULL, 9145067403770535936ULL, 9145138256373495808ULL, 9145176178492863488ULL, 9145180718048422912ULL, 
+        9145151315182289920ULL, 9145087296028480512ULL, 9144987865358106624ULL, 9144852097963012096ULL, 9144678928613645312ULL, 9144467140394889216ULL, 9144215351185108992ULL, 9143921997997384704ULL, 
+        9143585318845775872ULL, 9143203331731148800ULL, 9142773810257312768ULL, 9142294255285097472ULL, 9141761861904187392ULL, 9141173480843300864ULL, 9140525573239696384ULL, 9139814157437198336ULL, 
+        9139034746162339840ULL, 9138182272019620864ULL, 9137250998720920576ULL, 9136234414781762560ULL, 9135125105524876288ULL, 9133914598054752256ULL, 9132593172300693504ULL, 9131149629121302528ULL, 
+        9129571003605442560ULL, 9127842207781056512ULL, 9125945581490886656ULL, 9123860322519783424ULL, 9121561756103903232ULL, 9119020388077357056ULL, 9116200662522868736ULL, 9113059309703859200ULL, 
+        9109543116355768320ULL, 9105585866407156736ULL, 9101104065533302784ULL, 9095990841091574784ULL, 9090107032100334592ULL, 9083267820942501888ULL, 9075222044710370304ULL, 9065618996814246912ULL, 
+        9053952818353061888ULL, 9039464405367553024ULL, 9020956994822791168ULL, 8996420381136461824ULL, 8962179864989821952ULL, 8910666378117820416ULL, 8823151412433759232ULL, 8635200272912259072ULL, 
+        
+    };
+
+static const __device__ double d_zig_norm_wn_d[ZIG_NORM_N] = 
+    {
+        4.0257361753443210e-19, 2.9525087324443186e-20, 3.9342599392832608e-20, 4.6246425347586748e-20, 
+        5.1763914042385189e-20, 5.6449640834352308e-20, 6.0573527358081342e-20, 6.4289171043094145e-20, 
+        6.7693094764174845e-20, 7.0850295979475128e-20, 7.3806837233608293e-20, 7.6596672942659502e-20, 
+        7.9245628141411729e-20, 8.1773852495627263e-20, 8.4197404679295537e-20, 8.6529314599371946e-20, 
+        8.8780318459276993e-20, 9.0959381335295787e-20, 9.3074077437578031e-20, 9.5130872484260246e-20, 
+        9.7135337163136932e-20, 9.9092311073543100e-20, 1.0100603042928294e-19, 1.0288022880565575e-19, 
+        1.0471821753928861e-19, 1.0652295056401819e-19, 1.0829707719711610e-19, 1.1004298549334462e-19, 
+        1.1176283814088830e-19, 1.1345860240512407e-19, 1.1513207528132417e-19, 1.1678490476029962e-19, 
+        1.1841860791725479e-19, 1.2003458638664777e-19, 1.2163413967253444e-19, 1.2321847665603983e-19, 
+        1.2478872559296176e-19, 1.2634594284046020e-19, 1.2789112050891904e-19, 1.2942519320083720e-19, 
+        1.3094904397110428e-19, 1.3246350962078548e-19, 1.3396938541847287e-19, 1.3546742932849792e-19, 
+        1.3695836581318104e-19, 1.3844288926629805e-19, 1.3992166712666634e-19, 1.4139534271387115e-19, 
+        1.4286453782241176e-19, 1.4432985510574471e-19, 1.4579188027767067e-19, 1.4725118415512615e-19, 
+        1.4870832456359026e-19, 1.5016384812391790e-19, 1.5161829193738984e-19, 1.5307218518407548e-19, 
+        1.5452605064818346e-19, 1.5598040618289500e-19, 1.5743576612620251e-19, 1.5889264267848658e-19, 
+        1.6035154725193821e-19, 1.6181299180145531e-19, 1.6327749014629877e-19, 1.6474555929157790e-19, 
+        1.6621772075853890e-19, 1.6769450193265187e-19, 1.6917643743862974e-19, 1.7066407055176944e-19, 
+        1.7215795465538344e-19, 1.7365865475459814e-19, 1.7516674905744122e-19, 1.7668283063493791e-19, 
+        1.7820750917290019e-19, 1.7974141282924452e-19, 1.8128519021203697e-19, 1.8283951249506784e-19, 
+        1.8440507568964031e-19, 1.8598260309345871e-19, 1.8757284794007823e-19, 1.8917659627539031e-19, 
+        1.9079467009114439e-19, 1.9242793074964137e-19, 1.9407728273858887e-19, 1.9574367780082372e-19, 
+        1.9742811949035087e-19, 1.9913166821412961e-19, 2.0085544682851441e-19, 2.0260064687054661e-19, 
+        2.0436853551779138e-19, 2.0616046338661754e-19, 2.0797787329834815e-19, 2.0982231016635441e-19, 
+        2.1169543218592603e-19, 2.1359902354390373e-19, 2.1553500890825237e-19, 2.1750547001111489e-19, 
+        2.1951266470519626e-19, 2.2155904895623407e-19, 2.2364730233864982e-19, 2.2578035773369353e-19, 
+        2.2796143609818306e-19, 2.3019408738910510e-19, 2.3248223901110294e-19, 2.3483025352271443e-19, 
+        2.3724299782471223e-19, 2.3972592670486002e-19, 2.4228518449235413e-19, 2.4492772977631629e-19, 
+        2.4766148980545977e-19, 2.5049555352064359e-19, 2.5344041550083278e-19, 2.5650828793028007e-19, 
+        2.5971350482658397e-19, 2.6307305352513716e-19, 2.6660728501312522e-19, 2.7034088098496077e-19, 
+        2.7430419832133061e-19, 2.7853518384161303e-19, 2.8308217840491711e-19, 2.8800816020939885e-19, 
+        2.9339742149711877e-19, 2.9936658321426139e-19, 3.0608386382640300e-19, 3.1380540603331418e-19, 
+        3.2295089482951543e-19, 3.3428434263487300e-19, 3.4944757423882822e-19, 3.7324959268074302e-19, 
+        
+    };
+
+static const __device__ double d_zig_norm_fn_d[ZIG_NORM_N] = 
+    {
+        1.0000000000000000, 0.96359969312708615, 0.93628268168505957, 0.91304364797174020, 
+        0.89228165078402610, 0.87324304891006954, 0.85550060786945059, 0.83878360529598961, 
+        0.82290721138140899, 0.80773829468296054, 0.79317701177130506, 0.77914608592968770, 
+        0.76558417389770450, 0.75244155917461142, 0.73967724367264731, 0.72725691834418482, 
+        0.71515150741049860, 0.70333609901615812, 0.69178914343667508, 0.68049184099733406, 
+        0.66942766734889037, 0.65858200005008805, 0.64794182111022247, 0.63749547733504230, 
+        0.62723248524992725, 0.61714337081888093, 0.60721953662512029, 0.59745315094451668, 
+        0.58783705443470657, 0.57836468111976314, 0.56902999106795094, 0.55982741270408687, 
+        0.55075179311460454, 0.54179835502542550, 0.53296265938383613, 0.52424057267298407, 
+        0.51562823824400184, 0.50712205107556896, 0.49871863547097950, 0.49041482528384411, 
+        0.48220764632948521, 0.47409430069301695, 0.46607215268945612, 0.45813871626787206, 
+        0.45029164368203922, 0.44252871527546844, 0.43484783024999091, 0.42724699830499607, 
+        0.41972433204957438, 0.41227804010266100, 0.40490642080722294, 0.39760785649387331, 
+        0.39038080823731458, 0.38322381105590120, 0.37613546951056259, 0.36911445366447221, 
+        0.36215949536931757, 0.35526938484791709, 0.34844296754632659, 0.34167914123155041, 
+        0.33497685331358917, 0.32833509837285030, 0.32175291587598492, 0.31522938806501088, 
+        0.30876363800618112, 0.30235482778648354, 0.29600215684693298, 0.28970486044295984, 
+        0.28346220822323298, 0.27727350291918812, 0.27113807913838461, 0.26505530225558921, 
+        0.25902456739620483, 0.25304529850732577, 0.24711694751232141, 0.24123899354543982, 
+        0.23541094226347908, 0.22963232523211613, 0.22390269938500842, 0.21822164655430540, 
+        0.21258877307173030, 0.20700370943992652, 0.20146611007431367, 0.19597565311627774, 
+        0.19053204031913715, 0.18513499700899219, 0.17978427212329545, 0.17447963833078950, 
+        0.16922089223736500, 0.16400785468342038, 0.15884037113947930, 0.15371831220818166, 
+        0.14864157424234226, 0.14361008009062776, 0.13862377998459460, 0.13368265258343937, 
+        0.12878670619594321, 0.12393598020286782, 0.11913054670765083, 0.11437051244886601, 
+        0.10965602101484027, 0.10498725540942132, 0.10036444102865587, 0.095787849121731439, 
+        0.091257800826830257, 0.086774671894780178, 0.082338898242235656, 0.077950982513973394, 
+        0.073611501884113403, 0.069321117393577908, 0.065080585213068073, 0.060890770348040406, 
+        0.056752663481049848, 0.052667401903051012, 0.048636295859867805, 0.044660862200491425, 
+        0.040742868074444175, 0.036884388786656203, 0.033087886146225751, 0.029356317440006850, 
+        0.025693291935934271, 0.022103304615927098, 0.018592102737011288, 0.015167298010546568, 
+        0.011839478657884862, 0.0086244844128598851, 0.0055489952207713449, 0.0026696290838809228, 
+        
+    };
+
+
+#endif // ROCRAND_ZIGGURAT_PRECOMPUTED_H_
@@ -25,6 +25,162 @@
 #define FQUALIFIERS __forceinline__ __device__ __host__
 #endif
 
+#include <algorithm>
+#include <thread>
+#include <vector>
+
 #include <rocrand_common.h>
+#include <hip/hip_runtime.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Unaligned counterparts of the vector types, used as a fallback
+    // so that kernels with 128-bit vectorized stores can also write to
+    // destinations the vector types' alignment requirements would reject
+    struct double2_unaligned
+    {
+        double x;
+        double y;
+    };
+
+    struct uint4_unaligned
+    {
+        unsigned int x;
+        unsigned int y;
+        unsigned int z;
+        unsigned int w;
+    };
+
+    struct float4_unaligned
+    {
+        float x;
+        float y;
+        float z;
+        float w;
+    };
+
+    struct double4_unaligned
+    {
+        double x;
+        double y;
+        double z;
+        double w;
+    };
+
+    template<class T>
+    struct unaligned_type
+    {
+        typedef void type;
+    };
+
+    template<>
+    struct unaligned_type<double2>
+    {
+        typedef double2_unaligned type;
+    };
+
+    template<>
+    struct unaligned_type<uint4>
+    {
+        typedef uint4_unaligned type;
+    };
+
+    template<>
+    struct unaligned_type<float4>
+    {
+        typedef float4_unaligned type;
+    };
+
+    template<>
+    struct unaligned_type<double4>
+    {
+        typedef double4_unaligned type;
+    };
+
+    __forceinline__ __device__
+    float atomic_add(float * address, float value)
+    {
+        return atomicAdd(address, value);
+    }
+
+    __forceinline__ __device__
+    double atomic_add(double * address, double value)
+    {
+        // atomicAdd on double is not available on all targets
+        unsigned long long * address_ull = (unsigned long long *)address;
+        unsigned long long old = *address_ull;
+        unsigned long long assumed;
+        do
+        {
+            assumed = old;
+            old = atomicCAS(address_ull, assumed,
+                            __double_as_longlong(
+                                value + __longlong_as_double(assumed)));
+        } while(assumed != old);
+        return __longlong_as_double(old);
+    }
+
+    inline __device__ unsigned int warp_reduce_min(unsigned int val, int size) {
+      for (int offset = size/2; offset > 0; offset /= 2) {
+        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
+        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
+        #else
+        unsigned int temp = __shfl_xor((int)val, offset);
+        #endif
+        val = (temp < val) ? temp : val;
+      }
+      return val;
+    }
+
+    // Runs op(first, last) over disjoint slices of [0, n) on host
+    // threads; used by the host-side table setup paths (alias tables,
+    // Poisson probabilities) and the host generator backends. Below
+    // min_parallel the whole range runs on the calling thread, so
+    // small setups do not pay thread start-up costs. Callers that
+    // combine per-slice values and need rounding independent of the
+    // worker count should iterate over fixed-size blocks instead of
+    // raw elements.
+    template<class Op>
+    inline void parallel_for(size_t n, Op op,
+                             size_t min_parallel = size_t(1) << 16)
+    {
+        if(n == 0)
+        {
+            return;
+        }
+        unsigned int workers =
+            std::max(1u, std::thread::hardware_concurrency());
+        if(n < min_parallel)
+        {
+            workers = 1;
+        }
+        workers = static_cast<unsigned int>(
+            std::min<size_t>(workers, n));
+        if(workers == 1)
+        {
+            op(size_t(0), n);
+            return;
+        }
+        const size_t chunk = (n + workers - 1) / workers;
+        std::vector<std::thread> threads;
+        for(unsigned int w = 1; w < workers; w++)
+        {
+            const size_t first = w * chunk;
+            if(first >= n)
+            {
+                break;
+            }
+            threads.emplace_back(op, first, std::min(first + chunk, n));
+        }
+        op(size_t(0), std::min(chunk, n));
+        for(auto& t : threads)
+        {
+            t.join();
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
 
 #endif // ROCRAND_RNG_COMMON_H_
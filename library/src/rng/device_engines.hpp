@@ -27,6 +27,7 @@
 
 #define ROCRAND_DETAIL_PHILOX_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_MRG32K3A_BM_NOT_IN_STATE
+#define ROCRAND_DETAIL_MRG31K3P_BM_NOT_IN_STATE
 #define ROCRAND_DETAIL_XORWOW_BM_NOT_IN_STATE
 
 #include <rocrand_kernel.h>
@@ -0,0 +1,382 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DEVICE_MEMORY_H_
+#define ROCRAND_RNG_DEVICE_MEMORY_H_
+
+#include <mutex>
+#include <vector>
+#include <unordered_map>
+
+#include <hip/hip_runtime.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Process-wide pool for the library's internal device allocations
+    // (engine arrays, distribution tables, kernel temporaries).
+    //
+    // hipMalloc and especially hipFree synchronize the whole device,
+    // which serializes unrelated streams every time a generator is
+    // created or a distribution table is rebuilt (set_lambda and
+    // friends). The pool keeps freed blocks in power-of-two buckets
+    // and hands them out again without touching the runtime on the
+    // hot paths.
+    //
+    // Reuse is made safe without synchronizing: every freed block
+    // carries an event recorded on the stream the caller last used
+    // the block on (the generator's stream for engine arrays and
+    // distribution tables), so the event completes only after the
+    // queued kernels that may still read the block -- including on
+    // streams created with hipStreamNonBlocking -- and a cached block
+    // is only handed out once its event has completed. Callers can
+    // replace the pool entirely with rocrand_set_allocator().
+    class device_memory_pool
+    {
+    public:
+
+        static hipError_t allocate(void ** ptr, size_t bytes)
+        {
+            device_memory_pool& pool = instance();
+            std::lock_guard<std::mutex> lock(pool.m_mutex);
+
+            if(pool.m_custom_allocate != NULL)
+            {
+                *ptr = pool.m_custom_allocate(bytes, pool.m_custom_state);
+                return *ptr != NULL ? hipSuccess : hipErrorMemoryAllocation;
+            }
+
+            int device;
+            if(hipGetDevice(&device) != hipSuccess)
+            {
+                return hipErrorInvalidDevice;
+            }
+
+            const size_t rounded = round_bytes(bytes);
+            const bool pooled = rounded <= max_pooled_bytes;
+            if(pooled)
+            {
+                // Prefer a cached block whose draining has finished
+                for(size_t i = 0; i < pool.m_free.size(); i++)
+                {
+                    block& b = pool.m_free[i];
+                    if(b.bytes == rounded && b.device == device
+                        && hipEventQuery(b.ready) == hipSuccess)
+                    {
+                        *ptr = b.ptr;
+                        pool.m_cached_bytes -= b.bytes;
+                        pool.m_live[*ptr] = b;
+                        pool.m_free.erase(pool.m_free.begin() + i);
+                        return hipSuccess;
+                    }
+                }
+            }
+
+            hipError_t error = hipMalloc(ptr, rounded);
+            if(error != hipSuccess)
+            {
+                // Give the cache back to the runtime and retry once
+                static_cast<void>(hipGetLastError());
+                pool.trim();
+                error = hipMalloc(ptr, rounded);
+                if(error != hipSuccess)
+                {
+                    return error;
+                }
+            }
+            block b;
+            b.ptr = *ptr;
+            b.bytes = rounded;
+            b.device = device;
+            b.pooled = pooled;
+            b.ready = NULL;
+            pool.m_live[*ptr] = b;
+            return hipSuccess;
+        }
+
+        static hipError_t deallocate(void * ptr, hipStream_t stream)
+        {
+            if(ptr == NULL)
+            {
+                return hipSuccess;
+            }
+            device_memory_pool& pool = instance();
+            std::lock_guard<std::mutex> lock(pool.m_mutex);
+
+            std::unordered_map<void *, block>::iterator it = pool.m_live.find(ptr);
+            if(it == pool.m_live.end())
+            {
+                // Allocated before a custom allocator was (un)set
+                if(pool.m_custom_deallocate != NULL)
+                {
+                    pool.m_custom_deallocate(ptr, pool.m_custom_state);
+                    return hipSuccess;
+                }
+                return hipFree(ptr);
+            }
+
+            block b = it->second;
+            pool.m_live.erase(it);
+            if(!b.pooled
+                || pool.m_cached_bytes + b.bytes > max_cached_bytes)
+            {
+                if(b.ready != NULL)
+                {
+                    hipEventDestroy(b.ready);
+                }
+                return hipFree(b.ptr);
+            }
+            if(b.ready == NULL
+                && hipEventCreateWithFlags(&b.ready,
+                                           hipEventDisableTiming) != hipSuccess)
+            {
+                return hipFree(b.ptr);
+            }
+            // The block may still be read by kernels queued on the
+            // owning stream; it only becomes reusable once this event
+            // has completed
+            if(hipEventRecord(b.ready, stream) != hipSuccess)
+            {
+                hipEventDestroy(b.ready);
+                return hipFree(b.ptr);
+            }
+            pool.m_cached_bytes += b.bytes;
+            pool.m_free.push_back(b);
+            return hipSuccess;
+        }
+
+        // Installs (or with two NULLs removes) a caller-provided
+        // allocator (see rocrand_set_allocator()); the internal cache
+        // is returned to the runtime
+        static void set_allocator(void * (*allocate)(size_t, void *),
+                                  void (*deallocate)(void *, void *),
+                                  void * state)
+        {
+            device_memory_pool& pool = instance();
+            std::lock_guard<std::mutex> lock(pool.m_mutex);
+            pool.trim();
+            pool.m_custom_allocate = allocate;
+            pool.m_custom_deallocate = deallocate;
+            pool.m_custom_state = state;
+        }
+
+    private:
+
+        struct block
+        {
+            void * ptr;
+            size_t bytes;
+            int device;
+            bool pooled;
+            hipEvent_t ready;
+        };
+
+        device_memory_pool()
+            : m_custom_allocate(NULL), m_custom_deallocate(NULL),
+              m_custom_state(NULL), m_cached_bytes(0)
+        { }
+
+        static device_memory_pool& instance()
+        {
+            static device_memory_pool pool;
+            return pool;
+        }
+
+        // Frees all cached blocks back to the runtime (under m_mutex)
+        void trim()
+        {
+            for(block& b : m_free)
+            {
+                hipEventDestroy(b.ready);
+                hipFree(b.ptr);
+            }
+            m_free.clear();
+            m_cached_bytes = 0;
+        }
+
+        static size_t round_bytes(size_t bytes)
+        {
+            size_t rounded = min_block_bytes;
+            while(rounded < bytes)
+            {
+                rounded *= 2;
+            }
+            return rounded;
+        }
+
+        // Sub-allocation granularity; smaller requests share a bucket
+        static const size_t min_block_bytes = 256;
+        // Blocks past this go straight to the runtime: pooling them
+        // would round up too much memory and they are rare
+        static const size_t max_pooled_bytes = size_t(64) << 20;
+        // Upper bound on memory parked in the cache
+        static const size_t max_cached_bytes = size_t(256) << 20;
+
+        std::mutex m_mutex;
+        void * (*m_custom_allocate)(size_t, void *);
+        void (*m_custom_deallocate)(void *, void *);
+        void * m_custom_state;
+        std::vector<block> m_free;
+        std::unordered_map<void *, block> m_live;
+        size_t m_cached_bytes;
+    };
+
+    // Drop-in counterparts of hipMalloc/hipFree for the library's
+    // internal device allocations
+    inline hipError_t device_malloc(void ** ptr, size_t bytes)
+    {
+        return device_memory_pool::allocate(ptr, bytes);
+    }
+
+    template<class T>
+    inline hipError_t device_malloc(T ** ptr, size_t bytes)
+    {
+        return device_memory_pool::allocate(reinterpret_cast<void **>(ptr), bytes);
+    }
+
+    // Frees a block last used on \p stream; the block is recycled only
+    // after the work queued there before this call has completed
+    inline hipError_t device_free(void * ptr, hipStream_t stream)
+    {
+        return device_memory_pool::deallocate(ptr, stream);
+    }
+
+    // Variant for blocks with no device work pending on any stream
+    // (failure-path cleanup after a synchronous copy, process
+    // teardown); equivalent to passing the legacy default stream
+    inline hipError_t device_free(void * ptr)
+    {
+        return device_memory_pool::deallocate(ptr, 0);
+    }
+
+    // Rotating pinned host buffers for asynchronous uploads of
+    // host-built tables (see rocrand_discrete_distribution_base::
+    // init_async()). acquire() hands out a slot's buffer, record()
+    // marks the upload from it as enqueued on a stream and rotates to
+    // the next slot; a slot is handed out again only after its
+    // recorded upload has completed, so buffers in flight are never
+    // overwritten while double buffering keeps the host from waiting
+    // in the steady state.
+    class pinned_staging
+    {
+    public:
+
+        pinned_staging() : m_next(0)
+        {
+            for(unsigned int i = 0; i < s_slots; i++)
+            {
+                m_buffers[i] = NULL;
+                m_capacities[i] = 0;
+                m_recorded[i] = false;
+            }
+        }
+
+        ~pinned_staging()
+        {
+            for(unsigned int i = 0; i < s_slots; i++)
+            {
+                if(m_recorded[i])
+                {
+                    hipEventSynchronize(m_events[i]);
+                    hipEventDestroy(m_events[i]);
+                }
+                if(m_buffers[i] != NULL)
+                {
+                    hipHostFree(m_buffers[i]);
+                }
+            }
+        }
+
+        pinned_staging(const pinned_staging&) = delete;
+        pinned_staging& operator=(const pinned_staging&) = delete;
+
+        // Returns a pinned buffer of at least bytes in *ptr; blocks
+        // only while the slot's previous upload is still in flight
+        hipError_t acquire(void ** ptr, size_t bytes)
+        {
+            const unsigned int slot = m_next;
+            if(m_recorded[slot])
+            {
+                const hipError_t error = hipEventSynchronize(m_events[slot]);
+                if(error != hipSuccess)
+                {
+                    return error;
+                }
+            }
+            if(m_capacities[slot] < bytes)
+            {
+                if(m_buffers[slot] != NULL)
+                {
+                    hipHostFree(m_buffers[slot]);
+                    m_buffers[slot] = NULL;
+                    m_capacities[slot] = 0;
+                }
+                const hipError_t error = hipHostMalloc(&m_buffers[slot], bytes);
+                if(error != hipSuccess)
+                {
+                    return error;
+                }
+                m_capacities[slot] = bytes;
+            }
+            *ptr = m_buffers[slot];
+            return hipSuccess;
+        }
+
+        // Marks the upload from the last acquired buffer as enqueued
+        // on stream and rotates to the next slot
+        hipError_t record(hipStream_t stream)
+        {
+            const unsigned int slot = m_next;
+            if(!m_recorded[slot])
+            {
+                const hipError_t error =
+                    hipEventCreateWithFlags(&m_events[slot], hipEventDisableTiming);
+                if(error != hipSuccess)
+                {
+                    return error;
+                }
+                m_recorded[slot] = true;
+            }
+            const hipError_t error = hipEventRecord(m_events[slot], stream);
+            if(error == hipSuccess)
+            {
+                m_next = (slot + 1) % s_slots;
+            }
+            return error;
+        }
+
+    private:
+
+        // Up to 4 tables are uploaded per rebuild (alias probabilities
+        // and aliases, cdf and its top level); twice that double
+        // buffers consecutive rebuilds
+        static const unsigned int s_slots = 8;
+
+        unsigned int m_next;
+        void * m_buffers[s_slots];
+        size_t m_capacities[s_slots];
+        hipEvent_t m_events[s_slots];
+        bool m_recorded[s_slots];
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DEVICE_MEMORY_H_
@@ -0,0 +1,101 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DEVICE_STATES_H_
+#define ROCRAND_RNG_DEVICE_STATES_H_
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "log.hpp"
+#include "device_memory.hpp"
+#include "engine_state_cache.hpp"
+#include "device_engines.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Backs rocrand_create_device_states(): every state is put on its
+    // own subsequence, the layout device API users get from calling
+    // rocrand_init(seed, state_id, 0, &state) themselves.
+    template<class StateType>
+    __global__
+    void init_device_states_kernel(StateType * states,
+                                   const unsigned long long seed,
+                                   const size_t count)
+    {
+        const size_t state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(state_id < count)
+        {
+            rocrand_init(seed, state_id, 0, &states[state_id]);
+        }
+    }
+
+    template<class StateType>
+    rocrand_status create_device_states(rocrand_rng_type rng_type,
+                                        size_t count,
+                                        unsigned long long seed,
+                                        void ** device_states)
+    {
+        StateType * states;
+        const size_t bytes = count * sizeof(StateType);
+        if(device_malloc(&states, bytes) != hipSuccess)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        // The layout matches the engine arrays of host-API generators
+        // of the same type (seed, subsequence = index, offset 0), so
+        // both sides share one pool of pristine states and skip the
+        // skipahead-heavy initialization when the other has run it
+        const auto key = engine_state_key(rng_type, seed, 0, bytes);
+        if(engine_state_cache::lookup(key, states, NULL))
+        {
+            *device_states = states;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const unsigned int threads = 256;
+        const unsigned int blocks =
+            static_cast<unsigned int>((count + threads - 1) / threads);
+        op_logger log("init_device_states_kernel", count, blocks, threads, NULL);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(init_device_states_kernel<StateType>),
+            dim3(blocks), dim3(threads), 0, NULL,
+            states, seed, count
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            device_free(states);
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        engine_state_cache::insert(key, states, NULL);
+
+        *device_states = states;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_DEVICE_STATES_H_
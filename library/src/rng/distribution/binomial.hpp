@@ -0,0 +1,171 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+
+#include <cmath>
+#include <climits>
+#include <algorithm>
+#include <vector>
+
+#include <rocrand.h>
+
+#include "discrete.hpp"
+
+// Binomial sampling via the same precomputed discrete tables as the
+// Poisson distribution: only the window of outcomes with non-negligible
+// probability around the mean is tabulated, so draws are O(1) and need
+// a single uniform value, which keeps them compatible with the bulk
+// generation kernels.
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class rocrand_binomial_distribution : public rocrand_discrete_distribution_base<Method, IsHostSide>
+{
+public:
+
+    typedef rocrand_discrete_distribution_base<Method, IsHostSide> base;
+
+    rocrand_binomial_distribution()
+        : base() { }
+
+    rocrand_binomial_distribution(unsigned int trials, double prob)
+        : rocrand_binomial_distribution()
+    {
+        set_params(trials, prob);
+    }
+
+    __host__ __device__
+    ~rocrand_binomial_distribution() { }
+
+    void set_params(unsigned int trials, double prob)
+    {
+        const double mean = trials * prob;
+        const double stddev = std::sqrt(mean * (1.0 - prob));
+        size_t capacity =
+            2 * static_cast<size_t>(16.0 * (2.0 + stddev));
+        // Unlike Poisson, the support is bounded by the trial count
+        capacity = std::min<size_t>(capacity, static_cast<size_t>(trials) + 1);
+        std::vector<double> p(capacity);
+
+        calculate_probabilities(p, capacity, trials, prob);
+
+        this->init(p, this->size, this->offset);
+    }
+
+protected:
+
+    void calculate_probabilities(std::vector<double>& p, const size_t capacity,
+                                 const unsigned int trials, const double prob)
+    {
+        const double p_epsilon = 1e-12;
+        const double log_p = std::log(prob);
+        const double log_q = std::log1p(-prob);
+        const double log_nf = std::lgamma(trials + 1.0);
+
+        // Window of tabulated outcomes, centered on the mean and
+        // clamped to the support [0; trials]
+        int left = static_cast<int>(std::floor(trials * prob)) - capacity / 2;
+        left = std::max(left, 0);
+        left = std::min<int>(left, trials + 1 - capacity);
+        // Index of the mean inside the window; equals capacity / 2
+        // unless the window was clamped at either end of the support
+        const int center = static_cast<int>(std::floor(trials * prob)) - left;
+
+        // Calculate probabilities starting from mean in both directions,
+        // because only a small part of [0, trials] has non-negligible values
+        // (> p_epsilon).
+
+        int lo = 0;
+        for (int i = center; i >= 0; i--)
+        {
+            const double x = left + i;
+            const double pp = std::exp(log_nf
+                - std::lgamma(x + 1.0) - std::lgamma(trials - x + 1.0)
+                + x * log_p + (trials - x) * log_q);
+            if (pp < p_epsilon)
+            {
+                lo = i + 1;
+                break;
+            }
+            p[i] = pp;
+        }
+
+        int hi = capacity - 1;
+        for (int i = center + 1; i < static_cast<int>(capacity); i++)
+        {
+            const double x = left + i;
+            const double pp = std::exp(log_nf
+                - std::lgamma(x + 1.0) - std::lgamma(trials - x + 1.0)
+                + x * log_p + (trials - x) * log_q);
+            if (pp < p_epsilon)
+            {
+                hi = i - 1;
+                break;
+            }
+            p[i] = pp;
+        }
+
+        for (int i = lo; i <= hi; i++)
+        {
+            p[i - lo] = p[i];
+        }
+
+        this->size = hi - lo + 1;
+        this->offset = left + lo;
+    }
+};
+
+// Handles caching of precomputed tables for the distribution and recomputes
+// them only when the parameters change (as these computations, device memory
+// allocations and copying take time).
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class binomial_distribution_manager
+{
+public:
+
+    rocrand_binomial_distribution<Method, IsHostSide> dis;
+
+    binomial_distribution_manager()
+        : trials(0), prob(0.0)
+    { }
+
+    ~binomial_distribution_manager()
+    {
+        dis.deallocate();
+    }
+
+    void set_params(unsigned int new_trials, double new_prob)
+    {
+        const bool changed = trials != new_trials || prob != new_prob;
+        if (changed)
+        {
+            trials = new_trials;
+            prob = new_prob;
+            dis.set_params(trials, prob);
+        }
+    }
+
+private:
+
+    unsigned int trials;
+    double prob;
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
@@ -0,0 +1,236 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_CAUCHY_H_
+#define ROCRAND_RNG_DISTRIBUTION_CAUCHY_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "uniform.hpp"
+
+// Inverse-CDF Cauchy sampling with location \p median and scale
+// \p scale, fused into the generation pass like the other
+// distributions (see rocrand_generate_cauchy()). The textbook form
+// median + scale * tan(pi * (u - 1/2)) is rewritten through the
+// identity tan(pi * (u - 1/2)) = -cot(pi * u), which stays finite on
+// the whole (0; 1] range the uniform convention produces.
+
+template<class T>
+struct cauchy_distribution;
+
+template<>
+struct cauchy_distribution<float>
+{
+    const float median;
+    const float scale;
+
+    __host__ __device__
+    cauchy_distribution<float>(float median, float scale) :
+                               median(median), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return median - scale / tanf(ROCRAND_PI * uniform_distribution<float>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct cauchy_distribution<double>
+{
+    const double median;
+    const double scale;
+
+    __host__ __device__
+    cauchy_distribution<double>(double median, double scale) :
+                                median(median), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return median - scale / tan(ROCRAND_PI_DOUBLE * uniform_distribution<double>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v1, const unsigned int v2) const
+    {
+        return median - scale / tan(ROCRAND_PI_DOUBLE * uniform_distribution<double>()(v1, v2));
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned long long v) const
+    {
+        return median - scale / tan(ROCRAND_PI_DOUBLE * uniform_distribution<double>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const uint4 v) const
+    {
+        return double2 {
+            (*this)(v.x, v.y),
+            (*this)(v.z, v.w)
+        };
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v1, const uint4 v2) const
+    {
+        return double4 {
+            (*this)(v1.x, v1.y),
+            (*this)(v1.z, v1.w),
+            (*this)(v2.x, v2.y),
+            (*this)(v2.z, v2.w)
+        };
+    }
+};
+
+template<class T>
+struct mrg_cauchy_distribution;
+
+template<>
+struct mrg_cauchy_distribution<float>
+{
+    const float median;
+    const float scale;
+
+    __host__ __device__
+    mrg_cauchy_distribution<float>(float median, float scale) :
+                                   median(median), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return median - scale / tanf(ROCRAND_PI * mrg_uniform_distribution<float>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg_cauchy_distribution<double>
+{
+    const double median;
+    const double scale;
+
+    __host__ __device__
+    mrg_cauchy_distribution<double>(double median, double scale) :
+                                    median(median), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return median - scale / tan(ROCRAND_PI_DOUBLE * mrg_uniform_distribution<double>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<class T>
+struct mrg31k3p_cauchy_distribution;
+
+template<>
+struct mrg31k3p_cauchy_distribution<float>
+{
+    const float median;
+    const float scale;
+
+    __host__ __device__
+    mrg31k3p_cauchy_distribution<float>(float median, float scale) :
+                                        median(median), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return median - scale / tanf(ROCRAND_PI * mrg31k3p_uniform_distribution<float>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg31k3p_cauchy_distribution<double>
+{
+    const double median;
+    const double scale;
+
+    __host__ __device__
+    mrg31k3p_cauchy_distribution<double>(double median, double scale) :
+                                         median(median), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return median - scale / tan(ROCRAND_PI_DOUBLE * mrg31k3p_uniform_distribution<double>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_CAUCHY_H_
@@ -22,11 +22,14 @@
 #define ROCRAND_RNG_DISTRIBUTION_DISCRETE_H_
 
 #include <climits>
+#include <cstring>
 #include <algorithm>
 #include <vector>
 
 #include <rocrand.h>
 
+#include "common.hpp"
+#include "device_memory.hpp"
 #include "device_distributions.hpp"
 
 // Alias method
@@ -37,6 +40,325 @@
 // Vose M. D.
 // A Linear Algorithm For Generating Random Numbers With a Given Distribution, 1991
 
+namespace rocrand_host {
+namespace detail {
+
+    // Kernels building the tables directly on the device when the
+    // caller's probabilities are already in device memory (see
+    // rocrand_discrete_distribution_base::init_device()). The otherwise
+    // sequential alias table construction is parallelized by splitting
+    // the lists of underfull and overfull buckets into sections that
+    // can be packed independently.
+
+    static const unsigned int discrete_build_threads = 256;
+
+    __global__
+    void discrete_sum_kernel(const double * values,
+                             const unsigned int size,
+                             double * sum)
+    {
+        __shared__ double partial[discrete_build_threads];
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        double value = 0.0;
+        while (index < size)
+        {
+            value += values[index];
+            index += stride;
+        }
+        partial[hipThreadIdx_x] = value;
+        __syncthreads();
+        for (unsigned int d = hipBlockDim_x / 2; d > 0; d /= 2)
+        {
+            if (hipThreadIdx_x < d)
+            {
+                partial[hipThreadIdx_x] += partial[hipThreadIdx_x + d];
+            }
+            __syncthreads();
+        }
+        if (hipThreadIdx_x == 0)
+        {
+            atomic_add(sum, partial[0]);
+        }
+    }
+
+    // Scales the probabilities so they average to 1 and splits the
+    // buckets into underfull (scaled probability below 1) and overfull
+    // ones. The scaled probability of an underfull bucket is already
+    // its final table entry, and the identity alias stands in for
+    // buckets that keep their whole probability.
+    __global__
+    void discrete_classify_kernel(const double * values,
+                                  const unsigned int size,
+                                  const double * sum,
+                                  double * probability,
+                                  unsigned int * alias,
+                                  unsigned int * light,
+                                  unsigned int * heavy,
+                                  unsigned int * counts)
+    {
+        const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if (index >= size)
+        {
+            return;
+        }
+
+        const double p = values[index] * size / *sum;
+        probability[index] = p;
+        alias[index] = index;
+        if (p < 1.0)
+        {
+            light[atomicAdd(&counts[0], 1)] = index;
+        }
+        else
+        {
+            heavy[atomicAdd(&counts[1], 1)] = index;
+        }
+    }
+
+    // Block-wise inclusive scan; the optional indices gather the
+    // scanned values, so the same kernel processes the underfull and
+    // overfull bucket lists and the CDF.
+    __global__
+    void discrete_scan_kernel(const double * values,
+                              const unsigned int * indices,
+                              const unsigned int size,
+                              double * prefix,
+                              double * block_sums)
+    {
+        __shared__ double partial[discrete_build_threads];
+        const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        double value = 0.0;
+        if (index < size)
+        {
+            value = (indices != NULL) ? values[indices[index]] : values[index];
+        }
+        partial[hipThreadIdx_x] = value;
+        __syncthreads();
+        for (unsigned int d = 1; d < hipBlockDim_x; d *= 2)
+        {
+            double t = 0.0;
+            if (hipThreadIdx_x >= d)
+            {
+                t = partial[hipThreadIdx_x - d];
+            }
+            __syncthreads();
+            partial[hipThreadIdx_x] += t;
+            __syncthreads();
+        }
+        if (index < size)
+        {
+            prefix[index] = partial[hipThreadIdx_x];
+        }
+        if (hipThreadIdx_x == hipBlockDim_x - 1)
+        {
+            block_sums[hipBlockIdx_x] = partial[hipThreadIdx_x];
+        }
+    }
+
+    // Launched with a single thread: there is one value per block of
+    // the main scan, so the sequential pass is short
+    __global__
+    void discrete_scan_sums_kernel(double * block_sums,
+                                   const unsigned int count)
+    {
+        double sum = 0.0;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            sum += block_sums[i];
+            block_sums[i] = sum;
+        }
+    }
+
+    __global__
+    void discrete_scan_offset_kernel(double * prefix,
+                                     const double * block_sums,
+                                     const unsigned int size)
+    {
+        const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if (index >= size || hipBlockIdx_x == 0)
+        {
+            return;
+        }
+        prefix[index] += block_sums[hipBlockIdx_x - 1];
+    }
+
+    __global__
+    void discrete_convert_fp32_kernel(const double * values,
+                                      float * values_fp32,
+                                      const unsigned int size)
+    {
+        const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if (index >= size)
+        {
+            return;
+        }
+        values_fp32[index] = (float)values[index];
+    }
+
+    // Gathers the coarse top level of the CDF (the last entry of each
+    // segment); either of the output tables may be NULL
+    __global__
+    void discrete_cdf_top_kernel(const double * cdf,
+                                 const unsigned int size,
+                                 double * cdf_top,
+                                 float * cdf_top_fp32,
+                                 const unsigned int cdf_top_size)
+    {
+        const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if (index >= cdf_top_size)
+        {
+            return;
+        }
+        unsigned int last = (index + 1) * ROCRAND_DISCRETE_CDF_TOP_STRIDE - 1;
+        if (last >= size)
+        {
+            last = size - 1;
+        }
+        const double value = cdf[last];
+        if (cdf_top != NULL)
+        {
+            cdf_top[index] = value;
+        }
+        if (cdf_top_fp32 != NULL)
+        {
+            cdf_top_fp32[index] = value;
+        }
+    }
+
+    __global__
+    void discrete_cdf_normalize_kernel(double * cdf,
+                                       const unsigned int size,
+                                       const double * sum)
+    {
+        const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if (index >= size)
+        {
+            return;
+        }
+        cdf[index] /= *sum;
+    }
+
+    // Finds the overfull bucket that is the current donor once the
+    // first light_index underfull buckets are filled. Filling i
+    // underfull and closing j overfull buckets consumes i + j units of
+    // scaled probability, so donor j has residual
+    // L(i) + H(j + 1) - i - j left; the residual is nondecreasing in j
+    // and the donor is the first bucket with a residual of at least 1.
+    __forceinline__ __device__
+    unsigned int discrete_find_donor(const double * light_prefix,
+                                     const double * heavy_prefix,
+                                     const unsigned int heavy_count,
+                                     const unsigned int light_index)
+    {
+        const double filled = 1.0 + (double)light_index
+            - (light_index > 0 ? light_prefix[light_index - 1] : 0.0);
+        unsigned int lo = 0;
+        unsigned int hi = heavy_count;
+        while (lo < hi)
+        {
+            const unsigned int mid = (lo + hi) / 2;
+            if (heavy_prefix[mid] - (double)mid >= filled)
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+        return lo;
+    }
+
+    // Fills the underfull buckets with donations from the overfull
+    // ones. Each section handles a contiguous range of the underfull
+    // bucket list independently: the donor and its residual at the
+    // section boundary are recovered from the prefix sums, so no
+    // section depends on the packing done by another.
+    __global__
+    void discrete_sweep_kernel(double * probability,
+                               unsigned int * alias,
+                               const unsigned int * light,
+                               const unsigned int * heavy,
+                               const unsigned int light_count,
+                               const unsigned int heavy_count,
+                               const double * light_prefix,
+                               const double * heavy_prefix,
+                               const unsigned int sections)
+    {
+        const unsigned int section = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if (section >= sections)
+        {
+            return;
+        }
+
+        const unsigned int begin = (unsigned int)(
+            (unsigned long long)section * light_count / sections);
+        const unsigned int end = (unsigned int)(
+            (unsigned long long)(section + 1) * light_count / sections);
+        unsigned int j = discrete_find_donor(
+            light_prefix, heavy_prefix, heavy_count, begin);
+        // The last section also closes the overfull buckets left after
+        // all underfull ones are filled
+        const unsigned int j_end = (section == sections - 1)
+            ? heavy_count
+            : discrete_find_donor(light_prefix, heavy_prefix, heavy_count, end);
+
+        double w = 0.0;
+        if (j < heavy_count)
+        {
+            w = (begin > 0 ? light_prefix[begin - 1] : 0.0)
+                + heavy_prefix[j] - (double)begin - (double)j;
+        }
+
+        for (unsigned int i = begin; i < end; i++)
+        {
+            const unsigned int less = light[i];
+            // The underfull bucket keeps its scaled probability (written
+            // by the classify kernel); the donor fills the remainder
+            alias[less] = heavy[j < heavy_count ? j : heavy_count - 1];
+            w -= 1.0 - probability[less];
+            while (w < 1.0 && j < j_end)
+            {
+                // The donor dropped below the average and became
+                // underfull itself; the next overfull bucket fills it.
+                // Closing buckets outside [j; j_end) is left to the
+                // neighbouring sections, which also keeps the reads of
+                // their scaled probabilities free of races.
+                const unsigned int closed = heavy[j];
+                const double r = w > 0.0 ? w : 0.0;
+                j++;
+                if (j < j_end)
+                {
+                    w = probability[heavy[j]] - (1.0 - r);
+                }
+                probability[closed] = r;
+                alias[closed] = heavy[j < heavy_count ? j : heavy_count - 1];
+            }
+        }
+        // Overfull buckets left in the section's range hold exactly the
+        // average probability, up to rounding
+        while (j < j_end)
+        {
+            const unsigned int closed = heavy[j];
+            double r = w < 1.0 ? w : 1.0;
+            if (r < 0.0)
+            {
+                r = 0.0;
+            }
+            j++;
+            if (j < j_end)
+            {
+                w = probability[heavy[j]] - (1.0 - r);
+            }
+            probability[closed] = r;
+            alias[closed] = heavy[j < heavy_count ? j : heavy_count - 1];
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 enum rocrand_discrete_method
 {
     ROCRAND_DISCRETE_METHOD_ALIAS = 1,
@@ -55,13 +377,37 @@ public:
         probability = NULL;
         alias = NULL;
         cdf = NULL;
+        probability_fp32 = NULL;
+        cdf_fp32 = NULL;
+        cdf_top_size = 0;
+        cdf_top = NULL;
+        cdf_top_fp32 = NULL;
+        fp32_tables = false;
     }
 
     rocrand_discrete_distribution_base(const double * probabilities,
                                        unsigned int size,
-                                       unsigned int offset)
+                                       unsigned int offset,
+                                       bool use_fp32_tables = false)
         : rocrand_discrete_distribution_base()
     {
+        fp32_tables = use_fp32_tables;
+        if (!IsHostSide)
+        {
+            // Probabilities that are already resident on the device are
+            // processed in place by construction kernels, avoiding the
+            // host loops and the copy over PCIe
+            hipPointerAttribute_t attributes;
+            if (hipPointerGetAttributes(&attributes, probabilities) == hipSuccess
+                && attributes.memoryType == hipMemoryTypeDevice)
+            {
+                init_device(probabilities, size, offset);
+                return;
+            }
+            // A plain host pointer is not registered with the runtime
+            hipGetLastError();
+        }
+
         std::vector<double> p(probabilities, probabilities + size);
 
         init(p, size, offset);
@@ -70,7 +416,10 @@ public:
     __host__ __device__
     ~rocrand_discrete_distribution_base() { }
 
-    void deallocate()
+    // \p stream is the stream whose queued kernels may still read the
+    // tables (the generator's stream on rebuilds); the blocks are only
+    // recycled after that work has drained
+    void deallocate(hipStream_t stream = 0)
     {
         // Explicit deallocation is used because on HCC the object is copied
         // multiple times inside hipLaunchKernelGGL, and destructor is called
@@ -89,25 +438,62 @@ public:
             {
                 delete[] cdf;
             }
+            if (probability_fp32 != NULL)
+            {
+                delete[] probability_fp32;
+            }
+            if (cdf_fp32 != NULL)
+            {
+                delete[] cdf_fp32;
+            }
+            if (cdf_top != NULL)
+            {
+                delete[] cdf_top;
+            }
+            if (cdf_top_fp32 != NULL)
+            {
+                delete[] cdf_top_fp32;
+            }
         }
         else
         {
             if (probability != NULL)
             {
-                hipFree(probability);
+                rocrand_host::detail::device_free(probability, stream);
             }
             if (alias != NULL)
             {
-                hipFree(alias);
+                rocrand_host::detail::device_free(alias, stream);
             }
             if (cdf != NULL)
             {
-                hipFree(cdf);
+                rocrand_host::detail::device_free(cdf, stream);
+            }
+            if (probability_fp32 != NULL)
+            {
+                rocrand_host::detail::device_free(probability_fp32, stream);
+            }
+            if (cdf_fp32 != NULL)
+            {
+                rocrand_host::detail::device_free(cdf_fp32, stream);
+            }
+            if (cdf_top != NULL)
+            {
+                rocrand_host::detail::device_free(cdf_top, stream);
+            }
+            if (cdf_top_fp32 != NULL)
+            {
+                rocrand_host::detail::device_free(cdf_top_fp32, stream);
             }
         }
         probability = NULL;
         alias = NULL;
         cdf = NULL;
+        probability_fp32 = NULL;
+        cdf_fp32 = NULL;
+        cdf_top_size = 0;
+        cdf_top = NULL;
+        cdf_top_fp32 = NULL;
     }
 
     __forceinline__ __host__ __device__
@@ -145,18 +531,372 @@ protected:
         }
     }
 
+    // Like init(), but the finished host tables are uploaded with
+    // hipMemcpyAsync through pinned slots of \p staging, so the call
+    // returns once the copies are enqueued on \p stream instead of
+    // blocking on them. Work queued on \p stream afterwards (the
+    // generation kernels) is ordered after the uploads; \p staging
+    // keeps each slot's buffer untouched until its upload completes.
+    void init_async(std::vector<double> p,
+                    const unsigned int size,
+                    const unsigned int offset,
+                    hipStream_t stream,
+                    rocrand_host::detail::pinned_staging& staging)
+    {
+        this->size = size;
+        this->offset = offset;
+
+        deallocate(stream);
+        allocate();
+        normalize(p);
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        {
+            create_alias_table(p, stream, &staging);
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+        {
+            create_cdf(p, stream, &staging);
+        }
+    }
+
+    // Uploads one finished host table, either blocking (no staging)
+    // or asynchronously through a pinned staging slot
+    template<class T>
+    void upload_table(T * dst, const T * src, size_t count,
+                      hipStream_t stream,
+                      rocrand_host::detail::pinned_staging * staging)
+    {
+        hipError_t error;
+        if (staging == NULL)
+        {
+            error = hipMemcpy(dst, src, sizeof(T) * count, hipMemcpyDefault);
+        }
+        else
+        {
+            void * buffer = NULL;
+            if (staging->acquire(&buffer, sizeof(T) * count) != hipSuccess)
+            {
+                throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            std::memcpy(buffer, src, sizeof(T) * count);
+            error = hipMemcpyAsync(dst, buffer, sizeof(T) * count,
+                                   hipMemcpyDefault, stream);
+            if (error == hipSuccess)
+            {
+                error = staging->record(stream);
+            }
+        }
+        if (error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    // Builds the tables from probabilities in device memory with a few
+    // kernel launches instead of host loops followed by copies (for
+    // 1M-entry distributions the host construction takes hundreds of
+    // milliseconds and serializes on the PCIe transfer)
+    void init_device(const double * probabilities,
+                     const unsigned int size,
+                     const unsigned int offset)
+    {
+        this->size = size;
+        this->offset = offset;
+
+        deallocate();
+        allocate();
+
+        const unsigned int threads = rocrand_host::detail::discrete_build_threads;
+        const unsigned int blocks = (size + threads - 1) / threads;
+
+        double * sum = NULL;
+        double * block_sums = NULL;
+        double * light_prefix = NULL;
+        double * heavy_prefix = NULL;
+        unsigned int * light = NULL;
+        unsigned int * heavy = NULL;
+        unsigned int * counts = NULL;
+        // In the single-precision mode the construction still runs in
+        // double precision on scratch arrays and converts the finished
+        // tables at the end
+        double * scratch_probability = NULL;
+        double * scratch_cdf = NULL;
+
+        auto free_temporaries = [&]()
+        {
+            rocrand_host::detail::device_free(sum);
+            rocrand_host::detail::device_free(block_sums);
+            rocrand_host::detail::device_free(light_prefix);
+            rocrand_host::detail::device_free(heavy_prefix);
+            rocrand_host::detail::device_free(light);
+            rocrand_host::detail::device_free(heavy);
+            rocrand_host::detail::device_free(counts);
+            rocrand_host::detail::device_free(scratch_probability);
+            rocrand_host::detail::device_free(scratch_cdf);
+        };
+
+        hipError_t error;
+        error = rocrand_host::detail::device_malloc(&sum, sizeof(double));
+        if (error == hipSuccess)
+        {
+            error = rocrand_host::detail::device_malloc(&block_sums, sizeof(double) * blocks);
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+        {
+            if (error == hipSuccess && fp32_tables)
+            {
+                error = rocrand_host::detail::device_malloc(&scratch_probability, sizeof(double) * size);
+            }
+            if (error == hipSuccess)
+            {
+                error = rocrand_host::detail::device_malloc(&light_prefix, sizeof(double) * size);
+            }
+            if (error == hipSuccess)
+            {
+                error = rocrand_host::detail::device_malloc(&heavy_prefix, sizeof(double) * size);
+            }
+            if (error == hipSuccess)
+            {
+                error = rocrand_host::detail::device_malloc(&light, sizeof(unsigned int) * size);
+            }
+            if (error == hipSuccess)
+            {
+                error = rocrand_host::detail::device_malloc(&heavy, sizeof(unsigned int) * size);
+            }
+            if (error == hipSuccess)
+            {
+                error = rocrand_host::detail::device_malloc(&counts, sizeof(unsigned int) * 2);
+            }
+        }
+        if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+        {
+            if (error == hipSuccess && fp32_tables)
+            {
+                error = rocrand_host::detail::device_malloc(&scratch_cdf, sizeof(double) * size);
+            }
+        }
+        if (error != hipSuccess)
+        {
+            free_temporaries();
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+
+        double * const build_probability =
+            fp32_tables ? scratch_probability : probability;
+        double * const build_cdf = fp32_tables ? scratch_cdf : cdf;
+
+        try
+        {
+            error = hipMemset(sum, 0, sizeof(double));
+            if (error != hipSuccess)
+            {
+                throw ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::discrete_sum_kernel),
+                dim3(std::min(blocks, 1024u)), dim3(threads), 0, 0,
+                probabilities, size, sum
+            );
+            // Check kernel status
+            if (hipPeekAtLastError() != hipSuccess)
+            {
+                throw ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+
+            if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
+            {
+                error = hipMemset(counts, 0, sizeof(unsigned int) * 2);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::discrete_classify_kernel),
+                    dim3(blocks), dim3(threads), 0, 0,
+                    probabilities, size, sum,
+                    build_probability, alias, light, heavy, counts
+                );
+                if (hipPeekAtLastError() != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_LAUNCH_FAILURE;
+                }
+
+                unsigned int h_counts[2];
+                error = hipMemcpy(h_counts, counts, sizeof(unsigned int) * 2,
+                                  hipMemcpyDefault);
+                if (error != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+                const unsigned int light_count = h_counts[0];
+                const unsigned int heavy_count = h_counts[1];
+
+                // Without underfull buckets all scaled probabilities
+                // are 1 and the classify kernel already wrote the
+                // final table
+                if (light_count > 0 && heavy_count > 0)
+                {
+                    device_inclusive_scan(probabilities, light, light_count,
+                                          light_prefix, block_sums);
+                    device_inclusive_scan(probabilities, heavy, heavy_count,
+                                          heavy_prefix, block_sums);
+
+                    // Enough sections to occupy the device while keeping
+                    // the sequential pass of each section short
+                    const unsigned int sections = std::min(light_count, 4096u);
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(rocrand_host::detail::discrete_sweep_kernel),
+                        dim3((sections + threads - 1) / threads), dim3(threads), 0, 0,
+                        build_probability, alias, light, heavy,
+                        light_count, heavy_count,
+                        light_prefix, heavy_prefix, sections
+                    );
+                    if (hipPeekAtLastError() != hipSuccess)
+                    {
+                        throw ROCRAND_STATUS_LAUNCH_FAILURE;
+                    }
+                }
+                if (fp32_tables)
+                {
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(rocrand_host::detail::discrete_convert_fp32_kernel),
+                        dim3(blocks), dim3(threads), 0, 0,
+                        build_probability, probability_fp32, size
+                    );
+                    if (hipPeekAtLastError() != hipSuccess)
+                    {
+                        throw ROCRAND_STATUS_LAUNCH_FAILURE;
+                    }
+                }
+            }
+            if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
+            {
+                device_inclusive_scan(probabilities, NULL, size,
+                                      build_cdf, block_sums);
+                hipLaunchKernelGGL(
+                    HIP_KERNEL_NAME(rocrand_host::detail::discrete_cdf_normalize_kernel),
+                    dim3(blocks), dim3(threads), 0, 0,
+                    build_cdf, size, sum
+                );
+                if (hipPeekAtLastError() != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_LAUNCH_FAILURE;
+                }
+                if (fp32_tables)
+                {
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(rocrand_host::detail::discrete_convert_fp32_kernel),
+                        dim3(blocks), dim3(threads), 0, 0,
+                        build_cdf, cdf_fp32, size
+                    );
+                    if (hipPeekAtLastError() != hipSuccess)
+                    {
+                        throw ROCRAND_STATUS_LAUNCH_FAILURE;
+                    }
+                }
+                if (cdf_top_size > 0)
+                {
+                    hipLaunchKernelGGL(
+                        HIP_KERNEL_NAME(rocrand_host::detail::discrete_cdf_top_kernel),
+                        dim3((cdf_top_size + threads - 1) / threads),
+                        dim3(threads), 0, 0,
+                        build_cdf, size, cdf_top, cdf_top_fp32, cdf_top_size
+                    );
+                    if (hipPeekAtLastError() != hipSuccess)
+                    {
+                        throw ROCRAND_STATUS_LAUNCH_FAILURE;
+                    }
+                }
+            }
+        }
+        catch(...)
+        {
+            free_temporaries();
+            throw;
+        }
+        free_temporaries();
+    }
+
+    void device_inclusive_scan(const double * values,
+                               const unsigned int * indices,
+                               const unsigned int size,
+                               double * prefix,
+                               double * block_sums)
+    {
+        const unsigned int threads = rocrand_host::detail::discrete_build_threads;
+        const unsigned int blocks = (size + threads - 1) / threads;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::discrete_scan_kernel),
+            dim3(blocks), dim3(threads), 0, 0,
+            values, indices, size, prefix, block_sums
+        );
+        // Check kernel status
+        if (hipPeekAtLastError() != hipSuccess)
+        {
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::discrete_scan_sums_kernel),
+            dim3(1), dim3(1), 0, 0,
+            block_sums, blocks
+        );
+        if (hipPeekAtLastError() != hipSuccess)
+        {
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::discrete_scan_offset_kernel),
+            dim3(blocks), dim3(threads), 0, 0,
+            prefix, block_sums, size
+        );
+        if (hipPeekAtLastError() != hipSuccess)
+        {
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+    }
+
     void allocate()
     {
         if (IsHostSide)
         {
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
             {
-                probability = new double[size];
+                if (fp32_tables)
+                {
+                    probability_fp32 = new float[size];
+                }
+                else
+                {
+                    probability = new double[size];
+                }
                 alias = new unsigned int[size];
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
-                cdf = new double[size];
+                if (fp32_tables)
+                {
+                    cdf_fp32 = new float[size];
+                }
+                else
+                {
+                    cdf = new double[size];
+                }
+                // The coarse top level pays off only when the table
+                // spans multiple segments
+                if (size > ROCRAND_DISCRETE_CDF_TOP_STRIDE)
+                {
+                    cdf_top_size = (size + ROCRAND_DISCRETE_CDF_TOP_STRIDE - 1)
+                        / ROCRAND_DISCRETE_CDF_TOP_STRIDE;
+                    if (fp32_tables)
+                    {
+                        cdf_top_fp32 = new float[cdf_top_size];
+                    }
+                    else
+                    {
+                        cdf_top = new double[cdf_top_size];
+                    }
+                }
             }
         }
         else
@@ -164,12 +904,19 @@ protected:
             hipError_t error;
             if ((Method & ROCRAND_DISCRETE_METHOD_ALIAS) != 0)
             {
-                error = hipMalloc(&probability, sizeof(double) * size);
+                if (fp32_tables)
+                {
+                    error = rocrand_host::detail::device_malloc(&probability_fp32, sizeof(float) * size);
+                }
+                else
+                {
+                    error = rocrand_host::detail::device_malloc(&probability, sizeof(double) * size);
+                }
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
-                error = hipMalloc(&alias, sizeof(unsigned int) * size);
+                error = rocrand_host::detail::device_malloc(&alias, sizeof(unsigned int) * size);
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -177,30 +924,86 @@ protected:
             }
             if ((Method & ROCRAND_DISCRETE_METHOD_CDF) != 0)
             {
-                error = hipMalloc(&cdf, sizeof(double) * size);
+                if (fp32_tables)
+                {
+                    error = rocrand_host::detail::device_malloc(&cdf_fp32, sizeof(float) * size);
+                }
+                else
+                {
+                    error = rocrand_host::detail::device_malloc(&cdf, sizeof(double) * size);
+                }
                 if (error != hipSuccess)
                 {
                     throw ROCRAND_STATUS_ALLOCATION_FAILED;
                 }
+                // The coarse top level pays off only when the table
+                // spans multiple segments
+                if (size > ROCRAND_DISCRETE_CDF_TOP_STRIDE)
+                {
+                    cdf_top_size = (size + ROCRAND_DISCRETE_CDF_TOP_STRIDE - 1)
+                        / ROCRAND_DISCRETE_CDF_TOP_STRIDE;
+                    if (fp32_tables)
+                    {
+                        error = rocrand_host::detail::device_malloc(&cdf_top_fp32,
+                                          sizeof(float) * cdf_top_size);
+                    }
+                    else
+                    {
+                        error = rocrand_host::detail::device_malloc(&cdf_top,
+                                          sizeof(double) * cdf_top_size);
+                    }
+                    if (error != hipSuccess)
+                    {
+                        throw ROCRAND_STATUS_ALLOCATION_FAILED;
+                    }
+                }
             }
         }
     }
 
     void normalize(std::vector<double>& p)
     {
+        // Fixed-size blocks keep the summation order, and with it the
+        // rounding, independent of the worker count
+        const unsigned int block = 4096;
+        const unsigned int blocks = (size + block - 1) / block;
+        std::vector<double> partial(blocks, 0.0);
+        rocrand_host::detail::parallel_for(blocks,
+            [&](size_t first, size_t last)
+            {
+                for (size_t b = first; b < last; b++)
+                {
+                    const unsigned int end =
+                        std::min<unsigned int>((b + 1) * block, size);
+                    double s = 0.0;
+                    for (unsigned int i = b * block; i < end; i++)
+                    {
+                        s += p[i];
+                    }
+                    partial[b] = s;
+                }
+            },
+            // Blocks are heavy; a handful already justifies workers
+            16);
         double sum = 0.0;
-        for (unsigned int i = 0; i < size; i++)
+        for (unsigned int b = 0; b < blocks; b++)
         {
-            sum += p[i];
+            sum += partial[b];
         }
         // Normalize probabilities
-        for (unsigned int i = 0; i < size; i++)
-        {
-            p[i] /= sum;
-        }
+        rocrand_host::detail::parallel_for(size,
+            [&](size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; i++)
+                {
+                    p[i] /= sum;
+                }
+            });
     }
 
-    void create_alias_table(std::vector<double> p)
+    void create_alias_table(std::vector<double> p,
+                            hipStream_t stream = 0,
+                            rocrand_host::detail::pinned_staging * staging = NULL)
     {
         std::vector<double> h_probability(size);
         std::vector<unsigned int> h_alias(size);
@@ -220,14 +1023,41 @@ protected:
         small.reserve(size);
         large.reserve(size);
 
-        for (unsigned int i = 0; i < size; i++)
+        // Blocked parallel partition; appending the per-block runs in
+        // block order reproduces the index order, and with it the
+        // worklist processing order and the resulting table, of the
+        // serial loop
         {
-            if (p[i] >= average)
-                large.push_back(i);
-            else
-                small.push_back(i);
+            const unsigned int block = 65536;
+            const unsigned int blocks = (size + block - 1) / block;
+            std::vector<std::vector<unsigned int>> small_runs(blocks);
+            std::vector<std::vector<unsigned int>> large_runs(blocks);
+            rocrand_host::detail::parallel_for(blocks,
+                [&](size_t first, size_t last)
+                {
+                    for (size_t b = first; b < last; b++)
+                    {
+                        const unsigned int end =
+                            std::min<unsigned int>((b + 1) * block, size);
+                        for (unsigned int i = b * block; i < end; i++)
+                        {
+                            if (p[i] >= average)
+                                large_runs[b].push_back(i);
+                            else
+                                small_runs[b].push_back(i);
+                        }
+                    }
+                },
+                4);
+            for (unsigned int b = 0; b < blocks; b++)
+            {
+                small.insert(small.end(), small_runs[b].begin(), small_runs[b].end());
+                large.insert(large.end(), large_runs[b].begin(), large_runs[b].end());
+            }
         }
 
+        // The worklist walk carries state from step to step and stays
+        // serial; it is cheap next to the element-wise passes above
         while (!small.empty() && !large.empty())
         {
             const unsigned int less = small.back();
@@ -255,28 +1085,44 @@ protected:
             h_probability[i] = 1.0;
         }
 
+        std::vector<float> h_probability_fp32;
+        if (fp32_tables)
+        {
+            h_probability_fp32.assign(h_probability.begin(), h_probability.end());
+        }
+
         if (IsHostSide)
         {
-            std::copy(h_probability.begin(), h_probability.end(), probability);
+            if (fp32_tables)
+            {
+                std::copy(h_probability_fp32.begin(), h_probability_fp32.end(),
+                          probability_fp32);
+            }
+            else
+            {
+                std::copy(h_probability.begin(), h_probability.end(), probability);
+            }
             std::copy(h_alias.begin(), h_alias.end(), alias);
         }
         else
         {
-            hipError_t error;
-            error = hipMemcpy(probability, h_probability.data(), sizeof(double) * size, hipMemcpyDefault);
-            if (error != hipSuccess)
+            if (fp32_tables)
             {
-                throw ROCRAND_STATUS_INTERNAL_ERROR;
+                upload_table(probability_fp32, h_probability_fp32.data(), size,
+                             stream, staging);
             }
-            error = hipMemcpy(alias, h_alias.data(), sizeof(unsigned int) * size, hipMemcpyDefault);
-            if (error != hipSuccess)
+            else
             {
-                throw ROCRAND_STATUS_INTERNAL_ERROR;
+                upload_table(probability, h_probability.data(), size,
+                             stream, staging);
             }
+            upload_table(alias, h_alias.data(), size, stream, staging);
         }
     }
 
-    void create_cdf(std::vector<double> p)
+    void create_cdf(std::vector<double> p,
+                    hipStream_t stream = 0,
+                    rocrand_host::detail::pinned_staging * staging = NULL)
     {
         std::vector<double> h_cdf(size);
 
@@ -287,20 +1133,110 @@ protected:
             h_cdf[i] = sum;
         }
 
+        std::vector<float> h_cdf_fp32;
+        if (fp32_tables)
+        {
+            h_cdf_fp32.assign(h_cdf.begin(), h_cdf.end());
+        }
+
+        std::vector<double> h_cdf_top(cdf_top_size);
+        for (unsigned int t = 0; t < cdf_top_size; t++)
+        {
+            const unsigned int last = std::min<unsigned int>(
+                (t + 1) * ROCRAND_DISCRETE_CDF_TOP_STRIDE, size) - 1;
+            h_cdf_top[t] = h_cdf[last];
+        }
+
         if (IsHostSide)
         {
-            std::copy(h_cdf.begin(), h_cdf.end(), cdf);
+            if (fp32_tables)
+            {
+                std::copy(h_cdf_fp32.begin(), h_cdf_fp32.end(), cdf_fp32);
+                std::copy(h_cdf_top.begin(), h_cdf_top.end(), cdf_top_fp32);
+            }
+            else
+            {
+                std::copy(h_cdf.begin(), h_cdf.end(), cdf);
+                std::copy(h_cdf_top.begin(), h_cdf_top.end(), cdf_top);
+            }
         }
         else
         {
-            hipError_t error;
-            error = hipMemcpy(cdf, h_cdf.data(), sizeof(double) * size, hipMemcpyDefault);
-            if (error != hipSuccess)
+            if (fp32_tables)
             {
-                throw ROCRAND_STATUS_INTERNAL_ERROR;
+                upload_table(cdf_fp32, h_cdf_fp32.data(), size, stream, staging);
+            }
+            else
+            {
+                upload_table(cdf, h_cdf.data(), size, stream, staging);
             }
+            if (cdf_top_size > 0)
+            {
+                if (fp32_tables)
+                {
+                    std::vector<float> h_cdf_top_fp32(h_cdf_top.begin(),
+                                                      h_cdf_top.end());
+                    upload_table(cdf_top_fp32, h_cdf_top_fp32.data(),
+                                 cdf_top_size, stream, staging);
+                }
+                else
+                {
+                    upload_table(cdf_top, h_cdf_top.data(), cdf_top_size,
+                                 stream, staging);
+                }
+            }
+        }
+    }
+
+    // Selects the single-precision tables (probability_fp32, cdf_fp32)
+    // over the double-precision ones
+    bool fp32_tables;
+};
+
+// Handles caching of the table built from user-supplied weights (see
+// rocrand_sample_discrete()). The weights are identified by their
+// pointer and count, as fingerprinting their values on every call would
+// defeat the cache; callers must pass a different pointer (or count)
+// after changing the weight values in place.
+template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
+class discrete_distribution_manager
+{
+public:
+
+    rocrand_discrete_distribution_base<Method, IsHostSide> dis;
+
+    discrete_distribution_manager()
+        : weights(NULL), count(0), last_stream(0)
+    { }
+
+    ~discrete_distribution_manager()
+    {
+        dis.deallocate(last_stream);
+    }
+
+    // \p stream is the owning generator's stream: sampling kernels
+    // queued there may still read the previous tables, so rebuilds
+    // (and the final teardown) release the old tables against it
+    void set_weights(const double * new_weights, unsigned int new_count,
+                     hipStream_t stream = 0)
+    {
+        const bool changed = weights != new_weights || count != new_count;
+        if (changed)
+        {
+            weights = new_weights;
+            count = new_count;
+            dis.deallocate(stream);
+            dis = rocrand_discrete_distribution_base<Method, IsHostSide>(
+                new_weights, new_count, 0);
         }
+        last_stream = stream;
     }
+
+private:
+
+    const double * weights;
+    unsigned int count;
+    hipStream_t last_stream;
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_DISCRETE_H_
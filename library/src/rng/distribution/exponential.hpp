@@ -0,0 +1,228 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "uniform.hpp"
+
+// Inverse-CDF exponential sampling with rate \p lambda: one value of
+// -log(u) / lambda per uniform value from (0; 1], so the transform is
+// fused into the generation pass like the other distributions (see
+// rocrand_generate_exponential()).
+
+template<class T>
+struct exponential_distribution;
+
+template<>
+struct exponential_distribution<float>
+{
+    const float inv_lambda;
+
+    __host__ __device__
+    exponential_distribution<float>(float lambda) :
+                                    inv_lambda(1.0f / lambda) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return -logf(uniform_distribution<float>()(v)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct exponential_distribution<double>
+{
+    const double inv_lambda;
+
+    __host__ __device__
+    exponential_distribution<double>(double lambda) :
+                                     inv_lambda(1.0 / lambda) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return -log(uniform_distribution<double>()(v)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v1, const unsigned int v2) const
+    {
+        return -log(uniform_distribution<double>()(v1, v2)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned long long v) const
+    {
+        return -log(uniform_distribution<double>()(v)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const uint4 v) const
+    {
+        return double2 {
+            (*this)(v.x, v.y),
+            (*this)(v.z, v.w)
+        };
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v1, const uint4 v2) const
+    {
+        return double4 {
+            (*this)(v1.x, v1.y),
+            (*this)(v1.z, v1.w),
+            (*this)(v2.x, v2.y),
+            (*this)(v2.z, v2.w)
+        };
+    }
+};
+
+template<class T>
+struct mrg_exponential_distribution;
+
+template<>
+struct mrg_exponential_distribution<float>
+{
+    const float inv_lambda;
+
+    __host__ __device__
+    mrg_exponential_distribution<float>(float lambda) :
+                                        inv_lambda(1.0f / lambda) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return -logf(mrg_uniform_distribution<float>()(v)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg_exponential_distribution<double>
+{
+    const double inv_lambda;
+
+    __host__ __device__
+    mrg_exponential_distribution<double>(double lambda) :
+                                         inv_lambda(1.0 / lambda) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return -log(mrg_uniform_distribution<double>()(v)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<class T>
+struct mrg31k3p_exponential_distribution;
+
+template<>
+struct mrg31k3p_exponential_distribution<float>
+{
+    const float inv_lambda;
+
+    __host__ __device__
+    mrg31k3p_exponential_distribution<float>(float lambda) :
+                                             inv_lambda(1.0f / lambda) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return -logf(mrg31k3p_uniform_distribution<float>()(v)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg31k3p_exponential_distribution<double>
+{
+    const double inv_lambda;
+
+    __host__ __device__
+    mrg31k3p_exponential_distribution<double>(double lambda) :
+                                              inv_lambda(1.0 / lambda) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return -log(mrg31k3p_uniform_distribution<double>()(v)) * inv_lambda;
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_EXPONENTIAL_H_
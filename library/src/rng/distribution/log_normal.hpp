@@ -26,6 +26,9 @@
 
 #include "common.hpp"
 #include "device_distributions.hpp"
+// For rocrand_host::detail::inverse_normal_cdf() and the rationale of
+// the sobol_* inverse-CDF variants
+#include "normal.hpp"
 
 template<class T>
 struct log_normal_distribution;
@@ -99,6 +102,43 @@ struct log_normal_distribution<double>
     }
 };
 
+// Inverse-CDF log-normal for the quasi-random generators (see
+// sobol_normal_distribution in normal.hpp)
+template<class T>
+struct sobol_log_normal_distribution;
+
+template<>
+struct sobol_log_normal_distribution<float>
+{
+    sobol_normal_distribution<float> normal;
+
+    __host__ __device__
+    sobol_log_normal_distribution<float>(const float mean, const float stddev) :
+                                         normal(mean, stddev) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int x) const
+    {
+        return expf(normal(x));
+    }
+};
+
+template<>
+struct sobol_log_normal_distribution<double>
+{
+    sobol_normal_distribution<double> normal;
+
+    __host__ __device__
+    sobol_log_normal_distribution<double>(const double mean, const double stddev) :
+                                          normal(mean, stddev) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int x) const
+    {
+        return exp(normal(x));
+    }
+};
+
 template<class T>
 struct mrg_log_normal_distribution;
 
@@ -142,4 +182,47 @@ struct mrg_log_normal_distribution<double>
     }
 };
 
+template<class T>
+struct mrg31k3p_log_normal_distribution;
+
+template<>
+struct mrg31k3p_log_normal_distribution<float>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    mrg31k3p_log_normal_distribution<float>(float mean = 0.0f, float stddev = 1.0f) :
+                                       mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    float2 operator()(const unsigned int x, const unsigned int y)
+    {
+        float2 v = rocrand_device::detail::mrg31k3p_normal_distribution2(x, y);
+        v.x = expf(mean + (stddev * v.x));
+        v.y = expf(mean + (stddev * v.y));
+        return v;
+    }
+};
+
+template<>
+struct mrg31k3p_log_normal_distribution<double>
+{
+    const double mean;
+    const double stddev;
+
+    __host__ __device__
+    mrg31k3p_log_normal_distribution<double>(double mean = 0.0, double stddev = 1.0) :
+                                        mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const unsigned int x, const unsigned int y)
+    {
+        double2 v = rocrand_device::detail::mrg31k3p_normal_distribution_double2(x, y);
+        v.x = exp(mean + (stddev * v.x));
+        v.y = exp(mean + (stddev * v.y));
+        return v;
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_LOG_NORMAL_H_
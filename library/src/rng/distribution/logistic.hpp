@@ -0,0 +1,245 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_LOGISTIC_H_
+#define ROCRAND_RNG_DISTRIBUTION_LOGISTIC_H_
+
+#include <math.h>
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "device_distributions.hpp"
+#include "uniform.hpp"
+
+// Inverse-CDF logistic sampling with location \p location and scale
+// \p scale: one value of location + scale * log(u / (1 - u)) per
+// uniform value, fused into the generation pass like the other
+// distributions (see rocrand_generate_logistic()). The denominator is
+// floored at the granularity of the draw, so the closed endpoint of
+// the (0; 1] uniform convention maps to the quantile one half-draw in
+// instead of infinity.
+
+template<class T>
+struct logistic_distribution;
+
+template<>
+struct logistic_distribution<float>
+{
+    const float location;
+    const float scale;
+
+    __host__ __device__
+    logistic_distribution<float>(float location, float scale) :
+                                 location(location), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        const float u = uniform_distribution<float>()(v);
+        return location + scale * logf(u / fmaxf(1.0f - u, ROCRAND_2POW32_INV));
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct logistic_distribution<double>
+{
+    const double location;
+    const double scale;
+
+    __host__ __device__
+    logistic_distribution<double>(double location, double scale) :
+                                  location(location), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        const double u = uniform_distribution<double>()(v);
+        return location + scale * log(u / fmax(1.0 - u, ROCRAND_2POW32_INV_DOUBLE));
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v1, const unsigned int v2) const
+    {
+        const double u = uniform_distribution<double>()(v1, v2);
+        return location + scale * log(u / fmax(1.0 - u, ROCRAND_2POW53_INV_DOUBLE));
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned long long v) const
+    {
+        const double u = uniform_distribution<double>()(v);
+        return location + scale * log(u / fmax(1.0 - u, ROCRAND_2POW53_INV_DOUBLE));
+    }
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const uint4 v) const
+    {
+        return double2 {
+            (*this)(v.x, v.y),
+            (*this)(v.z, v.w)
+        };
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v1, const uint4 v2) const
+    {
+        return double4 {
+            (*this)(v1.x, v1.y),
+            (*this)(v1.z, v1.w),
+            (*this)(v2.x, v2.y),
+            (*this)(v2.z, v2.w)
+        };
+    }
+};
+
+template<class T>
+struct mrg_logistic_distribution;
+
+template<>
+struct mrg_logistic_distribution<float>
+{
+    const float location;
+    const float scale;
+
+    __host__ __device__
+    mrg_logistic_distribution<float>(float location, float scale) :
+                                     location(location), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        const float u = mrg_uniform_distribution<float>()(v);
+        return location + scale * logf(u / fmaxf(1.0f - u, ROCRAND_2POW32_INV));
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg_logistic_distribution<double>
+{
+    const double location;
+    const double scale;
+
+    __host__ __device__
+    mrg_logistic_distribution<double>(double location, double scale) :
+                                      location(location), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        const double u = mrg_uniform_distribution<double>()(v);
+        return location + scale * log(u / fmax(1.0 - u, ROCRAND_2POW32_INV_DOUBLE));
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<class T>
+struct mrg31k3p_logistic_distribution;
+
+template<>
+struct mrg31k3p_logistic_distribution<float>
+{
+    const float location;
+    const float scale;
+
+    __host__ __device__
+    mrg31k3p_logistic_distribution<float>(float location, float scale) :
+                                          location(location), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        const float u = mrg31k3p_uniform_distribution<float>()(v);
+        return location + scale * logf(u / fmaxf(1.0f - u, ROCRAND_2POW32_INV));
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg31k3p_logistic_distribution<double>
+{
+    const double location;
+    const double scale;
+
+    __host__ __device__
+    mrg31k3p_logistic_distribution<double>(double location, double scale) :
+                                           location(location), scale(scale) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        const double u = mrg31k3p_uniform_distribution<double>()(v);
+        return location + scale * log(u / fmax(1.0 - u, ROCRAND_2POW32_INV_DOUBLE));
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+#endif // ROCRAND_RNG_DISTRIBUTION_LOGISTIC_H_
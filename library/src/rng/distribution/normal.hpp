@@ -23,6 +23,7 @@
 
 #include <math.h>
 #include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
 
 #include "common.hpp"
 #include "device_distributions.hpp"
@@ -79,6 +80,47 @@ struct normal_distribution<float>
     }
 };
 
+// Packs two normally distributed half-precision values per generated
+// 32-bit value, feeding the two 16-bit halves of the draw through a
+// 16-bit Box-Muller transform; half buffers are filled through the
+// vectorized 32-bit path (see generate_normal_half() in the
+// generators)
+template<>
+struct normal_distribution<__half>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    normal_distribution<__half>(__half mean, __half stddev) :
+                                mean(__half2float(mean)),
+                                stddev(__half2float(stddev)) {}
+
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int x) const
+    {
+        float2 v = rocrand_device::detail::box_muller_half(
+            (unsigned short)(x), (unsigned short)(x >> 16)
+        );
+        const __half2 h = __halves2half2(
+            __float2half(mean + v.x * stddev),
+            __float2half(mean + v.y * stddev)
+        );
+        return *(const unsigned int *)&h;
+    }
+
+    __forceinline__ __host__ __device__
+    uint4 operator()(const uint4 x) const
+    {
+        return {
+            (*this)(x.x),
+            (*this)(x.y),
+            (*this)(x.z),
+            (*this)(x.w)
+        };
+    }
+};
+
 template<>
 struct normal_distribution<double>
 {
@@ -106,6 +148,288 @@ struct normal_distribution<double>
     }
 };
 
+namespace rocrand_host {
+namespace detail {
+
+// Inverse of the standard normal CDF; the device build uses the math
+// library intrinsic, the host build (host-side generators run the
+// distributions on the CPU) falls back to Acklam's rational
+// approximation (|relative error| < 1.15e-9)
+__forceinline__ __host__ __device__
+double inverse_normal_cdf(double p)
+{
+    #if defined(__HIP_DEVICE_COMPILE__)
+    return ::normcdfinv(p);
+    #else
+    static const double a[] = {
+        -3.969683028665376e+01,  2.209460984245205e+02, -2.759285104469687e+02,
+         1.383577518672690e+02, -3.066479806614716e+01,  2.506628277459239e+00
+    };
+    static const double b[] = {
+        -5.447609879822406e+01,  1.615858368580409e+02, -1.556989798598866e+02,
+         6.680131188771972e+01, -1.328068155288572e+01
+    };
+    static const double c[] = {
+        -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00,
+        -2.549732539343734e+00,  4.374664141464968e+00,  2.938163982698783e+00
+    };
+    static const double d[] = {
+         7.784695709041462e-03,  3.224671290700398e-01,  2.445134137142996e+00,
+         3.754408661907416e+00
+    };
+    const double p_tail = 0.02425;
+    if(p < p_tail)
+    {
+        const double q = sqrt(-2.0 * log(p));
+        return (((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5]) /
+               ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1.0);
+    }
+    else if(p <= 1.0 - p_tail)
+    {
+        const double q = p - 0.5;
+        const double r = q * q;
+        return (((((a[0]*r+a[1])*r+a[2])*r+a[3])*r+a[4])*r+a[5])*q /
+               (((((b[0]*r+b[1])*r+b[2])*r+b[3])*r+b[4])*r+1.0);
+    }
+    else
+    {
+        const double q = sqrt(-2.0 * log(1.0 - p));
+        return -(((((c[0]*q+c[1])*q+c[2])*q+c[3])*q+c[4])*q+c[5]) /
+                ((((d[0]*q+d[1])*q+d[2])*q+d[3])*q+1.0);
+    }
+    #endif
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// Normal distribution truncated to [low, high] via inverse-CDF
+// composition: each uniform draw is mapped into the CDF mass of the
+// interval and pushed back through the inverse normal CDF, so every
+// draw yields an accepted sample and throughput does not depend on
+// the width of the interval (unlike rejection on top of the full
+// normal)
+template<class T>
+struct truncated_normal_distribution;
+
+template<>
+struct truncated_normal_distribution<float>
+{
+    const float mean;
+    const float stddev;
+    const float low;
+    const float high;
+    float p_low;
+    float p_span;
+
+    __host__ __device__
+    truncated_normal_distribution<float>(float mean, float stddev,
+                                         float low, float high) :
+                                         mean(mean), stddev(stddev),
+                                         low(low), high(high)
+    {
+        // CDF of the standardized bounds; 0.7071... is 1/sqrt(2)
+        const double alpha = (static_cast<double>(low) - mean) / stddev;
+        const double beta = (static_cast<double>(high) - mean) / stddev;
+        const double pl = 0.5 * erfc(-alpha * 0.70710678118654752);
+        const double ph = 0.5 * erfc(-beta * 0.70710678118654752);
+        p_low = static_cast<float>(pl);
+        p_span = static_cast<float>(ph - pl);
+    }
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int x) const
+    {
+        const float u = rocrand_device::detail::uniform_distribution(x);
+        const float v = mean + stddev * static_cast<float>(
+            rocrand_host::detail::inverse_normal_cdf(p_low + u * p_span)
+        );
+        // Rounding can land just outside the interval
+        return fminf(fmaxf(v, low), high);
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 x) const
+    {
+        return {
+            (*this)(x.x),
+            (*this)(x.y),
+            (*this)(x.z),
+            (*this)(x.w)
+        };
+    }
+};
+
+template<>
+struct truncated_normal_distribution<double>
+{
+    const double mean;
+    const double stddev;
+    const double low;
+    const double high;
+    double p_low;
+    double p_span;
+
+    __host__ __device__
+    truncated_normal_distribution<double>(double mean, double stddev,
+                                          double low, double high) :
+                                          mean(mean), stddev(stddev),
+                                          low(low), high(high)
+    {
+        const double alpha = (low - mean) / stddev;
+        const double beta = (high - mean) / stddev;
+        const double pl = 0.5 * erfc(-alpha * 0.70710678118654752);
+        const double ph = 0.5 * erfc(-beta * 0.70710678118654752);
+        p_low = pl;
+        p_span = ph - pl;
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int x) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(x);
+        const double v = mean + stddev *
+            rocrand_host::detail::inverse_normal_cdf(p_low + u * p_span);
+        return fmin(fmax(v, low), high);
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int x1, const unsigned int x2) const
+    {
+        const double u = rocrand_device::detail::uniform_distribution_double(x1, x2);
+        const double v = mean + stddev *
+            rocrand_host::detail::inverse_normal_cdf(p_low + u * p_span);
+        return fmin(fmax(v, low), high);
+    }
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const uint4 x) const
+    {
+        return {
+            (*this)(x.x, x.y),
+            (*this)(x.z, x.w)
+        };
+    }
+};
+
+// Hybrid-precision normal distribution for double output: the uniforms
+// keep full 53-bit mantissa granularity, but the Box-Muller
+// transcendentals run in single precision (see
+// rocrand_device::detail::box_muller_double_fast). Backs
+// rocrand_generate_normal_double_fast() for GPUs with a reduced
+// double-precision rate.
+template<class T>
+struct fast_normal_distribution;
+
+template<>
+struct fast_normal_distribution<double>
+{
+    const double mean;
+    const double stddev;
+
+    __host__ __device__
+    fast_normal_distribution<double>(double mean = 0.0, double stddev = 1.0) :
+                                     mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    double2 operator()(uint4 x)
+    {
+        double2 v = rocrand_device::detail::box_muller_double_fast(x);
+        v.x = mean + v.x * stddev;
+        v.y = mean + v.y * stddev;
+        return v;
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int x)
+    {
+        const double v = static_cast<double>(
+            rocrand_device::detail::normal_distribution(x));
+        return mean + v * stddev;
+    }
+};
+
+// Inverse-CDF normal for the quasi-random generators: Box-Muller mixes
+// pairs of coordinates, which destroys the low-discrepancy structure of
+// a Sobol sequence, while the inverse CDF maps every coordinate
+// monotonically to one output and preserves the QMC convergence rate.
+// Mapping through inverse_normal_cdf() (normcdfinv on the device) also
+// keeps the tails accurate, so no corrective pass over the output is
+// needed.
+template<class T>
+struct sobol_normal_distribution;
+
+template<>
+struct sobol_normal_distribution<float>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    sobol_normal_distribution<float>(float mean = 0.0f, float stddev = 1.0f) :
+                                     mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int x) const
+    {
+        // The midpoint mapping keeps the argument inside the open
+        // (0; 1), where the inverse CDF is finite
+        const double p = (x + 0.5) * ROCRAND_2POW32_INV_DOUBLE;
+        return mean + stddev * static_cast<float>(
+            rocrand_host::detail::inverse_normal_cdf(p)
+        );
+    }
+};
+
+template<>
+struct sobol_normal_distribution<double>
+{
+    const double mean;
+    const double stddev;
+
+    __host__ __device__
+    sobol_normal_distribution<double>(double mean = 0.0, double stddev = 1.0) :
+                                      mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int x) const
+    {
+        const double p = (x + 0.5) * ROCRAND_2POW32_INV_DOUBLE;
+        return mean + stddev *
+            rocrand_host::detail::inverse_normal_cdf(p);
+    }
+};
+
+// Packs two half-precision outputs per 32-bit draw like
+// normal_distribution<__half>, but each 16-bit half is pushed through
+// the inverse CDF on its own, so both packed values stay monotone in
+// their coordinate
+template<>
+struct sobol_normal_distribution<__half>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    sobol_normal_distribution<__half>(__half mean, __half stddev) :
+                                      mean(__half2float(mean)),
+                                      stddev(__half2float(stddev)) {}
+
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int x) const
+    {
+        const double p0 = ((x & 0xFFFFu) + 0.5) / 65536.0;
+        const double p1 = ((x >> 16) + 0.5) / 65536.0;
+        const __half2 h = __halves2half2(
+            __float2half(mean + stddev * static_cast<float>(
+                rocrand_host::detail::inverse_normal_cdf(p0))),
+            __float2half(mean + stddev * static_cast<float>(
+                rocrand_host::detail::inverse_normal_cdf(p1)))
+        );
+        return *(const unsigned int *)&h;
+    }
+};
+
 template<class T>
 struct mrg_normal_distribution;
 
@@ -149,4 +473,47 @@ struct mrg_normal_distribution<double>
     }
 };
 
+template<class T>
+struct mrg31k3p_normal_distribution;
+
+template<>
+struct mrg31k3p_normal_distribution<float>
+{
+    const float mean;
+    const float stddev;
+
+    __host__ __device__
+    mrg31k3p_normal_distribution<float>(float mean = 0.0f, float stddev = 1.0f) :
+                                   mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    float2 operator()(const unsigned int x, const unsigned int y)
+    {
+        float2 v = rocrand_device::detail::mrg31k3p_normal_distribution2(x, y);
+        v.x = mean + v.x * stddev;
+        v.y = mean + v.y * stddev;
+        return v;
+    }
+};
+
+template<>
+struct mrg31k3p_normal_distribution<double>
+{
+    const double mean;
+    const double stddev;
+
+    __host__ __device__
+    mrg31k3p_normal_distribution<double>(double mean = 0.0, double stddev = 1.0) :
+                                    mean(mean), stddev(stddev) {}
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const unsigned int x, const unsigned int y)
+    {
+        double2 v = rocrand_device::detail::mrg31k3p_normal_distribution_double2(x, y);
+        v.x = mean + v.x * stddev;
+        v.y = mean + v.y * stddev;
+        return v;
+    }
+};
+
 #endif // ROCRAND_RNG_DISTRIBUTION_NORMAL_H_
@@ -27,6 +27,7 @@
 
 #include <rocrand.h>
 
+#include "../log.hpp"
 #include "discrete.hpp"
 
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
@@ -59,6 +60,22 @@ public:
         this->init(p, this->size, this->offset);
     }
 
+    // Asynchronous variant used by poisson_distribution_manager: the
+    // table upload is enqueued on \p stream through pinned slots of
+    // \p staging instead of blocking the host, so a rebuild for the
+    // next step overlaps the generation still running on the device
+    void set_lambda(double lambda, hipStream_t stream,
+                    rocrand_host::detail::pinned_staging& staging)
+    {
+        const size_t capacity =
+            2 * static_cast<size_t>(16.0 * (2.0 + std::sqrt(lambda)));
+        std::vector<double> p(capacity);
+
+        calculate_probabilities(p, capacity, lambda);
+
+        this->init_async(p, this->size, this->offset, stream, staging);
+    }
+
 protected:
 
     void calculate_probabilities(std::vector<double>& p, const size_t capacity,
@@ -69,34 +86,43 @@ protected:
 
         const int left = static_cast<int>(std::floor(lambda)) - capacity / 2;
 
-        // Calculate probabilities starting from mean in both directions,
-        // because only a small part of [0, lambda] has non-negligible values
-        // (> p_epsilon).
-
+        // The lgamma/exp evaluations are independent, so the whole
+        // band is computed in parallel (x stays integral, so values
+        // left of zero hit the lgamma poles and come out as exact
+        // zeros); lgamma dominates the per-entry cost, which makes
+        // parallelism pay off well below the default threshold
+        rocrand_host::detail::parallel_for(capacity,
+            [&](size_t first, size_t last)
+            {
+                for (size_t i = first; i < last; i++)
+                {
+                    const double x = left + static_cast<int>(i);
+                    p[i] = std::exp(x * log_lambda - std::lgamma(x + 1.0) - lambda);
+                }
+            },
+            size_t(1) << 10);
+
+        // The pmf is unimodal, so scanning outward from the mean finds
+        // the same range of non-negligible values (> p_epsilon) as the
+        // serial outward walks did
         int lo = 0;
         for (int i = capacity / 2; i >= 0; i--)
         {
-            const double x = left + i;
-            const double pp = std::exp(x * log_lambda - std::lgamma(x + 1.0) - lambda);
-            if (pp < p_epsilon)
+            if (p[i] < p_epsilon)
             {
                 lo = i + 1;
                 break;
             }
-            p[i] = pp;
         }
 
         int hi = capacity - 1;
         for (int i = capacity / 2 + 1; i < static_cast<int>(capacity); i++)
         {
-            const double x = left + i;
-            const double pp = std::exp(x * log_lambda - std::lgamma(x + 1.0) - lambda);
-            if (pp < p_epsilon)
+            if (p[i] < p_epsilon)
             {
                 hi = i - 1;
                 break;
             }
-            p[i] = pp;
         }
 
         for (int i = lo; i <= hi; i++)
@@ -109,9 +135,11 @@ protected:
     }
 };
 
-// Handles caching of precomputed tables for the distribution and recomputes
-// them only when lambda is changed (as these computations, device memory
-// allocations and copying take time).
+// Handles caching of precomputed tables for the distribution: tables for
+// recently used lambdas are kept resident on the device in an LRU cache
+// (as the probability computations, device memory allocations and copying
+// take time), so workloads alternating between a set of lambdas reuse
+// their tables instead of rebuilding them on every switch.
 template<rocrand_discrete_method Method = ROCRAND_DISCRETE_METHOD_ALIAS, bool IsHostSide = false>
 class poisson_distribution_manager
 {
@@ -120,27 +148,103 @@ public:
     rocrand_poisson_distribution<Method, IsHostSide> dis;
 
     poisson_distribution_manager()
-        : lambda(0.0)
+        : lambda(0.0), ticks(0), last_stream(0)
     { }
 
     ~poisson_distribution_manager()
     {
-        dis.deallocate();
+        // Entries own the device tables; dis only aliases the entry
+        // of the active lambda. Sampling kernels queued on the owning
+        // generator's stream may still read them, so the tables are
+        // released against that stream.
+        for (auto& entry : entries)
+        {
+            entry.dis.deallocate(last_stream);
+        }
     }
 
-    void set_lambda(double new_lambda)
+    // When a rebuild is needed and \p stream is the caller's
+    // generation stream, the table upload is enqueued there instead of
+    // blocking (see rocrand_poisson_distribution::set_lambda()); cache
+    // hits never touch the device either way
+    void set_lambda(double new_lambda, hipStream_t stream = 0)
     {
-        const bool changed = lambda != new_lambda;
-        if (changed)
+        last_stream = stream;
+        if (lambda == new_lambda)
+        {
+            return;
+        }
+        lambda = new_lambda;
+
+        for (auto& entry : entries)
         {
-            lambda = new_lambda;
-            dis.set_lambda(lambda);
+            if (entry.lambda == new_lambda)
+            {
+                entry.last_use = ++ticks;
+                dis = entry.dis;
+                return;
+            }
+        }
+
+        // Table rebuilds show up as one record each in the perf log
+        rocrand_host::detail::op_logger log("poisson_table_build", 0, 0, 0, 0);
+        cache_entry entry;
+        entry.lambda = new_lambda;
+        if (IsHostSide)
+        {
+            entry.dis.set_lambda(new_lambda);
+        }
+        else
+        {
+            entry.dis.set_lambda(new_lambda, stream, staging);
+        }
+        log.set_count(entry.dis.size);
+        entry.last_use = ++ticks;
+        if (entries.size() < max_entries)
+        {
+            entries.push_back(entry);
+        }
+        else
+        {
+            // Evict the least recently used lambda; its tables may
+            // still be read by kernels queued on the caller's stream
+            size_t lru = 0;
+            for (size_t i = 1; i < entries.size(); i++)
+            {
+                if (entries[i].last_use < entries[lru].last_use)
+                {
+                    lru = i;
+                }
+            }
+            entries[lru].dis.deallocate(stream);
+            entries[lru] = entry;
         }
+        dis = entry.dis;
     }
 
 private:
 
+    struct cache_entry
+    {
+        double lambda;
+        rocrand_poisson_distribution<Method, IsHostSide> dis;
+        unsigned long long last_use;
+    };
+
+    // Large enough to cover workloads alternating between a few dozen
+    // lambdas while bounding device memory spent on tables
+    static const size_t max_entries = 32;
+
     double lambda;
+    unsigned long long ticks;
+    // Stream of the latest set_lambda() call; the tables are released
+    // against it on eviction and teardown
+    hipStream_t last_stream;
+    std::vector<cache_entry> entries;
+
+    // Pinned slots backing the asynchronous table uploads; unused (and
+    // never allocated) for host-side distributions
+    rocrand_host::detail::pinned_staging staging;
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_POISSON_H_
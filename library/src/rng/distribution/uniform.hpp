@@ -23,6 +23,7 @@
 
 #include <math.h>
 #include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
 
 #include "common.hpp"
 #include "device_distributions.hpp"
@@ -113,14 +114,222 @@ struct uniform_distribution<double>
     }
 };
 
+// Packs two half-precision values from (0; 1] per generated 32-bit
+// value; half buffers are filled through the vectorized 32-bit path
+// (see generate_uniform_half() in the generators)
+template<>
+struct uniform_distribution<__half>
+{
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int v) const
+    {
+        const __half2 h = __halves2half2(
+            rocrand_device::detail::uniform_distribution_half((unsigned short)(v)),
+            rocrand_device::detail::uniform_distribution_half((unsigned short)(v >> 16))
+        );
+        return *(const unsigned int *)&h;
+    }
+
+    __forceinline__ __host__ __device__
+    uint4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+// Fused affine transform for rocrand_generate_uniform_range(): maps
+// the (0; 1] uniform output onto (low; high] in the same pass, saving
+// the separate scale/shift kernel a caller would otherwise run.
+template<class T>
+struct uniform_range_distribution;
+
+template<>
+struct uniform_range_distribution<float>
+{
+    const float low;
+    const float range;
+
+    __host__ __device__
+    uniform_range_distribution<float>(float low, float high) :
+                                      low(low), range(high - low) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return low + uniform_distribution<float>()(v) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct uniform_range_distribution<double>
+{
+    const double low;
+    const double range;
+
+    __host__ __device__
+    uniform_range_distribution<double>(double low, double high) :
+                                       low(low), range(high - low) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return low + uniform_distribution<double>()(v) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v1, const unsigned int v2) const
+    {
+        return low + uniform_distribution<double>()(v1, v2) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned long long v) const
+    {
+        return low + uniform_distribution<double>()(v) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const uint4 v) const
+    {
+        return double2 {
+            (*this)(v.x, v.y),
+            (*this)(v.z, v.w)
+        };
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v1, const uint4 v2) const
+    {
+        return double4 {
+            (*this)(v1.x, v1.y),
+            (*this)(v1.z, v1.w),
+            (*this)(v2.x, v2.y),
+            (*this)(v2.z, v2.w)
+        };
+    }
+};
+
+// Composes a user-supplied device-callable transform over the uniform
+// distribution, so generate-then-transform pipelines (e.g. exponential
+// via -log(u), integers in [0; k)) run in the generation pass instead
+// of a second kernel (see generate_transform() in the generators).
+// The transform is applied per component and must map T to T.
+template<class T, class UnaryOp>
+struct transformed_distribution;
+
+template<class UnaryOp>
+struct transformed_distribution<unsigned int, UnaryOp>
+{
+    const UnaryOp op;
+
+    __host__ __device__
+    transformed_distribution(UnaryOp op) : op(op) {}
+
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int v) const
+    {
+        return op(v);
+    }
+
+    __forceinline__ __host__ __device__
+    uint4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<class UnaryOp>
+struct transformed_distribution<float, UnaryOp>
+{
+    const UnaryOp op;
+
+    __host__ __device__
+    transformed_distribution(UnaryOp op) : op(op) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return op(uniform_distribution<float>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<class UnaryOp>
+struct transformed_distribution<double, UnaryOp>
+{
+    const UnaryOp op;
+
+    __host__ __device__
+    transformed_distribution(UnaryOp op) : op(op) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return op(uniform_distribution<double>()(v));
+    }
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v1, const unsigned int v2) const
+    {
+        return op(uniform_distribution<double>()(v1, v2));
+    }
+
+    __forceinline__ __host__ __device__
+    double2 operator()(const uint4 v) const
+    {
+        return double2 {
+            (*this)(v.x, v.y),
+            (*this)(v.z, v.w)
+        };
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v1, const uint4 v2) const
+    {
+        return double4 {
+            (*this)(v1.x, v1.y),
+            (*this)(v1.z, v1.w),
+            (*this)(v2.x, v2.y),
+            (*this)(v2.z, v2.w)
+        };
+    }
+};
+
 // MRG32K3A constants
 #ifndef ROCRAND_MRG32K3A_NORM_DOUBLE
 #define ROCRAND_MRG32K3A_NORM_DOUBLE (2.3283065498378288e-10) // 1/ROCRAND_MRG32K3A_M1
 #endif
-#ifndef ROCRAND_MRG32K3A_UINT_NORM
-#define ROCRAND_MRG32K3A_UINT_NORM (1.000000048661606966) // ROCRAND_MRG32K3A_POW32/ROCRAND_MRG32K3A_M1
-#endif
-
 template<class T>
 struct mrg_uniform_distribution;
 
@@ -130,7 +339,18 @@ struct mrg_uniform_distribution<unsigned int>
     __forceinline__ __host__ __device__
     unsigned int operator()(const unsigned int v) const
     {
-        return static_cast<unsigned int>(v * ROCRAND_MRG32K3A_UINT_NORM);
+        return rocrand_device::detail::mrg32k3a_uint_scale(v);
+    }
+
+    __forceinline__ __host__ __device__
+    uint4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
     }
 };
 
@@ -144,6 +364,17 @@ struct mrg_uniform_distribution<float>
     {
         return rocrand_device::detail::mrg_uniform_distribution(v);
     }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
 };
 
 // For unsigned integer between 0 and UINT_MAX, returns value between
@@ -156,6 +387,213 @@ struct mrg_uniform_distribution<double>
     {
         return rocrand_device::detail::mrg_uniform_distribution_double(v);
     }
+
+    // One engine output maps to one double, so the vectorized form
+    // is double4 (unlike uniform_distribution<double>)
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+// Range version of mrg_uniform_distribution (see
+// uniform_range_distribution)
+template<class T>
+struct mrg_uniform_range_distribution;
+
+template<>
+struct mrg_uniform_range_distribution<float>
+{
+    const float low;
+    const float range;
+
+    __host__ __device__
+    mrg_uniform_range_distribution<float>(float low, float high) :
+                                          low(low), range(high - low) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return low + mrg_uniform_distribution<float>()(v) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg_uniform_range_distribution<double>
+{
+    const double low;
+    const double range;
+
+    __host__ __device__
+    mrg_uniform_range_distribution<double>(double low, double high) :
+                                           low(low), range(high - low) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return low + mrg_uniform_distribution<double>()(v) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<class T>
+struct mrg31k3p_uniform_distribution;
+
+template<>
+struct mrg31k3p_uniform_distribution<unsigned int>
+{
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const unsigned int v) const
+    {
+        return rocrand_device::detail::mrg31k3p_uint_scale(v);
+    }
+
+    __forceinline__ __host__ __device__
+    uint4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+// For unsigned integer between 0 and UINT_MAX, returns value between
+// 0.0f and 1.0f, excluding 0.0f and including 1.0f.
+template<>
+struct mrg31k3p_uniform_distribution<float>
+{
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return rocrand_device::detail::mrg31k3p_uniform_distribution(v);
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+// For unsigned integer between 0 and UINT_MAX, returns value between
+// 0.0 and 1.0, excluding 0.0 and including 1.0.
+template<>
+struct mrg31k3p_uniform_distribution<double>
+{
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return rocrand_device::detail::mrg31k3p_uniform_distribution_double(v);
+    }
+
+    // One engine output maps to one double, so the vectorized form
+    // is double4 (unlike uniform_distribution<double>)
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+// Range version of mrg31k3p_uniform_distribution (see
+// uniform_range_distribution)
+template<class T>
+struct mrg31k3p_uniform_range_distribution;
+
+template<>
+struct mrg31k3p_uniform_range_distribution<float>
+{
+    const float low;
+    const float range;
+
+    __host__ __device__
+    mrg31k3p_uniform_range_distribution<float>(float low, float high) :
+                                               low(low), range(high - low) {}
+
+    __forceinline__ __host__ __device__
+    float operator()(const unsigned int v) const
+    {
+        return low + mrg31k3p_uniform_distribution<float>()(v) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    float4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
+};
+
+template<>
+struct mrg31k3p_uniform_range_distribution<double>
+{
+    const double low;
+    const double range;
+
+    __host__ __device__
+    mrg31k3p_uniform_range_distribution<double>(double low, double high) :
+                                                low(low), range(high - low) {}
+
+    __forceinline__ __host__ __device__
+    double operator()(const unsigned int v) const
+    {
+        return low + mrg31k3p_uniform_distribution<double>()(v) * range;
+    }
+
+    __forceinline__ __host__ __device__
+    double4 operator()(const uint4 v) const
+    {
+        return {
+            (*this)(v.x),
+            (*this)(v.y),
+            (*this)(v.z),
+            (*this)(v.w)
+        };
+    }
 };
 
 #endif // ROCRAND_RNG_DISTRIBUTION_UNIFORM_H_
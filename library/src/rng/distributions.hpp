@@ -22,9 +22,14 @@
 #define ROCRAND_RNG_DISTRIBUTIONS_H_
 
 #include "distribution/uniform.hpp"
+#include "distribution/exponential.hpp"
+#include "distribution/cauchy.hpp"
+#include "distribution/weibull.hpp"
+#include "distribution/logistic.hpp"
 #include "distribution/normal.hpp"
 #include "distribution/log_normal.hpp"
 #include "distribution/discrete.hpp"
 #include "distribution/poisson.hpp"
+#include "distribution/binomial.hpp"
 
 #endif // ROCRAND_RNG_DISTRIBUTION_S_H_
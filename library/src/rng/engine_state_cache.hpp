@@ -0,0 +1,210 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_ENGINE_STATE_CACHE_H_
+#define ROCRAND_RNG_ENGINE_STATE_CACHE_H_
+
+#include <mutex>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "device_memory.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // In-process cache of freshly initialized engine-state device arrays.
+    //
+    // Initializing the engine arrays of generators which use matrix-power
+    // skipahead (xorwow, mrg32k3a) takes orders of magnitude longer than
+    // copying the initialized states, so generators which are repeatedly
+    // created with the same (rng_type, seed, offset) can restore their
+    // engine arrays with a single device-to-device copy instead of
+    // re-running the initialization kernel.
+    //
+    // Only pristine states (device arrays as written by an initialization
+    // kernel, before any generation) may be inserted; entries are immutable
+    // afterwards.
+    class engine_state_cache
+    {
+    public:
+        struct key_type
+        {
+            int device;
+            rocrand_rng_type rng_type;
+            unsigned long long seed;
+            unsigned long long offset;
+            size_t bytes;
+
+            bool operator==(const key_type& other) const
+            {
+                return device == other.device
+                    && rng_type == other.rng_type
+                    && seed == other.seed
+                    && offset == other.offset
+                    && bytes == other.bytes;
+            }
+        };
+
+        // Copies a cached pristine engine array into \p dst on \p stream.
+        // Returns false when there is no entry for \p key.
+        //
+        // The inserting generator's copy may still be in flight on its
+        // own stream, and two streams do not order against each other
+        // even when both synchronize with the default stream, so the
+        // copy here first waits on the entry's ready event. The event
+        // is then re-recorded behind the copy: the mutex serializes the
+        // enqueues and every use waits on the previous recording, so
+        // the latest recording always covers all uses of the entry
+        // (which is what eviction waits on before freeing the buffer).
+        static bool lookup(const key_type& key, void * dst, hipStream_t stream)
+        {
+            engine_state_cache& cache = instance();
+            std::lock_guard<std::mutex> lock(cache.m_mutex);
+            for(entry& e : cache.m_entries)
+            {
+                if(e.key == key)
+                {
+                    if(hipStreamWaitEvent(stream, e.ready, 0) != hipSuccess)
+                    {
+                        return false;
+                    }
+                    if(hipMemcpyAsync(dst, e.states, key.bytes,
+                                      hipMemcpyDeviceToDevice, stream)
+                        != hipSuccess)
+                    {
+                        return false;
+                    }
+                    if(hipEventRecord(e.ready, stream) != hipSuccess)
+                    {
+                        // The copy is already enqueued; drain it so the
+                        // stale recording keeps covering all uses
+                        hipStreamSynchronize(stream);
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Inserts a copy of the pristine engine array \p src under \p key.
+        // The copy is enqueued on \p stream and an event recorded behind
+        // it, so generators restoring from the entry on other streams
+        // can order against it; insertion failures (allocation, cache
+        // full of newer entries) are silently ignored as the cache is
+        // purely an optimization.
+        static void insert(const key_type& key, const void * src, hipStream_t stream)
+        {
+            engine_state_cache& cache = instance();
+            std::lock_guard<std::mutex> lock(cache.m_mutex);
+            for(const entry& e : cache.m_entries)
+            {
+                if(e.key == key)
+                    return;
+            }
+
+            void * states;
+            if(rocrand_host::detail::device_malloc(&states, key.bytes) != hipSuccess)
+                return;
+            if(hipMemcpyAsync(states, src, key.bytes,
+                              hipMemcpyDeviceToDevice, stream) != hipSuccess)
+            {
+                rocrand_host::detail::device_free(states, stream);
+                return;
+            }
+            hipEvent_t ready;
+            if(hipEventCreateWithFlags(&ready, hipEventDisableTiming) != hipSuccess)
+            {
+                rocrand_host::detail::device_free(states, stream);
+                return;
+            }
+            if(hipEventRecord(ready, stream) != hipSuccess)
+            {
+                hipEventDestroy(ready);
+                rocrand_host::detail::device_free(states, stream);
+                return;
+            }
+
+            if(cache.m_entries.size() >= max_entries)
+            {
+                // Evict the oldest entry
+                release_entry(cache.m_entries.front());
+                cache.m_entries.erase(cache.m_entries.begin());
+            }
+            cache.m_entries.push_back(entry { key, states, ready });
+        }
+
+    private:
+        struct entry
+        {
+            key_type key;
+            void * states;
+            // Completes only after the insert copy and every lookup
+            // copy issued so far (see lookup())
+            hipEvent_t ready;
+        };
+
+        static const size_t max_entries = 8;
+
+        // Frees an entry's buffer once no pending copy reads it
+        static void release_entry(entry& e)
+        {
+            hipEventSynchronize(e.ready);
+            hipEventDestroy(e.ready);
+            rocrand_host::detail::device_free(e.states);
+        }
+
+        engine_state_cache() { }
+
+        ~engine_state_cache()
+        {
+            for(entry& e : m_entries)
+            {
+                release_entry(e);
+            }
+        }
+
+        static engine_state_cache& instance()
+        {
+            static engine_state_cache cache;
+            return cache;
+        }
+
+        std::mutex m_mutex;
+        std::vector<entry> m_entries;
+    };
+
+    inline engine_state_cache::key_type engine_state_key(rocrand_rng_type rng_type,
+                                                         unsigned long long seed,
+                                                         unsigned long long offset,
+                                                         size_t bytes)
+    {
+        int device = 0;
+        hipGetDevice(&device);
+        return engine_state_cache::key_type { device, rng_type, seed, offset, bytes };
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_ENGINE_STATE_CACHE_H_
@@ -21,15 +21,778 @@
 #ifndef ROCRAND_RNG_GENERATOR_TYPE_H_
 #define ROCRAND_RNG_GENERATOR_TYPE_H_
 
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <vector>
 #include <hip/hip_runtime.h>
+#include <hip/hip_fp16.h>
 #include <rocrand.h>
 
+#include "device_memory.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Header preceding the raw engine-state bytes in buffers written by
+    // the generators' save_state() (see rocrand_save_state())
+    struct generator_state_header
+    {
+        unsigned int version;
+        rocrand_rng_type rng_type;
+        unsigned long long seed;
+        unsigned long long offset;
+        size_t engine_bytes;
+    };
+
+    // 2: XORWOW engine blobs switched to the structure-of-arrays layout
+    static const unsigned int generator_state_version = 2;
+
+    // One in-flight chunk of rocrand_generate_chunks(); the host
+    // callback trampoline deletes it after delivering the chunk
+    struct chunk_delivery
+    {
+        rocrand_chunk_callback callback;
+        void * user_data;
+        void * data;
+        size_t bytes;
+    };
+
+    inline void chunk_delivery_trampoline(hipStream_t /* stream */,
+                                          hipError_t error, void * arg)
+    {
+        chunk_delivery * delivery = static_cast<chunk_delivery *>(arg);
+        if(error == hipSuccess)
+        {
+            delivery->callback(delivery->data, delivery->bytes,
+                               delivery->user_data);
+        }
+        delete delivery;
+    }
+
+    // Returns the number of blocks of \p threads threads needed to saturate
+    // the device active at generator creation time with \p kernel.
+    // Falls back to \p default_blocks when the device properties or
+    // the occupancy can't be queried (e.g. in a stream capture).
+    template<class Kernel>
+    inline unsigned int max_active_blocks(Kernel kernel,
+                                          unsigned int threads,
+                                          unsigned int default_blocks)
+    {
+        int device;
+        hipDeviceProp_t props;
+        if(hipGetDevice(&device) != hipSuccess
+            || hipGetDeviceProperties(&props, device) != hipSuccess)
+        {
+            return default_blocks;
+        }
+
+        int blocks_per_cu = 0;
+        if(hipOccupancyMaxActiveBlocksPerMultiprocessor(
+                &blocks_per_cu, kernel, threads, 0) != hipSuccess
+            || blocks_per_cu < 1)
+        {
+            // Assume a conservative number of resident blocks per
+            // multiprocessor when the occupancy API can't give an answer
+            blocks_per_cu = 4;
+        }
+        return static_cast<unsigned int>(props.multiProcessorCount * blocks_per_cu);
+    }
+
+    // Destination classes of a rocrand_generate* output pointer; each
+    // gets its own write path (see rocrand_generate())
+    enum pointer_location
+    {
+        pointer_location_device,
+        pointer_location_managed,
+        pointer_location_host
+    };
+
+    // Classifies \p ptr for the host/managed-destination handling of
+    // the generate calls. Pageable host allocations are unknown to the
+    // runtime, so a failed attribute query also counts as host;
+    // host-registered (zero-copy) memory reports hipMemoryTypeHost and
+    // counts as host too, which routes it through the staged pipeline
+    // instead of letting kernels store over PCIe word by word.
+    inline pointer_location get_pointer_location(const void * ptr)
+    {
+        hipPointerAttribute_t attributes;
+        if(hipPointerGetAttributes(&attributes, ptr) != hipSuccess)
+        {
+            // Clear the error the failed query left behind
+            static_cast<void>(hipGetLastError());
+            return pointer_location_host;
+        }
+        if(attributes.isManaged)
+        {
+            return pointer_location_managed;
+        }
+        return attributes.memoryType == hipMemoryTypeDevice
+            ? pointer_location_device
+            : pointer_location_host;
+    }
+
+    inline bool is_host_pointer(const void * ptr)
+    {
+        return get_pointer_location(ptr) == pointer_location_host;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
 struct rocrand_generator_base_type
 {
-    rocrand_generator_base_type(rocrand_rng_type rng_type) : rng_type(rng_type) {}
+    rocrand_generator_base_type(rocrand_rng_type rng_type)
+        : rng_type(rng_type),
+          m_copy_stream(0), m_pipeline_ready(false),
+          m_stats_enabled(false), m_stats_events_created(false),
+          m_stats_pending(false), m_stats_reinit_pending(true),
+          m_stats_last_ms(0.0), m_stats_total_ms(0.0),
+          m_stats_bytes(0), m_stats_launches(0), m_stats_reinits(0)
+    {
+        m_staging[0] = m_staging[1] = NULL;
+        m_staging_bytes[0] = m_staging_bytes[1] = 0;
+        m_chunk_host[0] = m_chunk_host[1] = NULL;
+        m_chunk_host_bytes[0] = m_chunk_host_bytes[1] = 0;
+    }
     const rocrand_rng_type rng_type;
 
-    virtual ~rocrand_generator_base_type() {}
+    // Serializes the C API calls on one handle (see rocrand.cpp) so a
+    // generator can be shared across host threads. Host-side state --
+    // the lazy init latch, the distribution parameter caches and the
+    // host-destination staging pipeline -- is mutated by the generate
+    // paths; the lock is held only for the (asynchronous) launch and
+    // costs noise next to it. Work is issued to the generator's single
+    // stream either way, so concurrent callers were already serialized
+    // on the device.
+    std::mutex m_api_mutex;
+
+    virtual ~rocrand_generator_base_type()
+    {
+        if(m_stats_events_created)
+        {
+            hipEventDestroy(m_stats_start);
+            hipEventDestroy(m_stats_stop);
+        }
+        if(m_pipeline_ready)
+        {
+            rocrand_host::detail::device_free(m_staging[0], m_copy_stream);
+            rocrand_host::detail::device_free(m_staging[1], m_copy_stream);
+            hipEventDestroy(m_gen_done[0]);
+            hipEventDestroy(m_gen_done[1]);
+            hipEventDestroy(m_copy_done[0]);
+            hipEventDestroy(m_copy_done[1]);
+            hipStreamDestroy(m_copy_stream);
+        }
+        hipHostFree(m_chunk_host[0]);
+        hipHostFree(m_chunk_host[1]);
+    }
+
+    // Entry points used by the C API (rocrand.cpp). Dispatching through
+    // these costs one indirect call per API call instead of an if/else
+    // chain over generator types followed by a static_cast. The defaults
+    // report an unsupported operation; generator classes override the
+    // operations they implement (the generate_* overrides forward to the
+    // class generate templates).
+    virtual rocrand_status init()
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_uint(unsigned int *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_char(unsigned char *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_short(unsigned short *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_long_long(unsigned long long *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_bytes(void *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_uniform_float(float *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_uniform_double(double *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_uniform_range_float(float *, size_t, float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_uniform_range_double(double *, size_t, double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_exponential_float(float *, size_t, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_exponential_double(double *, size_t, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_cauchy_float(float *, size_t, float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_cauchy_double(double *, size_t, double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_weibull_float(float *, size_t, float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_weibull_double(double *, size_t, double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_logistic_float(float *, size_t, float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_logistic_double(double *, size_t, double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_gamma_float(float *, size_t, float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_gamma_double(double *, size_t, double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_uniform_half(__half *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_normal_half(__half *, size_t, __half, __half)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_normal_float(float *, size_t, float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_normal_double(double *, size_t, double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_log_normal_float(float *, size_t, float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_log_normal_double(double *, size_t, double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_truncated_normal_float(float *, size_t,
+                                                           float, float,
+                                                           float, float)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_truncated_normal_double(double *, size_t,
+                                                            double, double,
+                                                            double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_normal_double_fast(double *, size_t,
+                                                       double, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_poisson_uint(unsigned int *, size_t, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_binomial_uint(unsigned int *, size_t,
+                                                  unsigned int, double)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_poisson_array_uint(unsigned int *, size_t,
+                                                       const double *)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status sample_discrete_uint(unsigned int *, size_t,
+                                                const double *, unsigned int)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_permutation_uint(unsigned int *, size_t)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status generate_multinomial_uint(unsigned int *, size_t,
+                                                     unsigned int,
+                                                     const double *, unsigned int)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    // Generators with serializable state (see rocrand_save_state())
+    // override these; a zero state size marks an unsupported type
+    virtual size_t state_size() const
+    {
+        return 0;
+    }
+
+    virtual rocrand_status save_state(void *)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status load_state(const void *)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    // Stream used for event recording by the rocrand_generate_*_async
+    // C API; rocrand_generator_type overrides this with its stream
+    virtual hipStream_t get_stream() const
+    {
+        return 0;
+    }
+
+    // Generators whose output layout spans the whole call (the
+    // quasirandom types write each dimension as one contiguous
+    // segment of the full buffer) override this to false, and the
+    // host-destination path below stages their entire result in a
+    // single chunk instead of splitting it
+    virtual bool supports_chunked_host_generate() const
+    {
+        return true;
+    }
+
+    // Generators that run on the host (see philox4x32_10_host.hpp)
+    // override this to true; their generate calls write through the
+    // output pointer directly instead of going through the pointer
+    // location dispatch and the device staging pipeline
+    virtual bool is_host_generator() const
+    {
+        return false;
+    }
+
+    // --- profiling counters (see rocrand_set_profiling()) ---
+
+    rocrand_status stats_set_enabled(bool enabled)
+    {
+        if(enabled && !m_stats_events_created)
+        {
+            if(hipEventCreate(&m_stats_start) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            if(hipEventCreate(&m_stats_stop) != hipSuccess)
+            {
+                hipEventDestroy(m_stats_start);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            m_stats_events_created = true;
+        }
+        m_stats_enabled = enabled;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Waits for the previously profiled call and folds its time into
+    // the counters; in steady state that work has long completed
+    rocrand_status stats_resolve()
+    {
+        if(!m_stats_pending)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(hipEventSynchronize(m_stats_stop) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        float ms;
+        if(hipEventElapsedTime(&ms, m_stats_start, m_stats_stop) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_stats_last_ms = ms;
+        m_stats_total_ms += ms;
+        m_stats_pending = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status stats_begin(size_t bytes)
+    {
+        const rocrand_status status = stats_resolve();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(m_stats_reinit_pending)
+        {
+            m_stats_reinits++;
+            m_stats_reinit_pending = false;
+        }
+        m_stats_bytes += bytes;
+        m_stats_launches++;
+        if(is_host_generator())
+        {
+            // Host generators complete synchronously; wall time
+            // stands in for the event pair
+            m_stats_host_begin = std::chrono::steady_clock::now();
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(hipEventRecord(m_stats_start, get_stream()) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status stats_end()
+    {
+        if(is_host_generator())
+        {
+            const double ms = std::chrono::duration<double, std::milli>(
+                std::chrono::steady_clock::now() - m_stats_host_begin).count();
+            m_stats_last_ms = ms;
+            m_stats_total_ms += ms;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(hipEventRecord(m_stats_stop, get_stream()) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_stats_pending = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Set by rocrand.cpp wherever the C API forces the engine array to
+    // be rebuilt (creation, seed, offset and ordering changes);
+    // consumed by stats_begin() so back-to-back changes count once
+    bool m_stats_enabled;
+    bool m_stats_reinit_pending;
+
+    // Generates into host memory by staging through an internal
+    // double-buffered device area (see rocrand_generate()'s
+    // host-destination mode): \p generate_chunk fills one staging
+    // buffer on the generator's stream while the device-to-host copy
+    // of the previous chunk drains on an internal copy stream, hiding
+    // the transfer behind the generation kernels when \p data is
+    // pinned. Unlike the device path, the call blocks until \p data
+    // is complete. GenerateOp invokes the generator's own
+    // device-destination entry point on a chunk.
+    template<class T, class GenerateOp>
+    rocrand_status generate_to_host(T * data, size_t n, GenerateOp generate_chunk)
+    {
+        if(n == 0)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Large enough to amortize launch and copy latencies, small
+        // enough that the two device buffers stay modest
+        const size_t default_staging_bytes = 4 << 20;
+        const bool chunked = supports_chunked_host_generate();
+        const size_t chunk = chunked
+            ? std::max<size_t>(default_staging_bytes / sizeof(T), 1)
+            : n;
+
+        rocrand_status status = ensure_pipeline(
+            chunk * sizeof(T), chunked ? 2 : 1);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const hipStream_t stream = get_stream();
+        size_t offset = 0;
+        unsigned int buf = 0;
+        size_t iteration = 0;
+        while(offset < n)
+        {
+            const size_t size = std::min(chunk, n - offset);
+            // The copy that last read this buffer must drain before
+            // generation overwrites it
+            if(iteration >= 2
+                && hipStreamWaitEvent(stream, m_copy_done[buf], 0) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            status = generate_chunk(static_cast<T *>(m_staging[buf]), size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            if(hipEventRecord(m_gen_done[buf], stream) != hipSuccess
+                || hipStreamWaitEvent(m_copy_stream, m_gen_done[buf], 0) != hipSuccess
+                || hipMemcpyAsync(data + offset, m_staging[buf], size * sizeof(T),
+                                  hipMemcpyDeviceToHost, m_copy_stream) != hipSuccess
+                || hipEventRecord(m_copy_done[buf], m_copy_stream) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            offset += size;
+            buf ^= 1;
+            iteration++;
+        }
+        // The host buffer must be complete when the call returns
+        if(hipStreamSynchronize(m_copy_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Generates into managed (hipMallocManaged) memory. The kernels'
+    // grid-stride stores fault page by page when the range is resident
+    // on the CPU, so the whole range is prefetched to the generating
+    // device first, turning the migration into one coarse-grained
+    // transfer; generation itself then runs the unchanged device path,
+    // keeping the output identical to a device-memory destination.
+    template<class T, class GenerateOp>
+    rocrand_status generate_to_managed(T * data, size_t n, GenerateOp generate_chunk)
+    {
+        int device;
+        if(hipGetDevice(&device) == hipSuccess
+            && hipMemPrefetchAsync(data, n * sizeof(T), device,
+                                   get_stream()) != hipSuccess)
+        {
+            // Best effort: without prefetch support the faulting path
+            // is still correct, only slower
+            static_cast<void>(hipGetLastError());
+        }
+        return generate_chunk(data, n);
+    }
+
+    // Chunked host delivery (see rocrand_generate_chunks()): a
+    // three-stage pipeline over the staging machinery of
+    // generate_to_host(). Generation of chunk i+2 runs on the
+    // generator's stream while the device-to-host copy of chunk i+1
+    // and the callback processing chunk i drain on the copy stream;
+    // a slow callback delays the copies, not the generation kernels.
+    rocrand_status generate_chunks(size_t total_bytes, size_t chunk_bytes,
+                                   rocrand_chunk_callback callback,
+                                   void * user_data)
+    {
+        if(total_bytes == 0)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        chunk_bytes = std::min(chunk_bytes, total_bytes);
+
+        // Host generators write through the pointer on the calling
+        // thread; generate straight into a host buffer and deliver
+        // each chunk inline
+        if(is_host_generator())
+        {
+            std::vector<unsigned char> buffer(chunk_bytes);
+            size_t offset = 0;
+            while(offset < total_bytes)
+            {
+                const size_t size = std::min(chunk_bytes, total_bytes - offset);
+                const rocrand_status status = generate_bytes(buffer.data(), size);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+                callback(buffer.data(), size, user_data);
+                offset += size;
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_status status = ensure_pipeline(chunk_bytes, 2);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        // Pinned host landing areas, reused across calls like the
+        // device staging buffers
+        for(unsigned int i = 0; i < 2; i++)
+        {
+            if(m_chunk_host_bytes[i] >= chunk_bytes)
+            {
+                continue;
+            }
+            hipHostFree(m_chunk_host[i]);
+            m_chunk_host[i] = NULL;
+            m_chunk_host_bytes[i] = 0;
+            if(hipHostMalloc(&m_chunk_host[i], chunk_bytes) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            m_chunk_host_bytes[i] = chunk_bytes;
+        }
+
+        const hipStream_t stream = get_stream();
+        size_t offset = 0;
+        unsigned int buf = 0;
+        size_t iteration = 0;
+        while(offset < total_bytes)
+        {
+            const size_t size = std::min(chunk_bytes, total_bytes - offset);
+            // The copy that last read this staging buffer must drain
+            // before generation overwrites it
+            if(iteration >= 2
+                && hipStreamWaitEvent(stream, m_copy_done[buf], 0) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            status = generate_bytes(m_staging[buf], size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            rocrand_host::detail::chunk_delivery * delivery =
+                new rocrand_host::detail::chunk_delivery;
+            delivery->callback = callback;
+            delivery->user_data = user_data;
+            delivery->data = m_chunk_host[buf];
+            delivery->bytes = size;
+            // The copy-done event is recorded before the callback, so
+            // staging-buffer reuse never waits for host processing;
+            // pinned-buffer reuse is ordered by the callbacks
+            // themselves, which serialize on the copy stream
+            if(hipEventRecord(m_gen_done[buf], stream) != hipSuccess
+                || hipStreamWaitEvent(m_copy_stream, m_gen_done[buf], 0) != hipSuccess
+                || hipMemcpyAsync(m_chunk_host[buf], m_staging[buf], size,
+                                  hipMemcpyDeviceToHost, m_copy_stream) != hipSuccess
+                || hipEventRecord(m_copy_done[buf], m_copy_stream) != hipSuccess
+                || hipStreamAddCallback(
+                       m_copy_stream,
+                       rocrand_host::detail::chunk_delivery_trampoline,
+                       delivery, 0) != hipSuccess)
+            {
+                delete delivery;
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            offset += size;
+            buf ^= 1;
+            iteration++;
+        }
+        // Every chunk must be delivered when the call returns
+        if(hipStreamSynchronize(m_copy_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+
+    // Creates the copy stream and events on the first host-destination
+    // call and (re)allocates the first \p buffers staging buffers to at
+    // least \p bytes each
+    rocrand_status ensure_pipeline(size_t bytes, unsigned int buffers)
+    {
+        if(!m_pipeline_ready)
+        {
+            if(hipStreamCreate(&m_copy_stream) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            for(unsigned int i = 0; i < 2; i++)
+            {
+                if(hipEventCreateWithFlags(&m_gen_done[i],
+                                           hipEventDisableTiming) != hipSuccess
+                    || hipEventCreateWithFlags(&m_copy_done[i],
+                                               hipEventDisableTiming) != hipSuccess)
+                {
+                    return ROCRAND_STATUS_INTERNAL_ERROR;
+                }
+            }
+            m_pipeline_ready = true;
+        }
+        for(unsigned int i = 0; i < buffers; i++)
+        {
+            if(m_staging_bytes[i] >= bytes)
+            {
+                continue;
+            }
+            rocrand_host::detail::device_free(m_staging[i], m_copy_stream);
+            m_staging[i] = NULL;
+            m_staging_bytes[i] = 0;
+            if(rocrand_host::detail::device_malloc(&m_staging[i], bytes) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            m_staging_bytes[i] = bytes;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Host-destination staging pipeline state (see generate_to_host());
+    // created lazily on the first call with a host pointer
+    void * m_staging[2];
+    size_t m_staging_bytes[2];
+    // Pinned landing areas for the chunked delivery of
+    // generate_chunks(), cycled in step with the staging buffers
+    void * m_chunk_host[2];
+    size_t m_chunk_host_bytes[2];
+    hipStream_t m_copy_stream;
+    hipEvent_t m_gen_done[2];
+    hipEvent_t m_copy_done[2];
+    bool m_pipeline_ready;
+
+    // Profiling state (see rocrand_set_profiling()); the event pair is
+    // created on first enable and reused for every profiled call
+    bool m_stats_events_created;
+    bool m_stats_pending;
+    hipEvent_t m_stats_start;
+    hipEvent_t m_stats_stop;
+    std::chrono::steady_clock::time_point m_stats_host_begin;
+    double m_stats_last_ms;
+    double m_stats_total_ms;
+    unsigned long long m_stats_bytes;
+    unsigned long long m_stats_launches;
+    unsigned long long m_stats_reinits;
 };
 
 // rocRAND random number generator base class
@@ -47,6 +810,19 @@ struct rocrand_generator_type : public rocrand_generator_base_type
 
     }
 
+    // For generator classes covering more than one type (e.g. the
+    // scrambled quasirandom variants), which pick the reported type
+    // at construction time
+    rocrand_generator_type(rocrand_rng_type rng_type,
+                           unsigned long long seed = 0,
+                           unsigned long long offset = 0,
+                           hipStream_t stream = 0)
+        : base_type(rng_type),
+          m_seed(seed), m_offset(offset), m_stream(stream)
+    {
+
+    }
+
     /// Return generator's type
     constexpr rocrand_rng_type type() const
     {
@@ -63,7 +839,7 @@ struct rocrand_generator_type : public rocrand_generator_base_type
         return m_offset;
     }
 
-    hipStream_t get_stream() const
+    hipStream_t get_stream() const override
     {
         return m_stream;
     }
@@ -22,9 +22,16 @@
 #define ROCRAND_RNG_GENERATORS_H_
 
 #include "philox4x32_10.hpp"
+#include "philox4x32_10_host.hpp"
+#include "philox4x32_10_multi.hpp"
+#include "threefry4x32_20.hpp"
 #include "mrg32k3a.hpp"
+#include "mrg31k3p.hpp"
 #include "xorwow.hpp"
 #include "sobol32.hpp"
+#include "sobol64.hpp"
 #include "mtgp32.hpp"
+#include "mt19937.hpp"
+#include "device_states.hpp"
 
 #endif // ROCRAND_RNG_GENERATORS_H_
@@ -0,0 +1,158 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_LOG_H_
+#define ROCRAND_RNG_LOG_H_
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+namespace rocrand_host {
+namespace detail {
+
+    // Process-wide sink for the structured perf records (see
+    // rocrand_set_log_callback()). With ROCRAND_LOG set in the
+    // environment records also go to stderr without a callback.
+    class log_sink
+    {
+    public:
+        static log_sink& instance()
+        {
+            static log_sink sink;
+            return sink;
+        }
+
+        void set_callback(rocrand_log_callback callback, void * user_data)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_callback = callback;
+            m_user_data = user_data;
+        }
+
+        bool enabled()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_callback != NULL || m_env_enabled;
+        }
+
+        void emit(const char * record)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(m_callback != NULL)
+            {
+                m_callback(record, m_user_data);
+            }
+            else if(m_env_enabled)
+            {
+                fprintf(stderr, "rocrand: %s\n", record);
+            }
+        }
+
+    private:
+        log_sink()
+            : m_callback(NULL), m_user_data(NULL)
+        {
+            const char * env = getenv("ROCRAND_LOG");
+            m_env_enabled = env != NULL && env[0] != '\0'
+                && !(env[0] == '0' && env[1] == '\0');
+        }
+
+        std::mutex m_mutex;
+        rocrand_log_callback m_callback;
+        void * m_user_data;
+        bool m_env_enabled;
+    };
+
+    // Emits one structured record -- op name, element count, grid,
+    // stream, microseconds -- for the operation enclosed by its scope.
+    // Timing synchronizes the stream on entry and exit, so enabled
+    // logging makes the timed operations effectively synchronous; the
+    // hook is a triage tool, not a steady-state profiler. A zero block
+    // count stands for operations without a launch grid (host-side
+    // work, or entry points that do not know the grid).
+    class op_logger
+    {
+    public:
+        op_logger(const char * op, size_t n,
+                  unsigned int blocks, unsigned int threads,
+                  hipStream_t stream)
+            : m_enabled(log_sink::instance().enabled()),
+              m_op(op), m_n(n),
+              m_blocks(blocks), m_threads(threads), m_stream(stream)
+        {
+            if(m_enabled)
+            {
+                hipStreamSynchronize(m_stream);
+                m_begin = std::chrono::steady_clock::now();
+            }
+        }
+
+        ~op_logger()
+        {
+            if(!m_enabled)
+            {
+                return;
+            }
+            hipStreamSynchronize(m_stream);
+            const double us = std::chrono::duration<double, std::micro>(
+                std::chrono::steady_clock::now() - m_begin).count();
+            char record[192];
+            if(m_blocks > 0)
+            {
+                snprintf(record, sizeof(record),
+                         "op=%s n=%zu grid=%ux%u stream=%p us=%.1f",
+                         m_op, m_n, m_blocks, m_threads,
+                         static_cast<void *>(m_stream), us);
+            }
+            else
+            {
+                snprintf(record, sizeof(record),
+                         "op=%s n=%zu grid=- stream=%p us=%.1f",
+                         m_op, m_n, static_cast<void *>(m_stream), us);
+            }
+            log_sink::instance().emit(record);
+        }
+
+        // For operations whose element count is only known once they
+        // finish (e.g. table builds)
+        void set_count(size_t n)
+        {
+            m_n = n;
+        }
+
+    private:
+        bool m_enabled;
+        const char * m_op;
+        size_t m_n;
+        unsigned int m_blocks;
+        unsigned int m_threads;
+        hipStream_t m_stream;
+        std::chrono::steady_clock::time_point m_begin;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_LOG_H_
@@ -0,0 +1,852 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_MRG31K3P_H_
+#define ROCRAND_RNG_MRG31K3P_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+#include <rocrand_mrg31k3p_precomputed.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "engine_state_cache.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    typedef ::rocrand_device::mrg31k3p_engine mrg31k3p_device_engine;
+
+    __global__
+    void init_engines_kernel(mrg31k3p_device_engine * engines,
+                            unsigned long long seed,
+                            unsigned long long offset)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        engines[engine_id] = mrg31k3p_device_engine(seed, engine_id, offset);
+    }
+
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel(mrg31k3p_device_engine * engines,
+                         Type * data, const size_t n,
+                         const unsigned long long seed,
+                         const unsigned long long offset,
+                         const bool init_engines,
+                         const Distribution distribution)
+    {
+        // TypeX can be uint4, float4 or double4
+        typedef decltype(distribution(uint4())) TypeX;
+        typedef typename unaligned_type<TypeX>::type TypeX_unaligned;
+        // x can be 2 or 4
+        const unsigned int x = sizeof(TypeX) / sizeof(Type);
+
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = engine_id;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        mrg31k3p_device_engine engine;
+        if(init_engines)
+        {
+            engine = mrg31k3p_device_engine(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
+
+        // A 128-bit store needs fewer memory transactions than x scalar
+        // stores; destinations that miss the vector type's alignment
+        // take the unaligned fallback
+        if(((uintptr_t)data)%(sizeof(TypeX)) == 0)
+        {
+            TypeX * dataX = (TypeX *)data;
+            while(index < (n/x))
+            {
+                dataX[index] = distribution(
+                    uint4 { engine(), engine(), engine(), engine() }
+                );
+                // Next position
+                index += stride;
+            }
+        }
+        else
+        {
+            TypeX_unaligned * dataX = (TypeX_unaligned *)data;
+            while(index < (n/x))
+            {
+                TypeX result = distribution(
+                    uint4 { engine(), engine(), engine(), engine() }
+                );
+                dataX[index] = *(TypeX_unaligned*)(&result);  // reinterpret as TypeX_unaligned
+                // Next position
+                index += stride;
+            }
+        }
+
+        // Check if we need to save tail (last 1,..,(x-1) random number).
+        // Those numbers should be generated by the thread that would
+        // save the next TypeX if n was equal n+(x-1) (index < (n/x) would
+        // be true in such situation).
+        auto tail_size = n & (x - 1);
+        if((index == n/x) && tail_size > 0)
+        {
+            TypeX result = distribution(
+                uint4 { engine(), engine(), engine(), engine() }
+            );
+            // Save the tail
+            data[n - tail_size] = (&result.x)[0]; // .x
+            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
+            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+        }
+
+        engines[engine_id] = engine;
+    }
+
+    template<class RealType, class Distribution>
+    __global__
+    void generate_normal_kernel(mrg31k3p_device_engine * engines,
+                                RealType * data, const size_t n,
+                                const unsigned long long seed,
+                                const unsigned long long offset,
+                                const bool init_engines,
+                                Distribution distribution)
+    {
+        typedef decltype(distribution(engines->next(), engines->next())) RealType2;
+
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = engine_id;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        mrg31k3p_device_engine engine;
+        if(init_engines)
+        {
+            engine = mrg31k3p_device_engine(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
+
+        RealType2 * data2 = (RealType2 *)data;
+        while(index < (n / 2))
+        {
+            data2[index] = distribution(engine(), engine());
+            // Next position
+            index += stride;
+        }
+
+        // First work-item saves the tail when n is not a multiple of 2
+        if(engine_id == 0 && (n & 1) > 0)
+        {
+            RealType2 result = distribution(engine(), engine());
+            // Save the tail
+            data[n - 1] = result.x;
+        }
+
+        // Save engine with its state
+        engines[engine_id] = engine;
+    }
+
+
+    template<class Distribution>
+    __global__
+    void generate_poisson_kernel(mrg31k3p_device_engine * engines,
+                                 unsigned int * data, const size_t n,
+                                 const unsigned long long seed,
+                                 const unsigned long long offset,
+                                 const bool init_engines,
+                                 const Distribution distribution)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = engine_id;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        mrg31k3p_device_engine engine;
+        if(init_engines)
+        {
+            engine = mrg31k3p_device_engine(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
+
+        // The discrete distribution is applied lane by lane, but results
+        // are still written back with 128-bit stores
+        if(((uintptr_t)data)%(sizeof(uint4)) == 0)
+        {
+            uint4 * data4 = (uint4 *)data;
+            while(index < (n/4))
+            {
+                data4[index] = uint4 {
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine())
+                };
+                // Next position
+                index += stride;
+            }
+        }
+        else
+        {
+            uint4_unaligned * data4 = (uint4_unaligned *)data;
+            while(index < (n/4))
+            {
+                data4[index] = uint4_unaligned {
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine())
+                };
+                // Next position
+                index += stride;
+            }
+        }
+
+        // Check if we need to save tail (last 1,2,3 random number)
+        auto tail_size = n & 3;
+        if((index == n/4) && tail_size > 0)
+        {
+            data[n - tail_size] = distribution(engine());
+            if(tail_size > 1) data[n - tail_size + 1] = distribution(engine());
+            if(tail_size > 2) data[n - tail_size + 2] = distribution(engine());
+        }
+
+        engines[engine_id] = engine;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_mrg31k3p : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_MRG31K3P>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_MRG31K3P>;
+    using engine_type = ::rocrand_host::detail::mrg31k3p_device_engine;
+
+    rocrand_mrg31k3p(unsigned long long seed = 12345,
+                     unsigned long long offset = 0,
+                     hipStream_t stream = 0)
+        : base_type(seed, offset, stream),
+          m_engines_initialized(false), m_engines(NULL)
+    {
+        // Size the grid for the device active at creation time
+        m_blocks = blocks_for_ordering(ROCRAND_ORDERING_PSEUDO_BEST);
+        m_engines_size = s_threads * m_blocks;
+
+        // Allocate device random number engines
+        auto error = rocrand_host::detail::device_malloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        if(error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        if(m_seed == 0)
+        {
+            m_seed = ROCRAND_MRG31K3P_DEFAULT_SEED;
+        }
+    }
+
+    ~rocrand_mrg31k3p()
+    {
+        rocrand_host::detail::device_free(m_engines, m_stream);
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    ///
+    /// New seed value should not be zero. If \p seed_value is equal
+    /// zero, value \p ROCRAND_MRG31K3P_DEFAULT_SEED is used instead.
+    void set_seed(unsigned long long seed)
+    {
+        if(seed == 0)
+        {
+            seed = ROCRAND_MRG31K3P_DEFAULT_SEED;
+        }
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+    }
+
+    /// Selects the output ordering (see rocrand_set_ordering()).
+    /// ROCRAND_ORDERING_PSEUDO_LEGACY pins the engine grid to its
+    /// fixed device-independent size; ROCRAND_ORDERING_PSEUDO_BEST
+    /// (the default) sizes it for the present device.
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        const unsigned int blocks = blocks_for_ordering(ordering);
+        if(blocks == m_blocks)
+            return ROCRAND_STATUS_SUCCESS;
+
+        engine_type * engines;
+        auto error = rocrand_host::detail::device_malloc(
+            &engines, sizeof(engine_type) * (s_threads * blocks));
+        if(error != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_host::detail::device_free(m_engines, m_stream);
+        m_engines = engines;
+        m_blocks = blocks;
+        m_engines_size = s_threads * m_blocks;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if (m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const auto key = rocrand_host::detail::engine_state_key(
+            ROCRAND_RNG_PSEUDO_MRG31K3P, m_seed, m_offset,
+            sizeof(engine_type) * m_engines_size
+        );
+        if(rocrand_host::detail::engine_state_cache::lookup(key, m_engines, m_stream))
+        {
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, m_seed, m_offset
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Retain a pristine copy so generators recreated with the same
+        // seed and offset skip the skipahead-heavy initialization
+        rocrand_host::detail::engine_state_cache::insert(key, m_engines, m_stream);
+
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+
+    /// Returns the size in bytes of a buffer able to hold the complete
+    /// generator state (see save_state()).
+    size_t state_size() const
+    {
+        return sizeof(rocrand_host::detail::generator_state_header)
+            + sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Snapshots the generator state (host fields and the device engine
+    /// array) into \p buffer of at least state_size() bytes.
+    rocrand_status save_state(void * buffer)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::generator_state_header header;
+        header.version = rocrand_host::detail::generator_state_version;
+        header.rng_type = rng_type;
+        header.seed = m_seed;
+        header.offset = m_offset;
+        header.engine_bytes = sizeof(engine_type) * m_engines_size;
+
+        memcpy(buffer, &header, sizeof(header));
+        if(hipMemcpy(static_cast<char *>(buffer) + sizeof(header),
+                     m_engines, header.engine_bytes,
+                     hipMemcpyDeviceToHost) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Restores the generator state from a buffer written by save_state().
+    /// The buffer must come from a generator of the same type with the
+    /// same engine array size (i.e. the same device configuration).
+    rocrand_status load_state(const void * buffer)
+    {
+        rocrand_host::detail::generator_state_header header;
+        memcpy(&header, buffer, sizeof(header));
+        if(header.version != rocrand_host::detail::generator_state_version
+            || header.rng_type != rng_type
+            || header.engine_bytes != sizeof(engine_type) * m_engines_size)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_seed = header.seed;
+        m_offset = header.offset;
+        if(hipMemcpy(m_engines,
+                     static_cast<const char *>(buffer) + sizeof(header),
+                     header.engine_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = mrg31k3p_uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        if(!m_engines_initialized)
+        {
+            // A cached pristine state is cheaper than in-kernel init
+            const auto key = rocrand_host::detail::engine_state_key(
+                ROCRAND_RNG_PSEUDO_MRG31K3P, m_seed, m_offset,
+                sizeof(engine_type) * m_engines_size
+            );
+            if(rocrand_host::detail::engine_state_cache::lookup(key, m_engines, m_stream))
+                m_engines_initialized = true;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        mrg31k3p_uniform_distribution<T> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        mrg31k3p_uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        mrg31k3p_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        mrg31k3p_cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        mrg31k3p_weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        mrg31k3p_logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        // data_size must be even
+        // data must be aligned to 2 * sizeof(T) bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        mrg31k3p_normal_distribution<T> distribution(mean, stddev);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        // data_size must be even
+        // data must be aligned to 2 * sizeof(T) bytes
+        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        mrg31k3p_log_normal_distribution<T> distribution(mean, stddev);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, m_seed, m_offset, init_engines, m_poisson.dis
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, m_seed, m_offset, init_engines, m_binomial.dis
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
+    {
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, m_seed, m_offset, init_engines, m_discrete.dis
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its 128-bit vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
+    }
+
+private:
+    // Engine grid size for the given ordering: the fixed
+    // device-independent default for LEGACY, the grid saturating the
+    // present device for BEST
+    unsigned int blocks_for_ordering(rocrand_ordering ordering) const
+    {
+        if(ordering != ROCRAND_ORDERING_PSEUDO_BEST)
+            return s_blocks;
+        return rocrand_host::detail::max_active_blocks(
+            static_cast<void(*)(engine_type *, unsigned int *, size_t,
+                                unsigned long long, unsigned long long,
+                                bool, mrg31k3p_uniform_distribution<unsigned int>)>(
+                rocrand_host::detail::generate_kernel<
+                    unsigned int, mrg31k3p_uniform_distribution<unsigned int>
+                >
+            ),
+            s_threads, s_blocks
+        );
+    }
+
+    // Returns a grid size just large enough to cover data_size without
+    // grid-stride iterations, capped at the full per-device grid.
+    // Small requests then load and store only a prefix of the engines.
+    uint32_t blocks_for_size(size_t data_size) const
+    {
+        // Each thread writes up to 4 elements per grid-stride iteration
+        const size_t elements_per_block = s_threads * 4;
+        const size_t blocks = (data_size + elements_per_block - 1) / elements_per_block;
+        return static_cast<uint32_t>(
+            std::min<size_t>(std::max<size_t>(blocks, 1), m_blocks)
+        );
+    }
+
+    bool m_engines_initialized;
+    engine_type * m_engines;
+    size_t m_engines_size;
+    uint32_t m_blocks;
+    // Default grid sizes, used when the device can't be queried
+    #ifdef __HIP_PLATFORM_NVCC__
+    static const uint32_t s_threads = 128;
+    static const uint32_t s_blocks = 128;
+    #else
+    static const uint32_t s_threads = 256;
+    static const uint32_t s_blocks = 512;
+    #endif
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<> m_binomial;
+
+    discrete_distribution_manager<> m_discrete;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_MRG31K3P_H_
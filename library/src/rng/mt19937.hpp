@@ -0,0 +1,667 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/*
+ * Copyright (C) 1997 - 2002, Makoto Matsumoto and Takuji Nishimura,
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ *   1. Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *
+ *   2. Redistributions in binary form must reproduce the above copyright
+ *      notice, this list of conditions and the following disclaimer in the
+ *      documentation and/or other materials provided with the distribution.
+ *
+ *   3. The names of its contributors may not be used to endorse or promote
+ *      products derived from this software without specific prior written
+ *      permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef ROCRAND_RNG_MT19937_H_
+#define ROCRAND_RNG_MT19937_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Mersenne Twister MT19937 state. One engine is shared by all
+    // threads of a block; the state is twisted cooperatively in
+    // shared memory (see mt19937_twist()).
+    struct mt19937_device_engine
+    {
+        static const unsigned int n = 624;
+        static const unsigned int m = 397;
+        static const unsigned int matrix_a = 0x9908B0DFU;
+        static const unsigned int upper_mask = 0x80000000U; // most significant bit
+        static const unsigned int lower_mask = 0x7FFFFFFFU; // least significant 31 bits
+
+        unsigned int mt[n];
+    };
+
+    __forceinline__ __device__ __host__
+    unsigned int mt19937_temper(unsigned int y)
+    {
+        y ^= (y >> 11);
+        y ^= (y << 7) & 0x9D2C5680U;
+        y ^= (y << 15) & 0xEFC60000U;
+        y ^= (y >> 18);
+        return y;
+    }
+
+    // Advances the whole 624-word state by one twist, cooperatively.
+    //
+    // The sequential recurrence for mt[i] reads mt[i + 1] and
+    // mt[(i + m) % n]; the state is split into phases such that every
+    // value a phase reads either belongs to the previous state or was
+    // written by an earlier phase:
+    //   phase 1: i in [0, n - m)          reads old values only
+    //   phase 2: i in [n - m, 2(n - m))   reads phase 1 results
+    //   phase 3: i in [2(n - m), n - 1)   reads phase 2 results
+    //   phase 4: i = n - 1                reads mt[0] and phase 2 results
+    // Each phase stages its reads in registers before writing, so the
+    // phases themselves are race-free. Must be called by all threads
+    // of the block; hipBlockDim_x must be at least n - m (227) threads.
+    __forceinline__ __device__
+    void mt19937_twist(unsigned int * mt)
+    {
+        typedef mt19937_device_engine engine_type;
+        constexpr unsigned int n = engine_type::n;
+        constexpr unsigned int m = engine_type::m;
+
+        const unsigned int thread_id = hipThreadIdx_x;
+        const unsigned int bounds[4] = { 0, n - m, 2 * (n - m), n - 1 };
+
+        #pragma unroll
+        for(unsigned int phase = 0; phase < 3; phase++)
+        {
+            const unsigned int i = bounds[phase] + thread_id;
+            const bool active = i < bounds[phase + 1];
+            unsigned int value = 0;
+            if(active)
+            {
+                const unsigned int y =
+                    (mt[i] & engine_type::upper_mask) | (mt[i + 1] & engine_type::lower_mask);
+                value = mt[(i + m) % n] ^ (y >> 1) ^ ((y & 1) ? engine_type::matrix_a : 0);
+            }
+            __syncthreads();
+            if(active)
+            {
+                mt[i] = value;
+            }
+            __syncthreads();
+        }
+
+        if(thread_id == 0)
+        {
+            const unsigned int y =
+                (mt[n - 1] & engine_type::upper_mask) | (mt[0] & engine_type::lower_mask);
+            mt[n - 1] = mt[m - 1] ^ (y >> 1) ^ ((y & 1) ? engine_type::matrix_a : 0);
+        }
+        __syncthreads();
+    }
+
+    __global__
+    void init_engines_kernel_mt19937(mt19937_device_engine * engines,
+                                     const unsigned int engines_size,
+                                     const unsigned long long seed)
+    {
+        typedef mt19937_device_engine engine_type;
+
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(engine_id >= engines_size)
+            return;
+
+        // The seeding recurrence is sequential, so one thread seeds one
+        // engine. Every engine gets its own seed derived from the
+        // generator's seed, making the per-block sequences distinct.
+        unsigned int s = static_cast<unsigned int>(seed ^ (seed >> 32))
+            + engine_id * 2654435761U;
+        engines[engine_id].mt[0] = s;
+        for(unsigned int i = 1; i < engine_type::n; i++)
+        {
+            s = 1812433253U * (s ^ (s >> 30)) + i;
+            engines[engine_id].mt[i] = s;
+        }
+    }
+
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel_mt19937(mt19937_device_engine * engines,
+                                 Type * data,
+                                 const size_t size,
+                                 Distribution distribution)
+    {
+        typedef mt19937_device_engine engine_type;
+        constexpr unsigned int n = engine_type::n;
+
+        const unsigned int engine_id = hipBlockIdx_x;
+
+        // Load device engine into shared memory
+        __shared__ unsigned int mt[n];
+        for(unsigned int i = hipThreadIdx_x; i < n; i += hipBlockDim_x)
+        {
+            mt[i] = engines[engine_id].mt[i];
+        }
+        __syncthreads();
+
+        // Each block fills consecutive n-value sections of the output;
+        // a whole twist is consumed per section, values generated past
+        // the end of the output are discarded.
+        unsigned long long base = static_cast<unsigned long long>(hipBlockIdx_x) * n;
+        const unsigned long long stride = static_cast<unsigned long long>(hipGridDim_x) * n;
+        while(base < size)
+        {
+            mt19937_twist(mt);
+            for(unsigned int i = hipThreadIdx_x; i < n; i += hipBlockDim_x)
+            {
+                const unsigned long long index = base + i;
+                if(index < size)
+                    data[index] = distribution(mt19937_temper(mt[i]));
+            }
+            __syncthreads();
+            base += stride;
+        }
+
+        // Save engine with its state
+        for(unsigned int i = hipThreadIdx_x; i < n; i += hipBlockDim_x)
+        {
+            engines[engine_id].mt[i] = mt[i];
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_mt19937 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_MT19937>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_MT19937>;
+    using engine_type = ::rocrand_host::detail::mt19937_device_engine;
+
+    rocrand_mt19937(unsigned long long seed = 0,
+                    unsigned long long offset = 0,
+                    hipStream_t stream = 0)
+        : base_type(seed, offset, stream),
+          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_blocks)
+    {
+        // Allocate device random number engines
+        auto error = rocrand_host::detail::device_malloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        if(error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    ~rocrand_mt19937()
+    {
+        rocrand_host::detail::device_free(m_engines, m_stream);
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel_mt19937),
+            dim3((m_engines_size + 127) / 128), dim3(128), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size), m_seed
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the size in bytes of a buffer able to hold the complete
+    /// generator state (see save_state()).
+    size_t state_size() const
+    {
+        return sizeof(rocrand_host::detail::generator_state_header)
+            + sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Snapshots the generator state (host fields and the device engine
+    /// array) into \p buffer of at least state_size() bytes.
+    rocrand_status save_state(void * buffer)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::generator_state_header header;
+        header.version = rocrand_host::detail::generator_state_version;
+        header.rng_type = rng_type;
+        header.seed = m_seed;
+        header.offset = m_offset;
+        header.engine_bytes = sizeof(engine_type) * m_engines_size;
+
+        memcpy(buffer, &header, sizeof(header));
+        if(hipMemcpy(static_cast<char *>(buffer) + sizeof(header),
+                     m_engines, header.engine_bytes,
+                     hipMemcpyDeviceToHost) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Restores the generator state from a buffer written by save_state().
+    /// The buffer must come from a generator of the same type with the
+    /// same engine array size (i.e. the same device configuration).
+    rocrand_status load_state(const void * buffer)
+    {
+        rocrand_host::detail::generator_state_header header;
+        memcpy(&header, buffer, sizeof(header));
+        if(header.version != rocrand_host::detail::generator_state_version
+            || header.rng_type != rng_type
+            || header.engine_bytes != sizeof(engine_type) * m_engines_size)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_seed = header.seed;
+        m_offset = header.offset;
+        if(hipMemcpy(m_engines,
+                     static_cast<const char *>(buffer) + sizeof(header),
+                     header.engine_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel_mt19937),
+            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, data, data_size, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_poisson.dis);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_binomial.dis);
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
+    {
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_discrete.dis);
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its 128-bit vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_uniform_half(__half * data, size_t n) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        uniform_distribution<__half>());
+    }
+
+    rocrand_status generate_normal_half(__half * data, size_t n,
+                                        __half mean, __half stddev) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        normal_distribution<__half>(mean, stddev));
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_truncated_normal_float(float * data, size_t n,
+                                                   float mean, float stddev,
+                                                   float low, float high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<float>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_truncated_normal_double(double * data, size_t n,
+                                                    double mean, double stddev,
+                                                    double low, double high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<double>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_normal_double_fast(double * data, size_t n,
+                                               double mean, double stddev) override
+    {
+        return generate(data, n,
+                        fast_normal_distribution<double>(mean, stddev));
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
+    }
+
+private:
+    bool m_engines_initialized;
+    engine_type * m_engines;
+    size_t m_engines_size;
+    static const uint32_t s_threads = 256;
+    #ifdef __HIP_PLATFORM_NVCC__
+    static const uint32_t s_blocks = 64;
+    #else
+    static const uint32_t s_blocks = 512;
+    #endif
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<> m_binomial;
+
+    discrete_distribution_manager<> m_discrete;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_MT19937_H_
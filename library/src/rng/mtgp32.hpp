@@ -60,6 +60,7 @@
 
 #include <rocrand.h>
 #include <rocrand_mtgp32_11213.h>
+#include <rocrand_mtgp32_jump_precomputed.h>
 
 #include "generator_type.hpp"
 #include "device_engines.hpp"
@@ -107,6 +108,163 @@ namespace detail {
         engines[engine_id].copy(&engine);
     }
 
+    // Advances each engine by \p offset values. One generated value
+    // corresponds to one transition of the F2-linear MTGP32 recursion, so
+    // the jump is evaluated as h(A)s where A is the state transition, s is
+    // the 351-word state window, and h = x^offset mod p with p the
+    // precomputed minimal polynomial of this engine's parameter set (see
+    // tools/mtgp32_jump_polynomial_generator.cpp). This takes O(deg(p))
+    // transitions per squaring instead of offset transitions in total.
+    //
+    // One block per engine; all threads of the block cooperate on the
+    // polynomial arithmetic and on the state accumulation.
+    __global__
+    void jump_ahead_kernel(mtgp32_device_engine * engines,
+                           unsigned long long offset)
+    {
+        const unsigned int engine_id = hipBlockIdx_x;
+        const unsigned int thread_id = hipThreadIdx_x;
+        const unsigned int block_size = hipBlockDim_x;
+
+        mtgp32_device_engine * engine = &engines[engine_id];
+
+        __shared__ unsigned int p[MTGP32_JUMP_POLY_SIZE]; // minimal polynomial
+        __shared__ unsigned int h[MTGP32_JUMP_POLY_SIZE]; // x^offset mod p
+        __shared__ unsigned int r[MTGP32_JUMP_POLY_SIZE];
+        __shared__ unsigned int rs[MTGP32_JUMP_POLY_SIZE];
+        __shared__ unsigned int s[MTGP_N];   // state window at offset 0
+        __shared__ unsigned int acc[MTGP_N]; // Horner accumulator
+        __shared__ unsigned int param_tbl[MTGP_TS];
+        __shared__ int head;
+
+        const int degp = d_mtgp32_jump_poly_degrees[engine_id];
+        const int state_offset = engine->m_state.offset;
+
+        for (int i = thread_id; i < MTGP32_JUMP_POLY_SIZE; i += block_size)
+        {
+            p[i] = d_mtgp32_jump_polys[engine_id][i];
+            h[i] = (i == 0 ? 1 : 0);
+        }
+        for (int i = thread_id; i < MTGP_N; i += block_size)
+        {
+            s[i] = engine->m_state.status[(state_offset + i) & MTGP_MASK];
+            acc[i] = 0;
+        }
+        if (thread_id < MTGP_TS)
+        {
+            param_tbl[thread_id] = engine->param_tbl[thread_id];
+        }
+        if (thread_id == 0)
+        {
+            head = 0;
+        }
+        __syncthreads();
+
+        // h = x^offset mod p, exponentiation by squaring over the offset
+        // bits, most significant bit first
+        int top = -1;
+        for (int e = 63; e >= 0; e--)
+        {
+            if ((offset >> e) & 1)
+            {
+                top = e;
+                break;
+            }
+        }
+        for (int e = top; e >= 0; e--)
+        {
+            // r = h * h mod p, bit-serial over the multiplier bits
+            for (int j = thread_id; j < MTGP32_JUMP_POLY_SIZE; j += block_size)
+            {
+                r[j] = 0;
+            }
+            __syncthreads();
+            for (int i = degp - 1; i >= 0; i--)
+            {
+                for (int j = thread_id; j < MTGP32_JUMP_POLY_SIZE; j += block_size)
+                {
+                    rs[j] = (r[j] << 1) | (j > 0 ? (r[j - 1] >> 31) : 0);
+                }
+                __syncthreads();
+                const bool reduce = (rs[degp >> 5] >> (degp & 31)) & 1;
+                const bool add = (h[i >> 5] >> (i & 31)) & 1;
+                for (int j = thread_id; j < MTGP32_JUMP_POLY_SIZE; j += block_size)
+                {
+                    r[j] = rs[j] ^ (reduce ? p[j] : 0) ^ (add ? h[j] : 0);
+                }
+                __syncthreads();
+            }
+            if ((offset >> e) & 1)
+            {
+                // r = r * x mod p
+                for (int j = thread_id; j < MTGP32_JUMP_POLY_SIZE; j += block_size)
+                {
+                    rs[j] = (r[j] << 1) | (j > 0 ? (r[j - 1] >> 31) : 0);
+                }
+                __syncthreads();
+                const bool reduce = (rs[degp >> 5] >> (degp & 31)) & 1;
+                for (int j = thread_id; j < MTGP32_JUMP_POLY_SIZE; j += block_size)
+                {
+                    r[j] = rs[j] ^ (reduce ? p[j] : 0);
+                }
+                __syncthreads();
+            }
+            for (int j = thread_id; j < MTGP32_JUMP_POLY_SIZE; j += block_size)
+            {
+                h[j] = r[j];
+            }
+            __syncthreads();
+        }
+
+        int degh = 0;
+        for (int i = degp - 1; i >= 0; i--)
+        {
+            if ((h[i >> 5] >> (i & 31)) & 1)
+            {
+                degh = i;
+                break;
+            }
+        }
+
+        // acc = h(A)s by Horner's rule; acc is a circular window with its
+        // oldest word at head
+        const unsigned int pos = engine->pos_tbl;
+        const unsigned int sh1 = engine->sh1_tbl;
+        const unsigned int sh2 = engine->sh2_tbl;
+        const unsigned int mask = engine->mask;
+        for (int i = degh; i >= 0; i--)
+        {
+            if (thread_id == 0)
+            {
+                // acc = A * acc, one transition of the recursion
+                // (mtgp32_engine::para_rec)
+                unsigned int x = (acc[head] & mask) ^ acc[(head + 1) % MTGP_N];
+                x ^= x << sh1;
+                unsigned int y = x ^ (acc[(head + pos) % MTGP_N] >> sh2);
+                acc[head] = y ^ param_tbl[y & 0x0f];
+                head = (head + 1) % MTGP_N;
+            }
+            __syncthreads();
+            if ((h[i >> 5] >> (i & 31)) & 1)
+            {
+                for (int j = thread_id; j < MTGP_N; j += block_size)
+                {
+                    acc[(head + j) % MTGP_N] ^= s[j];
+                }
+                __syncthreads();
+            }
+        }
+
+        for (int i = thread_id; i < MTGP_N; i += block_size)
+        {
+            engine->m_state.status[i] = acc[(head + i) % MTGP_N];
+        }
+        if (thread_id == 0)
+        {
+            engine->m_state.offset = 0;
+        }
+    }
+
 } // end namespace detail
 } // end namespace rocrand_host
 
@@ -120,10 +278,13 @@ public:
                    unsigned long long offset = 0,
                    hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_blocks)
+          m_engines_initialized(false), m_engines(NULL)
     {
+        // Size the grid for the device active at creation time
+        m_engines_size = blocks_for_ordering(ROCRAND_ORDERING_PSEUDO_BEST);
+
         // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        auto error = rocrand_host::detail::device_malloc(&m_engines, sizeof(engine_type) * m_engines_size);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -132,7 +293,7 @@ public:
 
     ~rocrand_mtgp32()
     {
-        hipFree(m_engines);
+        rocrand_host::detail::device_free(m_engines, m_stream);
     }
 
     void reset()
@@ -156,6 +317,29 @@ public:
         m_engines_initialized = false;
     }
 
+    /// Changes the engine array size used by the generation kernels.
+    /// ROCRAND_ORDERING_PSEUDO_LEGACY keeps the fixed historical grid;
+    /// ROCRAND_ORDERING_PSEUDO_BEST (the default) sizes it for the present
+    /// device, up to the number of published MTGP32 parameter sets (each
+    /// engine needs its own set for an independent sequence).
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        const size_t engines_size = blocks_for_ordering(ordering);
+        if(engines_size == m_engines_size)
+            return ROCRAND_STATUS_SUCCESS;
+
+        engine_type * engines;
+        auto error = rocrand_host::detail::device_malloc(
+            &engines, sizeof(engine_type) * engines_size);
+        if(error != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_host::detail::device_free(m_engines, m_stream);
+        m_engines = engines;
+        m_engines_size = engines_size;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if (m_engines_initialized)
@@ -167,11 +351,85 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS)
             return ROCRAND_STATUS_ALLOCATION_FAILED;
 
+        if(m_offset > 0)
+        {
+            // Advance every engine by m_offset values using the precomputed
+            // jump polynomials
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::jump_ahead_kernel),
+                dim3(m_engines_size), dim3(s_threads), 0, m_stream,
+                m_engines, m_offset
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
         m_engines_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+
+    /// Returns the size in bytes of a buffer able to hold the complete
+    /// generator state (see save_state()).
+    size_t state_size() const
+    {
+        return sizeof(rocrand_host::detail::generator_state_header)
+            + sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Snapshots the generator state (host fields and the device engine
+    /// array) into \p buffer of at least state_size() bytes.
+    rocrand_status save_state(void * buffer)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::generator_state_header header;
+        header.version = rocrand_host::detail::generator_state_version;
+        header.rng_type = rng_type;
+        header.seed = m_seed;
+        header.offset = m_offset;
+        header.engine_bytes = sizeof(engine_type) * m_engines_size;
+
+        memcpy(buffer, &header, sizeof(header));
+        if(hipMemcpy(static_cast<char *>(buffer) + sizeof(header),
+                     m_engines, header.engine_bytes,
+                     hipMemcpyDeviceToHost) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Restores the generator state from a buffer written by save_state().
+    /// The buffer must come from a generator of the same type with the
+    /// same engine array size (i.e. the same device configuration).
+    rocrand_status load_state(const void * buffer)
+    {
+        rocrand_host::detail::generator_state_header header;
+        memcpy(&header, buffer, sizeof(header));
+        if(header.version != rocrand_host::detail::generator_state_version
+            || header.rng_type != rng_type
+            || header.engine_bytes != sizeof(engine_type) * m_engines_size)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_seed = header.seed;
+        m_offset = header.offset;
+        if(hipMemcpy(m_engines,
+                     static_cast<const char *>(buffer) + sizeof(header),
+                     header.engine_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     template<class T, class Distribution = uniform_distribution<T> >
     rocrand_status generate(T * data, size_t data_size,
                             const Distribution& distribution = Distribution())
@@ -189,7 +447,7 @@ public:
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
+            dim3(m_engines_size), dim3(s_threads), 0, m_stream,
             m_engines, data, data_size, size_rounded_up,
             size_rounded_down, distribution
         );
@@ -207,6 +465,42 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
@@ -225,7 +519,7 @@ public:
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, m_stream);
         }
         catch(rocrand_status status)
         {
@@ -234,7 +528,229 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_binomial.dis);
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
+    {
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_discrete.dis);
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its 128-bit vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_uniform_half(__half * data, size_t n) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        uniform_distribution<__half>());
+    }
+
+    rocrand_status generate_normal_half(__half * data, size_t n,
+                                        __half mean, __half stddev) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        normal_distribution<__half>(mean, stddev));
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
+    }
+
 private:
+    unsigned int blocks_for_ordering(rocrand_ordering ordering) const
+    {
+        unsigned int blocks = s_blocks;
+        if(ordering == ROCRAND_ORDERING_PSEUDO_BEST)
+        {
+            blocks = rocrand_host::detail::max_active_blocks(
+                static_cast<void(*)(engine_type *, unsigned int *,
+                                    size_t, size_t, size_t,
+                                    uniform_distribution<unsigned int>)>(
+                    rocrand_host::detail::generate_kernel<
+                        unsigned int, uniform_distribution<unsigned int>
+                    >),
+                s_threads, s_blocks
+            );
+        }
+        // Every engine needs its own parameter set for an independent
+        // sequence, so the grid cannot grow past the published table
+        return std::min(blocks, s_param_sets);
+    }
+
     bool m_engines_initialized;
     engine_type * m_engines;
     size_t m_engines_size;
@@ -245,9 +761,15 @@ private:
     static const uint32_t s_threads = 256;
     static const uint32_t s_blocks = 512;
     #endif
+    static const uint32_t s_param_sets
+        = sizeof(mtgp32dc_params_fast_11213) / sizeof(mtgp32dc_params_fast_11213[0]);
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<> m_binomial;
+
+    discrete_distribution_manager<> m_discrete;
 
     // m_seed from base_type
     // m_offset from base_type
@@ -0,0 +1,261 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PERSISTENT_H_
+#define ROCRAND_RNG_PERSISTENT_H_
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Work descriptor for the persistent generation service (see
+// rocrand_set_persistent_mode()): a destination buffer, a length and
+// the uniform output type to fill it with
+struct persistent_descriptor
+{
+    static constexpr unsigned int op_uniform_uint = 0;
+    static constexpr unsigned int op_uniform_float = 1;
+    static constexpr unsigned int op_uniform_double = 2;
+
+    void * data;
+    unsigned long long n;
+    unsigned int op;
+    unsigned int reserved;
+};
+
+// Lock-free single-producer ring shared between the host and the
+// resident service kernel, allocated in fine-grained (coherent)
+// pinned memory. The host writes descriptors and advances \p tail;
+// every block of the service grid processes its slice of each
+// descriptor in order, and the last block to finish one advances
+// \p done. The host never reuses a slot before \p done has moved past
+// it, and the device reads \p quit to leave the polling loop.
+struct persistent_queue
+{
+    static constexpr unsigned int capacity = 1024;
+
+    persistent_descriptor slots[capacity];
+    unsigned int blocks_done[capacity];
+    volatile unsigned long long tail;
+    volatile unsigned long long done;
+    volatile unsigned int quit;
+};
+
+// Resident generation kernel: engines live in registers across
+// requests and each request costs the queue push instead of a launch.
+// One engine per thread; the grid-wide interleaving of a request's
+// output matches a leapfrogged bulk launch with one value per engine
+// per round.
+template<class EngineType>
+__global__
+void persistent_service_kernel(EngineType * engines,
+                               persistent_queue * queue,
+                               const unsigned long long seed,
+                               const unsigned long long offset,
+                               const bool init_engines)
+{
+    const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    EngineType engine = init_engines
+        ? EngineType(seed, engine_id, offset)
+        : engines[engine_id];
+
+    unsigned long long next = 0;
+    while(queue->quit == 0)
+    {
+        if(next >= queue->tail)
+        {
+            continue;
+        }
+        __threadfence_system();
+        const unsigned int slot = next % persistent_queue::capacity;
+        const persistent_descriptor desc = queue->slots[slot];
+
+        // Scalar stores: the service targets many small buffers, whose
+        // pointers carry no alignment guarantee
+        if(desc.op == persistent_descriptor::op_uniform_uint)
+        {
+            unsigned int * data = static_cast<unsigned int *>(desc.data);
+            const unsigned long long groups = (desc.n + 3) / 4;
+            for(unsigned long long g = engine_id; g < groups; g += stride)
+            {
+                const uint4 v = engine.next4();
+                for(unsigned int j = 0; j < 4; j++)
+                {
+                    const unsigned long long i = 4 * g + j;
+                    if(i < desc.n) data[i] = (&v.x)[j];
+                }
+            }
+        }
+        else if(desc.op == persistent_descriptor::op_uniform_float)
+        {
+            float * data = static_cast<float *>(desc.data);
+            const unsigned long long groups = (desc.n + 3) / 4;
+            for(unsigned long long g = engine_id; g < groups; g += stride)
+            {
+                const float4 v = uniform_distribution<float>()(engine.next4());
+                for(unsigned int j = 0; j < 4; j++)
+                {
+                    const unsigned long long i = 4 * g + j;
+                    if(i < desc.n) data[i] = (&v.x)[j];
+                }
+            }
+        }
+        else if(desc.op == persistent_descriptor::op_uniform_double)
+        {
+            double * data = static_cast<double *>(desc.data);
+            const unsigned long long groups = (desc.n + 1) / 2;
+            for(unsigned long long g = engine_id; g < groups; g += stride)
+            {
+                const double2 v = uniform_distribution<double>()(engine.next4());
+                for(unsigned int j = 0; j < 2; j++)
+                {
+                    const unsigned long long i = 2 * g + j;
+                    if(i < desc.n) data[i] = (&v.x)[j];
+                }
+            }
+        }
+
+        __syncthreads();
+        if(hipThreadIdx_x == 0)
+        {
+            __threadfence_system();
+            if(atomicAdd(&queue->blocks_done[slot], 1) + 1 == hipGridDim_x)
+            {
+                queue->blocks_done[slot] = 0;
+                __threadfence_system();
+                atomicAdd(const_cast<unsigned long long *>(&queue->done), 1ull);
+            }
+        }
+        next++;
+    }
+
+    // Write the engines back so stateful generation continues
+    // seamlessly after the service stops
+    engines[engine_id] = engine;
+}
+
+// Host side of the persistent generation service: owns the queue, the
+// dedicated stream the resident kernel runs on, and the producer end
+// of the ring
+template<class EngineType>
+class persistent_service
+{
+public:
+    persistent_service(const persistent_service&) = delete;
+    persistent_service& operator=(const persistent_service&) = delete;
+
+    persistent_service(EngineType * engines, size_t engines_size,
+                       unsigned int threads,
+                       unsigned long long seed, unsigned long long offset,
+                       bool init_engines)
+        : m_queue(NULL), m_stream(NULL), m_tail(0)
+    {
+        if(hipHostMalloc(reinterpret_cast<void **>(&m_queue), sizeof(persistent_queue),
+                         hipHostMallocCoherent) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        std::memset(const_cast<persistent_queue *>(m_queue), 0, sizeof(persistent_queue));
+
+        if(hipStreamCreateWithFlags(&m_stream, hipStreamNonBlocking) != hipSuccess)
+        {
+            hipHostFree(m_queue);
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        const unsigned int blocks = static_cast<unsigned int>(engines_size / threads);
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(persistent_service_kernel),
+            dim3(blocks), dim3(threads), 0, m_stream,
+            engines, m_queue, seed, offset, init_engines
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            hipStreamDestroy(m_stream);
+            hipHostFree(m_queue);
+            throw ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+    }
+
+    ~persistent_service()
+    {
+        // Drain pending requests before posting the quit flag so no
+        // enqueued work is abandoned
+        synchronize();
+        m_queue->quit = 1;
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        hipStreamSynchronize(m_stream);
+        hipStreamDestroy(m_stream);
+        hipHostFree(m_queue);
+    }
+
+    rocrand_status enqueue(void * data, size_t n, unsigned int op)
+    {
+        // Wait for a free slot; the ring is full only when the device
+        // is more than \p capacity requests behind
+        while(m_tail - m_queue->done >= persistent_queue::capacity)
+        {
+            std::this_thread::yield();
+        }
+        persistent_descriptor& desc =
+            const_cast<persistent_queue *>(m_queue)
+                ->slots[m_tail % persistent_queue::capacity];
+        desc.data = data;
+        desc.n = n;
+        desc.op = op;
+        std::atomic_thread_fence(std::memory_order_release);
+        m_tail++;
+        m_queue->tail = m_tail;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Blocks until every enqueued request has been fully written
+    rocrand_status synchronize() const
+    {
+        while(m_queue->done < m_tail)
+        {
+            std::this_thread::yield();
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+    volatile persistent_queue * m_queue;
+    hipStream_t m_stream;
+    unsigned long long m_tail;
+};
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_PERSISTENT_H_
@@ -54,137 +54,98 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define ROCRAND_RNG_PHILOX4X32_10_H_
 
 #include <algorithm>
+#include <vector>
 #include <hip/hip_runtime.h>
 
 #include <rocrand.h>
 
+#include "common.hpp"
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "persistent.hpp"
 
 namespace rocrand_host {
 namespace detail {
 
-    struct double2_unaligned
+    template<unsigned int Rounds>
+    struct philox4x32_device_engine : public ::rocrand_device::philox4x32_engine<Rounds>
     {
-        double x;
-        double y;
-    };
-
-    struct uint4_unaligned
-    {
-        unsigned int x;
-        unsigned int y;
-        unsigned int z;
-        unsigned int w;
-    };
-
-    struct float4_unaligned
-    {
-        float x;
-        float y;
-        float z;
-        float w;
-    };
-
-    struct double4_unaligned
-    {
-        double x;
-        double y;
-        double z;
-        double w;
-    };
-
-    template<class T>
-    struct unaligned_type
-    {
-        typedef void type;
-    };
-
-    template<>
-    struct unaligned_type<double2>
-    {
-        typedef double2_unaligned type;
-    };
-
-    template<>
-    struct unaligned_type<uint4>
-    {
-        typedef uint4_unaligned type;
-    };
-
-    template<>
-    struct unaligned_type<float4>
-    {
-        typedef float4_unaligned type;
-    };
-
-    template<>
-    struct unaligned_type<double4>
-    {
-        typedef double4_unaligned type;
-    };
-
-    inline __device__ unsigned int warp_reduce_min(unsigned int val, int size) {
-      for (int offset = size/2; offset > 0; offset /= 2) {
-        #if defined(__HIP_PLATFORM_NVCC__) && __CUDACC_VER_MAJOR__ >= 9
-        unsigned int temp = __shfl_xor_sync(0xffffffff, (int)val, offset);
-        #else
-        unsigned int temp = __shfl_xor((int)val, offset);
-        #endif
-        val = (temp < val) ? temp : val;
-      }
-      return val;
-    }
-
-    struct philox4x32_10_device_engine : public ::rocrand_device::philox4x32_10_engine
-    {
-        typedef ::rocrand_device::philox4x32_10_engine base_type;
-        typedef base_type::philox4x32_10_state state_type;
+        typedef ::rocrand_device::philox4x32_engine<Rounds> base_type;
+        typedef typename base_type::philox4x32_state state_type;
 
         __forceinline__ __device__ __host__
-        philox4x32_10_device_engine() { }
+        philox4x32_device_engine() { }
 
         __forceinline__ __device__ __host__
-        philox4x32_10_device_engine(const unsigned long long seed,
-                                    const unsigned long long subsequence,
-                                    const unsigned long long offset)
+        philox4x32_device_engine(const unsigned long long seed,
+                                 const unsigned long long subsequence,
+                                 const unsigned long long offset)
             : base_type(seed, subsequence, offset)
         {
 
         }
 
         __forceinline__ __device__ __host__
-        ~philox4x32_10_device_engine () {}
+        ~philox4x32_device_engine () {}
 
         __forceinline__ __device__ __host__
         uint4 next4_leap(unsigned int leap)
         {
-            uint4 ret = m_state.result;
+            uint4 ret = this->m_state.result;
             this->discard_state(leap);
-            m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+            this->m_state.result =
+                this->run_rounds(this->m_state.counter, this->m_state.key);
             return ret;
         }
 
         // m_state from base class
     };
 
+    template<class DeviceEngineType>
     __global__
-    void init_engines_kernel(philox4x32_10_device_engine * engines,
+    void init_engines_kernel(DeviceEngineType * engines,
                              const unsigned long long seed,
                              const unsigned long long offset)
     {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = philox4x32_10_device_engine(seed, engine_id, offset);
+        engines[engine_id] = DeviceEngineType(seed, engine_id, offset);
     }
 
-    template<unsigned int ThreadsPerEngine, class Distribution>
+    // Re-keys every engine in place for a new seed (see
+    // rocrand_reseed()); the counters are left untouched, so the
+    // engines keep their sequence position and only switch to the
+    // stream keyed by the new seed
+    template<class DeviceEngineType>
+    __global__
+    void rekey_engines_kernel(DeviceEngineType * engines,
+                              const unsigned long long seed)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        engines[engine_id].rekey(seed);
+    }
+
+    // Moves every engine subsequence_base subsequences forward (see
+    // rocrand_set_subsequence()); the philox subsequence skip is plain
+    // counter arithmetic, so the per-engine cost is O(1)
+    template<class DeviceEngineType>
+    __global__
+    void skip_subsequences_kernel(DeviceEngineType * engines,
+                                  const unsigned long long subsequence_base)
+    {
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        engines[engine_id].discard_subsequence(subsequence_base);
+    }
+
+    template<unsigned int ThreadsPerEngine, bool HasTail, class DeviceEngineType, class Distribution>
     __global__
-    void generate_kernel(philox4x32_10_device_engine * engines,
+    void generate_kernel(DeviceEngineType * engines,
                          double * data, const size_t n,
+                         const unsigned long long seed,
+                         const unsigned long long offset,
+                         const bool init_engines,
                          Distribution distribution)
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
         typedef decltype(distribution(uint4())) Type2;
         typedef typename unaligned_type<Type2>::type Type2_unaligned;
 
@@ -192,8 +153,17 @@ namespace detail {
         const unsigned int engine_id = index/ThreadsPerEngine;
         const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
         if(hipThreadIdx_x%ThreadsPerEngine > 0)
         {
             // Skips hipThreadIdx_x%ThreadsPerEngine states
@@ -232,26 +202,28 @@ namespace detail {
         // true in such situation).
         // If this condition is met, then we know that (index == index_min)
         // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 1;
-        if((index == n/2) && tail_size > 0)
+        const auto tail_size = HasTail ? (n & 1) : 0;
+        if(HasTail && (index == n/2) && tail_size > 0)
         {
             Type2 result = distribution(engine.next4());
             // Save the tail
             data[n - tail_size] = result.x;
         }
 
-        // Save engine
-        if(smallest_state)
+        // Save engine (stateless calls pass no engine array)
+        if(engines != NULL && smallest_state)
             engines[engine_id] = engine;
     }
 
-    template<unsigned int ThreadsPerEngine, class Type, class Distribution>
+    template<unsigned int ThreadsPerEngine, bool HasTail, class DeviceEngineType, class Type, class Distribution>
     __global__
-    void generate_kernel(philox4x32_10_device_engine * engines,
+    void generate_kernel(DeviceEngineType * engines,
                          Type * data, const size_t n,
+                         const unsigned long long seed,
+                         const unsigned long long offset,
+                         const bool init_engines,
                          Distribution distribution)
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
         typedef decltype(distribution(uint4())) Type4;
         typedef typename unaligned_type<Type4>::type Type4_unaligned;
 
@@ -259,8 +231,17 @@ namespace detail {
         const unsigned int engine_id = index/ThreadsPerEngine;
         const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
         if(hipThreadIdx_x%ThreadsPerEngine > 0)
         {
             // Skips hipThreadIdx_x%ThreadsPerEngine states
@@ -299,8 +280,8 @@ namespace detail {
         // true in such situation).
         // If this condition is met, then we know that (index == index_min)
         // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & 3;
-        if((index == n/4) && tail_size > 0)
+        const auto tail_size = HasTail ? (n & 3) : 0;
+        if(HasTail && (index == n/4) && tail_size > 0)
         {
             Type4 result = distribution(engine.next4());
             // Save the tail
@@ -309,260 +290,2537 @@ namespace detail {
             if(tail_size > 2) data[n - tail_size + 2] = result.z;
         }
 
-        // Save engine
-        if(smallest_state)
+        // Save engine (stateless calls pass no engine array)
+        if(engines != NULL && smallest_state)
             engines[engine_id] = engine;
     }
 
-    template<unsigned int ThreadsPerEngine, class RealType, class Distribution>
+    // Grid-agnostic variant of generate_kernel() used under
+    // ROCRAND_ORDERING_PSEUDO_COUNTER: every group of outputs is drawn
+    // from a fresh engine keyed by (seed, counter + group index), so
+    // an element's value depends only on its position in the overall
+    // call sequence — never on the launch geometry. No engine array is
+    // loaded or saved; the host advances the counter instead
+    template<class DeviceEngineType, class Type, class Distribution>
     __global__
-    void generate_normal_kernel(philox4x32_10_device_engine * engines,
-                                RealType * data, const size_t n,
-                                Distribution distribution)
+    void generate_counter_kernel(Type * data, const size_t n,
+                                 const unsigned long long seed,
+                                 const unsigned long long counter,
+                                 const unsigned long long offset,
+                                 Distribution distribution)
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
-        // RealTypeX can be float4, double2
-        typedef decltype(distribution(uint4())) RealTypeX;
-        // x can be 2 or 4
-        const unsigned x = sizeof(RealTypeX) / sizeof(RealType);
+        // TypeX can be a 4- or (for double distributions) 2-wide vector
+        typedef decltype(distribution(uint4())) TypeX;
+        const unsigned int x = sizeof(TypeX) / sizeof(Type);
+
+        const size_t groups = (n + x - 1) / x;
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+
+        while(index < groups)
+        {
+            // One single-draw subsequence per group; the philox
+            // subsequence skip is plain counter arithmetic
+            DeviceEngineType engine(seed, counter + index, offset);
+            TypeX result = distribution(engine.next4());
+            const size_t base = index * x;
+            // The last group may be partial
+            for(unsigned int i = 0; i < x && base + i < n; i++)
+            {
+                data[base + i] = (&result.x)[i];
+            }
+            index += stride;
+        }
+    }
+
+    // Counter-keyed companion of generate_bytes_kernel(): each group
+    // yields the 16 bytes of one draw, so neither the buffer's
+    // alignment nor the grid affects the values
+    template<class DeviceEngineType>
+    __global__
+    void generate_counter_bytes_kernel(unsigned char * data, const size_t bytes,
+                                       const unsigned long long seed,
+                                       const unsigned long long counter,
+                                       const unsigned long long offset)
+    {
+        const size_t groups = (bytes + 15) / 16;
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+
+        while(index < groups)
+        {
+            DeviceEngineType engine(seed, counter + index, offset);
+            const uint4 u4 = engine.next4();
+            const size_t base = index * 16;
+            // The last group may be partial
+            for(unsigned int i = 0; i < 16 && base + i < bytes; i++)
+            {
+                data[base + i] = static_cast<unsigned char>(
+                    (&u4.x)[i / 4] >> (8 * (i % 4)));
+            }
+            index += stride;
+        }
+    }
+
+    // Counter-keyed companion of generate_poisson_kernel() for the
+    // table-driven distributions, which map single 32-bit draws
+    template<class DeviceEngineType, class Distribution>
+    __global__
+    void generate_counter_poisson_kernel(unsigned int * data, const size_t n,
+                                         const unsigned long long seed,
+                                         const unsigned long long counter,
+                                         const unsigned long long offset,
+                                         const Distribution distribution)
+    {
+        const size_t groups = (n + 3) / 4;
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+
+        while(index < groups)
+        {
+            DeviceEngineType engine(seed, counter + index, offset);
+            const uint4 u4 = engine.next4();
+            const unsigned int result[4] = {
+                distribution(u4.x),
+                distribution(u4.y),
+                distribution(u4.z),
+                distribution(u4.w)
+            };
+            const size_t base = index * 4;
+            // The last group may be partial
+            for(unsigned int i = 0; i < 4 && base + i < n; i++)
+            {
+                data[base + i] = result[i];
+            }
+            index += stride;
+        }
+    }
+
+    // rocrand_generate_uniform_bits(): slices every 32-bit draw into
+    // 32/Bits reduced-precision uniforms, so one next4 feeds 4*32/Bits
+    // output floats. Values keep the (0; 1] convention of
+    // uniform_distribution, just at Bits bits of resolution; otherwise
+    // the kernel mirrors generate_kernel() (leapfrogged engines,
+    // aligned/unaligned stores, in-kernel tail)
+    template<unsigned int ThreadsPerEngine, bool HasTail, unsigned int Bits, class DeviceEngineType>
+    __global__
+    void generate_uniform_bits_kernel(DeviceEngineType * engines,
+                                      float * data, const size_t n,
+                                      const unsigned long long seed,
+                                      const unsigned long long offset,
+                                      const bool init_engines)
+    {
+        // Floats cut from each 32-bit value and from each draw
+        constexpr unsigned int per_value = 32 / Bits;
+        constexpr unsigned int per_draw = 4 * per_value;
+        const unsigned int mask =
+            static_cast<unsigned int>((1ull << Bits) - 1ull);
+        const float scale =
+            static_cast<float>(1.0 / static_cast<double>(1ull << Bits));
 
         unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         const unsigned int engine_id = index/ThreadsPerEngine;
         const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
         if(hipThreadIdx_x%ThreadsPerEngine > 0)
         {
             // Skips hipThreadIdx_x%ThreadsPerEngine states
             engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
         }
 
-        RealTypeX * dataX = (RealTypeX *)data;
-        while(index < (n/x))
+        const bool aligned = ((uintptr_t)data)%(sizeof(float4)) == 0;
+        while(index < (n/per_draw))
         {
-            dataX[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+            const uint4 u4 = engine.next4_leap(ThreadsPerEngine);
+            float result[per_draw];
+            for(unsigned int j = 0; j < 4; j++)
+            {
+                const unsigned int v = (&u4.x)[j];
+                for(unsigned int k = 0; k < per_value; k++)
+                {
+                    result[j * per_value + k] =
+                        scale + ((v >> (k * Bits)) & mask) * scale;
+                }
+            }
+            if(aligned)
+            {
+                float4 * data4 = (float4 *)data;
+                for(unsigned int j = 0; j < per_draw/4; j++)
+                {
+                    data4[index * (per_draw/4) + j] = float4 {
+                        result[4*j], result[4*j + 1],
+                        result[4*j + 2], result[4*j + 3]
+                    };
+                }
+            }
+            else
+            {
+                for(unsigned int j = 0; j < per_draw; j++)
+                {
+                    data[index * per_draw + j] = result[j];
+                }
+            }
             // Next position
             index += stride;
         }
 
         // Find thread with the smallest state of the engine which id is engine_id
         unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = index == index_min;
+        const bool smallest_state = (index == index_min);
 
-        // Check if we need to save tail (last 1,..,(x-1) random number).
-        // Those numbers should be generated by the thread that would
-        // save next uint4 if n was equal n+(x-1) (index < (n/x) would be
-        // true in such situation).
-        // If this condition is met, then we know that (index == index_min)
-        // is also true for that thread, so we don't need to check that.
-        auto tail_size = n & (x - 1);
-        if((index == n/4) && tail_size > 0)
+        // The tail (last n%per_draw values) is produced by the thread
+        // that would store the next full draw; as in generate_kernel()
+        // that thread also has the smallest state of its engine
+        const auto tail_size = HasTail ? (n % per_draw) : 0;
+        if(HasTail && (index == n/per_draw) && tail_size > 0)
         {
-            RealTypeX result = distribution(engine.next4());
-            // Save the tail
-            data[n - tail_size] = (&result.x)[0]; // .x
-            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
-            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+            const uint4 u4 = engine.next4();
+            for(unsigned int j = 0; j < tail_size; j++)
+            {
+                const unsigned int v = (&u4.x)[j / per_value];
+                data[n - tail_size + j] =
+                    scale + ((v >> ((j % per_value) * Bits)) & mask) * scale;
+            }
         }
 
-        // Save engine
-        if(smallest_state)
+        // Save engine (stateless calls pass no engine array)
+        if(engines != NULL && smallest_state)
             engines[engine_id] = engine;
     }
 
-    template <unsigned int ThreadsPerEngine, class Distribution>
+    // Fills an arbitrarily aligned byte buffer of arbitrary length in
+    // one launch (see rocrand_generate_bytes()). Bytes before the
+    // first 4-byte aligned address form the head and bytes after the
+    // last whole 32-bit word form the byte tail; both are written by
+    // the tail thread, while the bulk of the buffer goes through the
+    // same aligned/unaligned dual path as generate_kernel()
+    template<unsigned int ThreadsPerEngine, class DeviceEngineType>
     __global__
-    void generate_poisson_kernel(philox4x32_10_device_engine * engines,
-                                 unsigned int * data, const size_t n,
-                                 const Distribution distribution)
+    void generate_bytes_kernel(DeviceEngineType * engines,
+                               unsigned char * data, const size_t bytes,
+                               const unsigned long long seed,
+                               const unsigned long long offset,
+                               const bool init_engines)
     {
-        typedef philox4x32_10_device_engine DeviceEngineType;
-
         unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         const unsigned int engine_id = index/ThreadsPerEngine;
         const unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        // Load device engine
-        DeviceEngineType engine = engines[engine_id];
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
         if(hipThreadIdx_x%ThreadsPerEngine > 0)
         {
             // Skips hipThreadIdx_x%ThreadsPerEngine states
             engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
         }
 
-        if(((uintptr_t)data)%(sizeof(uint4)) == 0)
+        size_t head_size = (4 - ((uintptr_t)data & 3)) & 3;
+        if(head_size > bytes) head_size = bytes;
+        const size_t n = (bytes - head_size) / 4;
+        const size_t tail_bytes = (bytes - head_size) & 3;
+        unsigned int * data_uint = (unsigned int *)(data + head_size);
+
+        if(((uintptr_t)data_uint)%(sizeof(uint4)) == 0)
         {
-            uint4 * data4 = (uint4 *)data;
-            while(index < (n / 4))
+            uint4 * data4 = (uint4 *)data_uint;
+            while(index < (n/4))
             {
-                const uint4 u4 = engine.next4();
-                const uint4 result = uint4 {
-                    distribution(u4.x),
-                    distribution(u4.y),
-                    distribution(u4.z),
-                    distribution(u4.w)
-                };
-                data4[index] = result;
+                data4[index] = engine.next4_leap(ThreadsPerEngine);
+                // Next position
                 index += stride;
             }
         }
         else
         {
-            uint4_unaligned * data4 = (uint4_unaligned *)data;
-            while(index < (n / 4))
+            uint4_unaligned * data4 = (uint4_unaligned *)data_uint;
+            while(index < (n/4))
             {
-                const uint4 u4 = engine.next4();
-                const uint4 result = uint4 {
-                    distribution(u4.x),
-                    distribution(u4.y),
-                    distribution(u4.z),
-                    distribution(u4.w)
-                };
-                data4[index] = *(uint4_unaligned*)(&result); // reinterpret as uint4_unaligned
+                uint4 result = engine.next4_leap(ThreadsPerEngine);
+                data4[index] = *(uint4_unaligned*)(&result);  // reinterpret as uint4_unaligned
+                // Next position
                 index += stride;
             }
         }
 
         // Find thread with the smallest state of the engine which id is engine_id
         unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
-        const bool smallest_state = index == index_min;
+        const bool smallest_state = (index == index_min);
 
-        // First work-item saves the tail when n is not a multiple of 4
-        auto tail_size = n & 3;
-        if((index == n/4) == 0 && tail_size > 0)
+        // The thread that would save the next uint4 (see the tail
+        // handling in generate_kernel()) also writes the leftover
+        // whole words and the head and tail bytes
+        const auto tail_size = n & 3;
+        if((index == n/4) && (tail_size > 0 || tail_bytes > 0 || head_size > 0))
         {
-            const uint4 u4 = engine.next4();
-            const uint4 result = uint4 {
-                distribution(u4.x),
-                distribution(u4.y),
-                distribution(u4.z),
-                distribution(u4.w)
-            };
-            data[n - tail_size] = (&result.x)[0]; // .x
-            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
-            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+            const uint4 result = engine.next4();
+            if(tail_size > 0) data_uint[n - tail_size] = result.x;
+            if(tail_size > 1) data_uint[n - tail_size + 1] = result.y;
+            if(tail_size > 2) data_uint[n - tail_size + 2] = result.z;
+            // The word tail never uses the fourth word of the draw, so
+            // its bytes fill the byte tail; the head gets a separate
+            // draw, as head and byte tail can need up to 3 bytes each
+            unsigned char * tail = (unsigned char *)(data_uint + n);
+            for(unsigned int i = 0; i < tail_bytes; i++)
+            {
+                tail[i] = (unsigned char)(result.w >> (8 * i));
+            }
+            if(head_size > 0)
+            {
+                const uint4 head_draw = engine.next4();
+                for(unsigned int i = 0; i < head_size; i++)
+                {
+                    data[i] = (unsigned char)(head_draw.x >> (8 * i));
+                }
+            }
         }
 
-        // Save engine with its state
-        if(smallest_state)
+        // Save engine (stateless calls pass no engine array)
+        if(engines != NULL && smallest_state)
             engines[engine_id] = engine;
     }
 
-} // end namespace detail
-} // end namespace rocrand_host
-
-class rocrand_philox4x32_10 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
-{
-    static constexpr unsigned int s_threads_per_engine = 16;
 
-public:
-    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
-    using engine_type = ::rocrand_host::detail::philox4x32_10_device_engine;
-
-    rocrand_philox4x32_10(unsigned long long seed = 0,
-                          unsigned long long offset = 0,
-                          hipStream_t stream = 0)
-        : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL),
-          m_engines_size(s_threads * s_blocks / s_threads_per_engine)
+    // One Marsaglia-Tsang gamma candidate round for shape >= 1
+    // (see generate_gamma_kernel): the squeeze accepts ~96% of
+    // candidates, so most elements finish after one uint4 draw
+    template<class DeviceEngineType>
+    __forceinline__ __device__
+    float gamma_sample(DeviceEngineType& engine, float d, float c)
     {
-        // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
-        if(error != hipSuccess)
+        while(true)
         {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+            const uint4 r = engine.next4();
+            const float2 nrm = rocrand_device::detail::box_muller(r.x, r.y);
+            const float x = nrm.x;
+            float v = 1.0f + c * x;
+            if(v <= 0.0f)
+            {
+                continue;
+            }
+            v = v * v * v;
+            const float u = rocrand_device::detail::uniform_distribution(r.z);
+            if(u < 1.0f - 0.0331f * (x * x) * (x * x))
+            {
+                return d * v;
+            }
+            if(logf(u) < 0.5f * x * x + d * (1.0f - v + logf(v)))
+            {
+                return d * v;
+            }
         }
     }
 
-    ~rocrand_philox4x32_10()
+    template<class DeviceEngineType>
+    __forceinline__ __device__
+    double gamma_sample(DeviceEngineType& engine, double d, double c)
     {
-        hipFree(m_engines);
+        while(true)
+        {
+            const double2 nrm = rocrand_device::detail::box_muller_double(engine.next4());
+            const double x = nrm.x;
+            double v = 1.0 + c * x;
+            if(v <= 0.0)
+            {
+                continue;
+            }
+            v = v * v * v;
+            const uint4 r = engine.next4();
+            const double u = rocrand_device::detail::uniform_distribution_double(r.x, r.y);
+            if(u < 1.0 - 0.0331 * (x * x) * (x * x))
+            {
+                return d * v;
+            }
+            if(log(u) < 0.5 * x * x + d * (1.0 - v + log(v)))
+            {
+                return d * v;
+            }
+        }
     }
 
-    void reset()
+    // Gamma rejection sampling (Marsaglia and Tsang, 2000) for
+    // counter-based generators (see rocrand_generate_gamma()). The
+    // number of draws per element varies, which does not fit the fixed
+    // draw-to-output mapping of the leapfrogged bulk kernels, so each
+    // element draws from its own subsequence of a separate re-keyed
+    // stream and the generator's main stream is never touched. \p offset
+    // reserves a fresh counter region per call.
+    template<class DeviceEngineType, class RealType>
+    __global__
+    void generate_gamma_kernel(RealType * data, const size_t n,
+                               const unsigned long long seed,
+                               const unsigned long long offset,
+                               const RealType shape, const RealType scale)
     {
-        m_engines_initialized = false;
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+
+        // shape < 1 is boosted to shape + 1 and corrected by
+        // u^(1/shape) below (Marsaglia-Tsang, section 6)
+        const RealType alpha = shape < RealType(1) ? shape + RealType(1) : shape;
+        const RealType d = alpha - RealType(1) / RealType(3);
+        const RealType c = RealType(1) / sqrt(RealType(9) * d);
+
+        while(index < n)
+        {
+            DeviceEngineType engine(seed, index, offset);
+            RealType x = gamma_sample(engine, d, c);
+            if(shape < RealType(1))
+            {
+                const RealType u = rocrand_device::detail::uniform_distribution(engine.next4().x);
+                x = x * pow(u, RealType(1) / shape);
+            }
+            data[index] = x * scale;
+            // Next position
+            index += stride;
+        }
     }
 
-    /// Changes seed to \p seed and resets generator state.
-    void set_seed(unsigned long long seed)
+
+    // Per-element lambda Poisson sampling (see
+    // rocrand_generate_poisson_array()). Small rates are drawn exactly
+    // with Knuth's product-of-uniforms method; large rates fall back
+    // to the normal approximation with continuity correction, whose
+    // relative error is small once lambda is past the threshold. Draw
+    // counts vary per element, so this uses the same per-element
+    // subsequences of a re-keyed side stream as generate_gamma_kernel.
+    template<class DeviceEngineType>
+    __global__
+    void generate_poisson_array_kernel(unsigned int * data, const size_t n,
+                                       const unsigned long long seed,
+                                       const unsigned long long offset,
+                                       const double * lambdas)
     {
-        m_seed = seed;
-        m_engines_initialized = false;
+        // Knuth's method consumes ~lambda draws, so past this the
+        // normal approximation is both faster and accurate enough
+        const double lambda_threshold = 64.0;
+
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+
+        while(index < n)
+        {
+            DeviceEngineType engine(seed, index, offset);
+            const double lambda = lambdas[index];
+            if(lambda < lambda_threshold)
+            {
+                const double limit = exp(-lambda);
+                unsigned int k = 0;
+                double product = 1.0;
+                do
+                {
+                    k++;
+                    product *= rocrand_device::detail::uniform_distribution_double(engine.next());
+                } while(product > limit);
+                data[index] = k - 1;
+            }
+            else
+            {
+                const double2 nrm =
+                    rocrand_device::detail::box_muller_double(engine.next4());
+                const double v = floor(lambda + sqrt(lambda) * nrm.x + 0.5);
+                data[index] = v < 0.0 ? 0 : static_cast<unsigned int>(v);
+            }
+            // Next position
+            index += stride;
+        }
     }
 
-    void set_offset(unsigned long long offset)
+    // Number of Feistel rounds applied when encrypting an index; enough
+    // for the walk to be statistically indistinguishable from a uniform
+    // permutation while staying cheap next to the memory traffic
+    static const unsigned int permutation_rounds = 16;
+
+    // Murmur3-style finalizer used as the Feistel round function
+    __forceinline__ __device__
+    unsigned int permutation_round_mix(unsigned int x)
     {
-        m_offset = offset;
-        m_engines_initialized = false;
+        x ^= x >> 16;
+        x *= 0x85EBCA6BU;
+        x ^= x >> 13;
+        x *= 0xC2B2AE35U;
+        x ^= x >> 16;
+        return x;
     }
 
-    rocrand_status init()
+    // Uniform random permutation of [0; n) without a sort (see
+    // rocrand_generate_permutation()). Each element independently
+    // encrypts its own index with a keyed balanced Feistel network over
+    // the smallest covering power-of-two domain and cycle-walks back
+    // into range, so the mapping is a bijection computed in O(1) per
+    // element.
+    __global__
+    void generate_permutation_kernel(unsigned int * perm,
+                                     const size_t n,
+                                     unsigned long long key,
+                                     const unsigned int half_bits)
     {
-        if(m_engines_initialized)
-            return ROCRAND_STATUS_SUCCESS;
+        // Round keys from the splitmix64 sequence over the call's key
+        unsigned int keys[permutation_rounds];
+        for (unsigned int r = 0; r < permutation_rounds; r++)
+        {
+            key += 0x9E3779B97F4A7C15ULL;
+            unsigned long long z = key;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            keys[r] = static_cast<unsigned int>(z ^ (z >> 31));
+        }
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks/s_threads_per_engine), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        const unsigned int mask =
+            static_cast<unsigned int>((1ULL << half_bits) - 1);
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
 
-        m_engines_initialized = true;
-        return ROCRAND_STATUS_SUCCESS;
-    }
+        while(index < n)
+        {
+            unsigned long long x = index;
+            do
+            {
+                unsigned int left = static_cast<unsigned int>(x >> half_bits);
+                unsigned int right = static_cast<unsigned int>(x) & mask;
+                #pragma unroll
+                for (unsigned int r = 0; r < permutation_rounds; r++)
+                {
+                    const unsigned int f =
+                        permutation_round_mix(right ^ keys[r]) & mask;
+                    const unsigned int next = left ^ f;
+                    left = right;
+                    right = next;
+                }
+                x = (static_cast<unsigned long long>(left) << half_bits) | right;
+            } while (x >= n);
+            perm[index] = static_cast<unsigned int>(x);
+            // Next position
+            index += stride;
+        }
+    }
+
+    // Binomial(n, p) draw from the side stream engine, used per
+    // category by generate_multinomial_kernel. Small n * p uses BINV
+    // (inversion by sequential search over the pmf, O(n * p) expected
+    // draws from a single uniform); larger n * p uses the BTRS
+    // transformed rejection of Hormann (1993), which needs a handful
+    // of uniforms regardless of n. Unlike the host-side table approach
+    // of binomial.hpp, both paths are stateless, so the parameters can
+    // change with every call.
+    template<class DeviceEngineType>
+    __forceinline__ __device__
+    unsigned int multinomial_binomial(DeviceEngineType& engine,
+                                      const unsigned int n, const double p)
+    {
+        if(n == 0 || p <= 0.0)
+        {
+            return 0;
+        }
+        if(p >= 1.0)
+        {
+            return n;
+        }
+
+        // Both samplers want p <= 0.5; flip the failure/success roles
+        // otherwise and mirror the result
+        const bool flip = p > 0.5;
+        const double q = flip ? 1.0 - p : p;
+        unsigned int k = 0;
+        if(n * q < 10.0)
+        {
+            // BINV
+            const double s = q / (1.0 - q);
+            const double a = (n + 1.0) * s;
+            double r = exp(n * log1p(-q));
+            double u = rocrand_device::detail::uniform_distribution_double(engine.next());
+            while(u > r)
+            {
+                u -= r;
+                k++;
+                if(k > n)
+                {
+                    k = n;
+                    break;
+                }
+                r *= (a / k - s);
+            }
+        }
+        else
+        {
+            // BTRS
+            const double nq = n * q;
+            const double spq = sqrt(nq * (1.0 - q));
+            const double b = 1.15 + 2.53 * spq;
+            const double a = -0.0873 + 0.0248 * b + 0.01 * q;
+            const double c = nq + 0.5;
+            const double v_r = 0.92 - 4.2 / b;
+            const double alpha = (2.83 + 5.1 / b) * spq;
+            const double lpq = log(q / (1.0 - q));
+            const double m = floor((n + 1.0) * q);
+            const double h = lgamma(m + 1.0) + lgamma(n - m + 1.0);
+            while(true)
+            {
+                const double u =
+                    rocrand_device::detail::uniform_distribution_double(engine.next()) - 0.5;
+                const double v =
+                    rocrand_device::detail::uniform_distribution_double(engine.next());
+                const double us = 0.5 - fabs(u);
+                const double kd = floor((2.0 * a / us + b) * u + c);
+                if(kd < 0.0 || kd > n)
+                {
+                    continue;
+                }
+                // Fast acceptance region covering ~86% of proposals
+                if(us >= 0.07 && v <= v_r)
+                {
+                    k = static_cast<unsigned int>(kd);
+                    break;
+                }
+                // Exact acceptance test against the pmf
+                const double t = h - lgamma(kd + 1.0) - lgamma(n - kd + 1.0)
+                    + (kd - m) * lpq;
+                if(log(v * alpha / (a / (us * us) + b)) <= t)
+                {
+                    k = static_cast<unsigned int>(kd);
+                    break;
+                }
+            }
+        }
+        return flip ? n - k : k;
+    }
+
+    // Multinomial counts via the conditional-binomial decomposition
+    // (see rocrand_generate_multinomial()): each thread produces one
+    // complete draw by walking the categories in order and giving
+    // category i a Binomial(remaining, w_i / remaining_weight) share
+    // of the trials still unassigned, so the k counts always sum to
+    // exactly the trial count. Draw counts vary per element, so this
+    // uses the same per-element subsequences of a re-keyed side stream
+    // as generate_poisson_array_kernel.
+    template<class DeviceEngineType>
+    __global__
+    void generate_multinomial_kernel(unsigned int * counts, const size_t num_draws,
+                                     const unsigned int trials,
+                                     const double * weights,
+                                     const unsigned int num_weights,
+                                     const unsigned long long seed,
+                                     const unsigned long long offset)
+    {
+        size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const size_t stride = hipGridDim_x * hipBlockDim_x;
+
+        while(index < num_draws)
+        {
+            DeviceEngineType engine(seed, index, offset);
+            // Weights need not be normalized; the remaining weight
+            // is maintained by subtraction as categories are consumed
+            double rest = 0.0;
+            for(unsigned int i = 0; i < num_weights; i++)
+            {
+                rest += weights[i];
+            }
+            unsigned int remaining = trials;
+            unsigned int * row = counts + index * num_weights;
+            for(unsigned int i = 0; i < num_weights; i++)
+            {
+                const double w = weights[i];
+                unsigned int x;
+                if(remaining == 0)
+                {
+                    x = 0;
+                }
+                else if(i == num_weights - 1 || rest <= w)
+                {
+                    // Last category with any mass left; assigning the
+                    // remainder here keeps the row sum exact even when
+                    // rounding has exhausted rest early
+                    x = remaining;
+                }
+                else
+                {
+                    x = multinomial_binomial(engine, remaining, w / rest);
+                }
+                row[i] = x;
+                remaining -= x;
+                rest -= w;
+            }
+            // Next position
+            index += stride;
+        }
+    }
+
+    // Descriptor of one output buffer of a batched generate call
+    // (see rocrand_generate_batch()). chunk_start is the exclusive
+    // prefix sum of ceil(size / 4) over the batch, so the buffer
+    // holds the uint4 chunks [chunk_start; next chunk_start)
+    struct batch_descriptor
+    {
+        unsigned int * data;
+        size_t size;
+        size_t chunk_start;
+    };
+
+    // Fills a batch of buffers in one launch by grid-striding over the
+    // concatenation of all buffers' uint4 chunks. \p batch carries the
+    // buffer descriptors plus an end sentinel whose chunk_start is the
+    // total chunk count. A buffer whose size is not a multiple of 4
+    // gets a partial last chunk; the unused draws of that chunk are
+    // discarded, so batched and buffer-by-buffer output differ for
+    // such sizes (both are valid streams).
+    template<unsigned int ThreadsPerEngine, class DeviceEngineType, class Distribution>
+    __global__
+    void generate_batch_kernel(DeviceEngineType * engines,
+                               const batch_descriptor * batch,
+                               const size_t total_chunks,
+                               const unsigned long long seed,
+                               const unsigned long long offset,
+                               const bool init_engines,
+                               Distribution distribution)
+    {
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        // Chunk indices grow monotonically per thread, so the buffer
+        // lookup can advance linearly instead of searching from scratch
+        unsigned int buffer = 0;
+        while(index < total_chunks)
+        {
+            while(batch[buffer + 1].chunk_start <= index)
+            {
+                buffer++;
+            }
+            unsigned int * data = batch[buffer].data;
+            const size_t n = batch[buffer].size;
+            const size_t base = (index - batch[buffer].chunk_start) * 4;
+
+            uint4 result = distribution(engine.next4_leap(ThreadsPerEngine));
+            if(base + 4 <= n)
+            {
+                if(((uintptr_t)data)%(sizeof(uint4)) == 0)
+                {
+                    ((uint4 *)data)[base/4] = result;
+                }
+                else
+                {
+                    ((uint4_unaligned *)data)[base/4] = *(uint4_unaligned*)(&result);
+                }
+            }
+            else
+            {
+                // Partial last chunk of this buffer
+                data[base] = result.x;
+                if(base + 1 < n) data[base + 1] = result.y;
+                if(base + 2 < n) data[base + 2] = result.z;
+            }
+            // Next position
+            index += stride;
+        }
+
+        // Find thread with the smallest state of the engine which id is engine_id
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = (index == index_min);
+
+        // Save engine
+        if(smallest_state)
+            engines[engine_id] = engine;
+    }
+
+    template<unsigned int ThreadsPerEngine, bool HasTail, class DeviceEngineType, class RealType, class Distribution>
+    __global__
+    void generate_normal_kernel(DeviceEngineType * engines,
+                                RealType * data, const size_t n,
+                                const unsigned long long seed,
+                                const unsigned long long offset,
+                                const bool init_engines,
+                                Distribution distribution)
+    {
+        // RealTypeX can be float4, double2
+        typedef decltype(distribution(uint4())) RealTypeX;
+        typedef typename unaligned_type<RealTypeX>::type RealTypeX_unaligned;
+        // x can be 2 or 4
+        const unsigned x = sizeof(RealTypeX) / sizeof(RealType);
+
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        if(((uintptr_t)data)%(sizeof(RealTypeX)) == 0)
+        {
+            RealTypeX * dataX = (RealTypeX *)data;
+            while(index < (n/x))
+            {
+                dataX[index] = distribution(engine.next4_leap(ThreadsPerEngine));
+                // Next position
+                index += stride;
+            }
+        }
+        else
+        {
+            RealTypeX_unaligned * dataX = (RealTypeX_unaligned *)data;
+            while(index < (n/x))
+            {
+                RealTypeX result = distribution(engine.next4_leap(ThreadsPerEngine));
+                dataX[index] = *(RealTypeX_unaligned*)(&result);  // reinterpret as RealTypeX_unaligned
+                // Next position
+                index += stride;
+            }
+        }
+
+        // Find thread with the smallest state of the engine which id is engine_id
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = index == index_min;
+
+        // Check if we need to save tail (last 1,..,(x-1) random number).
+        // Those numbers should be generated by the thread that would
+        // save next uint4 if n was equal n+(x-1) (index < (n/x) would be
+        // true in such situation).
+        // If this condition is met, then we know that (index == index_min)
+        // is also true for that thread, so we don't need to check that.
+        const auto tail_size = HasTail ? (n & (x - 1)) : 0;
+        if(HasTail && (index == n/x) && tail_size > 0)
+        {
+            RealTypeX result = distribution(engine.next4());
+            // Save the tail
+            data[n - tail_size] = (&result.x)[0]; // .x
+            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
+            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+        }
+
+        // Save engine (stateless calls pass no engine array)
+        if(engines != NULL && smallest_state)
+            engines[engine_id] = engine;
+    }
+
+    // Placeholder payoff for the reduce overloads without a user
+    // functor; compiled out via HasPayoff
+    template<class T>
+    struct empty_payoff
+    {
+        __forceinline__ __host__ __device__
+        T operator()(const T) const
+        {
+            return 0;
+        }
+    };
+
+    // Fused generate+reduce for Monte Carlo estimators (see
+    // rocrand_generate_normal_reduce()): runs the same draw loop as
+    // generate_normal_kernel but accumulates partial sums instead of
+    // materializing the stream. Each block reduces its threads' sums
+    // of value, value^2 and (when HasPayoff) payoff(value) in shared
+    // memory and atomically adds the block partials to \p sums, which
+    // must be zeroed before the launch. The engines advance exactly as
+    // for a generate call of the same size.
+    template<unsigned int ThreadsPerEngine, unsigned int BlockSize, bool HasPayoff, class DeviceEngineType, class RealType, class PayoffOp, class Distribution>
+    __global__
+    void generate_reduce_kernel(DeviceEngineType * engines,
+                                RealType * sums, const size_t n,
+                                const unsigned long long seed,
+                                const unsigned long long offset,
+                                const bool init_engines,
+                                PayoffOp payoff,
+                                Distribution distribution)
+    {
+        // RealTypeX can be float4, double2
+        typedef decltype(distribution(uint4())) RealTypeX;
+        // x can be 2 or 4
+        const unsigned x = sizeof(RealTypeX) / sizeof(RealType);
+
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        RealType sum = 0;
+        RealType sum_sq = 0;
+        RealType sum_payoff = 0;
+        while(index < (n/x))
+        {
+            RealTypeX result = distribution(engine.next4_leap(ThreadsPerEngine));
+            for(unsigned int i = 0; i < x; i++)
+            {
+                const RealType value = (&result.x)[i];
+                sum += value;
+                sum_sq += value * value;
+                if(HasPayoff)
+                {
+                    sum_payoff += payoff(value);
+                }
+            }
+            // Next position
+            index += stride;
+        }
+
+        // Find thread with the smallest state of the engine which id is engine_id
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = index == index_min;
+
+        // Accumulate the tail (last 1,..,(x-1) random numbers), which
+        // is drawn by the same thread that would take the next chunk
+        // (see generate_normal_kernel)
+        const auto tail_size = n & (x - 1);
+        if((index == n/x) && tail_size > 0)
+        {
+            RealTypeX result = distribution(engine.next4());
+            for(unsigned int i = 0; i < tail_size; i++)
+            {
+                const RealType value = (&result.x)[i];
+                sum += value;
+                sum_sq += value * value;
+                if(HasPayoff)
+                {
+                    sum_payoff += payoff(value);
+                }
+            }
+        }
+
+        // Save engine
+        if(smallest_state)
+            engines[engine_id] = engine;
+
+        // Block-level reduction of the per-thread partials
+        __shared__ RealType reduce[(HasPayoff ? 3 : 2) * BlockSize];
+        reduce[hipThreadIdx_x] = sum;
+        reduce[BlockSize + hipThreadIdx_x] = sum_sq;
+        if(HasPayoff)
+        {
+            reduce[2 * BlockSize + hipThreadIdx_x] = sum_payoff;
+        }
+        __syncthreads();
+        for(unsigned int d = BlockSize/2; d > 0; d >>= 1)
+        {
+            if(hipThreadIdx_x < d)
+            {
+                reduce[hipThreadIdx_x] += reduce[hipThreadIdx_x + d];
+                reduce[BlockSize + hipThreadIdx_x]
+                    += reduce[BlockSize + hipThreadIdx_x + d];
+                if(HasPayoff)
+                {
+                    reduce[2 * BlockSize + hipThreadIdx_x]
+                        += reduce[2 * BlockSize + hipThreadIdx_x + d];
+                }
+            }
+            __syncthreads();
+        }
+        if(hipThreadIdx_x == 0)
+        {
+            atomic_add(&sums[0], reduce[0]);
+            atomic_add(&sums[1], reduce[BlockSize]);
+            if(HasPayoff)
+            {
+                atomic_add(&sums[2], reduce[2 * BlockSize]);
+            }
+        }
+    }
+
+    template <unsigned int ThreadsPerEngine, bool HasTail, class DeviceEngineType, class Distribution>
+    __global__
+    void generate_poisson_kernel(DeviceEngineType * engines,
+                                 unsigned int * data, const size_t n,
+                                 const unsigned long long seed,
+                                 const unsigned long long offset,
+                                 const bool init_engines,
+                                 const Distribution distribution)
+    {
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int engine_id = index/ThreadsPerEngine;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        DeviceEngineType engine;
+        if(init_engines)
+        {
+            engine = DeviceEngineType(seed, engine_id, offset);
+        }
+        else
+        {
+            engine = engines[engine_id];
+        }
+        if(hipThreadIdx_x%ThreadsPerEngine > 0)
+        {
+            // Skips hipThreadIdx_x%ThreadsPerEngine states
+            engine.discard(4 * (hipThreadIdx_x%ThreadsPerEngine));
+        }
+
+        if(((uintptr_t)data)%(sizeof(uint4)) == 0)
+        {
+            uint4 * data4 = (uint4 *)data;
+            while(index < (n / 4))
+            {
+                const uint4 u4 = engine.next4();
+                const uint4 result = uint4 {
+                    distribution(u4.x),
+                    distribution(u4.y),
+                    distribution(u4.z),
+                    distribution(u4.w)
+                };
+                data4[index] = result;
+                index += stride;
+            }
+        }
+        else
+        {
+            uint4_unaligned * data4 = (uint4_unaligned *)data;
+            while(index < (n / 4))
+            {
+                const uint4 u4 = engine.next4();
+                const uint4 result = uint4 {
+                    distribution(u4.x),
+                    distribution(u4.y),
+                    distribution(u4.z),
+                    distribution(u4.w)
+                };
+                data4[index] = *(uint4_unaligned*)(&result); // reinterpret as uint4_unaligned
+                index += stride;
+            }
+        }
+
+        // Find thread with the smallest state of the engine which id is engine_id
+        unsigned int index_min = warp_reduce_min(index, ThreadsPerEngine);
+        const bool smallest_state = index == index_min;
+
+        // First work-item saves the tail when n is not a multiple of 4
+        auto tail_size = n & 3;
+        if((index == n/4) == 0 && tail_size > 0)
+        {
+            const uint4 u4 = engine.next4();
+            const uint4 result = uint4 {
+                distribution(u4.x),
+                distribution(u4.y),
+                distribution(u4.z),
+                distribution(u4.w)
+            };
+            data[n - tail_size] = (&result.x)[0]; // .x
+            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
+            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+        }
+
+        // Save engine with its state (stateless calls pass no engine array)
+        if(engines != NULL && smallest_state)
+            engines[engine_id] = engine;
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+// PHILOX-4x32 host-side generator. The round count selects between the
+// crush-resistant default (10 rounds, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+// and the fast mode (7 rounds, ROCRAND_RNG_PSEUDO_PHILOX4_32_7, the
+// lowest round count Random123 reports to pass BigCrush); everything
+// but the device engine's round loop is shared.
+template<unsigned int Rounds = 10>
+class rocrand_philox4x32 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>
+{
+    // Historical engine sharing, used under LEGACY ordering (which
+    // promises a device-independent layout) and as the fallback when
+    // the tuning table has no entry for the device. The tuned value is
+    // selected at creation time from the compiled instantiation set
+    // {8, 16} (see tuning.hpp).
+    static constexpr unsigned int s_default_threads_per_engine = 16;
+    // Upper bound on the internal stream pool of split generate calls
+    static constexpr unsigned int s_max_split_streams = 8;
+    // Below this many values per stream a split costs more in launch
+    // and synchronization overhead than the extra channels return
+    static constexpr size_t s_min_split_size = size_t(1) << 22;
+
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10>;
+    using engine_type = ::rocrand_host::detail::philox4x32_device_engine<Rounds>;
+
+    rocrand_philox4x32(unsigned long long seed = 0,
+                       unsigned long long offset = 0,
+                       hipStream_t stream = 0)
+        : base_type(Rounds == 10
+                        ? ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+                        : ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+                    seed, offset, stream),
+          m_engines_initialized(false), m_engines(NULL),
+          m_batch(NULL), m_batch_capacity(0), m_side_offset(0),
+          m_split_streams(1), m_split_created(0),
+          m_counter_ordering(false), m_counter(0),
+          m_subsequence_base(0),
+          m_persistent(NULL)
+    {
+        // Size the grid and the engine sharing for the device active
+        // at creation time
+        m_threads_per_engine =
+            rocrand_host::detail::tuning_for_device().philox_threads_per_engine;
+        m_blocks = blocks_for_ordering(ROCRAND_ORDERING_PSEUDO_BEST,
+                                       m_threads_per_engine);
+        m_engines_size = s_threads * m_blocks / m_threads_per_engine;
+
+        // Allocate device random number engines
+        auto error = rocrand_host::detail::device_malloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        if(error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    ~rocrand_philox4x32()
+    {
+        stop_persistent();
+        for(unsigned int i = 0; i < m_split_created; i++)
+        {
+            hipEventDestroy(m_split_events[i]);
+            hipStreamDestroy(m_split_pool[i]);
+        }
+        if(m_split_created > 0)
+        {
+            hipEventDestroy(m_split_fork);
+        }
+        rocrand_host::detail::device_free(m_engines, m_stream);
+        rocrand_host::detail::device_free(m_batch, m_stream);
+    }
+
+    void reset()
+    {
+        stop_persistent();
+        m_subsequence_base = 0;
+        m_engines_initialized = false;
+        m_counter = 0;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        stop_persistent();
+        m_seed = seed;
+        m_subsequence_base = 0;
+        m_engines_initialized = false;
+        m_counter = 0;
+    }
+
+    /// Switches the generator to the stream keyed by \p seed without
+    /// repositioning the engines (see rocrand_reseed()): a single
+    /// kernel swaps the Philox key of every engine in place, so
+    /// per-shard reseed loops skip the full engine reinitialization
+    /// that set_seed() schedules. A subsequence partition set by
+    /// set_subsequence() stays in effect.
+    rocrand_status reseed(unsigned long long seed)
+    {
+        // The resident service kernel holds engine state in registers
+        stop_persistent();
+        m_seed = seed;
+        if(m_counter_ordering)
+        {
+            // COUNTER ordering keys outputs by (seed, element index);
+            // restarting the counter is all a new stream needs
+            m_counter = 0;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(!m_engines_initialized)
+        {
+            // Nothing to re-key yet; lazy initialization picks up the
+            // new seed inside the next generate kernel
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::rekey_engines_kernel),
+            dim3(m_blocks / m_threads_per_engine), dim3(s_threads), 0, m_stream,
+            m_engines, m_seed
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        stop_persistent();
+        m_offset = offset;
+        m_subsequence_base = 0;
+        m_engines_initialized = false;
+        m_counter = 0;
+    }
+
+    /// Positions the engines into partition \p rank of \p num_ranks
+    /// disjoint partitions of the subsequence space (see
+    /// rocrand_set_subsequence()). The partition base is applied with
+    /// one O(1)-per-engine counter skip on top of the ordinary
+    /// initialization; changing the seed, offset or ordering resets
+    /// the generator to the full sequence. Not available under
+    /// ROCRAND_ORDERING_PSEUDO_COUNTER, which keys outputs by element
+    /// index instead of the engine array.
+    rocrand_status set_subsequence(unsigned int rank, unsigned int num_ranks)
+    {
+        if(num_ranks == 0 || rank >= num_ranks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        if(m_counter_ordering)
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        // The resident service kernel holds engine state in registers
+        stop_persistent();
+        // Slice the 2^64 subsequence space evenly: engine i of rank r
+        // sits at subsequence r * stride + i, so partitions stay
+        // disjoint for any per-device engine count below the stride
+        m_subsequence_base = (~0ULL / num_ranks) * rank;
+        m_engines_initialized = false;
+        if(m_subsequence_base == 0)
+        {
+            // Rank 0 owns the start of the sequence, which is what
+            // ordinary (lazy) initialization produces anyway
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::skip_subsequences_kernel),
+            dim3(m_blocks / m_threads_per_engine), dim3(s_threads), 0, m_stream,
+            m_engines, m_subsequence_base
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Selects the output ordering (see rocrand_set_ordering()).
+    /// ROCRAND_ORDERING_PSEUDO_LEGACY pins the engine grid to its
+    /// fixed device-independent size; ROCRAND_ORDERING_PSEUDO_BEST
+    /// (the default) sizes it for the present device;
+    /// ROCRAND_ORDERING_PSEUDO_COUNTER drops the persistent engines
+    /// entirely and keys every output group by a running counter.
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        // The resident service kernel holds pointers into the engine
+        // array, which may be reallocated below
+        stop_persistent();
+        if(ordering == ROCRAND_ORDERING_PSEUDO_COUNTER)
+        {
+            m_counter_ordering = true;
+            m_counter = 0;
+            m_subsequence_base = 0;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        m_counter_ordering = false;
+        // LEGACY keeps the historical engine sharing so its layout
+        // stays device-independent; BEST takes the tuned value
+        const unsigned int threads_per_engine =
+            ordering == ROCRAND_ORDERING_PSEUDO_LEGACY
+                ? s_default_threads_per_engine
+                : rocrand_host::detail::tuning_for_device().philox_threads_per_engine;
+        const unsigned int blocks =
+            blocks_for_ordering(ordering, threads_per_engine);
+        if(blocks == m_blocks && threads_per_engine == m_threads_per_engine)
+            return ROCRAND_STATUS_SUCCESS;
+
+        engine_type * engines;
+        auto error = rocrand_host::detail::device_malloc(
+            &engines, sizeof(engine_type) * (s_threads * blocks / threads_per_engine));
+        if(error != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_host::detail::device_free(m_engines, m_stream);
+        m_engines = engines;
+        m_blocks = blocks;
+        m_threads_per_engine = threads_per_engine;
+        m_engines_size = s_threads * m_blocks / m_threads_per_engine;
+        m_subsequence_base = 0;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3(m_blocks / m_threads_per_engine), dim3(s_threads), 0, m_stream,
+            m_engines, m_seed, m_offset
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+
+    /// Returns the size in bytes of a buffer able to hold the complete
+    /// generator state (see save_state()).
+    size_t state_size() const
+    {
+        return sizeof(rocrand_host::detail::generator_state_header)
+            + sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Snapshots the generator state (host fields and the device engine
+    /// array) into \p buffer of at least state_size() bytes.
+    rocrand_status save_state(void * buffer)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::generator_state_header header;
+        header.version = rocrand_host::detail::generator_state_version;
+        header.rng_type = rng_type;
+        header.seed = m_seed;
+        header.offset = m_offset;
+        header.engine_bytes = sizeof(engine_type) * m_engines_size;
+
+        memcpy(buffer, &header, sizeof(header));
+        if(hipMemcpy(static_cast<char *>(buffer) + sizeof(header),
+                     m_engines, header.engine_bytes,
+                     hipMemcpyDeviceToHost) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Restores the generator state from a buffer written by save_state().
+    /// The buffer must come from a generator of the same type with the
+    /// same engine array size (i.e. the same device configuration).
+    rocrand_status load_state(const void * buffer)
+    {
+        rocrand_host::detail::generator_state_header header;
+        memcpy(&header, buffer, sizeof(header));
+        if(header.version != rocrand_host::detail::generator_state_version
+            || header.rng_type != rng_type
+            || header.engine_bytes != sizeof(engine_type) * m_engines_size)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_seed = header.seed;
+        m_offset = header.offset;
+        if(hipMemcpy(m_engines,
+                     static_cast<const char *>(buffer) + sizeof(header),
+                     header.engine_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Enables splitting of large generate calls across \p count
+    /// internal streams (see rocrand_set_split_streams()); 0 or 1
+    /// restores the single-launch default. Streams and events are
+    /// created here so the first split call pays no setup cost.
+    rocrand_status set_split_streams(unsigned int count)
+    {
+        count = std::max(count, 1u);
+        count = std::min(count, s_max_split_streams);
+        if(count > 1 && m_split_created == 0
+            && hipEventCreateWithFlags(&m_split_fork,
+                                       hipEventDisableTiming) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        while(m_split_created < count)
+        {
+            if(hipStreamCreate(&m_split_pool[m_split_created]) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            if(hipEventCreateWithFlags(&m_split_events[m_split_created],
+                                       hipEventDisableTiming) != hipSuccess)
+            {
+                hipStreamDestroy(m_split_pool[m_split_created]);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            m_split_created++;
+        }
+        m_split_streams = count;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Starts or stops the persistent generation service (see
+    /// rocrand_set_persistent_mode()). While enabled, a resident
+    /// kernel keeps the device engines in registers and polls a work
+    /// queue in coherent pinned memory; uniform generate calls push a
+    /// descriptor instead of launching. Enabling consumes the engine
+    /// grid until the mode is stopped; stopping synchronizes the
+    /// service and writes the engines back, so ordinary generation
+    /// continues where the service left off.
+    rocrand_status set_persistent_mode(bool enabled)
+    {
+        if(!enabled)
+        {
+            stop_persistent();
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(m_persistent != NULL)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        try
+        {
+            m_persistent = new rocrand_host::detail::persistent_service<engine_type>(
+                m_engines, m_engines_size, s_threads,
+                m_seed, m_offset, !m_engines_initialized);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        // The service initializes (or adopts) every engine and writes
+        // them all back when it stops
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Blocks until every request enqueued to the persistent service
+    /// has been fully written; a no-op when the mode is off.
+    rocrand_status persistent_synchronize() const
+    {
+        if(m_persistent == NULL)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        return m_persistent->synchronize();
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        if(m_persistent != NULL)
+        {
+            const rocrand_status status =
+                persistent_enqueue(data, data_size, distribution);
+            if(status != ROCRAND_STATUS_TYPE_ERROR)
+            {
+                return status;
+            }
+            // Requests the service cannot serve go through the
+            // counter-keyed path, which neither reads nor advances the
+            // engine array the resident kernel owns
+            return generate_counter(data, data_size, distribution);
+        }
+
+        if(m_counter_ordering)
+        {
+            return generate_counter(data, data_size, distribution);
+        }
+
+        // Opt-in multi-stream path for very large requests
+        if(m_split_streams > 1
+            && data_size >= m_split_streams * s_min_split_size)
+        {
+            return generate_split(data, data_size, distribution);
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        const rocrand_status status = launch_generate(
+            blocks, m_stream, m_engines, data, data_size,
+            m_seed, m_offset, init_engines, distribution);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Counter-keyed path used under ROCRAND_ORDERING_PSEUDO_COUNTER:
+    /// each group of outputs comes from its own virtual subsequence
+    /// keyed by (seed, running counter), so a buffer depends only on
+    /// the seed, the offset and the sequence of call sizes — the same
+    /// seed gives bit-identical buffers on any device and grid. The
+    /// persistent engine array is neither read nor advanced.
+    template<class T, class Distribution>
+    rocrand_status generate_counter(T * data, size_t data_size,
+                                    const Distribution& distribution)
+    {
+        const size_t x = sizeof(decltype(distribution(uint4()))) / sizeof(T);
+        const size_t groups = (data_size + x - 1) / x;
+        const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+            std::max<size_t>((groups + s_threads - 1) / s_threads, 1), m_blocks));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_counter_kernel<engine_type>),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            data, data_size, m_seed, m_counter, m_offset, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_counter += groups;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Counter-keyed companion for the table-driven distributions
+    // (Poisson, binomial, discrete), which map single 32-bit draws
+    template<class Distribution>
+    rocrand_status generate_counter_poisson(unsigned int * data, size_t data_size,
+                                            const Distribution& distribution)
+    {
+        const size_t groups = (data_size + 3) / 4;
+        const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+            std::max<size_t>((groups + s_threads - 1) / s_threads, 1), m_blocks));
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_counter_poisson_kernel<engine_type>),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            data, data_size, m_seed, m_counter, m_offset, distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_counter += groups;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Multi-stream path for very large requests (see
+    /// rocrand_set_split_streams()): the output is cut into one
+    /// contiguous slice per internal stream, and each slice is filled
+    /// by a stateless launch over its own partition of the re-keyed
+    /// side stream, so the concurrent grids never share engine
+    /// counters and the main stream's engines are untouched. The
+    /// generator's stream waits on a per-slice event from every pool
+    /// stream, so to callers the call completes like a single launch.
+    template<class T, class Distribution>
+    rocrand_status generate_split(T * data, size_t data_size,
+                                  const Distribution& distribution)
+    {
+        // Slices stay multiples of 4, so only the last launch may
+        // need the in-kernel tail handling
+        const size_t slice =
+            ((data_size / m_split_streams) + 3) & ~static_cast<size_t>(3);
+
+        // Work already queued on the generator's stream (e.g. a
+        // previous call into the same buffer) must drain first
+        if(hipEventRecord(m_split_fork, m_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        for(unsigned int i = 0; i < m_split_streams; i++)
+        {
+            const size_t start = i * slice;
+            if(start >= data_size)
+            {
+                break;
+            }
+            const size_t n = std::min(slice, data_size - start);
+            if(hipStreamWaitEvent(m_split_pool[i], m_split_fork, 0) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            // Each slice's engines start at side position
+            // m_side_offset + start; a slice's engines consume at most
+            // n positions, so the partitions cannot collide
+            const rocrand_status status = launch_generate(
+                blocks_for_size(n), m_split_pool[i],
+                static_cast<engine_type *>(NULL), data + start, n,
+                m_seed ^ 0x9E3779B97F4A7C15ULL, m_side_offset + start,
+                true, distribution);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+
+            if(hipEventRecord(m_split_events[i], m_split_pool[i]) != hipSuccess
+                || hipStreamWaitEvent(m_stream, m_split_events[i], 0) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+        }
+
+        // Reserve the whole consumed side-stream region, so successive
+        // split calls (and the other side-stream users) stay disjoint
+        m_side_offset += data_size;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p data with \p bytes random bytes. Unlike generate(),
+    /// the destination may have any length and alignment; the bulk of
+    /// the buffer is still written with vectorized 32-bit stores.
+    rocrand_status generate_bytes(void * data, size_t bytes) override
+    {
+        if(m_counter_ordering)
+        {
+            const size_t groups = (bytes + 15) / 16;
+            const uint32_t blocks = static_cast<uint32_t>(std::min<size_t>(
+                std::max<size_t>((groups + s_threads - 1) / s_threads, 1), m_blocks));
+
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_counter_bytes_kernel<engine_type>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                static_cast<unsigned char *>(data), bytes,
+                m_seed, m_counter, m_offset
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+            m_counter += groups;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size((bytes + 3) / 4);
+
+        const rocrand_status status = m_threads_per_engine == 8
+            ? launch_bytes_impl<8>(blocks, data, bytes, init_engines)
+            : launch_bytes_impl<16>(blocks, data, bytes, init_engines);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
+    /// Fills \p data with \p data_size uniforms from (0; 1] carrying
+    /// only \p bits bits of resolution: every 32-bit draw is sliced
+    /// into 32/bits values, multiplying the output rate for consumers
+    /// that trade entropy per value for throughput (noise textures and
+    /// the like). \p bits must be 8, 16 or 32; 32 matches
+    /// generate_uniform() exactly.
+    rocrand_status generate_uniform_bits(float * data, size_t data_size,
+                                         unsigned int bits)
+    {
+        switch(bits)
+        {
+            case 8: return generate_uniform_bits_impl<8>(data, data_size);
+            case 16: return generate_uniform_bits_impl<16>(data, data_size);
+            case 32: return generate_uniform(data, data_size);
+            default: return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+
+    template<unsigned int Bits>
+    rocrand_status generate_uniform_bits_impl(float * data, size_t data_size)
+    {
+        const unsigned int per_value = 32 / Bits;
+
+        const bool init_engines = !m_engines_initialized;
+        // Each thread still consumes one draw per iteration, so the
+        // grid is sized by 32-bit values like in generate()
+        const uint32_t blocks = init_engines
+            ? m_blocks
+            : blocks_for_size((data_size + per_value - 1) / per_value);
+
+        const rocrand_status status = m_threads_per_engine == 8
+            ? launch_uniform_bits_impl<8, Bits>(blocks, data, data_size,
+                                                init_engines)
+            : launch_uniform_bits_impl<16, Bits>(blocks, data, data_size,
+                                                 init_engines);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Applies the device-callable \p op to every generated value
+    /// inside the generation kernel, fusing generate-then-transform
+    /// pipelines into one pass over memory. For floating-point types
+    /// \p op receives uniform values from (0; 1] (e.g.
+    /// <tt>op(u) = -logf(u)</tt> yields exponentials); for
+    /// <tt>unsigned int</tt> it receives the raw engine output.
+    /// \p op must map T to T.
+    template<class T, class UnaryOp>
+    rocrand_status generate_transform(T * data, size_t data_size, UnaryOp op)
+    {
+        transformed_distribution<T, UnaryOp> distribution(op);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Fills \p data with \p data_size gamma distributed values with
+    /// the given \p shape and \p scale using Marsaglia-Tsang rejection
+    /// sampling. Each element draws from its own subsequence of a
+    /// re-keyed stream, as the variable number of rejections does not
+    /// fit the fixed draw mapping of the bulk kernels; the generator's
+    /// main stream is not advanced.
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        if(shape <= static_cast<T>(0) || scale <= static_cast<T>(0))
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_gamma_kernel<engine_type>),
+            dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+            data, data_size,
+            // Re-keyed so the rejection draws never collide with the
+            // subsequences of the main stream's engines
+            m_seed ^ 0x9E3779B97F4A7C15ULL, m_side_offset,
+            shape, scale
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Reserve a counter region large enough that an element
+        // exhausting it (hundreds of consecutive rejections) is
+        // practically impossible
+        m_side_offset += 256;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p data with \p data_size Poisson distributed values
+    /// whose rates are taken per element from the device array
+    /// \p lambdas, in a single launch. Rates below 64 are drawn
+    /// exactly (Knuth), larger rates use the normal approximation.
+    /// Like generate_gamma(), draws come from a re-keyed side stream,
+    /// so the generator's main stream is not advanced.
+    rocrand_status generate_poisson_array(unsigned int * data, size_t data_size,
+                                          const double * lambdas)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_array_kernel<engine_type>),
+            dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+            data, data_size,
+            // Re-keyed so the per-element draws never collide with the
+            // subsequences of the main stream's engines
+            m_seed ^ 0x9E3779B97F4A7C15ULL, m_side_offset,
+            lambdas
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Knuth consumes ~lambda draws per element; a 1024-word region
+        // outlasts the threshold rate by a comfortable margin
+        m_side_offset += 1024;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_permutation(unsigned int * data, size_t data_size)
+    {
+        if(data_size == 0)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        // The permutation values are 32-bit
+        if(data_size > (1ULL << 32))
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        // Smallest balanced Feistel domain covering data_size
+        unsigned int bits = 1;
+        while((1ULL << bits) < data_size)
+        {
+            bits++;
+        }
+        const unsigned int half_bits = (bits + 1) / 2;
+
+        // Keyed from the re-keyed side stream so successive calls
+        // produce independent permutations and never collide with the
+        // main stream's draws
+        const unsigned long long key =
+            (m_seed ^ 0x9E3779B97F4A7C15ULL) + m_side_offset;
+        m_side_offset += 16;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_permutation_kernel),
+            dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+            data, data_size, key, half_bits
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p counts with \p num_draws multinomial count vectors
+    /// (row-major, \p num_weights counts per draw) of \p trials trials
+    /// over the categories weighted by the device array \p weights, in
+    /// a single launch via the conditional-binomial decomposition.
+    /// Like generate_poisson_array(), draws come from a re-keyed side
+    /// stream, so the generator's main stream is not advanced.
+    rocrand_status generate_multinomial(unsigned int * counts, size_t num_draws,
+                                        unsigned int trials,
+                                        const double * weights,
+                                        unsigned int num_weights)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multinomial_kernel<engine_type>),
+            dim3(blocks_for_size(num_draws)), dim3(s_threads), 0, m_stream,
+            counts, num_draws, trials, weights, num_weights,
+            // Re-keyed so the per-element draws never collide with the
+            // subsequences of the main stream's engines
+            m_seed ^ 0x9E3779B97F4A7C15ULL, m_side_offset
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // BTRS needs a few draws per category and BINV at most ~10
+        // expected; a 4096-word region covers even very wide rows
+        m_side_offset += 4096;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p data with \p data_size values taken from absolute
+    /// position \p sequence_offset of the generator's logical stream
+    /// (i.e. the stream that a generator with the same seed and offset
+    /// produces from its start), without reading or modifying the
+    /// generator's device state. As the counter re-key is O(1),
+    /// concurrent host threads can pull disjoint slices of one stream
+    /// with no synchronization between them.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_at(T * data, size_t data_size,
+                               unsigned long long sequence_offset,
+                               const Distribution& distribution = Distribution())
+    {
+        return launch_generate(
+            blocks_for_size(data_size), m_stream,
+            static_cast<engine_type *>(NULL), data, data_size,
+            m_seed, m_offset + sequence_offset, true, distribution);
+    }
+
+    /// Fills each of the \p count buffers \p data[i] with \p sizes[i]
+    /// uniformly distributed 32-bit unsigned integers in a single
+    /// kernel launch, amortizing launch overhead and engine load/store
+    /// across the whole batch.
+    rocrand_status generate_batch(unsigned int * const * data,
+                                  const size_t * sizes,
+                                  int count)
+    {
+        if(count < 1 || data == NULL || sizes == NULL)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        if(m_counter_ordering)
+        {
+            // One counter launch per buffer; reproducibility outranks
+            // single-launch batching in this mode
+            for(int i = 0; i < count; i++)
+            {
+                const rocrand_status status = generate_counter(
+                    data[i], sizes[i], uniform_distribution<unsigned int>());
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Build chunk-indexed descriptors, with an end sentinel
+        // carrying the total chunk count
+        std::vector<rocrand_host::detail::batch_descriptor> batch(count + 1);
+        size_t chunks = 0;
+        size_t total = 0;
+        for(int i = 0; i < count; i++)
+        {
+            batch[i].data = data[i];
+            batch[i].size = sizes[i];
+            batch[i].chunk_start = chunks;
+            chunks += (sizes[i] + 3) / 4;
+            total += sizes[i];
+        }
+        batch[count].data = NULL;
+        batch[count].size = 0;
+        batch[count].chunk_start = chunks;
+
+        rocrand_status status = update_batch_descriptors(batch);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(total);
+
+        status = m_threads_per_engine == 8
+            ? launch_batch_impl<8>(blocks, chunks, init_engines)
+            : launch_batch_impl<16>(blocks, chunks, init_engines);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_counter_ordering)
+        {
+            return generate_counter(data, data_size,
+                                    normal_distribution<T>(mean, stddev));
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        const rocrand_status status = launch_normal(
+            blocks, data, data_size, init_engines,
+            normal_distribution<T>(mean, stddev));
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        if(m_counter_ordering)
+        {
+            return generate_counter(data, data_size,
+                                    log_normal_distribution<T>(mean, stddev));
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        const rocrand_status status = launch_normal(
+            blocks, data, data_size, init_engines,
+            log_normal_distribution<T>(mean, stddev));
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Draws \p n normally distributed values with the given \p mean
+    /// and \p stddev and reduces them on the fly: \p sums must point
+    /// to 3 zero-initializable device values which receive the sum of
+    /// the values, the sum of their squares and the sum of
+    /// <tt>payoff(value)</tt> for the device-callable functor
+    /// \p payoff. The stream is never materialized, so no output
+    /// bandwidth is spent; the generator state advances as if
+    /// generate_normal() was called with the same \p n.
+    template<class T, class PayoffOp>
+    rocrand_status generate_normal_reduce(size_t n, T mean, T stddev,
+                                          T * sums, PayoffOp payoff)
+    {
+        return generate_reduce_impl<true>(
+            n, sums, 3, payoff, normal_distribution<T>(mean, stddev)
+        );
+    }
+
+    /// Like the payoff overload, but \p sums points to 2 device
+    /// values receiving the sum of the values and the sum of their
+    /// squares only.
+    template<class T>
+    rocrand_status generate_normal_reduce(size_t n, T mean, T stddev,
+                                          T * sums)
+    {
+        return generate_reduce_impl<false>(
+            n, sums, 2, rocrand_host::detail::empty_payoff<T>(),
+            normal_distribution<T>(mean, stddev)
+        );
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        if(m_counter_ordering)
+        {
+            return generate_counter_poisson(data, data_size, m_poisson.dis);
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        const rocrand_status status = launch_poisson(
+            blocks, data, data_size, init_engines, m_poisson.dis);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
 
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
-                            const Distribution& distribution = Distribution())
+        if(m_counter_ordering)
+        {
+            return generate_counter_poisson(data, data_size, m_binomial.dis);
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        const rocrand_status status = launch_poisson(
+            blocks, data, data_size, init_engines, m_binomial.dis);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
             return status;
+        }
 
-        hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
-        );
-        // Check kernel status
-        if(hipPeekAtLastError() != hipSuccess)
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        if(m_counter_ordering)
+        {
+            return generate_counter_poisson(data, data_size, m_discrete.dis);
+        }
 
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        const rocrand_status status = launch_poisson(
+            blocks, data, data_size, init_engines, m_discrete.dis);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_uniform(T * data, size_t data_size)
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
     {
-        uniform_distribution<T> udistribution;
-        return generate(data, data_size, udistribution);
+        return generate(data, n);
     }
 
-    template<class T>
-    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    rocrand_status generate_char(unsigned char * data, size_t n) override
     {
-        // data_size must be even
-        // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
         {
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
         }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
 
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its 128-bit vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_gamma_float(float * data, size_t n,
+                                        float shape, float scale) override
+    {
+        return generate_gamma(data, n, shape, scale);
+    }
+
+    rocrand_status generate_gamma_double(double * data, size_t n,
+                                         double shape, double scale) override
+    {
+        return generate_gamma(data, n, shape, scale);
+    }
+
+    rocrand_status generate_uniform_half(__half * data, size_t n) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        uniform_distribution<__half>());
+    }
+
+    rocrand_status generate_normal_half(__half * data, size_t n,
+                                        __half mean, __half stddev) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        normal_distribution<__half>(mean, stddev));
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_truncated_normal_float(float * data, size_t n,
+                                                   float mean, float stddev,
+                                                   float low, float high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<float>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_truncated_normal_double(double * data, size_t n,
+                                                    double mean, double stddev,
+                                                    double low, double high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<double>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_normal_double_fast(double * data, size_t n,
+                                               double mean, double stddev) override
+    {
+        return generate(data, n,
+                        fast_normal_distribution<double>(mean, stddev));
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
+    }
+
+    rocrand_status generate_poisson_array_uint(unsigned int * data, size_t n,
+                                               const double * lambdas) override
+    {
+        return generate_poisson_array(data, n, lambdas);
+    }
+
+    rocrand_status generate_permutation_uint(unsigned int * data,
+                                             size_t n) override
+    {
+        return generate_permutation(data, n);
+    }
+
+    rocrand_status generate_multinomial_uint(unsigned int * counts, size_t num_draws,
+                                             unsigned int trials,
+                                             const double * weights,
+                                             unsigned int num_weights) override
+    {
+        return generate_multinomial(counts, num_draws, trials, weights, num_weights);
+    }
+
+private:
+    // Engine grid size for the given ordering: the fixed
+    // device-independent default for LEGACY, the grid saturating the
+    // present device for BEST; always a multiple of threads_per_engine
+    // blocks because engines are shared by that many consecutive threads
+    unsigned int blocks_for_ordering(rocrand_ordering ordering,
+                                     unsigned int threads_per_engine) const
+    {
+        unsigned int blocks = s_blocks;
+        if(ordering == ROCRAND_ORDERING_PSEUDO_BEST)
+        {
+            // The occupancy depends on the instantiation, so the query
+            // uses the one the generator will launch
+            blocks = threads_per_engine == 8
+                ? rocrand_host::detail::max_active_blocks(
+                      rocrand_host::detail::generate_kernel<
+                          8, false, engine_type,
+                          unsigned int, uniform_distribution<unsigned int>
+                      >,
+                      s_threads, s_blocks)
+                : rocrand_host::detail::max_active_blocks(
+                      rocrand_host::detail::generate_kernel<
+                          16, false, engine_type,
+                          unsigned int, uniform_distribution<unsigned int>
+                      >,
+                      s_threads, s_blocks);
+        }
+        return ((blocks + threads_per_engine - 1) / threads_per_engine)
+            * threads_per_engine;
+    }
+
+    template<bool HasPayoff, class T, class PayoffOp, class Distribution>
+    rocrand_status generate_reduce_impl(size_t n, T * sums, size_t count,
+                                        PayoffOp payoff,
+                                        Distribution distribution)
+    {
+        // The kernel accumulates with atomics, so the output starts at 0
+        if(hipMemsetAsync(sums, 0, count * sizeof(T), m_stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(n);
+
+        const rocrand_status status = m_threads_per_engine == 8
+            ? launch_reduce_impl<8, HasPayoff>(blocks, sums, n, payoff,
+                                               distribution, init_engines)
+            : launch_reduce_impl<16, HasPayoff>(blocks, sums, n, payoff,
+                                                distribution, init_engines);
+        if(status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        normal_distribution<T> distribution(mean, stddev);
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Uploads batch descriptors into a device buffer cached (and grown
+    // on demand) in the generator. The copy is synchronous because the
+    // host-side descriptors live on the caller's stack.
+    rocrand_status update_batch_descriptors(
+        const std::vector<rocrand_host::detail::batch_descriptor>& batch)
+    {
+        const size_t bytes =
+            sizeof(rocrand_host::detail::batch_descriptor) * batch.size();
+        if(batch.size() > m_batch_capacity)
+        {
+            rocrand_host::detail::device_free(m_batch, m_stream);
+            m_batch = NULL;
+            m_batch_capacity = 0;
+            if(rocrand_host::detail::device_malloc(&m_batch, bytes) != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            m_batch_capacity = batch.size();
+        }
+        if(hipMemcpy(m_batch, batch.data(),
+                     bytes, hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Returns a grid size just large enough to cover data_size without
+    // grid-stride iterations, capped at the full per-device grid.
+    // Small requests then load and store only a prefix of the engines,
+    // cutting fixed per-call cost.
+    uint32_t blocks_for_size(size_t data_size) const
+    {
+        const size_t elements_per_block = s_threads * 4;
+        size_t blocks = (data_size + elements_per_block - 1) / elements_per_block;
+        // Engines are shared by m_threads_per_engine consecutive threads
+        blocks = ((blocks + m_threads_per_engine - 1) / m_threads_per_engine)
+            * m_threads_per_engine;
+        return static_cast<uint32_t>(
+            std::min<size_t>(std::max<size_t>(blocks, m_threads_per_engine), m_blocks)
+        );
+    }
+
+    // Tuned-instantiation dispatch: the engine-based kernels are
+    // compiled for every threads-per-engine value in the tuning table
+    // ({8, 16}, see tuning.hpp) and each launch picks the
+    // instantiation selected at creation time, so the leapfrog stride
+    // stays a compile-time constant
+    template<class T, class Distribution>
+    rocrand_status launch_generate(uint32_t blocks, hipStream_t stream,
+                                   engine_type * engines,
+                                   T * data, size_t data_size,
+                                   unsigned long long seed,
+                                   unsigned long long offset,
+                                   bool init_engines,
+                                   const Distribution& distribution)
+    {
+        return m_threads_per_engine == 8
+            ? launch_generate_impl<8>(blocks, stream, engines, data, data_size,
+                                      seed, offset, init_engines, distribution)
+            : launch_generate_impl<16>(blocks, stream, engines, data, data_size,
+                                       seed, offset, init_engines, distribution);
+    }
 
+    template<unsigned int ThreadsPerEngine, class T, class Distribution>
+    rocrand_status launch_generate_impl(uint32_t blocks, hipStream_t stream,
+                                        engine_type * engines,
+                                        T * data, size_t data_size,
+                                        unsigned long long seed,
+                                        unsigned long long offset,
+                                        bool init_engines,
+                                        const Distribution& distribution)
+    {
+        // The in-kernel tail handling is compiled out when n is a multiple of 4
+        if((data_size & 3) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<ThreadsPerEngine, false>),
+                dim3(blocks), dim3(s_threads), 0, stream,
+                engines, data, data_size, seed, offset, init_engines, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<ThreadsPerEngine, true>),
+                dim3(blocks), dim3(s_threads), 0, stream,
+                engines, data, data_size, seed, offset, init_engines, distribution
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<unsigned int ThreadsPerEngine>
+    rocrand_status launch_bytes_impl(uint32_t blocks, void * data,
+                                     size_t bytes, bool init_engines)
+    {
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_bytes_kernel<ThreadsPerEngine>),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, static_cast<unsigned char *>(data), bytes,
+            m_seed, m_offset, init_engines
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
@@ -571,26 +2829,45 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T>
-    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    template<unsigned int ThreadsPerEngine, unsigned int Bits>
+    rocrand_status launch_uniform_bits_impl(uint32_t blocks, float * data,
+                                            size_t data_size, bool init_engines)
     {
-        // data_size must be even
-        // data must be aligned to 2 * sizeof(T) bytes
-        if(data_size%2 != 0 || ((uintptr_t)(data)%(2*sizeof(T))) != 0)
+        const unsigned int per_draw = 4 * (32 / Bits);
+        // The in-kernel tail handling is compiled out when n is a
+        // multiple of the per-draw output count
+        if((data_size % per_draw) == 0)
         {
-            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_uniform_bits_kernel<ThreadsPerEngine, false, Bits>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines
+            );
         }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_uniform_bits_kernel<ThreadsPerEngine, true, Bits>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
 
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
-
-        log_normal_distribution<T> distribution(mean, stddev);
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
+    template<unsigned int ThreadsPerEngine>
+    rocrand_status launch_batch_impl(uint32_t blocks, size_t chunks,
+                                     bool init_engines)
+    {
+        uniform_distribution<unsigned int> distribution;
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_batch_kernel<ThreadsPerEngine>),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, m_batch, chunks, m_seed, m_offset, init_engines, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
@@ -599,25 +2876,103 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    template<class T, class Distribution>
+    rocrand_status launch_normal(uint32_t blocks, T * data, size_t data_size,
+                                 bool init_engines,
+                                 const Distribution& distribution)
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        return m_threads_per_engine == 8
+            ? launch_normal_impl<8>(blocks, data, data_size, init_engines,
+                                    distribution)
+            : launch_normal_impl<16>(blocks, data, data_size, init_engines,
+                                     distribution);
+    }
 
-        try
+    template<unsigned int ThreadsPerEngine, class T, class Distribution>
+    rocrand_status launch_normal_impl(uint32_t blocks, T * data,
+                                      size_t data_size, bool init_engines,
+                                      const Distribution& distribution)
+    {
+        // The distribution stores float4 or double2 at once; the
+        // in-kernel tail handling is compiled out when n is a
+        // multiple of that width
+        const size_t x = 16 / sizeof(T);
+        if((data_size & (x - 1)) == 0)
         {
-            m_poisson.set_lambda(lambda);
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<ThreadsPerEngine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
         }
-        catch(rocrand_status status)
+        else
         {
-            return status;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<ThreadsPerEngine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class Distribution>
+    rocrand_status launch_poisson(uint32_t blocks, unsigned int * data,
+                                  size_t data_size, bool init_engines,
+                                  const Distribution& distribution)
+    {
+        return m_threads_per_engine == 8
+            ? launch_poisson_impl<8>(blocks, data, data_size, init_engines,
+                                     distribution)
+            : launch_poisson_impl<16>(blocks, data, data_size, init_engines,
+                                      distribution);
+    }
+
+    template<unsigned int ThreadsPerEngine, class Distribution>
+    rocrand_status launch_poisson_impl(uint32_t blocks, unsigned int * data,
+                                       size_t data_size, bool init_engines,
+                                       const Distribution& distribution)
+    {
+        // The in-kernel tail handling is compiled out when n is a multiple of 4
+        if((data_size & 3) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<ThreadsPerEngine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
         }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<ThreadsPerEngine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
+    template<unsigned int ThreadsPerEngine, bool HasPayoff,
+             class T, class PayoffOp, class Distribution>
+    rocrand_status launch_reduce_impl(uint32_t blocks, T * sums, size_t n,
+                                      PayoffOp payoff,
+                                      const Distribution& distribution,
+                                      bool init_engines)
+    {
         hipLaunchKernelGGL(
-            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine>),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, m_poisson.dis
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_reduce_kernel<ThreadsPerEngine, s_threads, HasPayoff>),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, sums, n, m_seed, m_offset, init_engines,
+            payoff, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
@@ -626,19 +2981,99 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-private:
+    // Requests the persistent service can serve become queue pushes;
+    // the generic overload reports everything else so generate() can
+    // fall back to the counter-keyed path
+    template<class T, class Distribution>
+    rocrand_status persistent_enqueue(T *, size_t, const Distribution&)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status persistent_enqueue(unsigned int * data, size_t n,
+                                      const uniform_distribution<unsigned int>&)
+    {
+        return m_persistent->enqueue(
+            data, n, rocrand_host::detail::persistent_descriptor::op_uniform_uint);
+    }
+
+    rocrand_status persistent_enqueue(float * data, size_t n,
+                                      const uniform_distribution<float>&)
+    {
+        return m_persistent->enqueue(
+            data, n, rocrand_host::detail::persistent_descriptor::op_uniform_float);
+    }
+
+    rocrand_status persistent_enqueue(double * data, size_t n,
+                                      const uniform_distribution<double>&)
+    {
+        return m_persistent->enqueue(
+            data, n, rocrand_host::detail::persistent_descriptor::op_uniform_double);
+    }
+
+    // Stops the service (synchronizing it and writing the engines
+    // back); called before anything that invalidates or reallocates
+    // the engine array
+    void stop_persistent()
+    {
+        delete m_persistent;
+        m_persistent = NULL;
+    }
+
     bool m_engines_initialized;
     engine_type * m_engines;
-    const size_t m_engines_size;
+    size_t m_engines_size;
+    uint32_t m_blocks;
+    // Consecutive threads sharing one engine, selected from the
+    // compiled instantiation set by the tuning table at creation
+    unsigned int m_threads_per_engine;
+
+    // Cached device-side descriptor array for generate_batch()
+    rocrand_host::detail::batch_descriptor * m_batch;
+    size_t m_batch_capacity;
+
+    // Counter region already consumed by the re-keyed side stream
+    // (generate_gamma(), generate_poisson_array())
+    unsigned long long m_side_offset;
+
+    // ROCRAND_ORDERING_PSEUDO_COUNTER: next virtual-stream counter
+    // value; advanced by the group count of each generate call
+    bool m_counter_ordering;
+    unsigned long long m_counter;
+
+    // Base subsequence of the partition set by set_subsequence()
+    // (0 = full sequence)
+    unsigned long long m_subsequence_base;
+
+    // Persistent generation service (see rocrand_set_persistent_mode());
+    // NULL while the mode is off
+    rocrand_host::detail::persistent_service<engine_type> * m_persistent;
+
+    // Internal stream pool for split generate calls (see
+    // rocrand_set_split_streams()); m_split_created streams/events
+    // exist, m_split_streams of them are active
+    unsigned int m_split_streams;
+    unsigned int m_split_created;
+    hipStream_t m_split_pool[s_max_split_streams];
+    hipEvent_t m_split_events[s_max_split_streams];
+    hipEvent_t m_split_fork;
 
     const static uint32_t s_threads = 256;
+    // Default grid size, used when the device can't be queried
     const static uint32_t s_blocks = 1024;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<> m_binomial;
+
+    discrete_distribution_manager<> m_discrete;
 
     // m_seed from base_type
     // m_offset from base_type
 };
 
+typedef rocrand_philox4x32<10> rocrand_philox4x32_10;
+typedef rocrand_philox4x32<7> rocrand_philox4x32_7;
+
 #endif // ROCRAND_RNG_PHILOX4X32_10_H_
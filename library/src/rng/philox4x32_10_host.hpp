@@ -0,0 +1,435 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PHILOX4X32_10_HOST_H_
+#define ROCRAND_RNG_PHILOX4X32_10_HOST_H_
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "common.hpp"
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "philox4x32_10.hpp"
+
+// PHILOX-4x32-10 generator running on host threads, for nodes without
+// a GPU (see ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST). The class walks
+// the same virtual grid as the device generator's kernels -- the fixed
+// ROCRAND_ORDERING_PSEUDO_LEGACY grid, including the per-call grid
+// clamping of blocks_for_size() -- with the same engine class and the
+// same distribution functors, so the integer and uniform output
+// streams are bit-identical to a device PHILOX-4x32-10 generator set
+// to legacy ordering. Normal, log-normal and exponential output uses
+// the host libm transcendentals, which may differ from the device
+// intrinsics in the last bits.
+//
+// The per-engine counter streams are independent, so the work splits
+// evenly over std::thread workers; PHILOX has no recurrence across
+// lanes, which also leaves the inner loops open to the host compiler's
+// vectorizer. Output is written directly through the passed pointer on
+// the calling threads, so destinations must be host-accessible, and
+// calls complete synchronously; the generator's stream is unused.
+class rocrand_philox4x32_10_host : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST>
+{
+    // Grid walked by the device kernels under legacy ordering
+    static constexpr uint32_t s_threads = 256;
+    static constexpr uint32_t s_blocks = 1024;
+    static constexpr unsigned int s_threads_per_engine = 16;
+    // Below this many values the worker threads cost more to start
+    // than they save
+    static constexpr size_t s_min_parallel_size = size_t(1) << 16;
+
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST>;
+    using engine_type = ::rocrand_host::detail::philox4x32_device_engine<10>;
+
+    rocrand_philox4x32_10_host(unsigned long long seed = 0,
+                               unsigned long long offset = 0)
+        : base_type(seed, offset),
+          m_engines_initialized(false),
+          m_engines(size_t(s_threads) * s_blocks / s_threads_per_engine)
+    {
+
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+    }
+
+    bool is_host_generator() const override
+    {
+        return true;
+    }
+
+    rocrand_status init() override
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // Counter skips are O(1), so construction is cheap enough to
+        // run on the calling thread
+        for(size_t i = 0; i < m_engines.size(); i++)
+        {
+            m_engines[i] = engine_type(m_seed, i, m_offset);
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        if(data_size == 0)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // The device path runs its fused-init call over the full grid
+        // and later calls over a grid clamped to the request, and the
+        // grid size enters the output layout through the stride; both
+        // are matched here
+        const bool init_engines = !m_engines_initialized;
+        if(init_engines)
+        {
+            const rocrand_status status = init();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        const uint32_t blocks =
+            init_engines ? s_blocks : blocks_for_size(data_size);
+        const unsigned int stride = blocks * s_threads;
+        const unsigned int engines_used = stride / s_threads_per_engine;
+
+        unsigned int workers =
+            std::max(1u, std::thread::hardware_concurrency());
+        if(data_size < s_min_parallel_size)
+        {
+            workers = 1;
+        }
+        workers = std::min(workers, engines_used);
+
+        // Engines are private to their lanes, so splitting on engine
+        // boundaries needs no synchronization between the workers
+        const unsigned int chunk = (engines_used + workers - 1) / workers;
+        std::vector<std::thread> threads;
+        for(unsigned int w = 1; w < workers; w++)
+        {
+            const unsigned int first = w * chunk;
+            const unsigned int last = std::min(first + chunk, engines_used);
+            threads.emplace_back(
+                &rocrand_philox4x32_10_host::generate_range<T, Distribution>,
+                this, first, last, stride, data, data_size, distribution);
+        }
+        generate_range(0u, std::min(chunk, engines_used), stride,
+                       data, data_size, distribution);
+        for(auto& t : threads)
+        {
+            t.join();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+private:
+    // Host port of the device generate_kernel() body over the engine
+    // range [first, last): every virtual thread of the grid is
+    // replayed lane by lane -- same lane skips, same grid-stride
+    // write pattern, same tail rule, and the engine state written
+    // back is the one the device's smallest-index lane would save --
+    // so the output and the state evolution match the device
+    // generator draw for draw
+    template<class T, class Distribution>
+    void generate_range(const unsigned int first, const unsigned int last,
+                        const unsigned int stride,
+                        T * data, const size_t n,
+                        const Distribution distribution)
+    {
+        typedef decltype(distribution(uint4())) Type4;
+        const unsigned int x = sizeof(Type4) / sizeof(T);
+        const auto tail_size = n & (x - 1);
+
+        for(unsigned int engine_id = first; engine_id < last; engine_id++)
+        {
+            const engine_type base = m_engines[engine_id];
+            unsigned int index_min = 0;
+            engine_type engine_min;
+
+            for(unsigned int lane = 0; lane < s_threads_per_engine; lane++)
+            {
+                engine_type engine = base;
+                if(lane > 0)
+                {
+                    // Skips lane states, as in the device kernel
+                    engine.discard(4 * lane);
+                }
+
+                unsigned int index = engine_id * s_threads_per_engine + lane;
+                while(index < (n / x))
+                {
+                    const Type4 result =
+                        distribution(engine.next4_leap(s_threads_per_engine));
+                    // memcpy stands in for the kernel's aligned and
+                    // unaligned store paths; the values are the same
+                    std::memcpy(data + size_t(index) * x, &result, sizeof(Type4));
+                    index += stride;
+                }
+
+                // The lane that would store the next Type4 draws the tail
+                if((index == n / x) && tail_size > 0)
+                {
+                    const Type4 result = distribution(engine.next4());
+                    data[n - tail_size] = (&result.x)[0];
+                    if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1];
+                    if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2];
+                }
+
+                // Final indexes are distinct across lanes, so the
+                // minimum picks exactly one engine to save
+                if(lane == 0 || index < index_min)
+                {
+                    index_min = index;
+                    engine_min = engine;
+                }
+            }
+
+            m_engines[engine_id] = engine_min;
+        }
+    }
+
+    // Per-call grid clamping of the device generator (see
+    // rocrand_philox4x32::blocks_for_size()), against the fixed
+    // legacy grid
+    uint32_t blocks_for_size(size_t data_size) const
+    {
+        const size_t elements_per_block = s_threads * 4;
+        size_t blocks = (data_size + elements_per_block - 1) / elements_per_block;
+        blocks = ((blocks + s_threads_per_engine - 1) / s_threads_per_engine)
+            * s_threads_per_engine;
+        return static_cast<uint32_t>(
+            std::min<size_t>(std::max<size_t>(blocks, s_threads_per_engine), s_blocks)
+        );
+    }
+
+    bool m_engines_initialized;
+    std::vector<engine_type> m_engines;
+};
+
+#endif // ROCRAND_RNG_PHILOX4X32_10_HOST_H_
@@ -0,0 +1,297 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_PHILOX4X32_10_MULTI_H_
+#define ROCRAND_RNG_PHILOX4X32_10_MULTI_H_
+
+#include <algorithm>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "philox4x32_10.hpp"
+
+// Multi-device PHILOX-4x32-10 generator.
+//
+// Holds one rocrand_philox4x32_10 per selected device and fills each
+// request by splitting it into per-device chunks which run concurrently.
+// Because Philox is counter-based, disjoint chunks of one logical stream
+// are claimed by offsetting each sub-generator into the counter space
+// (set_offset is an O(1) re-key, no skip-ahead kernels), so the devices
+// never produce overlapping counters for one (seed, offset) pair.
+//
+// The output buffer must be accessible from every selected device
+// (e.g. through peer access or one buffer per device chunk).
+// Generation is asynchronous on each device's null stream; the caller
+// synchronizes the devices before reading the output.
+class rocrand_philox4x32_10_multi : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI>;
+
+    rocrand_philox4x32_10_multi(const int * devices, int device_count,
+                                unsigned long long seed = 0,
+                                unsigned long long offset = 0)
+        : base_type(seed, offset, 0),
+          m_devices(devices, devices + device_count),
+          m_generated(0)
+    {
+        int previous_device;
+        if(hipGetDevice(&previous_device) != hipSuccess)
+        {
+            throw ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        try
+        {
+            for(int device : m_devices)
+            {
+                if(hipSetDevice(device) != hipSuccess)
+                {
+                    throw ROCRAND_STATUS_OUT_OF_RANGE;
+                }
+                m_generators.push_back(new rocrand_philox4x32_10(seed, offset));
+            }
+        }
+        catch(...)
+        {
+            for(auto generator : m_generators)
+            {
+                delete generator;
+            }
+            hipSetDevice(previous_device);
+            throw;
+        }
+        hipSetDevice(previous_device);
+    }
+
+    ~rocrand_philox4x32_10_multi()
+    {
+        int previous_device;
+        hipGetDevice(&previous_device);
+        for(size_t i = 0; i < m_generators.size(); i++)
+        {
+            hipSetDevice(m_devices[i]);
+            delete m_generators[i];
+        }
+        hipSetDevice(previous_device);
+    }
+
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_generated = 0;
+        for(size_t i = 0; i < m_generators.size(); i++)
+        {
+            m_generators[i]->set_seed(seed);
+        }
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_generated = 0;
+    }
+
+    rocrand_status init()
+    {
+        int previous_device;
+        if(hipGetDevice(&previous_device) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        for(size_t i = 0; i < m_generators.size(); i++)
+        {
+            if(hipSetDevice(m_devices[i]) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+                break;
+            }
+            status = m_generators[i]->init();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                break;
+        }
+        hipSetDevice(previous_device);
+        return status;
+    }
+
+    template<class T>
+    rocrand_status generate(T * data, size_t data_size)
+    {
+        return for_each_device(
+            [&](size_t i, size_t start, size_t len)
+            {
+                m_generators[i]->set_offset(m_offset + m_generated + start);
+                return m_generators[i]->generate(data + start, len);
+            },
+            data_size, 4
+        );
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        return for_each_device(
+            [&](size_t i, size_t start, size_t len)
+            {
+                m_generators[i]->set_offset(m_offset + m_generated + start);
+                return m_generators[i]->generate_uniform(data + start, len);
+            },
+            data_size, 4
+        );
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        return for_each_device(
+            [&](size_t i, size_t start, size_t len)
+            {
+                m_generators[i]->set_offset(m_offset + m_generated + start);
+                return m_generators[i]->generate_normal(data + start, len, mean, stddev);
+            },
+            data_size, 4
+        );
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        return for_each_device(
+            [&](size_t i, size_t start, size_t len)
+            {
+                m_generators[i]->set_offset(m_offset + m_generated + start);
+                return m_generators[i]->generate_log_normal(data + start, len, mean, stddev);
+            },
+            data_size, 4
+        );
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        return for_each_device(
+            [&](size_t i, size_t start, size_t len)
+            {
+                m_generators[i]->set_offset(m_offset + m_generated + start);
+                return m_generators[i]->generate_poisson(data + start, len, lambda);
+            },
+            data_size, 4
+        );
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+private:
+    // Splits data_size into per-device chunks aligned to chunk_multiple
+    // (so alignment requirements of the vectorized kernels hold for every
+    // chunk start) and runs op(generator_index, start, length) on each
+    // device. Advances the counter partition afterwards.
+    template<class Op>
+    rocrand_status for_each_device(Op op, size_t data_size, size_t chunk_multiple)
+    {
+        int previous_device;
+        if(hipGetDevice(&previous_device) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        size_t chunk = (data_size + m_generators.size() - 1) / m_generators.size();
+        chunk = ((chunk + chunk_multiple - 1) / chunk_multiple) * chunk_multiple;
+
+        rocrand_status status = ROCRAND_STATUS_SUCCESS;
+        size_t start = 0;
+        for(size_t i = 0; i < m_generators.size(); i++)
+        {
+            const size_t len = std::min(chunk, data_size - start);
+            if(len == 0)
+                break;
+            if(hipSetDevice(m_devices[i]) != hipSuccess)
+            {
+                status = ROCRAND_STATUS_INTERNAL_ERROR;
+                break;
+            }
+            status = op(i, start, len);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                break;
+            start += len;
+            if(start == data_size)
+                break;
+        }
+
+        m_generated += data_size;
+        hipSetDevice(previous_device);
+        return status;
+    }
+
+    std::vector<int> m_devices;
+    std::vector<rocrand_philox4x32_10 *> m_generators;
+    // Values generated since the last seed/offset change, used to keep
+    // the per-device counter partitions disjoint between calls
+    unsigned long long m_generated;
+};
+
+#endif // ROCRAND_RNG_PHILOX4X32_10_MULTI_H_
@@ -30,16 +30,44 @@
 #include "generator_type.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
+#include "sobol_scramble.hpp"
+#include "table_file.hpp"
+#include "table_registry.hpp"
+#include "tuning.hpp"
 
 namespace rocrand_host {
 namespace detail {
 
+    // The 32-bit direction vectors, resolved against a mapped table
+    // file when ROCRAND_TABLE_FILE supplies one, and the compiled-in
+    // table otherwise. The 64-bit generator derives its vectors from
+    // the same table, so a file carrying more dimensions extends both.
+    inline const unsigned int * sobol32_direction_vectors(size_t * bytes = NULL)
+    {
+        return static_cast<const unsigned int *>(
+            precomputed_table_file::lookup("sobol32_direction_vectors",
+                                           h_sobol32_direction_vectors,
+                                           sizeof(h_sobol32_direction_vectors),
+                                           bytes)
+        );
+    }
+
+    // Number of dimensions the resolved table covers (SOBOL_DIM unless
+    // a larger table is mapped)
+    inline unsigned int sobol_direction_vector_dimensions()
+    {
+        size_t bytes;
+        sobol32_direction_vectors(&bytes);
+        return static_cast<unsigned int>(bytes / (32 * sizeof(unsigned int)));
+    }
+
     typedef ::rocrand_device::sobol32_engine<true> sobol32_device_engine;
 
     template<class Type, class Distribution>
     __global__
     void generate_kernel(Type * data, const size_t n,
                          const unsigned int * direction_vectors,
+                         const unsigned int * scramble_constants,
                          const unsigned int offset,
                          Distribution distribution)
     {
@@ -58,11 +86,71 @@ namespace detail {
 
         sobol32_device_engine engine(vectors, offset + engine_id);
 
+        // Digital shift of the scrambled variant, zero when plain
+        const unsigned int scramble =
+            scramble_constants != NULL ? scramble_constants[dimension] : 0;
+
         const unsigned int start = dimension * n;
         unsigned int index = engine_id;
         while(index < n)
         {
-            data[start + index] = distribution(engine.current());
+            data[start + index] = distribution(engine.current() ^ scramble);
+            engine.discard_stride(stride);
+            index += stride;
+        }
+    }
+
+    // Point-major variant (ROCRAND_SOBOL_ORDER_INTERLEAVED): writes
+    // data[index * dimensions + dimension]. A block covers a tile of up
+    // to 32 consecutive dimensions (hipBlockIdx_y) times a strip of
+    // points; the lanes of a warp take consecutive dimensions of one
+    // point, so the point-major stores stay coalesced.
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel_interleaved(Type * data, const size_t n,
+                                     const unsigned int dimensions,
+                                     const unsigned int * direction_vectors,
+                                     const unsigned int * scramble_constants,
+                                     const unsigned int offset,
+                                     Distribution distribution)
+    {
+        constexpr unsigned int tile_dims = 32;
+        const unsigned int dim_base = hipBlockIdx_y * tile_dims;
+
+        // Stage the tile's direction vectors
+        __shared__ unsigned int vectors[tile_dims * 32];
+        for(unsigned int i = hipThreadIdx_x; i < tile_dims * 32; i += hipBlockDim_x)
+        {
+            const unsigned int dim = dim_base + i / 32;
+            if(dim < dimensions)
+            {
+                vectors[i] = direction_vectors[dim * 32 + i % 32];
+            }
+        }
+        __syncthreads();
+
+        const unsigned int dimension = dim_base + hipThreadIdx_x % tile_dims;
+        if(dimension >= dimensions)
+            return;
+
+        // Point lanes leap-frog over the sequence like engine_id does
+        // in the dimension-major kernel; lanes * hipGridDim_x is a
+        // power of 2 as strided discard requires
+        const unsigned int lanes = hipBlockDim_x / tile_dims;
+        const unsigned int stride = hipGridDim_x * lanes;
+        unsigned int index = hipBlockIdx_x * lanes + hipThreadIdx_x / tile_dims;
+
+        sobol32_device_engine engine(
+            &vectors[(hipThreadIdx_x % tile_dims) * 32], offset + index);
+
+        // Digital shift of the scrambled variant, zero when plain
+        const unsigned int scramble =
+            scramble_constants != NULL ? scramble_constants[dimension] : 0;
+
+        while(index < n)
+        {
+            data[index * dimensions + dimension] =
+                distribution(engine.current() ^ scramble);
             engine.discard_stride(stride);
             index += stride;
         }
@@ -78,28 +166,37 @@ public:
     using engine_type = ::rocrand_host::detail::sobol32_device_engine;
 
     rocrand_sobol32(unsigned long long offset = 0,
-                    hipStream_t stream = 0)
-        : base_type(0, offset, stream),
+                    hipStream_t stream = 0,
+                    bool scrambled = false)
+        : base_type(scrambled ? ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+                              : ROCRAND_RNG_QUASI_SOBOL32,
+                    0, offset, stream),
           m_initialized(false),
-          m_dimensions(1)
+          m_dimensions(1),
+          m_vector_dimensions(0),
+          m_order(ROCRAND_SOBOL_ORDER_DIMENSION),
+          m_direction_vectors(NULL),
+          m_scrambled(scrambled),
+          m_scramble_initialized(false),
+          m_scramble_constants(NULL)
     {
-        // Allocate direction vectors
-        hipError_t error;
-        error = hipMalloc(&m_direction_vectors, sizeof(unsigned int) * SOBOL_N);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_ALLOCATION_FAILED;
-        }
-        error = hipMemcpy(m_direction_vectors, h_sobol32_direction_vectors, sizeof(unsigned int) * SOBOL_N, hipMemcpyHostToDevice);
-        if(error != hipSuccess)
-        {
-            throw ROCRAND_STATUS_INTERNAL_ERROR;
-        }
+        // Direction vectors are loaded lazily for the active dimensions
+        // only (see update_direction_vectors()), so construction does
+        // not touch the device
+        m_threads = rocrand_host::detail::tuning_for_device().sobol_threads;
     }
 
     ~rocrand_sobol32()
     {
-        hipFree(m_direction_vectors);
+        if(m_scrambled)
+        {
+            rocrand_host::detail::device_free(m_direction_vectors, m_stream);
+            rocrand_host::detail::device_free(m_scramble_constants, m_stream);
+        }
+        else
+        {
+            rocrand_host::detail::device_table_registry::release(m_direction_vectors, m_stream);
+        }
     }
 
     void reset()
@@ -119,12 +216,44 @@ public:
         m_initialized = false;
     }
 
+    void set_order(rocrand_sobol_order order)
+    {
+        m_order = order;
+        m_initialized = false;
+    }
+
     rocrand_status init()
     {
         if (m_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
-        m_current_offset = static_cast<unsigned int>(m_offset);
+        rocrand_status status = update_direction_vectors();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(m_scrambled && !m_scramble_initialized)
+        {
+            // Fold the random lower-triangular matrix into the direction
+            // vectors and draw the digital-shift constants, once per
+            // load of the vectors (both kernels derive every value from
+            // (dimension, seed) alone, so a prefix of the table is
+            // scrambled identically regardless of the resident size)
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::scramble_direction_vectors_kernel),
+                dim3((m_vector_dimensions * 32 + 255) / 256), dim3(256), 0, m_stream,
+                m_direction_vectors, m_vector_dimensions, m_seed
+            );
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::init_scramble_constants_kernel),
+                dim3((m_vector_dimensions + 255) / 256), dim3(256), 0, m_stream,
+                m_scramble_constants, m_vector_dimensions, m_seed
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            m_scramble_initialized = true;
+        }
+
+        m_current_offset = m_offset;
         m_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
@@ -141,15 +270,40 @@ public:
         if (status != ROCRAND_STATUS_SUCCESS)
             return status;
 
-        #ifdef __HIP_PLATFORM_NVCC__
-        const uint32_t threads = 64;
+        // Per-architecture block size from the tuning table (see
+        // tuning.hpp), replacing the old compile-time platform fork
+        const uint32_t threads = m_threads;
         const uint32_t max_blocks = 4096;
-        #else
-        const uint32_t threads = 256;
-        const uint32_t max_blocks = 4096;
-        #endif
 
         const size_t size = data_size / m_dimensions;
+
+        if(m_order == ROCRAND_SOBOL_ORDER_INTERLEAVED)
+        {
+            // A block covers 32 dimensions times (threads / 32) point
+            // lanes; blocks_x must be power of 2 because strided
+            // discard (leap frog) supports only power of 2 jumps
+            const uint32_t lanes = threads / 32;
+            const uint32_t blocks_x = next_power2(std::min(max_blocks,
+                static_cast<uint32_t>((size + lanes - 1) / lanes)));
+            const uint32_t blocks_y = (m_dimensions + 31) / 32;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel_interleaved),
+                dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+                data, size, m_dimensions,
+                static_cast<const unsigned int*>(m_direction_vectors),
+                static_cast<const unsigned int*>(m_scramble_constants),
+                static_cast<unsigned int>(m_current_offset),
+                distribution
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+            m_current_offset += size;
+
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
         const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
 
         // blocks_x must be power of 2 because strided discard (leap frog)
@@ -160,7 +314,9 @@ public:
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
             dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
             data, size,
-            static_cast<const unsigned int*>(m_direction_vectors), m_current_offset,
+            static_cast<const unsigned int*>(m_direction_vectors),
+            static_cast<const unsigned int*>(m_scramble_constants),
+            static_cast<unsigned int>(m_current_offset),
             distribution
         );
         // Check kernel status
@@ -179,17 +335,56 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    // Normals come from the inverse CDF rather than Box-Muller: each
+    // Sobol coordinate maps monotonically to one output, preserving
+    // the low-discrepancy structure and the QMC convergence rate
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        normal_distribution<T> distribution(mean, stddev);
+        sobol_normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
 
     template<class T>
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
-        log_normal_distribution<T> distribution(mean, stddev);
+        sobol_log_normal_distribution<T> distribution(mean, stddev);
         return generate(data, data_size, distribution);
     }
 
@@ -197,7 +392,7 @@ public:
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, m_stream);
         }
         catch(rocrand_status status)
         {
@@ -206,14 +401,304 @@ public:
         return generate(data, data_size, m_poisson.dis);
     }
 
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_binomial.dis);
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
+    {
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        return generate(data, data_size, m_discrete.dis);
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+
+    // Each dimension occupies one contiguous segment of the full
+    // output buffer, so host-destination calls cannot be chunked
+    bool supports_chunked_host_generate() const override
+    {
+        return false;
+    }
+
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its 128-bit vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_uniform_half(__half * data, size_t n) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        uniform_distribution<__half>());
+    }
+
+    rocrand_status generate_normal_half(__half * data, size_t n,
+                                        __half mean, __half stddev) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        sobol_normal_distribution<__half>(mean, stddev));
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
+    }
+
 private:
+    // Makes the direction vectors of the active dimensions resident on
+    // the device. Only a prefix of the precomputed table covering
+    // m_dimensions dimensions is kept, so high-dimensional residency is
+    // paid for only when it is actually requested; shrinking keeps the
+    // current (larger) prefix.
+    rocrand_status update_direction_vectors()
+    {
+        if(m_vector_dimensions >= m_dimensions)
+            return ROCRAND_STATUS_SUCCESS;
+
+        const unsigned int * h_vectors =
+            rocrand_host::detail::sobol32_direction_vectors();
+
+        hipError_t error;
+        if(m_scrambled)
+        {
+            // The scramble matrix is folded into the direction vectors
+            // in place, so the scrambled variant needs a private copy
+            unsigned int * vectors;
+            error = rocrand_host::detail::device_malloc(&vectors, sizeof(unsigned int) * m_dimensions * 32);
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            error = hipMemcpy(vectors, h_vectors,
+                              sizeof(unsigned int) * m_dimensions * 32,
+                              hipMemcpyHostToDevice);
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::device_free(vectors);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            unsigned int * constants;
+            error = rocrand_host::detail::device_malloc(&constants, sizeof(unsigned int) * m_dimensions);
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::device_free(vectors);
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_direction_vectors, m_stream);
+            rocrand_host::detail::device_free(m_scramble_constants, m_stream);
+            m_direction_vectors = vectors;
+            m_scramble_constants = constants;
+            // The fresh vectors are pristine and must be folded again
+            m_scramble_initialized = false;
+        }
+        else
+        {
+            // Plain generators never modify the table, so all instances
+            // on a device with the same dimension count share one copy
+            unsigned int * vectors;
+            error = rocrand_host::detail::device_table_registry::acquire(
+                h_vectors, h_vectors,
+                sizeof(unsigned int) * m_dimensions * 32, &vectors
+            );
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_table_registry::release(m_direction_vectors, m_stream);
+            m_direction_vectors = vectors;
+        }
+        m_vector_dimensions = m_dimensions;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     bool m_initialized;
     unsigned int m_dimensions;
-    unsigned int m_current_offset;
+    unsigned int m_vector_dimensions;
+    // Generate-kernel block size from the tuning table
+    uint32_t m_threads;
+    rocrand_sobol_order m_order;
+    // Tracked in full 64 bits; the 32-bit Gray-code sequence has period
+    // 2^32 per dimension, so the position enters the kernels reduced
+    // modulo the period (exact, and an O(1) jump for the engine)
+    unsigned long long m_current_offset;
     unsigned int * m_direction_vectors;
+    bool m_scrambled;
+    bool m_scramble_initialized;
+    unsigned int * m_scramble_constants;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_binomial;
+
+    discrete_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_discrete;
 
     // m_offset from base_type
 
@@ -0,0 +1,814 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL64_H_
+#define ROCRAND_RNG_SOBOL64_H_
+
+#include <algorithm>
+#include <vector>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+#include <rocrand_sobol64.h>
+#include <rocrand_sobol_precomputed.h>
+
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+#include "sobol_scramble.hpp"
+// For sobol32_direction_vectors(); the 64-bit vectors are derived from
+// the (possibly file-mapped) 32-bit table
+#include "sobol32.hpp"
+#include "table_registry.hpp"
+#include "tuning.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    typedef ::rocrand_device::sobol64_engine<true> sobol64_device_engine;
+
+    // Maps the 64-bit Sobol output to the usual output types. The
+    // existing uniform_distribution functors keep the most significant
+    // bits of a 32-bit input, so their 64-bit equivalents keep the most
+    // significant bits here; double gets the full 64-bit precision.
+    template<class T>
+    struct sobol64_uniform_distribution
+    {
+        __forceinline__ __host__ __device__
+        T operator()(const unsigned long long v) const
+        {
+            return uniform_distribution<T>()(static_cast<unsigned int>(v >> 32));
+        }
+    };
+
+    template<>
+    struct sobol64_uniform_distribution<unsigned int>
+    {
+        __forceinline__ __host__ __device__
+        unsigned int operator()(const unsigned long long v) const
+        {
+            return static_cast<unsigned int>(v >> 32);
+        }
+    };
+
+    template<>
+    struct sobol64_uniform_distribution<unsigned long long>
+    {
+        __forceinline__ __host__ __device__
+        unsigned long long operator()(const unsigned long long v) const
+        {
+            return v;
+        }
+    };
+
+    template<>
+    struct sobol64_uniform_distribution<double>
+    {
+        __forceinline__ __host__ __device__
+        double operator()(const unsigned long long v) const
+        {
+            return uniform_distribution<double>()(v);
+        }
+    };
+
+    // Range version of sobol64_uniform_distribution (see
+    // uniform_range_distribution)
+    template<class T>
+    struct sobol64_uniform_range_distribution
+    {
+        const T low;
+        const T range;
+
+        __host__ __device__
+        sobol64_uniform_range_distribution(T low, T high) :
+            low(low), range(high - low) {}
+
+        __forceinline__ __host__ __device__
+        T operator()(const unsigned long long v) const
+        {
+            return low + sobol64_uniform_distribution<T>()(v) * range;
+        }
+    };
+
+    // 64-bit counterpart of exponential_distribution (see
+    // distribution/exponential.hpp)
+    template<class T>
+    struct sobol64_exponential_distribution
+    {
+        const T inv_lambda;
+
+        __host__ __device__
+        sobol64_exponential_distribution(T lambda) :
+            inv_lambda(static_cast<T>(1) / lambda) {}
+
+        __forceinline__ __host__ __device__
+        T operator()(const unsigned long long v) const
+        {
+            return -log(sobol64_uniform_distribution<T>()(v)) * inv_lambda;
+        }
+    };
+
+    // Adapts the 32-bit input distributions (normal, Poisson, ...) to
+    // the 64-bit Sobol output by keeping the most significant bits
+    template<class Distribution>
+    struct sobol64_msb_distribution
+    {
+        Distribution distribution;
+
+        sobol64_msb_distribution(Distribution distribution = Distribution())
+            : distribution(distribution) { }
+
+        __forceinline__ __host__ __device__
+        auto operator()(const unsigned long long v) const
+            -> decltype(distribution(static_cast<unsigned int>(0)))
+        {
+            return distribution(static_cast<unsigned int>(v >> 32));
+        }
+    };
+
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel_sobol64(Type * data, const size_t n,
+                                 const unsigned long long * direction_vectors,
+                                 const unsigned long long * scramble_constants,
+                                 const unsigned long long offset,
+                                 Distribution distribution)
+    {
+        const unsigned int dimension = hipBlockIdx_y;
+        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Each thread of the current block use the same direction vectors
+        // (the dimension is determined by hipBlockIdx_y)
+        __shared__ unsigned long long vectors[64];
+        if (hipThreadIdx_x < 64)
+        {
+            vectors[hipThreadIdx_x] = direction_vectors[dimension * 64 + hipThreadIdx_x];
+        }
+        __syncthreads();
+
+        sobol64_device_engine engine(vectors, offset + engine_id);
+
+        // Digital shift of the scrambled variant, zero when plain
+        const unsigned long long scramble =
+            scramble_constants != NULL ? scramble_constants[dimension] : 0;
+
+        const size_t start = dimension * n;
+        size_t index = engine_id;
+        while(index < n)
+        {
+            data[start + index] = distribution(engine.current() ^ scramble);
+            engine.discard_stride(stride);
+            index += stride;
+        }
+    }
+
+    // Point-major variant (ROCRAND_SOBOL_ORDER_INTERLEAVED): writes
+    // data[index * dimensions + dimension]. A block covers a tile of up
+    // to 32 consecutive dimensions (hipBlockIdx_y) times a strip of
+    // points; the lanes of a warp take consecutive dimensions of one
+    // point, so the point-major stores stay coalesced.
+    template<class Type, class Distribution>
+    __global__
+    void generate_kernel_sobol64_interleaved(Type * data, const size_t n,
+                                             const unsigned int dimensions,
+                                             const unsigned long long * direction_vectors,
+                                             const unsigned long long * scramble_constants,
+                                             const unsigned long long offset,
+                                             Distribution distribution)
+    {
+        constexpr unsigned int tile_dims = 32;
+        const unsigned int dim_base = hipBlockIdx_y * tile_dims;
+
+        // Stage the tile's direction vectors
+        __shared__ unsigned long long vectors[tile_dims * 64];
+        for(unsigned int i = hipThreadIdx_x; i < tile_dims * 64; i += hipBlockDim_x)
+        {
+            const unsigned int dim = dim_base + i / 64;
+            if(dim < dimensions)
+            {
+                vectors[i] = direction_vectors[dim * 64 + i % 64];
+            }
+        }
+        __syncthreads();
+
+        const unsigned int dimension = dim_base + hipThreadIdx_x % tile_dims;
+        if(dimension >= dimensions)
+            return;
+
+        // Point lanes leap-frog over the sequence like engine_id does
+        // in the dimension-major kernel; lanes * hipGridDim_x is a
+        // power of 2 as strided discard requires
+        const unsigned int lanes = hipBlockDim_x / tile_dims;
+        const unsigned int stride = hipGridDim_x * lanes;
+        size_t index = hipBlockIdx_x * lanes + hipThreadIdx_x / tile_dims;
+
+        sobol64_device_engine engine(
+            &vectors[(hipThreadIdx_x % tile_dims) * 64], offset + index);
+
+        // Digital shift of the scrambled variant, zero when plain
+        const unsigned long long scramble =
+            scramble_constants != NULL ? scramble_constants[dimension] : 0;
+
+        while(index < n)
+        {
+            data[index * dimensions + dimension] =
+                distribution(engine.current() ^ scramble);
+            engine.discard_stride(stride);
+            index += stride;
+        }
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_sobol64 : public rocrand_generator_type<ROCRAND_RNG_QUASI_SOBOL64>
+{
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_QUASI_SOBOL64>;
+    using engine_type = ::rocrand_host::detail::sobol64_device_engine;
+
+    rocrand_sobol64(unsigned long long offset = 0,
+                    hipStream_t stream = 0,
+                    bool scrambled = false)
+        : base_type(scrambled ? ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
+                              : ROCRAND_RNG_QUASI_SOBOL64,
+                    0, offset, stream),
+          m_initialized(false),
+          m_dimensions(1),
+          m_vector_dimensions(0),
+          m_order(ROCRAND_SOBOL_ORDER_DIMENSION),
+          m_direction_vectors(NULL),
+          m_scrambled(scrambled),
+          m_scramble_initialized(false),
+          m_scramble_constants(NULL)
+    {
+        // Direction vectors are derived and loaded lazily for the
+        // active dimensions only (see update_direction_vectors()), so
+        // construction does not touch the device
+        m_threads = rocrand_host::detail::tuning_for_device().sobol_threads;
+    }
+
+    ~rocrand_sobol64()
+    {
+        if(m_scrambled)
+        {
+            rocrand_host::detail::device_free(m_direction_vectors, m_stream);
+            rocrand_host::detail::device_free(m_scramble_constants, m_stream);
+        }
+        else
+        {
+            rocrand_host::detail::device_table_registry::release(m_direction_vectors, m_stream);
+        }
+    }
+
+    void reset()
+    {
+        m_initialized = false;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_initialized = false;
+    }
+
+    void set_dimensions(unsigned int dimensions)
+    {
+        m_dimensions = dimensions;
+        m_initialized = false;
+    }
+
+    void set_order(rocrand_sobol_order order)
+    {
+        m_order = order;
+        m_initialized = false;
+    }
+
+    rocrand_status init()
+    {
+        if (m_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        rocrand_status status = update_direction_vectors();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        if(m_scrambled && !m_scramble_initialized)
+        {
+            // Fold the random lower-triangular matrix into the direction
+            // vectors and draw the digital-shift constants, once per
+            // load of the vectors (both kernels derive every value from
+            // (dimension, seed) alone, so a prefix of the table is
+            // scrambled identically regardless of the resident size)
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::scramble_direction_vectors_kernel),
+                dim3((m_vector_dimensions * 64 + 255) / 256), dim3(256), 0, m_stream,
+                m_direction_vectors, m_vector_dimensions, m_seed
+            );
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::init_scramble_constants_kernel),
+                dim3((m_vector_dimensions + 255) / 256), dim3(256), 0, m_stream,
+                m_scramble_constants, m_vector_dimensions, m_seed
+            );
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            m_scramble_initialized = true;
+        }
+
+        m_current_offset = m_offset;
+        m_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T,
+             class Distribution = rocrand_host::detail::sobol64_uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        if (data_size % m_dimensions != 0)
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        // Per-architecture block size from the tuning table (see
+        // tuning.hpp), replacing the old compile-time platform fork
+        const uint32_t threads = m_threads;
+        const uint32_t max_blocks = 4096;
+
+        const size_t size = data_size / m_dimensions;
+
+        if(m_order == ROCRAND_SOBOL_ORDER_INTERLEAVED)
+        {
+            // A block covers 32 dimensions times (threads / 32) point
+            // lanes; blocks_x must be power of 2 because strided
+            // discard (leap frog) supports only power of 2 jumps
+            const uint32_t lanes = threads / 32;
+            const uint32_t blocks_x = next_power2(std::min(max_blocks,
+                static_cast<uint32_t>((size + lanes - 1) / lanes)));
+            const uint32_t blocks_y = (m_dimensions + 31) / 32;
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel_sobol64_interleaved),
+                dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+                data, size, m_dimensions,
+                static_cast<const unsigned long long*>(m_direction_vectors),
+                static_cast<const unsigned long long*>(m_scramble_constants),
+                m_current_offset,
+                distribution
+            );
+            // Check kernel status
+            if(hipPeekAtLastError() != hipSuccess)
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+            m_current_offset += size;
+
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const uint32_t blocks = std::min(max_blocks, static_cast<uint32_t>((size + threads - 1) / threads));
+
+        // blocks_x must be power of 2 because strided discard (leap frog)
+        // supports only power of 2 jumps
+        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+        const uint32_t blocks_y = m_dimensions;
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel_sobol64),
+            dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream,
+            data, size,
+            static_cast<const unsigned long long*>(m_direction_vectors),
+            static_cast<const unsigned long long*>(m_scramble_constants),
+            m_current_offset,
+            distribution
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        rocrand_host::detail::sobol64_uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        rocrand_host::detail::sobol64_uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        rocrand_host::detail::sobol64_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        rocrand_host::detail::sobol64_msb_distribution<cauchy_distribution<T> >
+            distribution((cauchy_distribution<T>(median, scale)));
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        rocrand_host::detail::sobol64_msb_distribution<weibull_distribution<T> >
+            distribution((weibull_distribution<T>(shape, scale)));
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        rocrand_host::detail::sobol64_msb_distribution<logistic_distribution<T> >
+            distribution((logistic_distribution<T>(location, scale)));
+        return generate(data, data_size, distribution);
+    }
+
+    // Normals come from the inverse CDF rather than Box-Muller (see
+    // sobol_normal_distribution), which preserves the low-discrepancy
+    // structure and the QMC convergence rate
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        rocrand_host::detail::sobol64_msb_distribution<sobol_normal_distribution<T> >
+            distribution((sobol_normal_distribution<T>(mean, stddev)));
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        rocrand_host::detail::sobol64_msb_distribution<sobol_log_normal_distribution<T> >
+            distribution((sobol_log_normal_distribution<T>(mean, stddev)));
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        rocrand_host::detail::sobol64_msb_distribution<decltype(m_poisson.dis)>
+            distribution(m_poisson.dis);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        rocrand_host::detail::sobol64_msb_distribution<decltype(m_binomial.dis)>
+            distribution(m_binomial.dis);
+        return generate(data, data_size, distribution);
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
+    {
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+        rocrand_host::detail::sobol64_msb_distribution<decltype(m_discrete.dis)>
+            distribution(m_discrete.dis);
+        return generate(data, data_size, distribution);
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+
+    // Each dimension occupies one contiguous segment of the full
+    // output buffer, so host-destination calls cannot be chunked
+    bool supports_chunked_host_generate() const override
+    {
+        return false;
+    }
+
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Native 64-bit output
+        return generate(data, n);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
+    }
+
+private:
+    // Registry key for the shared 64-bit table; a key distinct from
+    // h_sobol32_direction_vectors is needed because prefixes of the
+    // 32-bit and 64-bit tables can have equal byte sizes
+    static const void * table_key()
+    {
+        static const int tag = 0;
+        return &tag;
+    }
+
+    // Makes the direction vectors of the active dimensions resident on
+    // the device. Only a prefix of the table covering m_dimensions
+    // dimensions is derived and kept, so high-dimensional residency is
+    // paid for only when it is actually requested; shrinking keeps the
+    // current (larger) prefix.
+    rocrand_status update_direction_vectors()
+    {
+        if(m_vector_dimensions >= m_dimensions)
+            return ROCRAND_STATUS_SUCCESS;
+
+        // The 64-bit direction vectors are derived from the precomputed
+        // 32-bit table. For bit index j < 32 the Joe-Kuo direction
+        // numbers m_j have no bits below 2^(32-j), so the true 64-bit
+        // vectors are exactly the 32-bit vectors shifted up; the first
+        // 2^32 points per dimension match the full-precision sequence
+        // bit for bit. The remaining vectors (used past 2^32 points)
+        // continue with van der Corput values until the table is
+        // regenerated from Joe-Kuo data with
+        // tools/sobol_direction_vector_generator.
+        const unsigned int * h_vectors32 =
+            rocrand_host::detail::sobol32_direction_vectors();
+        std::vector<unsigned long long> h_vectors(size_t(m_dimensions) * 64);
+        for(unsigned int dim = 0; dim < m_dimensions; dim++)
+        {
+            for(unsigned int j = 0; j < 32; j++)
+            {
+                h_vectors[dim * 64 + j] =
+                    static_cast<unsigned long long>(
+                        h_vectors32[dim * 32 + j]) << 32;
+            }
+            for(unsigned int j = 32; j < 64; j++)
+            {
+                h_vectors[dim * 64 + j] = 1ULL << (63 - j);
+            }
+        }
+
+        hipError_t error;
+        if(m_scrambled)
+        {
+            // The scramble matrix is folded into the direction vectors
+            // in place, so the scrambled variant needs a private copy
+            unsigned long long * vectors;
+            error = rocrand_host::detail::device_malloc(&vectors, sizeof(unsigned long long) * m_dimensions * 64);
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            error = hipMemcpy(vectors, h_vectors.data(),
+                              sizeof(unsigned long long) * m_dimensions * 64,
+                              hipMemcpyHostToDevice);
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::device_free(vectors);
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            unsigned long long * constants;
+            error = rocrand_host::detail::device_malloc(&constants, sizeof(unsigned long long) * m_dimensions);
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::device_free(vectors);
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_free(m_direction_vectors, m_stream);
+            rocrand_host::detail::device_free(m_scramble_constants, m_stream);
+            m_direction_vectors = vectors;
+            m_scramble_constants = constants;
+            // The fresh vectors are pristine and must be folded again
+            m_scramble_initialized = false;
+        }
+        else
+        {
+            // Plain generators never modify the table, so all instances
+            // on a device with the same dimension count share one copy
+            // (the expansion above is deterministic)
+            unsigned long long * vectors;
+            error = rocrand_host::detail::device_table_registry::acquire(
+                table_key(), h_vectors.data(),
+                sizeof(unsigned long long) * m_dimensions * 64, &vectors
+            );
+            if(error != hipSuccess)
+            {
+                return ROCRAND_STATUS_ALLOCATION_FAILED;
+            }
+            rocrand_host::detail::device_table_registry::release(m_direction_vectors, m_stream);
+            m_direction_vectors = vectors;
+        }
+        m_vector_dimensions = m_dimensions;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    bool m_initialized;
+    unsigned int m_dimensions;
+    unsigned int m_vector_dimensions;
+    // Generate-kernel block size from the tuning table
+    uint32_t m_threads;
+    rocrand_sobol_order m_order;
+    unsigned long long m_current_offset;
+    unsigned long long * m_direction_vectors;
+    bool m_scrambled;
+    bool m_scramble_initialized;
+    unsigned long long * m_scramble_constants;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_binomial;
+
+    discrete_distribution_manager<ROCRAND_DISCRETE_METHOD_CDF> m_discrete;
+
+    // m_offset from base_type
+
+    size_t next_power2(size_t x)
+    {
+        size_t power = 1;
+        while (power < x)
+        {
+            power *= 2;
+        }
+        return power;
+    }
+};
+
+#endif // ROCRAND_RNG_SOBOL64_H_
@@ -0,0 +1,109 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SOBOL_SCRAMBLE_H_
+#define ROCRAND_RNG_SOBOL_SCRAMBLE_H_
+
+#include <hip/hip_runtime.h>
+
+// Linear matrix scrambling with a digital shift (J. Matousek, On the
+// L2-discrepancy for anchored boxes, 1998), the randomization used by
+// the scrambled Sobol generator variants. The random lower-triangular
+// matrix is folded into the direction vectors once at initialization,
+// so the per-point cost of scrambling is the single XOR of the
+// digital-shift constant.
+
+namespace rocrand_host {
+namespace detail {
+
+    // Finalizer of the splitmix64 generator; used to derive the
+    // deterministic per-dimension scramble values from the seed
+    __forceinline__ __device__ __host__
+    unsigned long long sobol_scramble_hash(unsigned long long x)
+    {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    __forceinline__ __device__
+    unsigned int sobol_parity(unsigned int x)
+    {
+        return __popc(x) & 1;
+    }
+
+    __forceinline__ __device__
+    unsigned int sobol_parity(unsigned long long x)
+    {
+        return __popcll(x) & 1;
+    }
+
+    // Multiplies every direction vector in place by a random
+    // lower-triangular bit matrix with unit diagonal. The matrix depends
+    // only on the vector's dimension, so all vectors of one dimension
+    // are transformed consistently; output bit r is the parity of
+    // (matrix row r & vector). One thread transforms one vector.
+    template<class T>
+    __global__
+    void scramble_direction_vectors_kernel(T * vectors,
+                                           const unsigned int dimensions,
+                                           const unsigned long long seed)
+    {
+        constexpr unsigned int bits = sizeof(T) * 8;
+
+        const unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(index >= dimensions * bits)
+            return;
+
+        const unsigned int dimension = index / bits;
+        const T v = vectors[index];
+        T result = 0;
+        for(unsigned int r = 0; r < bits; r++)
+        {
+            // Unit diagonal plus random bits below it
+            T row = static_cast<T>(
+                sobol_scramble_hash(seed + static_cast<unsigned long long>(dimension) * bits + r));
+            row = (row & ((static_cast<T>(1) << r) - 1)) | (static_cast<T>(1) << r);
+            result |= static_cast<T>(sobol_parity(static_cast<T>(row & v))) << r;
+        }
+        vectors[index] = result;
+    }
+
+    // Fills the per-dimension digital-shift constants, drawn from a
+    // hash stream disjoint from the matrix rows above
+    template<class T>
+    __global__
+    void init_scramble_constants_kernel(T * constants,
+                                        const unsigned int dimensions,
+                                        const unsigned long long seed)
+    {
+        const unsigned int dimension = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        if(dimension >= dimensions)
+            return;
+
+        constants[dimension] = static_cast<T>(
+            sobol_scramble_hash(seed + 0x8000000000000000ULL + dimension));
+    }
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_SOBOL_SCRAMBLE_H_
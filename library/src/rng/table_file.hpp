@@ -0,0 +1,210 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TABLE_FILE_H_
+#define ROCRAND_RNG_TABLE_FILE_H_
+
+#include <cstdlib>
+#include <cstring>
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace rocrand_host {
+namespace detail {
+
+    // Optional out-of-binary source for the precomputed constant tables.
+    //
+    // The ROCRAND_TABLE_FILE environment variable may point at a binary
+    // table file; when it does, the file is memory-mapped once per
+    // process and lookups resolve named tables against it, so the
+    // megabytes of header-embedded constants stay untouched on disk
+    // instead of being paged in with the library's data segment, and
+    // files carrying larger tables (e.g. more Sobol dimensions) take
+    // effect without recompiling. An absent or unusable file, and names
+    // the file does not carry, quietly fall back to the compiled-in
+    // tables.
+    //
+    // File layout (native endianness, unsigned little-endian fields on
+    // every supported platform):
+    //   bytes 0..7    magic "ROCRTBL\0"
+    //   bytes 8..11   format version (currently 1) as unsigned int
+    //   bytes 12..15  table count as unsigned int
+    //   table count directory entries of 64 bytes each:
+    //     bytes 0..47   zero-padded table name
+    //     bytes 48..55  payload offset from the start of the file
+    //     bytes 56..63  payload size in bytes
+    // Payloads follow the directory and must lie inside the file.
+    //
+    // tools/sobol_direction_vector_generator emits the Sobol direction
+    // vectors in this format when given a --table-file path.
+    class precomputed_table_file
+    {
+    public:
+        static const unsigned int format_version = 1;
+        static const size_t name_bytes = 48;
+
+        struct entry
+        {
+            char name[name_bytes];
+            unsigned long long offset;
+            unsigned long long bytes;
+        };
+
+        // Resolves the named table, or returns \p fallback when no
+        // usable file is mapped or the file has no such entry. When
+        // \p bytes is given it receives the size of whichever table is
+        // returned, so callers can take advantage of mapped tables
+        // larger than the compiled-in ones.
+        static const void * lookup(const char * name,
+                                   const void * fallback,
+                                   size_t fallback_bytes,
+                                   size_t * bytes = NULL)
+        {
+            const precomputed_table_file& file = instance();
+            const entry * e = file.find(name);
+            if(e == NULL)
+            {
+                if(bytes != NULL)
+                {
+                    *bytes = fallback_bytes;
+                }
+                return fallback;
+            }
+            if(bytes != NULL)
+            {
+                *bytes = static_cast<size_t>(e->bytes);
+            }
+            return file.m_base + e->offset;
+        }
+
+        // True when a table file is mapped (used by tests)
+        static bool mapped()
+        {
+            return instance().m_base != NULL;
+        }
+
+    private:
+        precomputed_table_file()
+            : m_base(NULL), m_file_bytes(0), m_entries(NULL), m_count(0)
+        {
+            #ifndef _WIN32
+            const char * path = std::getenv("ROCRAND_TABLE_FILE");
+            if(path == NULL || path[0] == '\0')
+            {
+                return;
+            }
+            const int fd = ::open(path, O_RDONLY);
+            if(fd < 0)
+            {
+                return;
+            }
+            struct stat st;
+            if(::fstat(fd, &st) != 0 || st.st_size < (off_t)header_bytes)
+            {
+                ::close(fd);
+                return;
+            }
+            const size_t file_bytes = static_cast<size_t>(st.st_size);
+            void * base = ::mmap(NULL, file_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+            // The mapping keeps its own reference to the file
+            ::close(fd);
+            if(base == MAP_FAILED)
+            {
+                return;
+            }
+            const char * bytes = static_cast<const char *>(base);
+            unsigned int version, count;
+            std::memcpy(&version, bytes + 8, sizeof(version));
+            std::memcpy(&count, bytes + 12, sizeof(count));
+            if(std::memcmp(bytes, "ROCRTBL\0", 8) != 0
+                || version != format_version
+                || count > (file_bytes - header_bytes) / sizeof(entry))
+            {
+                ::munmap(base, file_bytes);
+                return;
+            }
+            const entry * entries =
+                reinterpret_cast<const entry *>(bytes + header_bytes);
+            for(unsigned int i = 0; i < count; i++)
+            {
+                // Reject unterminated names and payloads outside the file
+                if(entries[i].name[name_bytes - 1] != '\0'
+                    || entries[i].offset > file_bytes
+                    || entries[i].bytes > file_bytes - entries[i].offset)
+                {
+                    ::munmap(base, file_bytes);
+                    return;
+                }
+            }
+            m_base = bytes;
+            m_file_bytes = file_bytes;
+            m_entries = entries;
+            m_count = count;
+            #endif
+        }
+
+        ~precomputed_table_file()
+        {
+            #ifndef _WIN32
+            if(m_base != NULL)
+            {
+                ::munmap(const_cast<char *>(m_base), m_file_bytes);
+            }
+            #endif
+        }
+
+        precomputed_table_file(const precomputed_table_file&) = delete;
+        precomputed_table_file& operator=(const precomputed_table_file&) = delete;
+
+        static precomputed_table_file& instance()
+        {
+            static precomputed_table_file file;
+            return file;
+        }
+
+        const entry * find(const char * name) const
+        {
+            for(unsigned int i = 0; i < m_count; i++)
+            {
+                if(std::strncmp(m_entries[i].name, name, name_bytes) == 0)
+                {
+                    return &m_entries[i];
+                }
+            }
+            return NULL;
+        }
+
+        static const size_t header_bytes = 16;
+
+        const char * m_base;
+        size_t m_file_bytes;
+        const entry * m_entries;
+        unsigned int m_count;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_TABLE_FILE_H_
@@ -0,0 +1,162 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TABLE_REGISTRY_H_
+#define ROCRAND_RNG_TABLE_REGISTRY_H_
+
+#include <mutex>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "device_memory.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    // Refcounted per-device registry of immutable device tables.
+    //
+    // Every Sobol generator needs a device copy of the same precomputed
+    // direction-vector table; with many generators per process the
+    // per-instance copies are redundant memory and upload time. The
+    // registry uploads a given table once per device and hands the same
+    // device pointer to every acquirer, so the second and later
+    // generators construct without touching the table at all.
+    //
+    // Shared tables are strictly read-only: generators which modify
+    // their tables in place (the scrambled Sobol variants fold the
+    // scramble matrix into the direction vectors) must keep private
+    // copies and stay away from the registry.
+    class device_table_registry
+    {
+    public:
+
+        // Returns in \p d_table a device copy of the \p bytes bytes at
+        // \p h_table for the current device, uploading it on first use
+        // and bumping a reference count afterwards. \p key must be an
+        // address that uniquely and stably identifies the table's
+        // contents process-wide - typically the host table itself;
+        // tables of different sizes may share a key.
+        static hipError_t acquire(const void * key,
+                                  const void * h_table,
+                                  size_t bytes,
+                                  void ** d_table)
+        {
+            device_table_registry& registry = instance();
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+
+            int device;
+            hipError_t error = hipGetDevice(&device);
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+
+            for(entry& e : registry.m_entries)
+            {
+                if(e.key == key && e.bytes == bytes && e.device == device)
+                {
+                    e.refs++;
+                    *d_table = e.d_table;
+                    return hipSuccess;
+                }
+            }
+
+            void * d_ptr;
+            error = rocrand_host::detail::device_malloc(&d_ptr, bytes);
+            if(error != hipSuccess)
+            {
+                return error;
+            }
+            error = hipMemcpy(d_ptr, h_table, bytes, hipMemcpyHostToDevice);
+            if(error != hipSuccess)
+            {
+                rocrand_host::detail::device_free(d_ptr);
+                return error;
+            }
+            registry.m_entries.push_back(entry { key, device, d_ptr, bytes, 1 });
+            *d_table = d_ptr;
+            return hipSuccess;
+        }
+
+        template<class T>
+        static hipError_t acquire(const void * key,
+                                  const T * h_table,
+                                  size_t bytes,
+                                  T ** d_table)
+        {
+            return acquire(key, static_cast<const void *>(h_table), bytes,
+                           reinterpret_cast<void **>(d_table));
+        }
+
+        // Drops one reference to \p d_table; the device copy is freed
+        // when the last generator using it is destroyed. \p stream is
+        // the releasing generator's stream, so kernels it queued before
+        // the release drain before the table's memory is recycled.
+        static void release(const void * d_table, hipStream_t stream = 0)
+        {
+            if(d_table == NULL)
+            {
+                return;
+            }
+            device_table_registry& registry = instance();
+            std::lock_guard<std::mutex> lock(registry.m_mutex);
+            for(size_t i = 0; i < registry.m_entries.size(); i++)
+            {
+                entry& e = registry.m_entries[i];
+                if(e.d_table == d_table)
+                {
+                    if(--e.refs == 0)
+                    {
+                        rocrand_host::detail::device_free(e.d_table, stream);
+                        registry.m_entries.erase(registry.m_entries.begin() + i);
+                    }
+                    return;
+                }
+            }
+        }
+
+    private:
+
+        struct entry
+        {
+            const void * key;
+            int device;
+            void * d_table;
+            size_t bytes;
+            unsigned int refs;
+        };
+
+        device_table_registry() { }
+
+        static device_table_registry& instance()
+        {
+            static device_table_registry registry;
+            return registry;
+        }
+
+        std::mutex m_mutex;
+        std::vector<entry> m_entries;
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_TABLE_REGISTRY_H_
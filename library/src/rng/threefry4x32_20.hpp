@@ -0,0 +1,1002 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_THREEFRY4X32_20_H_
+#define ROCRAND_RNG_THREEFRY4X32_20_H_
+
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+#include <rocrand_threefry4x32.h>
+
+#include "generator_type.hpp"
+#include "device_engines.hpp"
+#include "distributions.hpp"
+// ThreeFry shares the counter-based generate kernels with Philox
+// (they are templated on the device engine type)
+#include "philox4x32_10.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+    struct threefry4x32_20_device_engine : public ::rocrand_device::threefry4x32_20_engine
+    {
+        typedef ::rocrand_device::threefry4x32_20_engine base_type;
+        typedef base_type::threefry4x32_20_state state_type;
+
+        __forceinline__ __device__ __host__
+        threefry4x32_20_device_engine() { }
+
+        __forceinline__ __device__ __host__
+        threefry4x32_20_device_engine(const unsigned long long seed,
+                                      const unsigned long long subsequence,
+                                      const unsigned long long offset)
+            : base_type(seed, subsequence, offset)
+        {
+
+        }
+
+        __forceinline__ __device__ __host__
+        ~threefry4x32_20_device_engine () {}
+
+        __forceinline__ __device__ __host__
+        uint4 next4_leap(unsigned int leap)
+        {
+            uint4 ret = m_state.result;
+            this->discard_state(leap);
+            m_state.result = this->twenty_rounds(m_state.counter, m_state.key);
+            return ret;
+        }
+
+        // m_state from base class
+    };
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+class rocrand_threefry4x32_20 : public rocrand_generator_type<ROCRAND_RNG_PSEUDO_THREEFRY4_32_20>
+{
+    static constexpr unsigned int s_threads_per_engine = 16;
+
+public:
+    using base_type = rocrand_generator_type<ROCRAND_RNG_PSEUDO_THREEFRY4_32_20>;
+    using engine_type = ::rocrand_host::detail::threefry4x32_20_device_engine;
+
+    rocrand_threefry4x32_20(unsigned long long seed = 0,
+                            unsigned long long offset = 0,
+                            hipStream_t stream = 0)
+        : base_type(seed, offset, stream),
+          m_engines_initialized(false), m_engines(NULL),
+          m_side_offset(0)
+    {
+        // Size the grid for the device active at creation time
+        m_blocks = blocks_for_ordering(ROCRAND_ORDERING_PSEUDO_BEST);
+        m_engines_size = s_threads * m_blocks / s_threads_per_engine;
+
+        // Allocate device random number engines
+        auto error = rocrand_host::detail::device_malloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        if(error != hipSuccess)
+        {
+            throw ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+    }
+
+    ~rocrand_threefry4x32_20()
+    {
+        rocrand_host::detail::device_free(m_engines, m_stream);
+    }
+
+    void reset()
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        m_engines_initialized = false;
+    }
+
+    /// Switches the generator to the stream keyed by \p seed without
+    /// repositioning the engines (see rocrand_reseed()): a single
+    /// kernel swaps the Threefry key of every engine in place, so
+    /// per-shard reseed loops skip the full engine reinitialization
+    /// that set_seed() schedules.
+    rocrand_status reseed(unsigned long long seed)
+    {
+        m_seed = seed;
+        if(!m_engines_initialized)
+        {
+            // Nothing to re-key yet; init() picks up the new seed
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::rekey_engines_kernel),
+            dim3(m_blocks / s_threads_per_engine), dim3(s_threads), 0, m_stream,
+            m_engines, m_seed
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    void set_offset(unsigned long long offset)
+    {
+        m_offset = offset;
+        m_engines_initialized = false;
+    }
+
+    /// Selects the output ordering (see rocrand_set_ordering()).
+    /// ROCRAND_ORDERING_PSEUDO_LEGACY pins the engine grid to its
+    /// fixed device-independent size; ROCRAND_ORDERING_PSEUDO_BEST
+    /// (the default) sizes it for the present device.
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        const unsigned int blocks = blocks_for_ordering(ordering);
+        if(blocks == m_blocks)
+            return ROCRAND_STATUS_SUCCESS;
+
+        engine_type * engines;
+        auto error = rocrand_host::detail::device_malloc(
+            &engines, sizeof(engine_type) * (s_threads * blocks / s_threads_per_engine));
+        if(error != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_host::detail::device_free(m_engines, m_stream);
+        m_engines = engines;
+        m_blocks = blocks;
+        m_engines_size = s_threads * m_blocks / s_threads_per_engine;
+        m_engines_initialized = false;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
+            dim3(m_blocks/s_threads_per_engine), dim3(s_threads), 0, m_stream,
+            m_engines, m_seed, m_offset
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Returns the size in bytes of a buffer able to hold the complete
+    /// generator state (see save_state()).
+    size_t state_size() const
+    {
+        return sizeof(rocrand_host::detail::generator_state_header)
+            + sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Snapshots the generator state (host fields and the device engine
+    /// array) into \p buffer of at least state_size() bytes.
+    rocrand_status save_state(void * buffer)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::generator_state_header header;
+        header.version = rocrand_host::detail::generator_state_version;
+        header.rng_type = rng_type;
+        header.seed = m_seed;
+        header.offset = m_offset;
+        header.engine_bytes = sizeof(engine_type) * m_engines_size;
+
+        memcpy(buffer, &header, sizeof(header));
+        if(hipMemcpy(static_cast<char *>(buffer) + sizeof(header),
+                     m_engines, header.engine_bytes,
+                     hipMemcpyDeviceToHost) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Restores the generator state from a buffer written by save_state().
+    /// The buffer must come from a generator of the same type with the
+    /// same engine array size (i.e. the same device configuration).
+    rocrand_status load_state(const void * buffer)
+    {
+        rocrand_host::detail::generator_state_header header;
+        memcpy(&header, buffer, sizeof(header));
+        if(header.version != rocrand_host::detail::generator_state_version
+            || header.rng_type != rng_type
+            || header.engine_bytes != sizeof(engine_type) * m_engines_size)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_seed = header.seed;
+        m_offset = header.offset;
+        if(hipMemcpy(m_engines,
+                     static_cast<const char *>(buffer) + sizeof(header),
+                     header.engine_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            const Distribution& distribution = Distribution())
+    {
+        const bool init_engines = !m_engines_initialized;
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        // The in-kernel tail handling is compiled out when n is a multiple of 4
+        if((data_size & 3) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p data with \p bytes random bytes. Unlike generate(),
+    /// the destination may have any length and alignment; the bulk of
+    /// the buffer is still written with vectorized 32-bit stores.
+    rocrand_status generate_bytes(void * data, size_t bytes) override
+    {
+        const bool init_engines = !m_engines_initialized;
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size((bytes + 3) / 4);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_bytes_kernel<s_threads_per_engine>),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, static_cast<unsigned char *>(data), bytes,
+            m_seed, m_offset, init_engines
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T * data, size_t data_size)
+    {
+        uniform_distribution<T> udistribution;
+        return generate(data, data_size, udistribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    /// Fills \p data with \p data_size gamma distributed values with
+    /// the given \p shape and \p scale using Marsaglia-Tsang rejection
+    /// sampling. Each element draws from its own subsequence of a
+    /// re-keyed stream, as the variable number of rejections does not
+    /// fit the fixed draw mapping of the bulk kernels; the generator's
+    /// main stream is not advanced.
+    template<class T>
+    rocrand_status generate_gamma(T * data, size_t data_size, T shape, T scale)
+    {
+        if(shape <= static_cast<T>(0) || scale <= static_cast<T>(0))
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_gamma_kernel<engine_type>),
+            dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+            data, data_size,
+            // Re-keyed so the rejection draws never collide with the
+            // subsequences of the main stream's engines
+            m_seed ^ 0x9E3779B97F4A7C15ULL, m_side_offset,
+            shape, scale
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Reserve a counter region large enough that an element
+        // exhausting it (hundreds of consecutive rejections) is
+        // practically impossible
+        m_side_offset += 256;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p data with \p data_size Poisson distributed values
+    /// whose rates are taken per element from the device array
+    /// \p lambdas, in a single launch. Rates below 64 are drawn
+    /// exactly (Knuth), larger rates use the normal approximation.
+    /// Like generate_gamma(), draws come from a re-keyed side stream,
+    /// so the generator's main stream is not advanced.
+    rocrand_status generate_poisson_array(unsigned int * data, size_t data_size,
+                                          const double * lambdas)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_array_kernel<engine_type>),
+            dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+            data, data_size,
+            // Re-keyed so the per-element draws never collide with the
+            // subsequences of the main stream's engines
+            m_seed ^ 0x9E3779B97F4A7C15ULL, m_side_offset,
+            lambdas
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // Knuth consumes ~lambda draws per element; a 1024-word region
+        // outlasts the threshold rate by a comfortable margin
+        m_side_offset += 1024;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_permutation(unsigned int * data, size_t data_size)
+    {
+        if(data_size == 0)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        // The permutation values are 32-bit
+        if(data_size > (1ULL << 32))
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        // Smallest balanced Feistel domain covering data_size
+        unsigned int bits = 1;
+        while((1ULL << bits) < data_size)
+        {
+            bits++;
+        }
+        const unsigned int half_bits = (bits + 1) / 2;
+
+        // Keyed from the re-keyed side stream so successive calls
+        // produce independent permutations and never collide with the
+        // main stream's draws
+        const unsigned long long key =
+            (m_seed ^ 0x9E3779B97F4A7C15ULL) + m_side_offset;
+        m_side_offset += 16;
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_permutation_kernel),
+            dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+            data, data_size, key, half_bits
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p counts with \p num_draws multinomial count vectors of
+    /// \p trials trials over the categories weighted by the device
+    /// array \p weights (see
+    /// rocrand_philox4x32_10::generate_multinomial()), drawn from a
+    /// re-keyed side stream without advancing the main stream.
+    rocrand_status generate_multinomial(unsigned int * counts, size_t num_draws,
+                                        unsigned int trials,
+                                        const double * weights,
+                                        unsigned int num_weights)
+    {
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_multinomial_kernel<engine_type>),
+            dim3(blocks_for_size(num_draws)), dim3(s_threads), 0, m_stream,
+            counts, num_draws, trials, weights, num_weights,
+            // Re-keyed so the per-element draws never collide with the
+            // subsequences of the main stream's engines
+            m_seed ^ 0x9E3779B97F4A7C15ULL, m_side_offset
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        // BTRS needs a few draws per category and BINV at most ~10
+        // expected; a 4096-word region covers even very wide rows
+        m_side_offset += 4096;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Fills \p data with \p data_size values taken from absolute
+    /// position \p sequence_offset of the generator's logical stream
+    /// (see rocrand_philox4x32_10::generate_at()), without reading or
+    /// modifying the generator's device state.
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate_at(T * data, size_t data_size,
+                               unsigned long long sequence_offset,
+                               const Distribution& distribution = Distribution())
+    {
+        // The in-kernel tail handling is compiled out when n is a multiple of 4
+        if((data_size & 3) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine, false>),
+                dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+                static_cast<engine_type *>(NULL), data, data_size,
+                m_seed, m_offset + sequence_offset, true, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel<s_threads_per_engine, true>),
+                dim3(blocks_for_size(data_size)), dim3(s_threads), 0, m_stream,
+                static_cast<engine_type *>(NULL), data, data_size,
+                m_seed, m_offset + sequence_offset, true, distribution
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        normal_distribution<T> distribution(mean, stddev);
+
+        // The distribution stores float4 or double2 at once; the
+        // in-kernel tail handling is compiled out when n is a
+        // multiple of that width
+        const size_t x = 16 / sizeof(T);
+        if((data_size & (x - 1)) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
+    {
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        log_normal_distribution<T> distribution(mean, stddev);
+
+        // The distribution stores float4 or double2 at once; the
+        // in-kernel tail handling is compiled out when n is a
+        // multiple of that width
+        const size_t x = 16 / sizeof(T);
+        if((data_size & (x - 1)) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel<s_threads_per_engine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, distribution
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
+    {
+        try
+        {
+            m_poisson.set_lambda(lambda, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        // The in-kernel tail handling is compiled out when n is a multiple of 4
+        if((data_size & 3) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, m_poisson.dis
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, m_poisson.dis
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        // The in-kernel tail handling is compiled out when n is a multiple of 4
+        if((data_size & 3) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, m_binomial.dis
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, m_binomial.dis
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
+    {
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        const bool init_engines = !m_engines_initialized;
+        const uint32_t blocks =
+            init_engines ? m_blocks : blocks_for_size(data_size);
+
+        // The in-kernel tail handling is compiled out when n is a multiple of 4
+        if((data_size & 3) == 0)
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine, false>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, m_discrete.dis
+            );
+        }
+        else
+        {
+            hipLaunchKernelGGL(
+                HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel<s_threads_per_engine, true>),
+                dim3(blocks), dim3(s_threads), 0, m_stream,
+                m_engines, data, data_size, m_seed, m_offset, init_engines, m_discrete.dis
+            );
+        }
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its 128-bit vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_gamma_float(float * data, size_t n,
+                                        float shape, float scale) override
+    {
+        return generate_gamma(data, n, shape, scale);
+    }
+
+    rocrand_status generate_gamma_double(double * data, size_t n,
+                                         double shape, double scale) override
+    {
+        return generate_gamma(data, n, shape, scale);
+    }
+
+    rocrand_status generate_uniform_half(__half * data, size_t n) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        uniform_distribution<__half>());
+    }
+
+    rocrand_status generate_normal_half(__half * data, size_t n,
+                                        __half mean, __half stddev) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        normal_distribution<__half>(mean, stddev));
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_truncated_normal_float(float * data, size_t n,
+                                                   float mean, float stddev,
+                                                   float low, float high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<float>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_truncated_normal_double(double * data, size_t n,
+                                                    double mean, double stddev,
+                                                    double low, double high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<double>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_normal_double_fast(double * data, size_t n,
+                                               double mean, double stddev) override
+    {
+        return generate(data, n,
+                        fast_normal_distribution<double>(mean, stddev));
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
+    }
+
+    rocrand_status generate_poisson_array_uint(unsigned int * data, size_t n,
+                                               const double * lambdas) override
+    {
+        return generate_poisson_array(data, n, lambdas);
+    }
+
+    rocrand_status generate_permutation_uint(unsigned int * data,
+                                             size_t n) override
+    {
+        return generate_permutation(data, n);
+    }
+
+    rocrand_status generate_multinomial_uint(unsigned int * counts, size_t num_draws,
+                                             unsigned int trials,
+                                             const double * weights,
+                                             unsigned int num_weights) override
+    {
+        return generate_multinomial(counts, num_draws, trials, weights, num_weights);
+    }
+
+private:
+    // Engine grid size for the given ordering: the fixed
+    // device-independent default for LEGACY, the grid saturating the
+    // present device for BEST; always a multiple of s_threads_per_engine
+    // blocks because engines are shared by that many consecutive threads
+    unsigned int blocks_for_ordering(rocrand_ordering ordering) const
+    {
+        unsigned int blocks = s_blocks;
+        if(ordering == ROCRAND_ORDERING_PSEUDO_BEST)
+        {
+            blocks = rocrand_host::detail::max_active_blocks(
+                rocrand_host::detail::generate_kernel<
+                    s_threads_per_engine, false, engine_type,
+                    unsigned int, uniform_distribution<unsigned int>
+                >,
+                s_threads, s_blocks
+            );
+        }
+        return ((blocks + s_threads_per_engine - 1) / s_threads_per_engine)
+            * s_threads_per_engine;
+    }
+
+    // Returns a grid size just large enough to cover data_size without
+    // grid-stride iterations, capped at the full per-device grid.
+    // Small requests then load and store only a prefix of the engines,
+    // cutting fixed per-call cost.
+    uint32_t blocks_for_size(size_t data_size) const
+    {
+        const size_t elements_per_block = s_threads * 4;
+        size_t blocks = (data_size + elements_per_block - 1) / elements_per_block;
+        // Engines are shared by s_threads_per_engine consecutive threads
+        blocks = ((blocks + s_threads_per_engine - 1) / s_threads_per_engine)
+            * s_threads_per_engine;
+        return static_cast<uint32_t>(
+            std::min<size_t>(std::max<size_t>(blocks, s_threads_per_engine), m_blocks)
+        );
+    }
+
+    bool m_engines_initialized;
+    engine_type * m_engines;
+
+    // Counter region already consumed by the re-keyed side stream
+    // (generate_gamma(), generate_poisson_array())
+    unsigned long long m_side_offset;
+    size_t m_engines_size;
+    uint32_t m_blocks;
+
+    const static uint32_t s_threads = 256;
+    // Default grid size, used when the device can't be queried
+    const static uint32_t s_blocks = 1024;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager<> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<> m_binomial;
+
+    discrete_distribution_manager<> m_discrete;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+#endif // ROCRAND_RNG_THREEFRY4X32_20_H_
@@ -0,0 +1,97 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TRANSFORM_H_
+#define ROCRAND_RNG_TRANSFORM_H_
+
+#include <algorithm>
+
+#include <hip/hip_runtime.h>
+
+#include <rocrand.h>
+
+#include "distributions.hpp"
+
+namespace rocrand_host {
+namespace detail {
+
+// Applies a distribution functor to caller-provided raw 32-bit draws
+// (see rocrand_transform()): a single bandwidth-bound pass with uint4
+// loads and vector stores over the bulk, and a one-to-one scalar tail.
+// The double-output variants never take the tail: n is required to be
+// even there, so the uint4 groups (two doubles each) cover the input
+// exactly.
+template<class RealType, class Distribution>
+__global__
+void transform_kernel(const unsigned int * input, RealType * output,
+                      const size_t n, Distribution distribution)
+{
+    typedef decltype(distribution(uint4())) TypeX;
+    constexpr unsigned int x = sizeof(TypeX) / sizeof(RealType);
+
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+    size_t index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    const uint4 * input4 = reinterpret_cast<const uint4 *>(input);
+    TypeX * outputX = reinterpret_cast<TypeX *>(output);
+    const size_t groups = n / x;
+    while(index < groups)
+    {
+        outputX[index] = distribution(input4[index]);
+        index += stride;
+    }
+
+    const size_t tail = n - groups * x;
+    if(hipBlockIdx_x == 0 && hipThreadIdx_x < tail)
+    {
+        const size_t i = n - tail + hipThreadIdx_x;
+        output[i] = distribution(input[i]);
+    }
+}
+
+template<class RealType, class Distribution>
+rocrand_status transform_launch(const unsigned int * input, RealType * output,
+                                size_t n, Distribution distribution,
+                                hipStream_t stream)
+{
+    constexpr unsigned int x =
+        sizeof(decltype(distribution(uint4()))) / sizeof(RealType);
+    constexpr uint32_t threads = 256;
+    constexpr uint32_t max_blocks = 4096;
+    const size_t groups = n / x;
+    const uint32_t blocks = static_cast<uint32_t>(
+        std::min<size_t>((groups + threads - 1) / threads + 1, max_blocks));
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(transform_kernel),
+        dim3(blocks), dim3(threads), 0, stream,
+        input, output, n, distribution
+    );
+    // Check kernel status
+    if(hipPeekAtLastError() != hipSuccess)
+        return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_TRANSFORM_H_
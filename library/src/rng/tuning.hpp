@@ -0,0 +1,103 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_TUNING_H_
+#define ROCRAND_RNG_TUNING_H_
+
+#include <cstring>
+
+#include <hip/hip_runtime.h>
+
+namespace rocrand_host {
+namespace detail {
+
+// Best-known kernel configuration for one device architecture. The
+// generators query it once at creation and pick the matching compiled
+// instantiation, so each architecture runs its tuned configuration out
+// of the box. philox_threads_per_engine must be one of the values the
+// PHILOX generator instantiates its kernels for (8 or 16, see
+// philox4x32_10.hpp).
+struct device_tuning
+{
+    // Block size of the Sobol generate kernels
+    unsigned int sobol_threads;
+    // Consecutive threads sharing one PHILOX engine
+    unsigned int philox_threads_per_engine;
+};
+
+#if !defined(__HIP_PLATFORM_NVCC__)
+// Entries are matched by gcnArchName prefix; the first match wins, so
+// specific names go before family prefixes
+struct device_tuning_entry
+{
+    const char * arch;
+    device_tuning tuning;
+};
+
+static const device_tuning_entry device_tuning_table[] = {
+    { "gfx906", { 256, 16 } },
+    { "gfx908", { 256, 16 } },
+    { "gfx90a", { 256, 16 } },
+    // Wave32 RDNA parts: sharing an engine among 16 threads leaves
+    // half of each engine's leapfrog lanes outside the wavefront, so
+    // pair engines with 8 threads there
+    { "gfx10",  { 256, 8 } },
+    { "gfx11",  { 256, 8 } },
+};
+#endif
+
+// Returns the tuning for the device active at generator creation
+// time; unknown architectures (and failed property queries, e.g. in a
+// stream capture) get the historical defaults
+inline device_tuning tuning_for_device()
+{
+#if defined(__HIP_PLATFORM_NVCC__)
+    const device_tuning default_tuning = { 64, 16 };
+    return default_tuning;
+#else
+    const device_tuning default_tuning = { 256, 16 };
+
+    int device;
+    hipDeviceProp_t props;
+    if(hipGetDevice(&device) != hipSuccess
+        || hipGetDeviceProperties(&props, device) != hipSuccess)
+    {
+        return default_tuning;
+    }
+
+    const size_t entries =
+        sizeof(device_tuning_table) / sizeof(device_tuning_table[0]);
+    for(size_t i = 0; i < entries; i++)
+    {
+        const device_tuning_entry& entry = device_tuning_table[i];
+        if(std::strncmp(props.gcnArchName, entry.arch,
+                        std::strlen(entry.arch)) == 0)
+        {
+            return entry.tuning;
+        }
+    }
+    return default_tuning;
+#endif
+}
+
+} // end namespace detail
+} // end namespace rocrand_host
+
+#endif // ROCRAND_RNG_TUNING_H_
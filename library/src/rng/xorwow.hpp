@@ -26,7 +26,10 @@
 
 #include <rocrand.h>
 
+#include "common.hpp"
+#include "log.hpp"
 #include "generator_type.hpp"
+#include "engine_state_cache.hpp"
 #include "device_engines.hpp"
 #include "distributions.hpp"
 
@@ -35,71 +38,205 @@ namespace detail {
 
     typedef ::rocrand_device::xorwow_engine xorwow_device_engine;
 
+    // The host generator keeps the engine states in structure-of-arrays
+    // layout: word k of engine i lives at engine_words[k * stride + i],
+    // where the stride is the total engine count. A warp's loads of any
+    // one state word are then fully coalesced, while the array-of-structs
+    // layout spreads each engine over a 24-byte record and wastes
+    // bandwidth on memory-bound grids. The Box-Muller cache is compiled
+    // out of the engine here (see device_engines.hpp), so the whole
+    // state is the xorshift words and the Weyl value.
+    static_assert(sizeof(xorwow_device_engine) % sizeof(unsigned int) == 0,
+                  "xorwow engine state must be a whole number of words");
+
+    static const unsigned int xorwow_state_words =
+        sizeof(xorwow_device_engine) / sizeof(unsigned int);
+
+    __forceinline__ __device__ __host__
+    xorwow_device_engine xorwow_load_engine(const unsigned int * engine_words,
+                                            const unsigned int stride,
+                                            const unsigned int engine_id)
+    {
+        xorwow_device_engine engine;
+        unsigned int * words = reinterpret_cast<unsigned int *>(&engine);
+        for(unsigned int k = 0; k < xorwow_state_words; k++)
+        {
+            words[k] = engine_words[k * stride + engine_id];
+        }
+        return engine;
+    }
+
+    __forceinline__ __device__ __host__
+    void xorwow_store_engine(unsigned int * engine_words,
+                             const unsigned int stride,
+                             const unsigned int engine_id,
+                             const xorwow_device_engine& engine)
+    {
+        const unsigned int * words = reinterpret_cast<const unsigned int *>(&engine);
+        for(unsigned int k = 0; k < xorwow_state_words; k++)
+        {
+            engine_words[k * stride + engine_id] = words[k];
+        }
+    }
+
+    // ROCRAND_INIT_FAST replaces the subsequence skipahead that
+    // dominates generator startup with hash-based seeding (see
+    // xorwow_engine::seed_fast()); the generator offset does not
+    // apply in that mode
+    __forceinline__ __device__
+    xorwow_device_engine xorwow_create_engine(const unsigned long long seed,
+                                              const unsigned int engine_id,
+                                              const unsigned long long offset,
+                                              const bool fast_init)
+    {
+        if(fast_init)
+        {
+            xorwow_device_engine engine;
+            engine.seed_fast(seed, engine_id);
+            return engine;
+        }
+        return xorwow_device_engine(seed, engine_id, offset);
+    }
+
     __global__
-    void init_engines_kernel(xorwow_device_engine * engines,
+    void init_engines_kernel(unsigned int * engine_words,
+                             const unsigned int engine_stride,
                              unsigned long long seed,
-                             unsigned long long offset)
+                             unsigned long long offset,
+                             const bool fast_init)
     {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        engines[engine_id] = xorwow_device_engine(seed, engine_id, offset);
+        xorwow_store_engine(engine_words, engine_stride, engine_id,
+                            xorwow_create_engine(seed, engine_id, offset, fast_init));
     }
 
-    template<class Type, class Distribution>
+    // Moves every engine subsequence_base subsequences forward (see
+    // rocrand_set_subsequence()); the per-engine skipahead is O(1)
     __global__
-    void generate_kernel(xorwow_device_engine * engines,
-                         Type * data, const size_t n,
-                         const Distribution distribution)
+    void skip_subsequences_kernel(unsigned int * engine_words,
+                                  const unsigned int engine_stride,
+                                  const unsigned long long subsequence_base)
     {
         const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int index = engine_id;
-        unsigned int stride = hipGridDim_x * hipBlockDim_x;
-
-        xorwow_device_engine engine = engines[engine_id];
-
-        while(index < n)
-        {
-            data[index] = distribution(engine());
-            index += stride;
-        }
-
-        engines[engine_id] = engine;
+        xorwow_device_engine engine =
+            xorwow_load_engine(engine_words, engine_stride, engine_id);
+        engine.discard_subsequence(subsequence_base);
+        xorwow_store_engine(engine_words, engine_stride, engine_id, engine);
     }
 
-    template<class Distribution>
+    template<class Type, class Distribution>
     __global__
-    void generate_kernel(xorwow_device_engine * engines,
-                         double * data, const size_t n,
+    void generate_kernel(unsigned int * engine_words,
+                         const unsigned int engine_offset,
+                         const unsigned int engine_stride,
+                         Type * data, const size_t n,
+                         const unsigned long long seed,
+                         const unsigned long long offset,
+                         const bool init_engines,
+                         const bool fast_init,
                          const Distribution distribution)
     {
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int index = engine_id;
+        // TypeX can be uint4, float4 or double2
+        typedef decltype(distribution(uint4())) TypeX;
+        typedef typename unaligned_type<TypeX>::type TypeX_unaligned;
+        // x can be 2 or 4
+        const unsigned int x = sizeof(TypeX) / sizeof(Type);
+
+        const unsigned int engine_id =
+            engine_offset + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        xorwow_device_engine engine = engines[engine_id];
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        xorwow_device_engine engine;
+        if(init_engines)
+        {
+            engine = xorwow_create_engine(seed, engine_id, offset, fast_init);
+        }
+        else
+        {
+            engine = xorwow_load_engine(engine_words, engine_stride, engine_id);
+        }
 
-        while(index < n)
+        // A 128-bit store needs fewer memory transactions than x scalar
+        // stores; destinations that miss the vector type's alignment
+        // take the unaligned fallback
+        if(((uintptr_t)data)%(sizeof(TypeX)) == 0)
         {
-            data[index] = distribution(engine(), engine());
-            index += stride;
+            TypeX * dataX = (TypeX *)data;
+            while(index < (n/x))
+            {
+                dataX[index] = distribution(
+                    uint4 { engine(), engine(), engine(), engine() }
+                );
+                // Next position
+                index += stride;
+            }
+        }
+        else
+        {
+            TypeX_unaligned * dataX = (TypeX_unaligned *)data;
+            while(index < (n/x))
+            {
+                TypeX result = distribution(
+                    uint4 { engine(), engine(), engine(), engine() }
+                );
+                dataX[index] = *(TypeX_unaligned*)(&result);  // reinterpret as TypeX_unaligned
+                // Next position
+                index += stride;
+            }
         }
 
-        engines[engine_id] = engine;
+        // Check if we need to save tail (last 1,..,(x-1) random number).
+        // Those numbers should be generated by the thread that would
+        // save the next TypeX if n was equal n+(x-1) (index < (n/x) would
+        // be true in such situation).
+        auto tail_size = n & (x - 1);
+        if((index == n/x) && tail_size > 0)
+        {
+            TypeX result = distribution(
+                uint4 { engine(), engine(), engine(), engine() }
+            );
+            // Save the tail
+            data[n - tail_size] = (&result.x)[0]; // .x
+            if(tail_size > 1) data[n - tail_size + 1] = (&result.x)[1]; // .y
+            if(tail_size > 2) data[n - tail_size + 2] = (&result.x)[2]; // .z
+        }
+
+        xorwow_store_engine(engine_words, engine_stride, engine_id, engine);
     }
 
     template<class Distribution>
     __global__
-    void generate_normal_kernel(xorwow_device_engine * engines,
+    void generate_normal_kernel(unsigned int * engine_words,
+                                const unsigned int engine_offset,
+                                const unsigned int engine_stride,
                                 float * data, const size_t n,
+                                const unsigned long long seed,
+                                const unsigned long long offset,
+                                const bool init_engines,
+                                const bool fast_init,
                                 Distribution distribution)
     {
-        typedef decltype(distribution(engines->next(), engines->next())) RealType2;
+        typedef decltype(distribution(0u, 0u)) RealType2;
 
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int index = engine_id;
+        const unsigned int engine_id =
+            engine_offset + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        // Load device engine
-        xorwow_device_engine engine = engines[engine_id];
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        xorwow_device_engine engine;
+        if(init_engines)
+        {
+            engine = xorwow_create_engine(seed, engine_id, offset, fast_init);
+        }
+        else
+        {
+            engine = xorwow_load_engine(engine_words, engine_stride, engine_id);
+        }
 
         RealType2 * data2 = (RealType2 *)data;
         while(index < (n / 2))
@@ -110,7 +247,7 @@ namespace detail {
         }
 
         // First work-item saves the tail when n is not a multiple of 2
-        if(engine_id == 0 && (n & 1) > 0)
+        if(hipBlockIdx_x == 0 && hipThreadIdx_x == 0 && (n & 1) > 0)
         {
             RealType2 result = distribution(engine(), engine());
             // Save the tail
@@ -118,24 +255,40 @@ namespace detail {
         }
 
         // Save engine with its state
-        engines[engine_id] = engine;
+        xorwow_store_engine(engine_words, engine_stride, engine_id, engine);
     }
 
     // TODO: combine with generate_normal_kernel<float> after refactoring of distributions
     template<class Distribution>
     __global__
-    void generate_normal_kernel(xorwow_device_engine * engines,
+    void generate_normal_kernel(unsigned int * engine_words,
+                                const unsigned int engine_offset,
+                                const unsigned int engine_stride,
                                 double * data, const size_t n,
+                                const unsigned long long seed,
+                                const unsigned long long offset,
+                                const bool init_engines,
+                                const bool fast_init,
                                 Distribution distribution)
     {
         typedef decltype(distribution(uint4())) RealType2;
 
-        const unsigned int engine_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
-        unsigned int index = engine_id;
+        const unsigned int engine_id =
+            engine_offset + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
         unsigned int stride = hipGridDim_x * hipBlockDim_x;
 
-        // Load device engine
-        xorwow_device_engine engine = engines[engine_id];
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        xorwow_device_engine engine;
+        if(init_engines)
+        {
+            engine = xorwow_create_engine(seed, engine_id, offset, fast_init);
+        }
+        else
+        {
+            engine = xorwow_load_engine(engine_words, engine_stride, engine_id);
+        }
 
         RealType2 * data2 = (RealType2 *)data;
         while(index < (n / 2))
@@ -148,7 +301,7 @@ namespace detail {
         }
 
         // First work-item saves the tail when n is not a multiple of 2
-        if(engine_id == 0 && (n & 1) > 0)
+        if(hipBlockIdx_x == 0 && hipThreadIdx_x == 0 && (n & 1) > 0)
         {
             RealType2 result = distribution(
                 uint4 { engine(), engine(), engine(), engine() }
@@ -158,7 +311,82 @@ namespace detail {
         }
 
         // Save engine with its state
-        engines[engine_id] = engine;
+        xorwow_store_engine(engine_words, engine_stride, engine_id, engine);
+    }
+
+
+    template<class Distribution>
+    __global__
+    void generate_poisson_kernel(unsigned int * engine_words,
+                                 const unsigned int engine_offset,
+                                 const unsigned int engine_stride,
+                                 unsigned int * data, const size_t n,
+                                 const unsigned long long seed,
+                                 const unsigned long long offset,
+                                 const bool init_engines,
+                                 const bool fast_init,
+                                 const Distribution distribution)
+    {
+        const unsigned int engine_id =
+            engine_offset + hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int index = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+        unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+        // Load or initialize device engine, so a reseeded generator
+        // produces output without a separate initialization launch
+        xorwow_device_engine engine;
+        if(init_engines)
+        {
+            engine = xorwow_create_engine(seed, engine_id, offset, fast_init);
+        }
+        else
+        {
+            engine = xorwow_load_engine(engine_words, engine_stride, engine_id);
+        }
+
+        // The discrete distribution is applied lane by lane, but results
+        // are still written back with 128-bit stores
+        if(((uintptr_t)data)%(sizeof(uint4)) == 0)
+        {
+            uint4 * data4 = (uint4 *)data;
+            while(index < (n/4))
+            {
+                data4[index] = uint4 {
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine())
+                };
+                // Next position
+                index += stride;
+            }
+        }
+        else
+        {
+            uint4_unaligned * data4 = (uint4_unaligned *)data;
+            while(index < (n/4))
+            {
+                data4[index] = uint4_unaligned {
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine()),
+                    distribution(engine())
+                };
+                // Next position
+                index += stride;
+            }
+        }
+
+        // Check if we need to save tail (last 1,2,3 random number)
+        auto tail_size = n & 3;
+        if((index == n/4) && tail_size > 0)
+        {
+            data[n - tail_size] = distribution(engine());
+            if(tail_size > 1) data[n - tail_size + 1] = distribution(engine());
+            if(tail_size > 2) data[n - tail_size + 2] = distribution(engine());
+        }
+
+        xorwow_store_engine(engine_words, engine_stride, engine_id, engine);
     }
 
 } // end namespace detail
@@ -174,10 +402,17 @@ public:
                    unsigned long long offset = 0,
                    hipStream_t stream = 0)
         : base_type(seed, offset, stream),
-          m_engines_initialized(false), m_engines(NULL), m_engines_size(s_threads * s_blocks)
+          m_engines_initialized(false), m_engines(NULL),
+          m_subsequence_base(0),
+          m_initialization(ROCRAND_INIT_DEFAULT),
+          m_pool_size(0), m_active_partition(0), m_pool_event_created(false)
     {
+        // Size the grid for the device active at creation time
+        m_blocks = blocks_for_ordering(ROCRAND_ORDERING_PSEUDO_BEST);
+        m_engines_size = s_threads * m_blocks;
+
         // Allocate device random number engines
-        auto error = hipMalloc(&m_engines, sizeof(engine_type) * m_engines_size);
+        auto error = rocrand_host::detail::device_malloc(&m_engines, sizeof(engine_type) * m_engines_size);
         if(error != hipSuccess)
         {
             throw ROCRAND_STATUS_ALLOCATION_FAILED;
@@ -186,19 +421,167 @@ public:
 
     ~rocrand_xorwow()
     {
-        hipFree(m_engines);
+        if(m_pool_event_created)
+        {
+            hipEventDestroy(m_pool_init_done);
+        }
+        rocrand_host::detail::device_free(m_engines, m_stream);
+    }
+
+    /// Sets the stream; in pool mode selects the engine partition
+    /// bound to \p stream instead (see rocrand_set_stream_pool()),
+    /// and a stream outside the pool leaves pool mode.
+    void set_stream(hipStream_t stream)
+    {
+        if(m_pool_size > 0)
+        {
+            for(unsigned int i = 0; i < m_pool_size; i++)
+            {
+                if(m_pool_streams[i] == stream)
+                {
+                    m_active_partition = i;
+                    base_type::set_stream(stream);
+                    return;
+                }
+            }
+            m_pool_size = 0;
+        }
+        base_type::set_stream(stream);
+    }
+
+    /// Binds \p count user streams to disjoint partitions of the
+    /// engine array (see rocrand_set_stream_pool()); a zero count
+    /// disables pool mode. Fails when the engine grid cannot give
+    /// every stream at least one block.
+    rocrand_status set_stream_pool(const hipStream_t * streams,
+                                   unsigned int count)
+    {
+        if(count == 0)
+        {
+            m_pool_size = 0;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        if(count > s_max_pool_streams || count > m_blocks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        if(!m_pool_event_created)
+        {
+            if(hipEventCreateWithFlags(&m_pool_init_done,
+                                       hipEventDisableTiming) != hipSuccess)
+            {
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+            }
+            m_pool_event_created = true;
+        }
+        for(unsigned int i = 0; i < count; i++)
+        {
+            m_pool_streams[i] = streams[i];
+        }
+        m_pool_size = count;
+        m_active_partition = 0;
+        base_type::set_stream(streams[0]);
+        return ROCRAND_STATUS_SUCCESS;
     }
 
     /// Changes seed to \p seed and resets generator state.
     void set_seed(unsigned long long seed)
     {
         m_seed = seed;
+        m_subsequence_base = 0;
         m_engines_initialized = false;
     }
 
     void set_offset(unsigned long long offset)
     {
         m_offset = offset;
+        m_subsequence_base = 0;
+        m_engines_initialized = false;
+    }
+
+    /// Positions the engines into partition \p rank of \p num_ranks
+    /// disjoint partitions of the subsequence space (see
+    /// rocrand_set_subsequence()). The partition base is applied with
+    /// one O(1)-per-engine skipahead launch on top of the ordinary
+    /// initialization; changing the seed, offset, ordering or
+    /// initialization mode resets the generator to the full sequence.
+    rocrand_status set_subsequence(unsigned int rank, unsigned int num_ranks)
+    {
+        if(num_ranks == 0 || rank >= num_ranks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        // Slice the 2^64 subsequence index space evenly: engine i of
+        // rank r sits at subsequence r * stride + i, so partitions
+        // stay disjoint for any per-device engine count below the
+        // stride
+        m_subsequence_base = (~0ULL / num_ranks) * rank;
+        m_engines_initialized = false;
+        if(m_subsequence_base == 0)
+        {
+            // Rank 0 owns the start of the sequence, which is what
+            // ordinary (lazy) initialization produces anyway
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::skip_subsequences_kernel),
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size),
+            m_subsequence_base
+        );
+        if(hipPeekAtLastError() != hipSuccess)
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Selects the output ordering (see rocrand_set_ordering()).
+    /// ROCRAND_ORDERING_PSEUDO_LEGACY pins the engine grid to its
+    /// fixed device-independent size; ROCRAND_ORDERING_PSEUDO_BEST
+    /// (the default) sizes it for the present device.
+    rocrand_status set_ordering(rocrand_ordering ordering)
+    {
+        const unsigned int blocks = blocks_for_ordering(ordering);
+        if(blocks == m_blocks)
+            return ROCRAND_STATUS_SUCCESS;
+
+        unsigned int * engines;
+        auto error = rocrand_host::detail::device_malloc(
+            &engines, sizeof(engine_type) * (s_threads * blocks));
+        if(error != hipSuccess)
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        rocrand_host::detail::device_free(m_engines, m_stream);
+        m_engines = engines;
+        m_blocks = blocks;
+        m_engines_size = s_threads * m_blocks;
+        m_subsequence_base = 0;
+        m_engines_initialized = false;
+        // The resized grid may no longer cover every pool partition
+        if(m_pool_size > m_blocks)
+        {
+            m_pool_size = 0;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Selects the engine initialization mode (see
+    /// rocrand_set_initialization()). ROCRAND_INIT_FAST hashes the
+    /// engine states from the seed and the engine id instead of
+    /// running the subsequence skipahead, which makes (re)seeding
+    /// near-instant but drops the contiguous-stream positioning, so
+    /// the generator offset is ignored.
+    void set_initialization(rocrand_initialization initialization)
+    {
+        if(initialization == m_initialization)
+            return;
+        m_initialization = initialization;
+        m_subsequence_base = 0;
         m_engines_initialized = false;
     }
 
@@ -207,37 +590,146 @@ public:
         if (m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
 
+        const bool fast_init = (m_initialization == ROCRAND_INIT_FAST);
+        const auto key = rocrand_host::detail::engine_state_key(
+            ROCRAND_RNG_PSEUDO_XORWOW, m_seed, m_offset,
+            sizeof(engine_type) * m_engines_size
+        );
+        // Hash-based initialization is cheaper than restoring a
+        // cached state, so the cache is only used for the default mode
+        if(!fast_init
+            && rocrand_host::detail::engine_state_cache::lookup(key, m_engines, m_stream))
+        {
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_host::detail::op_logger log(
+            "init_engines_kernel", m_engines_size, m_blocks, s_threads, m_stream);
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::init_engines_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, m_seed, m_offset
+            dim3(m_blocks), dim3(s_threads), 0, m_stream,
+            m_engines, static_cast<unsigned int>(m_engines_size),
+            m_seed, m_offset, fast_init
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        // Retain a pristine copy so generators recreated with the same
+        // seed and offset skip the skipahead-heavy initialization
+        if(!fast_init)
+        {
+            rocrand_host::detail::engine_state_cache::insert(key, m_engines, m_stream);
+        }
+
         m_engines_initialized = true;
 
         return ROCRAND_STATUS_SUCCESS;
     }
 
+
+    /// Returns the size in bytes of a buffer able to hold the complete
+    /// generator state (see save_state()).
+    size_t state_size() const
+    {
+        return sizeof(rocrand_host::detail::generator_state_header)
+            + sizeof(engine_type) * m_engines_size;
+    }
+
+    /// Snapshots the generator state (host fields and the device engine
+    /// array) into \p buffer of at least state_size() bytes.
+    rocrand_status save_state(void * buffer)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return status;
+
+        rocrand_host::detail::generator_state_header header;
+        header.version = rocrand_host::detail::generator_state_version;
+        header.rng_type = rng_type;
+        header.seed = m_seed;
+        header.offset = m_offset;
+        header.engine_bytes = sizeof(engine_type) * m_engines_size;
+
+        memcpy(buffer, &header, sizeof(header));
+        if(hipMemcpy(static_cast<char *>(buffer) + sizeof(header),
+                     m_engines, header.engine_bytes,
+                     hipMemcpyDeviceToHost) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Restores the generator state from a buffer written by save_state().
+    /// The buffer must come from a generator of the same type with the
+    /// same engine array size (i.e. the same device configuration).
+    rocrand_status load_state(const void * buffer)
+    {
+        rocrand_host::detail::generator_state_header header;
+        memcpy(&header, buffer, sizeof(header));
+        if(header.version != rocrand_host::detail::generator_state_version
+            || header.rng_type != rng_type
+            || header.engine_bytes != sizeof(engine_type) * m_engines_size)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_seed = header.seed;
+        m_offset = header.offset;
+        if(hipMemcpy(m_engines,
+                     static_cast<const char *>(buffer) + sizeof(header),
+                     header.engine_bytes,
+                     hipMemcpyHostToDevice) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     template<class T, class Distribution = uniform_distribution<T> >
     rocrand_status generate(T * data, size_t data_size,
                             const Distribution& distribution = Distribution())
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        if(!m_engines_initialized && m_initialization != ROCRAND_INIT_FAST
+            && m_pool_size == 0)
+        {
+            // A cached pristine state is cheaper than in-kernel init
+            const auto key = rocrand_host::detail::engine_state_key(
+                ROCRAND_RNG_PSEUDO_XORWOW, m_seed, m_offset,
+                sizeof(engine_type) * m_engines_size
+            );
+            if(rocrand_host::detail::engine_state_cache::lookup(key, m_engines, m_stream))
+                m_engines_initialized = true;
+        }
+
+        unsigned int engine_offset = 0;
+        uint32_t grid_limit = m_blocks;
+        if(m_pool_size > 0)
+        {
+            const rocrand_status status = pool_partition(engine_offset, grid_limit);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        const bool init_engines = !m_engines_initialized;
+        const bool fast_init = (m_initialization == ROCRAND_INIT_FAST);
+        // Initialization covers all engines, so it needs the full grid
+        const uint32_t blocks = init_engines
+            ? grid_limit
+            : std::min<uint32_t>(blocks_for_size(data_size), grid_limit);
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, engine_offset, static_cast<unsigned int>(m_engines_size),
+            data, data_size, m_seed, m_offset, init_engines, fast_init, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
 
@@ -248,6 +740,56 @@ public:
         return generate(data, data_size, udistribution);
     }
 
+    /// Applies the device-callable \p op to every generated value
+    /// inside the generation kernel, fusing generate-then-transform
+    /// pipelines into one pass over memory. For floating-point types
+    /// \p op receives uniform values from (0; 1] (e.g.
+    /// <tt>op(u) = -logf(u)</tt> yields exponentials); for
+    /// <tt>unsigned int</tt> it receives the raw engine output.
+    /// \p op must map T to T.
+    template<class T, class UnaryOp>
+    rocrand_status generate_transform(T * data, size_t data_size, UnaryOp op)
+    {
+        transformed_distribution<T, UnaryOp> distribution(op);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_range(T * data, size_t data_size,
+                                          T low, T high)
+    {
+        uniform_range_distribution<T> distribution(low, high);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T * data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_cauchy(T * data, size_t data_size, T median, T scale)
+    {
+        cauchy_distribution<T> distribution(median, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_weibull(T * data, size_t data_size, T shape, T scale)
+    {
+        weibull_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_logistic(T * data, size_t data_size, T location, T scale)
+    {
+        logistic_distribution<T> distribution(location, scale);
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_normal(T * data, size_t data_size, T mean, T stddev)
     {
@@ -258,21 +800,33 @@ public:
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
         }
 
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        unsigned int engine_offset = 0;
+        uint32_t grid_limit = m_blocks;
+        if(m_pool_size > 0)
+        {
+            const rocrand_status status = pool_partition(engine_offset, grid_limit);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        const bool init_engines = !m_engines_initialized;
+        const bool fast_init = (m_initialization == ROCRAND_INIT_FAST);
+        const uint32_t blocks = init_engines
+            ? grid_limit
+            : std::min<uint32_t>(blocks_for_size(data_size), grid_limit);
 
         normal_distribution<T> distribution(mean, stddev);
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, engine_offset, static_cast<unsigned int>(m_engines_size),
+            data, data_size, m_seed, m_offset, init_engines, fast_init, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
 
@@ -286,21 +840,33 @@ public:
             return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
         }
 
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
-            return status;
+        unsigned int engine_offset = 0;
+        uint32_t grid_limit = m_blocks;
+        if(m_pool_size > 0)
+        {
+            const rocrand_status status = pool_partition(engine_offset, grid_limit);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        const bool init_engines = !m_engines_initialized;
+        const bool fast_init = (m_initialization == ROCRAND_INIT_FAST);
+        const uint32_t blocks = init_engines
+            ? grid_limit
+            : std::min<uint32_t>(blocks_for_size(data_size), grid_limit);
 
         log_normal_distribution<T> distribution(mean, stddev);
 
         hipLaunchKernelGGL(
             HIP_KERNEL_NAME(rocrand_host::detail::generate_normal_kernel),
-            dim3(s_blocks), dim3(s_threads), 0, m_stream,
-            m_engines, data, data_size, distribution
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, engine_offset, static_cast<unsigned int>(m_engines_size),
+            data, data_size, m_seed, m_offset, init_engines, fast_init, distribution
         );
         // Check kernel status
         if(hipPeekAtLastError() != hipSuccess)
             return ROCRAND_STATUS_LAUNCH_FAILURE;
 
+        m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
 
@@ -308,19 +874,393 @@ public:
     {
         try
         {
-            m_poisson.set_lambda(lambda);
+            m_poisson.set_lambda(lambda, m_stream);
         }
         catch(rocrand_status status)
         {
             return status;
         }
-        return generate(data, data_size, m_poisson.dis);
+
+        unsigned int engine_offset = 0;
+        uint32_t grid_limit = m_blocks;
+        if(m_pool_size > 0)
+        {
+            const rocrand_status status = pool_partition(engine_offset, grid_limit);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        const bool init_engines = !m_engines_initialized;
+        const bool fast_init = (m_initialization == ROCRAND_INIT_FAST);
+        const uint32_t blocks = init_engines
+            ? grid_limit
+            : std::min<uint32_t>(blocks_for_size(data_size), grid_limit);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, engine_offset, static_cast<unsigned int>(m_engines_size),
+            data, data_size, m_seed, m_offset, init_engines, fast_init, m_poisson.dis
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate_binomial(unsigned int * data, size_t data_size,
+                                     unsigned int trials, double p)
+    {
+        try
+        {
+            m_binomial.set_params(trials, p);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        unsigned int engine_offset = 0;
+        uint32_t grid_limit = m_blocks;
+        if(m_pool_size > 0)
+        {
+            const rocrand_status status = pool_partition(engine_offset, grid_limit);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        const bool init_engines = !m_engines_initialized;
+        const bool fast_init = (m_initialization == ROCRAND_INIT_FAST);
+        const uint32_t blocks = init_engines
+            ? grid_limit
+            : std::min<uint32_t>(blocks_for_size(data_size), grid_limit);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, engine_offset, static_cast<unsigned int>(m_engines_size),
+            data, data_size, m_seed, m_offset, init_engines, fast_init, m_binomial.dis
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // Samples indices from the categorical distribution defined by
+    // weights; the table is cached by m_discrete (see
+    // rocrand_sample_discrete())
+    rocrand_status generate_discrete(unsigned int * data, size_t data_size,
+                                     const double * weights, unsigned int num_weights)
+    {
+        try
+        {
+            m_discrete.set_weights(weights, num_weights, m_stream);
+        }
+        catch(rocrand_status status)
+        {
+            return status;
+        }
+
+        unsigned int engine_offset = 0;
+        uint32_t grid_limit = m_blocks;
+        if(m_pool_size > 0)
+        {
+            const rocrand_status status = pool_partition(engine_offset, grid_limit);
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+        }
+        const bool init_engines = !m_engines_initialized;
+        const bool fast_init = (m_initialization == ROCRAND_INIT_FAST);
+        const uint32_t blocks = init_engines
+            ? grid_limit
+            : std::min<uint32_t>(blocks_for_size(data_size), grid_limit);
+
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(rocrand_host::detail::generate_poisson_kernel),
+            dim3(blocks), dim3(s_threads), 0, m_stream,
+            m_engines, engine_offset, static_cast<unsigned int>(m_engines_size),
+            data, data_size, m_seed, m_offset, init_engines, fast_init, m_discrete.dis
+        );
+        // Check kernel status
+        if(hipPeekAtLastError() != hipSuccess)
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    // C API dispatch (see rocrand_generator_base_type)
+    rocrand_status generate_uint(unsigned int * data, size_t n) override
+    {
+        return generate(data, n);
+    }
+
+    rocrand_status generate_char(unsigned char * data, size_t n) override
+    {
+        // 4 bytes are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 3) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 4);
+    }
+
+    rocrand_status generate_short(unsigned short * data, size_t n) override
+    {
+        // 2 shorts are packed per generated 32-bit value and stored
+        // through the vectorized 32-bit path
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2);
+    }
+
+    rocrand_status generate_long_long(unsigned long long * data, size_t n) override
+    {
+        // Two generated 32-bit values are spliced per 64-bit output;
+        // the 32-bit path keeps its 128-bit vectorized stores
+        return generate(reinterpret_cast<unsigned int *>(data), n * 2);
+    }
+
+    rocrand_status generate_uniform_float(float * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_double(double * data, size_t n) override
+    {
+        return generate_uniform(data, n);
+    }
+
+    rocrand_status generate_uniform_range_float(float * data, size_t n,
+                                                float low, float high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_uniform_range_double(double * data, size_t n,
+                                                 double low, double high) override
+    {
+        return generate_uniform_range(data, n, low, high);
+    }
+
+    rocrand_status generate_exponential_float(float * data, size_t n,
+                                              float lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_exponential_double(double * data, size_t n,
+                                               double lambda) override
+    {
+        return generate_exponential(data, n, lambda);
+    }
+
+    rocrand_status generate_cauchy_float(float * data, size_t n,
+                                         float median, float scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_cauchy_double(double * data, size_t n,
+                                          double median, double scale) override
+    {
+        return generate_cauchy(data, n, median, scale);
+    }
+
+    rocrand_status generate_weibull_float(float * data, size_t n,
+                                          float shape, float scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_weibull_double(double * data, size_t n,
+                                           double shape, double scale) override
+    {
+        return generate_weibull(data, n, shape, scale);
+    }
+
+    rocrand_status generate_logistic_float(float * data, size_t n,
+                                           float location, float scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_logistic_double(double * data, size_t n,
+                                            double location, double scale) override
+    {
+        return generate_logistic(data, n, location, scale);
+    }
+
+    rocrand_status generate_uniform_half(__half * data, size_t n) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        uniform_distribution<__half>());
+    }
+
+    rocrand_status generate_normal_half(__half * data, size_t n,
+                                        __half mean, __half stddev) override
+    {
+        // 2 halves are packed per generated 32-bit value
+        if((n & 1) != 0 || ((uintptr_t)data & 3) != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+        return generate(reinterpret_cast<unsigned int *>(data), n / 2,
+                        normal_distribution<__half>(mean, stddev));
+    }
+
+    rocrand_status generate_normal_float(float * data, size_t n,
+                                         float mean, float stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double(double * data, size_t n,
+                                          double mean, double stddev) override
+    {
+        return generate_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_float(float * data, size_t n,
+                                             float mean, float stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_log_normal_double(double * data, size_t n,
+                                              double mean, double stddev) override
+    {
+        return generate_log_normal(data, n, mean, stddev);
+    }
+
+    rocrand_status generate_truncated_normal_float(float * data, size_t n,
+                                                   float mean, float stddev,
+                                                   float low, float high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<float>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_truncated_normal_double(double * data, size_t n,
+                                                    double mean, double stddev,
+                                                    double low, double high) override
+    {
+        return generate(data, n,
+                        truncated_normal_distribution<double>(mean, stddev, low, high));
+    }
+
+    rocrand_status generate_normal_double_fast(double * data, size_t n,
+                                               double mean, double stddev) override
+    {
+        return generate(data, n,
+                        fast_normal_distribution<double>(mean, stddev));
+    }
+
+    rocrand_status generate_poisson_uint(unsigned int * data, size_t n,
+                                         double lambda) override
+    {
+        return generate_poisson(data, n, lambda);
+    }
+
+    rocrand_status generate_binomial_uint(unsigned int * data, size_t n,
+                                          unsigned int trials, double p) override
+    {
+        return generate_binomial(data, n, trials, p);
+    }
+
+    rocrand_status sample_discrete_uint(unsigned int * data, size_t n,
+                                        const double * weights,
+                                        unsigned int num_weights) override
+    {
+        return generate_discrete(data, n, weights, num_weights);
     }
 
 private:
+    // Engine grid size for the given ordering: the fixed
+    // device-independent default for LEGACY, the grid saturating the
+    // present device for BEST
+    unsigned int blocks_for_ordering(rocrand_ordering ordering) const
+    {
+        if(ordering != ROCRAND_ORDERING_PSEUDO_BEST)
+            return s_blocks;
+        return rocrand_host::detail::max_active_blocks(
+            static_cast<void(*)(unsigned int *, unsigned int, unsigned int,
+                                unsigned int *, size_t,
+                                unsigned long long, unsigned long long,
+                                bool, bool, uniform_distribution<unsigned int>)>(
+                rocrand_host::detail::generate_kernel<
+                    unsigned int, uniform_distribution<unsigned int>
+                >
+            ),
+            s_threads, s_blocks
+        );
+    }
+
+    // Returns a grid size just large enough to cover data_size without
+    // grid-stride iterations, capped at the full per-device grid.
+    // Small requests then load and store only a prefix of the engines.
+    // Ensures all engines are initialized -- ordering every pool
+    // stream after the init launch through m_pool_init_done -- and
+    // selects the engine partition bound to the active pool stream
+    rocrand_status pool_partition(unsigned int& engine_offset, uint32_t& grid_limit)
+    {
+        if(!m_engines_initialized)
+        {
+            const rocrand_status status = init();
+            if(status != ROCRAND_STATUS_SUCCESS)
+                return status;
+            if(hipEventRecord(m_pool_init_done, m_stream) != hipSuccess)
+                return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(hipStreamWaitEvent(m_stream, m_pool_init_done, 0) != hipSuccess)
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        grid_limit = m_blocks / m_pool_size;
+        engine_offset = m_active_partition * grid_limit * s_threads;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    uint32_t blocks_for_size(size_t data_size) const
+    {
+        // Each thread writes up to 4 elements per grid-stride iteration
+        const size_t elements_per_block = s_threads * 4;
+        const size_t blocks = (data_size + elements_per_block - 1) / elements_per_block;
+        return static_cast<uint32_t>(
+            std::min<size_t>(std::max<size_t>(blocks, 1), m_blocks)
+        );
+    }
+
     bool m_engines_initialized;
-    engine_type * m_engines;
+    // Engine states in structure-of-arrays layout (see
+    // xorwow_load_engine()); the allocation holds
+    // xorwow_state_words * m_engines_size words
+    unsigned int * m_engines;
     size_t m_engines_size;
+    uint32_t m_blocks;
+    // Base subsequence of the partition set by set_subsequence()
+    // (0 = full sequence)
+    unsigned long long m_subsequence_base;
+    rocrand_initialization m_initialization;
+    // Stream-pool mode (see rocrand_set_stream_pool()): partition i of
+    // the engine array is bound to pool stream i, so calls issued on
+    // different pool streams never share engine state
+    static const unsigned int s_max_pool_streams = 16;
+    hipStream_t m_pool_streams[s_max_pool_streams];
+    unsigned int m_pool_size; // 0 = pool mode off
+    unsigned int m_active_partition;
+    hipEvent_t m_pool_init_done;
+    bool m_pool_event_created;
+    // Default grid sizes, used when the device can't be queried
     #ifdef __HIP_PLATFORM_NVCC__
     static const uint32_t s_threads = 64;
     static const uint32_t s_blocks = 64;
@@ -331,6 +1271,10 @@ private:
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager<> m_poisson;
+    // Same caching for binomial parameter tables
+    binomial_distribution_manager<> m_binomial;
+
+    discrete_distribution_manager<> m_discrete;
 
     // m_seed from base_type
     // m_offset from base_type
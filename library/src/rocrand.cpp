@@ -21,9 +21,120 @@
 #include <hip/hip_runtime.h>
 
 #include "rng/generators.hpp"
+#include "rng/log.hpp"
+#include "rng/transform.hpp"
 
 #include <rocrand.h>
 #include <new>
+#include <climits>
+
+// Routes a generate call by its destination's memory type: host
+// (pageable, pinned or registered) memory goes through the staged
+// device pipeline, managed memory is prefetched to the device first
+// (see rocrand_generator_base_type::generate_to_host() and
+// generate_to_managed()); device destinations dispatch directly.
+// Templates cannot carry C linkage, so this sits outside the
+// extern "C" block below.
+template<class T, class GenerateOp>
+static rocrand_status rocrand_generate_dispatch(rocrand_generator generator,
+                                                const char * op,
+                                                T * output_data, size_t n,
+                                                GenerateOp generate_op)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    // One structured record per call when logging is enabled (see
+    // rocrand_set_log_callback()); the grid is chosen inside the
+    // generator, so the record carries no grid
+    rocrand_host::detail::op_logger log(op, n, 0, 0, generator->get_stream());
+    const bool profiled = generator->m_stats_enabled;
+    if(profiled)
+    {
+        const rocrand_status status =
+            generator->stats_begin(n * sizeof(T));
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+    rocrand_status status;
+    // Host generators write through the pointer on the calling
+    // threads; neither the pointer location query nor the device
+    // staging pipeline applies to them
+    if(generator->is_host_generator())
+    {
+        status = generate_op(output_data, n);
+    }
+    else
+    {
+        switch(rocrand_host::detail::get_pointer_location(output_data))
+        {
+            case rocrand_host::detail::pointer_location_host:
+                status = generator->generate_to_host(output_data, n, generate_op);
+                break;
+            case rocrand_host::detail::pointer_location_managed:
+                status = generator->generate_to_managed(output_data, n, generate_op);
+                break;
+            default:
+                status = generate_op(output_data, n);
+                break;
+        }
+    }
+    if(profiled && status == ROCRAND_STATUS_SUCCESS)
+    {
+        const rocrand_status stats_status = generator->stats_end();
+        if(stats_status != ROCRAND_STATUS_SUCCESS)
+        {
+            return stats_status;
+        }
+    }
+    return status;
+}
+
+
+// Shared body of rocrand_transform() and rocrand_transform_double():
+// validates the buffers, picks the distribution functor and launches
+// the single-pass transform kernel. Templates cannot carry C linkage
+// either, so this also sits outside the extern "C" block.
+template<class RealType>
+static rocrand_status rocrand_transform_impl(const unsigned int * input,
+                                             RealType * output, size_t n,
+                                             rocrand_transform_type distribution,
+                                             RealType p1, RealType p2,
+                                             hipStream_t stream)
+{
+    if(input == NULL || output == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    // The bulk of the pass runs on uint4 loads and vector stores;
+    // doubles additionally pair two draws per value
+    if(((uintptr_t)(input) & 15) != 0 || ((uintptr_t)(output) & 15) != 0
+        || (sizeof(RealType) == sizeof(double) && (n & 1) != 0))
+    {
+        return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+    }
+    switch(distribution)
+    {
+        case ROCRAND_TRANSFORM_UNIFORM:
+            return rocrand_host::detail::transform_launch(
+                input, output, n, uniform_distribution<RealType>(), stream);
+        case ROCRAND_TRANSFORM_NORMAL:
+            return rocrand_host::detail::transform_launch(
+                input, output, n, normal_distribution<RealType>(p1, p2), stream);
+        case ROCRAND_TRANSFORM_LOG_NORMAL:
+            return rocrand_host::detail::transform_launch(
+                input, output, n, log_normal_distribution<RealType>(p1, p2), stream);
+        case ROCRAND_TRANSFORM_EXPONENTIAL:
+            return rocrand_host::detail::transform_launch(
+                input, output, n, exponential_distribution<RealType>(p1), stream);
+        default:
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+}
 
 #if defined(__cplusplus)
 extern "C" {
@@ -38,10 +149,26 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
         {
             *generator = new rocrand_philox4x32_10();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+        {
+            *generator = new rocrand_philox4x32_7();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST)
+        {
+            *generator = new rocrand_philox4x32_10_host();
+        }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+        {
+            *generator = new rocrand_threefry4x32_20();
+        }
         else if(rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
         {
             *generator = new rocrand_mrg32k3a();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+        {
+            *generator = new rocrand_mrg31k3p();
+        }
         else if(rng_type == ROCRAND_RNG_PSEUDO_XORWOW
                     || rng_type == ROCRAND_RNG_PSEUDO_DEFAULT)
         {
@@ -52,10 +179,26 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
         {
             *generator = new rocrand_sobol32();
         }
+        else if(rng_type == ROCRAND_RNG_QUASI_SOBOL64)
+        {
+            *generator = new rocrand_sobol64();
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+        {
+            *generator = new rocrand_sobol32(0, 0, true);
+        }
+        else if(rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+        {
+            *generator = new rocrand_sobol64(0, 0, true);
+        }
         else if(rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
         {
             *generator = new rocrand_mtgp32();
         }
+        else if(rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+        {
+            *generator = new rocrand_mt19937();
+        }
         else
         {
             return ROCRAND_STATUS_TYPE_ERROR;
@@ -72,6 +215,30 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_create_generator_multi(rocrand_generator * generator,
+                               const int * devices, int device_count)
+{
+    if(devices == NULL || device_count < 1)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    try
+    {
+        *generator = new rocrand_philox4x32_10_multi(devices, device_count);
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 rocrand_status ROCRANDAPI
 rocrand_destroy_generator(rocrand_generator generator)
 {
@@ -89,530 +256,1515 @@ rocrand_destroy_generator(rocrand_generator generator)
 rocrand_status ROCRANDAPI
 rocrand_generate(rocrand_generator generator,
                  unsigned int * output_data, size_t n)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator](unsigned int * data, size_t size)
+        {
+            return generator->generate_uint(data, size);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_char(rocrand_generator generator,
+                      unsigned char * output_data, size_t n)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator](unsigned char * data, size_t size)
+        {
+            return generator->generate_char(data, size);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_short(rocrand_generator generator,
+                       unsigned short * output_data, size_t n)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator](unsigned short * data, size_t size)
+        {
+            return generator->generate_short(data, size);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_long_long(rocrand_generator generator,
+                           unsigned long long * output_data, size_t n)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator](unsigned long long * data, size_t size)
+        {
+            return generator->generate_long_long(data, size);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_bytes(rocrand_generator generator,
+                       void * output_data, size_t bytes)
+{
+    return rocrand_generate_dispatch(generator, __func__,
+        static_cast<unsigned char *>(output_data), bytes,
+        [generator](unsigned char * data, size_t size)
+        {
+            return generator->generate_bytes(data, size);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_chunks(rocrand_generator generator,
+                        size_t total_bytes, size_t chunk_bytes,
+                        rocrand_chunk_callback callback,
+                        void * user_data)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    if(callback == NULL || chunk_bytes == 0)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate(output_data, n);
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    rocrand_host::detail::op_logger log(__func__, total_bytes, 0, 0,
+                                        generator->get_stream());
+    return generator->generate_chunks(total_bytes, chunk_bytes,
+                                      callback, user_data);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_at(rocrand_generator generator,
+                    unsigned int * output_data, size_t n,
+                    unsigned long long sequence_offset)
+{
+    if(generator == NULL)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate(output_data, n);
+        return ROCRAND_STATUS_NOT_CREATED;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate(output_data, n);
+        rocrand_philox4x32_10 * philox4x32_10_generator =
+            static_cast<rocrand_philox4x32_10 *>(generator);
+        return philox4x32_10_generator->generate_at(output_data, n,
+                                                    sequence_offset);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate(output_data, n);
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_at(output_data, n,
+                                                   sequence_offset);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate(output_data, n);
+        rocrand_threefry4x32_20 * threefry4x32_20_generator =
+            static_cast<rocrand_threefry4x32_20 *>(generator);
+        return threefry4x32_20_generator->generate_at(output_data, n,
+                                                      sequence_offset);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_uniform(rocrand_generator generator,
-                         float * output_data, size_t n)
+rocrand_generate_batch(rocrand_generator generator,
+                       unsigned int * const * output_data,
+                       const size_t * sizes, int count)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
         rocrand_philox4x32_10 * philox4x32_10_generator =
             static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return philox4x32_10_generator->generate_batch(output_data, sizes,
+                                                       count);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
-    {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
-    {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        rocrand_philox4x32_7 * philox4x32_7_generator =
+            static_cast<rocrand_philox4x32_7 *>(generator);
+        return philox4x32_7_generator->generate_batch(output_data, sizes,
+                                                      count);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform(rocrand_generator generator,
+                         float * output_data, size_t n)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator](float * data, size_t size)
+        {
+            return generator->generate_uniform_float(data, size);
+        });
+}
+
 rocrand_status ROCRANDAPI
 rocrand_generate_uniform_double(rocrand_generator generator,
                                 double * output_data, size_t n)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator](double * data, size_t size)
+        {
+            return generator->generate_uniform_double(data, size);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_range(rocrand_generator generator,
+                               float * output_data, size_t n,
+                               float low, float high)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, low, high](float * data, size_t size)
+        {
+            return generator->generate_uniform_range_float(data, size, low, high);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_range_double(rocrand_generator generator,
+                                      double * output_data, size_t n,
+                                      double low, double high)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, low, high](double * data, size_t size)
+        {
+            return generator->generate_uniform_range_double(data, size, low, high);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_bits(rocrand_generator generator,
+                              float * output_data, size_t n,
+                              unsigned int bits)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, bits](float * data, size_t size)
+        {
+            if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+            {
+                return static_cast<rocrand_philox4x32_10 *>(generator)
+                    ->generate_uniform_bits(data, size, bits);
+            }
+            else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+            {
+                return static_cast<rocrand_philox4x32_7 *>(generator)
+                    ->generate_uniform_bits(data, size, bits);
+            }
+            return ROCRAND_STATUS_TYPE_ERROR;
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float mean, float stddev)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev](float * data, size_t size)
+        {
+            return generator->generate_normal_float(data, size, mean, stddev);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double(rocrand_generator generator,
+                               double * output_data, size_t n,
+                               double mean, double stddev)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev](double * data, size_t size)
+        {
+            return generator->generate_normal_double(data, size, mean, stddev);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_fast(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double mean, double stddev)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev](double * data, size_t size)
+        {
+            return generator->generate_normal_double_fast(data, size, mean, stddev);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_half(rocrand_generator generator,
+                              __half * output_data, size_t n)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator](__half * data, size_t size)
+        {
+            return generator->generate_uniform_half(data, size);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_half(rocrand_generator generator,
+                             __half * output_data, size_t n,
+                             __half mean, __half stddev)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev](__half * data, size_t size)
+        {
+            return generator->generate_normal_half(data, size, mean, stddev);
+        });
+}
+
+template<class T>
+static rocrand_status generate_normal_reduce_impl(rocrand_generator generator,
+                                                  size_t n, T mean, T stddev,
+                                                  T * sums)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_uniform(output_data, n);
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->generate_normal_reduce(n, mean, stddev, sums);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_uniform(output_data, n);
+        return static_cast<rocrand_philox4x32_7 *>(generator)
+            ->generate_normal_reduce(n, mean, stddev, sums);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
-    {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_uniform(output_data, n);
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_reduce(rocrand_generator generator,
+                               size_t n, float mean, float stddev,
+                               float * sums)
+{
+    return generate_normal_reduce_impl(generator, n, mean, stddev, sums);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_reduce_double(rocrand_generator generator,
+                                      size_t n, double mean, double stddev,
+                                      double * sums)
+{
+    return generate_normal_reduce_impl(generator, n, mean, stddev, sums);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal(rocrand_generator generator,
+                            float * output_data, size_t n,
+                            float mean, float stddev)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev](float * data, size_t size)
+        {
+            return generator->generate_log_normal_float(data, size, mean, stddev);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_log_normal_double(rocrand_generator generator,
+                                   double * output_data, size_t n,
+                                   double mean, double stddev)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev](double * data, size_t size)
+        {
+            return generator->generate_log_normal_double(data, size, mean, stddev);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal(rocrand_generator generator,
+                                  float * output_data, size_t n,
+                                  float mean, float stddev,
+                                  float low, float high)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev, low, high](float * data, size_t size)
+        {
+            if(!(low < high) || !(stddev > 0.0f))
+            {
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+            return generator->generate_truncated_normal_float(
+                data, size, mean, stddev, low, high);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_truncated_normal_double(rocrand_generator generator,
+                                         double * output_data, size_t n,
+                                         double mean, double stddev,
+                                         double low, double high)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, mean, stddev, low, high](double * data, size_t size)
+        {
+            if(!(low < high) || !(stddev > 0.0))
+            {
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+            return generator->generate_truncated_normal_double(
+                data, size, mean, stddev, low, high);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential(rocrand_generator generator,
+                             float * output_data, size_t n,
+                             float lambda)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, lambda](float * data, size_t size)
+        {
+            return generator->generate_exponential_float(data, size, lambda);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_exponential_double(rocrand_generator generator,
+                                    double * output_data, size_t n,
+                                    double lambda)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, lambda](double * data, size_t size)
+        {
+            return generator->generate_exponential_double(data, size, lambda);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_cauchy(rocrand_generator generator,
+                        float * output_data, size_t n,
+                        float median, float scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, median, scale](float * data, size_t size)
+        {
+            return generator->generate_cauchy_float(data, size, median, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_cauchy_double(rocrand_generator generator,
+                               double * output_data, size_t n,
+                               double median, double scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, median, scale](double * data, size_t size)
+        {
+            return generator->generate_cauchy_double(data, size, median, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_weibull(rocrand_generator generator,
+                         float * output_data, size_t n,
+                         float shape, float scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, shape, scale](float * data, size_t size)
+        {
+            if(!(shape > 0.0f) || !(scale > 0.0f))
+            {
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+            return generator->generate_weibull_float(data, size, shape, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_weibull_double(rocrand_generator generator,
+                                double * output_data, size_t n,
+                                double shape, double scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, shape, scale](double * data, size_t size)
+        {
+            if(!(shape > 0.0) || !(scale > 0.0))
+            {
+                return ROCRAND_STATUS_OUT_OF_RANGE;
+            }
+            return generator->generate_weibull_double(data, size, shape, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_logistic(rocrand_generator generator,
+                          float * output_data, size_t n,
+                          float location, float scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, location, scale](float * data, size_t size)
+        {
+            return generator->generate_logistic_float(data, size, location, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_logistic_double(rocrand_generator generator,
+                                 double * output_data, size_t n,
+                                 double location, double scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, location, scale](double * data, size_t size)
+        {
+            return generator->generate_logistic_double(data, size, location, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_transform(const unsigned int * input,
+                  float * output, size_t n,
+                  rocrand_transform_type distribution,
+                  float p1, float p2,
+                  hipStream_t stream)
+{
+    return rocrand_transform_impl(input, output, n, distribution, p1, p2, stream);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_transform_double(const unsigned int * input,
+                         double * output, size_t n,
+                         rocrand_transform_type distribution,
+                         double p1, double p2,
+                         hipStream_t stream)
+{
+    return rocrand_transform_impl(input, output, n, distribution, p1, p2, stream);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma(rocrand_generator generator,
+                       float * output_data, size_t n,
+                       float shape, float scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, shape, scale](float * data, size_t size)
+        {
+            return generator->generate_gamma_float(data, size, shape, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_gamma_double(rocrand_generator generator,
+                              double * output_data, size_t n,
+                              double shape, double scale)
+{
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, shape, scale](double * data, size_t size)
+        {
+            return generator->generate_gamma_double(data, size, shape, scale);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson(rocrand_generator generator,
+                         unsigned int * output_data, size_t n,
+                         double lambda)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if (lambda <= 0.0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // rocrand_generate_dispatch below takes the handle lock
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, lambda](unsigned int * data, size_t size)
+        {
+            return generator->generate_poisson_uint(data, size, lambda);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_poisson_array(rocrand_generator generator,
+                               unsigned int * output_data, size_t n,
+                               const double * lambdas)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return generator->generate_poisson_array_uint(output_data, n, lambdas);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_binomial(rocrand_generator generator,
+                          unsigned int * output_data, size_t n,
+                          unsigned int trials, double p)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(trials == 0 || !(p > 0.0 && p < 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // rocrand_generate_dispatch below takes the handle lock
+    return rocrand_generate_dispatch(generator, __func__, output_data, n,
+        [generator, trials, p](unsigned int * data, size_t size)
+        {
+            return generator->generate_binomial_uint(data, size, trials, p);
+        });
+}
+
+rocrand_status ROCRANDAPI
+rocrand_sample_discrete(rocrand_generator generator,
+                        unsigned int * indices, size_t n,
+                        const double * weights, size_t num_weights)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(num_weights == 0 || num_weights > UINT_MAX)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->sample_discrete_uint(
+        indices, n, weights, static_cast<unsigned int>(num_weights));
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_permutation(rocrand_generator generator,
+                             unsigned int * perm, size_t n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return generator->generate_permutation_uint(perm, n);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_multinomial(rocrand_generator generator,
+                             unsigned int * counts, size_t num_draws,
+                             unsigned int trials,
+                             const double * weights, size_t num_weights)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(num_weights == 0 || num_weights > UINT_MAX)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_multinomial_uint(
+        counts, num_draws, trials, weights,
+        static_cast<unsigned int>(num_weights));
+}
+
+// Records the caller's completion event after a successful enqueue
+static rocrand_status
+rocrand_record_event(rocrand_generator generator,
+                     rocrand_status status, hipEvent_t event)
+{
+    if(status == ROCRAND_STATUS_SUCCESS && event != NULL
+        && hipEventRecord(event, generator->get_stream()) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return status;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_async(rocrand_generator generator,
+                       unsigned int * output_data, size_t n,
+                       hipEvent_t event)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return rocrand_record_event(
+        generator, generator->generate_uint(output_data, n), event);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_async(rocrand_generator generator,
+                               float * output_data, size_t n,
+                               hipEvent_t event)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return rocrand_record_event(
+        generator, generator->generate_uniform_float(output_data, n), event);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_uniform_double_async(rocrand_generator generator,
+                                      double * output_data, size_t n,
+                                      hipEvent_t event)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return rocrand_record_event(
+        generator, generator->generate_uniform_double(output_data, n), event);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_async(rocrand_generator generator,
+                              float * output_data, size_t n,
+                              float mean, float stddev,
+                              hipEvent_t event)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return rocrand_record_event(
+        generator,
+        generator->generate_normal_float(output_data, n, mean, stddev),
+        event);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_generate_normal_double_async(rocrand_generator generator,
+                                     double * output_data, size_t n,
+                                     double mean, double stddev,
+                                     hipEvent_t event)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return rocrand_record_event(
+        generator,
+        generator->generate_normal_double(output_data, n, mean, stddev),
+        event);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_initialize_generator(rocrand_generator generator)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    return generator->init();
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_state_size(rocrand_generator generator, size_t * state_size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(state_size == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    const size_t size = generator->state_size();
+    if(size == 0)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    *state_size = size;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_save_state(rocrand_generator generator, void * state)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(state == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->save_state(state);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_load_state(rocrand_generator generator, const void * state)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(state == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->load_state(state);
+}
+
+rocrand_status ROCRANDAPI
+rocrand_create_device_states(rocrand_rng_type rng_type,
+                             size_t count,
+                             unsigned long long seed,
+                             void ** device_states)
+{
+    if(device_states == NULL || count == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    switch(rng_type)
+    {
+        case ROCRAND_RNG_PSEUDO_DEFAULT:
+        case ROCRAND_RNG_PSEUDO_XORWOW:
+            return rocrand_host::detail::create_device_states<rocrand_state_xorwow>(
+                ROCRAND_RNG_PSEUDO_XORWOW, count, seed, device_states);
+        case ROCRAND_RNG_PSEUDO_MRG32K3A:
+            return rocrand_host::detail::create_device_states<rocrand_state_mrg32k3a>(
+                rng_type, count, seed, device_states);
+        case ROCRAND_RNG_PSEUDO_MRG31K3P:
+            return rocrand_host::detail::create_device_states<rocrand_state_mrg31k3p>(
+                rng_type, count, seed, device_states);
+        case ROCRAND_RNG_PSEUDO_PHILOX4_32_10:
+            return rocrand_host::detail::create_device_states<rocrand_state_philox4x32_10>(
+                rng_type, count, seed, device_states);
+        case ROCRAND_RNG_PSEUDO_THREEFRY4_32_20:
+            return rocrand_host::detail::create_device_states<rocrand_state_threefry4x32_20>(
+                rng_type, count, seed, device_states);
+        default:
+            // MTGP32, MT19937 and the quasi generators need their own
+            // setup helpers (parameter sets, direction vectors)
+            return ROCRAND_STATUS_TYPE_ERROR;
+    }
+}
+
+rocrand_status ROCRANDAPI
+rocrand_get_device_state_size(rocrand_rng_type rng_type, size_t * state_size)
+{
+    if(state_size == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    switch(rng_type)
+    {
+        case ROCRAND_RNG_PSEUDO_DEFAULT:
+        case ROCRAND_RNG_PSEUDO_XORWOW:
+            *state_size = sizeof(rocrand_state_xorwow);
+            return ROCRAND_STATUS_SUCCESS;
+        case ROCRAND_RNG_PSEUDO_MRG32K3A:
+            *state_size = sizeof(rocrand_state_mrg32k3a);
+            return ROCRAND_STATUS_SUCCESS;
+        case ROCRAND_RNG_PSEUDO_MRG31K3P:
+            *state_size = sizeof(rocrand_state_mrg31k3p);
+            return ROCRAND_STATUS_SUCCESS;
+        case ROCRAND_RNG_PSEUDO_PHILOX4_32_10:
+            *state_size = sizeof(rocrand_state_philox4x32_10);
+            return ROCRAND_STATUS_SUCCESS;
+        case ROCRAND_RNG_PSEUDO_THREEFRY4_32_20:
+            *state_size = sizeof(rocrand_state_threefry4x32_20);
+            return ROCRAND_STATUS_SUCCESS;
+        default:
+            return ROCRAND_STATUS_TYPE_ERROR;
+    }
+}
+
+rocrand_status ROCRANDAPI
+rocrand_destroy_device_states(void * device_states)
+{
+    if(device_states == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    // The states may be in use by caller kernels on any stream; match
+    // the implicit synchronization of hipFree before the block can be
+    // recycled
+    if(hipDeviceSynchronize() != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    if(rocrand_host::detail::device_free(device_states) != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST)
+    {
+        // Host generators run synchronously on host threads; the
+        // stream is accepted for interface compatibility and unused
+        static_cast<rocrand_philox4x32_10_host *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        static_cast<rocrand_mrg31k3p *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        static_cast<rocrand_sobol64 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        static_cast<rocrand_mt19937 *>(generator)->set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_split_streams(rocrand_generator generator, unsigned int count)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->set_split_streams(count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)
+            ->set_split_streams(count);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_persistent_mode(rocrand_generator generator, int enabled)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->set_persistent_mode(enabled != 0);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)
+            ->set_persistent_mode(enabled != 0);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_persistent_synchronize(rocrand_generator generator)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->persistent_synchronize();
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return static_cast<rocrand_philox4x32_7 *>(generator)
+            ->persistent_synchronize();
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_stream_pool(rocrand_generator generator,
+                        const hipStream_t * streams, unsigned int count)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(streams == NULL && count > 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        return static_cast<rocrand_xorwow *>(generator)
+            ->set_stream_pool(streams, count);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        return static_cast<rocrand_mrg32k3a *>(generator)
+            ->set_stream_pool(streams, count);
+    }
+    return ROCRAND_STATUS_TYPE_ERROR;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_allocator(rocrand_allocate_func allocate,
+                      rocrand_deallocate_func deallocate,
+                      void * state)
+{
+    if((allocate == NULL) != (deallocate == NULL))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    rocrand_host::detail::device_memory_pool::set_allocator(
+        allocate, deallocate, state
+    );
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    // A rebuilt engine array shows up in the profiling counters
+    generator->m_stats_reinit_pending = true;
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    {
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST)
+    {
+        static_cast<rocrand_philox4x32_10_host *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    {
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
+        }
+        static_cast<rocrand_mrg32k3a *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG31K3P_DEFAULT_SEED;
+        }
+        static_cast<rocrand_mrg31k3p *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    {
+        static_cast<rocrand_xorwow *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    {
+        static_cast<rocrand_mtgp32 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_mt19937 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_uniform(output_data, n);
+        static_cast<rocrand_philox4x32_10_multi *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_normal(rocrand_generator generator,
-                        float * output_data, size_t n,
-                        float mean, float stddev)
+rocrand_reseed(rocrand_generator generator, unsigned long long seed)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
 
+    // Counter-based generators re-key their engines in place; the
+    // engine array stays valid, so no reinit shows up in the counters
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->reseed(seed);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
-    {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        return static_cast<rocrand_philox4x32_7 *>(generator)->reseed(seed);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        return static_cast<rocrand_threefry4x32_20 *>(generator)->reseed(seed);
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
-}
 
-rocrand_status ROCRANDAPI
-rocrand_generate_normal_double(rocrand_generator generator,
-                               double * output_data, size_t n,
-                               double mean, double stddev)
-{
-    if(generator == NULL)
+    // Every other type falls back to the ordinary reset-on-reseed path
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST)
     {
-        return ROCRAND_STATUS_NOT_CREATED;
+        generator->m_stats_reinit_pending = true;
+        static_cast<rocrand_philox4x32_10_host *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_normal(output_data, n,
-                                                        mean, stddev);
+        generator->m_stats_reinit_pending = true;
+        static_cast<rocrand_philox4x32_10_multi *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_normal(output_data, n,
-                                                   mean, stddev);
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
+        }
+        generator->m_stats_reinit_pending = true;
+        static_cast<rocrand_mrg32k3a *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        if(seed == 0ULL)
+        {
+            seed = ROCRAND_MRG31K3P_DEFAULT_SEED;
+        }
+        generator->m_stats_reinit_pending = true;
+        static_cast<rocrand_mrg31k3p *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        generator->m_stats_reinit_pending = true;
+        static_cast<rocrand_xorwow *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_normal(output_data, n,
-                                                          mean, stddev);
+        generator->m_stats_reinit_pending = true;
+        static_cast<rocrand_mtgp32 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_normal(output_data, n,
-                                                         mean, stddev);
+        generator->m_stats_reinit_pending = true;
+        static_cast<rocrand_mt19937 *>(generator)->set_seed(seed);
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_log_normal(rocrand_generator generator,
-                            float * output_data, size_t n,
-                            float mean, float stddev)
+rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    // A rebuilt engine array shows up in the profiling counters
+    generator->m_stats_reinit_pending = true;
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
+        static_cast<rocrand_philox4x32_10 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        static_cast<rocrand_philox4x32_7 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST)
+    {
+        static_cast<rocrand_philox4x32_10_host *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        static_cast<rocrand_threefry4x32_20 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        static_cast<rocrand_mrg32k3a *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        static_cast<rocrand_mrg31k3p *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        static_cast<rocrand_xorwow *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
+    {
+        static_cast<rocrand_sobol32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        static_cast<rocrand_sobol64 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        static_cast<rocrand_mtgp32 *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937)
+    {
+        // Can't set offset for MT19937
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI)
+    {
+        static_cast<rocrand_philox4x32_10_multi *>(generator)->set_offset(offset);
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_log_normal_double(rocrand_generator generator,
-                                   double * output_data, size_t n,
-                                   double mean, double stddev)
+rocrand_set_subsequence(rocrand_generator generator,
+                        unsigned int rank, unsigned int num_ranks)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    // A repositioned engine array shows up in the profiling counters
+    generator->m_stats_reinit_pending = true;
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_log_normal(output_data, n,
-                                                            mean, stddev);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_log_normal(output_data, n,
-                                                       mean, stddev);
+        return static_cast<rocrand_philox4x32_10 *>(generator)->set_subsequence(rank, num_ranks);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_philox4x32_7 *>(generator)->set_subsequence(rank, num_ranks);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_log_normal(output_data, n,
-                                                              mean, stddev);
+        return static_cast<rocrand_mrg32k3a *>(generator)->set_subsequence(rank, num_ranks);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_log_normal(output_data, n,
-                                                             mean, stddev);
+        return static_cast<rocrand_xorwow *>(generator)->set_subsequence(rank, num_ranks);
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_generate_poisson(rocrand_generator generator,
-                         unsigned int * output_data, size_t n,
-                         double lambda)
+rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
+                                              unsigned int dimensions)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if (lambda <= 0.0)
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    // The cap follows the resolved direction-vector table: SOBOL_DIM
+    // (20000) for the compiled-in table, more when ROCRAND_TABLE_FILE
+    // maps a larger one
+    if(dimensions < 1
+        || dimensions > rocrand_host::detail::sobol_direction_vector_dimensions())
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
 
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        rocrand_philox4x32_10 * philox4x32_10_generator =
-            static_cast<rocrand_philox4x32_10 *>(generator);
-        return philox4x32_10_generator->generate_poisson(output_data, n,
-                                                         lambda);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        rocrand_mrg32k3a * mrg32k3a_generator =
-            static_cast<rocrand_mrg32k3a *>(generator);
-        return mrg32k3a_generator->generate_poisson(output_data, n,
-                                                    lambda);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
-    {
-        rocrand_xorwow * rocrand_xorwow_generator =
-            static_cast<rocrand_xorwow *>(generator);
-        return rocrand_xorwow_generator->generate_poisson(output_data, n,
-                                                          lambda);
-    }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        rocrand_sobol32 * rocrand_sobol32_generator =
-            static_cast<rocrand_sobol32 *>(generator);
-        return rocrand_sobol32_generator->generate_poisson(output_data, n,
-                                                           lambda);
+        static_cast<rocrand_sobol32 *>(generator)->set_dimensions(dimensions);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        rocrand_mtgp32 * rocrand_mtgp32_generator =
-            static_cast<rocrand_mtgp32 *>(generator);
-        return rocrand_mtgp32_generator->generate_poisson(output_data, n,
-                                                          lambda);
+        static_cast<rocrand_sobol64 *>(generator)->set_dimensions(dimensions);
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_initialize_generator(rocrand_generator generator)
+rocrand_set_sobol_order(rocrand_generator generator,
+                        rocrand_sobol_order order)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        return static_cast<rocrand_philox4x32_10 *>(generator)->init();
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        return static_cast<rocrand_mrg32k3a *>(generator)->init();
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(order != ROCRAND_SOBOL_ORDER_DIMENSION
+        && order != ROCRAND_SOBOL_ORDER_INTERLEAVED)
     {
-        return static_cast<rocrand_xorwow *>(generator)->init();
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+
+    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32)
     {
-        return static_cast<rocrand_sobol32 *>(generator)->init();
+        static_cast<rocrand_sobol32 *>(generator)->set_order(order);
+        return ROCRAND_STATUS_SUCCESS;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL64
+                || generator->rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
     {
-        return static_cast<rocrand_mtgp32 *>(generator)->init();
+        static_cast<rocrand_sobol64 *>(generator)->set_order(order);
+        return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_stream(rocrand_generator generator, hipStream_t stream)
+rocrand_set_ordering(rocrand_generator generator, rocrand_ordering ordering)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    // A rebuilt engine array shows up in the profiling counters
+    generator->m_stats_reinit_pending = true;
+    if(ordering != ROCRAND_ORDERING_PSEUDO_BEST
+        && ordering != ROCRAND_ORDERING_PSEUDO_LEGACY
+        && ordering != ROCRAND_ORDERING_PSEUDO_COUNTER)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    // Counter-keyed virtual streams need a counter-based engine
+    if(ordering == ROCRAND_ORDERING_PSEUDO_COUNTER
+        && generator->rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        && generator->rng_type != ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
 
     if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
     {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_philox4x32_10 *>(generator)
+            ->set_ordering(ordering);
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_7)
     {
-        static_cast<rocrand_mrg32k3a *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_philox4x32_7 *>(generator)
+            ->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_THREEFRY4_32_20)
+    {
+        return static_cast<rocrand_threefry4x32_20 *>(generator)
+            ->set_ordering(ordering);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_xorwow *>(generator)
+            ->set_ordering(ordering);
     }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        static_cast<rocrand_sobol32 *>(generator)->set_stream(stream);
-        return ROCRAND_STATUS_SUCCESS;
+        return static_cast<rocrand_mrg32k3a *>(generator)
+            ->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG31K3P)
+    {
+        return static_cast<rocrand_mrg31k3p *>(generator)
+            ->set_ordering(ordering);
     }
     else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
     {
-        static_cast<rocrand_mtgp32 *>(generator)->set_stream(stream);
+        return static_cast<rocrand_mtgp32 *>(generator)
+            ->set_ordering(ordering);
+    }
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MT19937
+                || generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10_MULTI)
+    {
+        // Engine layout is already device-independent; both orderings
+        // produce identical output
         return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_seed(rocrand_generator generator, unsigned long long seed)
+rocrand_set_initialization(rocrand_generator generator,
+                           rocrand_initialization initialization)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_seed(seed);
-        return ROCRAND_STATUS_SUCCESS;
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(initialization != ROCRAND_INIT_DEFAULT
+        && initialization != ROCRAND_INIT_FAST)
     {
-        if(seed == 0ULL)
-        {
-            seed = ROCRAND_MRG32K3A_DEFAULT_SEED;
-        }
-        static_cast<rocrand_mrg32k3a *>(generator)->set_seed(seed);
-        return ROCRAND_STATUS_SUCCESS;
+        return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
+
+    if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
     {
-        static_cast<rocrand_xorwow *>(generator)->set_seed(seed);
+        static_cast<rocrand_xorwow *>(generator)
+            ->set_initialization(initialization);
         return ROCRAND_STATUS_SUCCESS;
     }
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
+    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
     {
-        static_cast<rocrand_mtgp32 *>(generator)->set_seed(seed);
+        static_cast<rocrand_mrg32k3a *>(generator)
+            ->set_initialization(initialization);
         return ROCRAND_STATUS_SUCCESS;
     }
     return ROCRAND_STATUS_TYPE_ERROR;
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_offset(rocrand_generator generator, unsigned long long offset)
+rocrand_set_profiling(rocrand_generator generator, int enabled)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
-    {
-        static_cast<rocrand_philox4x32_10 *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MRG32K3A)
-    {
-        static_cast<rocrand_mrg32k3a *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_XORWOW)
-    {
-        static_cast<rocrand_xorwow *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
-    }
-    else if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
-    {
-        static_cast<rocrand_sobol32 *>(generator)->set_offset(offset);
-        return ROCRAND_STATUS_SUCCESS;
-    }
-    else if(generator->rng_type == ROCRAND_RNG_PSEUDO_MTGP32)
-    {
-        // Can't set offset for MTGP32
-        return ROCRAND_STATUS_TYPE_ERROR;
-    }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    return generator->stats_set_enabled(enabled != 0);
 }
 
 rocrand_status ROCRANDAPI
-rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
-                                              unsigned int dimensions)
+rocrand_get_stats(rocrand_generator generator, rocrand_stats * stats)
 {
     if(generator == NULL)
     {
         return ROCRAND_STATUS_NOT_CREATED;
     }
-    if(dimensions < 1 || dimensions > 20000)
+    std::lock_guard<std::mutex> lock(generator->m_api_mutex);
+    if(stats == NULL)
     {
         return ROCRAND_STATUS_OUT_OF_RANGE;
     }
-
-    if(generator->rng_type == ROCRAND_RNG_QUASI_SOBOL32)
+    // Fold the last profiled call in so the report is complete
+    const rocrand_status status = generator->stats_resolve();
+    if(status != ROCRAND_STATUS_SUCCESS)
     {
-        static_cast<rocrand_sobol32 *>(generator)->set_dimensions(dimensions);
-        return ROCRAND_STATUS_SUCCESS;
+        return status;
     }
-    return ROCRAND_STATUS_TYPE_ERROR;
+    stats->last_time_ms = generator->m_stats_last_ms;
+    stats->total_time_ms = generator->m_stats_total_ms;
+    stats->bytes_written = generator->m_stats_bytes;
+    stats->launches = generator->m_stats_launches;
+    stats->reinits = generator->m_stats_reinits;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+rocrand_status ROCRANDAPI
+rocrand_set_log_callback(rocrand_log_callback callback, void * user_data)
+{
+    rocrand_host::detail::log_sink::instance().set_callback(callback, user_data);
+    return ROCRAND_STATUS_SUCCESS;
 }
 
 rocrand_status ROCRANDAPI
@@ -713,6 +1865,51 @@ rocrand_create_discrete_distribution(const double * probabilities,
     return ROCRAND_STATUS_SUCCESS;
 }
 
+rocrand_status ROCRANDAPI
+rocrand_create_discrete_distribution_fp32(const double * probabilities,
+                                          unsigned int size,
+                                          unsigned int offset,
+                                          rocrand_discrete_distribution * discrete_distribution)
+{
+    if (discrete_distribution == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    if (size == 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL> h_dis;
+    try
+    {
+        h_dis = rocrand_discrete_distribution_base<ROCRAND_DISCRETE_METHOD_UNIVERSAL>(
+            probabilities, size, offset, true);
+    }
+    catch(const std::exception& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+
+    hipError_t error;
+    error = hipMalloc(discrete_distribution, sizeof(rocrand_discrete_distribution_st));
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_ALLOCATION_FAILED;
+    }
+    error = hipMemcpy(*discrete_distribution, &h_dis, sizeof(rocrand_discrete_distribution_st), hipMemcpyDefault);
+    if (error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 rocrand_status ROCRANDAPI
 rocrand_destroy_discrete_distribution(rocrand_discrete_distribution discrete_distribution)
 {
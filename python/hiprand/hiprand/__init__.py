@@ -19,4 +19,4 @@
 # THE SOFTWARE.
 
 from .hiprand import HipRandError, PRNG, QRNG, get_version
-from .hip import HipError, DeviceNDArray, empty
+from .hip import HipError, DeviceNDArray, Stream, Event, empty
@@ -81,6 +81,13 @@ def load_hip():
             hip.hipMalloc = cuda.cudaMalloc
             hip.hipFree = cuda.cudaFree
             hip.hipMemcpy = cuda.cudaMemcpy
+            hip.hipStreamCreate = cuda.cudaStreamCreate
+            hip.hipStreamDestroy = cuda.cudaStreamDestroy
+            hip.hipStreamSynchronize = cuda.cudaStreamSynchronize
+            hip.hipEventCreate = cuda.cudaEventCreate
+            hip.hipEventDestroy = cuda.cudaEventDestroy
+            hip.hipEventRecord = cuda.cudaEventRecord
+            hip.hipEventSynchronize = cuda.cudaEventSynchronize
 
     if hip is None:
         raise ImportError("both libcudart.so and libhip_hcc.so cannot be loaded: " +
@@ -96,6 +103,52 @@ class MemoryPointer(object):
     def _finalize(cls, ptr):
         check_hip(hip.hipFree(ptr))
 
+class Stream(object):
+    """HIP stream.
+
+    Work enqueued on different streams may execute concurrently.
+    Pass a stream to the **stream** attribute of a generator to make
+    all its kernel launches asynchronous with respect to the host.
+    """
+
+    def __init__(self):
+        self.stream = c_void_p()
+        check_hip(hip.hipStreamCreate(byref(self.stream)))
+        track_for_finalization(self, self.stream, Stream._finalize)
+
+    @classmethod
+    def _finalize(cls, stream):
+        check_hip(hip.hipStreamDestroy(stream))
+
+    def synchronize(self):
+        """Blocks until all work enqueued on the stream has completed."""
+        check_hip(hip.hipStreamSynchronize(self.stream))
+
+class Event(object):
+    """HIP event.
+
+    Returned by asynchronous generation calls; call :func:`synchronize`
+    to wait for the generated numbers to be ready.
+    """
+
+    def __init__(self):
+        self.event = c_void_p()
+        check_hip(hip.hipEventCreate(byref(self.event)))
+        track_for_finalization(self, self.event, Event._finalize)
+
+    @classmethod
+    def _finalize(cls, event):
+        check_hip(hip.hipEventDestroy(event))
+
+    def record(self, stream=None):
+        """Captures the work enqueued on **stream** (*None* means default stream)."""
+        s = stream.stream if isinstance(stream, Stream) else stream
+        check_hip(hip.hipEventRecord(self.event, s))
+
+    def synchronize(self):
+        """Blocks until all work captured by the event has completed."""
+        check_hip(hip.hipEventSynchronize(self.event))
+
 def device_pointer(dary):
     return dary.data.ptr
 
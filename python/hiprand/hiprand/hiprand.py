@@ -29,7 +29,7 @@ import numbers
 import numpy as np
 
 from .hip import load_hip, HIP_PATHS
-from .hip import empty, DeviceNDArray, device_pointer
+from .hip import empty, DeviceNDArray, Stream, Event, device_pointer
 
 from .utils import find_library, expand_paths
 from .finalize import track_for_finalization
@@ -189,9 +189,14 @@ class RNG(object):
 
     @stream.setter
     def stream(self, stream):
-        check_hiprand(hiprand.hiprandSetStream(self._gen, stream))
+        handle = stream.stream if isinstance(stream, Stream) else stream
+        check_hiprand(hiprand.hiprandSetStream(self._gen, handle))
         self._stream = stream
 
+    def _stream_handle(self):
+        stream = self._stream
+        return stream.stream if isinstance(stream, Stream) else stream
+
     def _generate(self, gen_func, ary, size, *args):
         if size is not None:
             if size > ary.size:
@@ -211,6 +216,19 @@ class RNG(object):
         if needs_conversion:
             dary.copy_to_host(ary)
 
+    def _generate_async(self, gen_func, ary, size, *args):
+        if isinstance(ary, np.ndarray):
+            raise TypeError(
+                "asynchronous generation requires a device-side array")
+
+        # The launch itself is asynchronous with respect to the host;
+        # the event captures it on the generator's stream
+        self._generate(gen_func, ary, size, *args)
+
+        event = Event()
+        event.record(self._stream_handle())
+        return event
+
     def generate(self, ary, size=None):
         """Generates uniformly distributed integers.
 
@@ -331,6 +349,80 @@ class RNG(object):
         else:
             raise TypeError("unsupported type {}".format(ary.dtype))
 
+    def generate_async(self, ary, size=None):
+        """Asynchronous version of :func:`generate`.
+
+        Returns as soon as the generation is enqueued on the generator's
+        stream (see the **stream** attribute); **ary** must be a
+        device-side array. Call :func:`Event.synchronize` on the returned
+        event to wait for the numbers to be ready.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        if ary.dtype in (np.uint32, np.int32):
+            return self._generate_async(hiprand.hiprandGenerate, ary, size)
+        raise TypeError("unsupported type {}".format(ary.dtype))
+
+    def uniform_async(self, ary, size=None):
+        """Asynchronous version of :func:`uniform`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        if ary.dtype == np.float32:
+            return self._generate_async(hiprand.hiprandGenerateUniform, ary, size)
+        elif ary.dtype == np.float64:
+            return self._generate_async(hiprand.hiprandGenerateUniformDouble, ary, size)
+        raise TypeError("unsupported type {}".format(ary.dtype))
+
+    def normal_async(self, ary, mean, stddev, size=None):
+        """Asynchronous version of :func:`normal`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        if ary.dtype == np.float32:
+            return self._generate_async(
+                hiprand.hiprandGenerateNormal,
+                ary, size, c_float(mean), c_float(stddev))
+        elif ary.dtype == np.float64:
+            return self._generate_async(
+                hiprand.hiprandGenerateNormalDouble,
+                ary, size, c_double(mean), c_double(stddev))
+        raise TypeError("unsupported type {}".format(ary.dtype))
+
+    def lognormal_async(self, ary, mean, stddev, size=None):
+        """Asynchronous version of :func:`lognormal`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        if ary.dtype == np.float32:
+            return self._generate_async(
+                hiprand.hiprandGenerateLogNormal,
+                ary, size, c_float(mean), c_float(stddev))
+        elif ary.dtype == np.float64:
+            return self._generate_async(
+                hiprand.hiprandGenerateLogNormalDouble,
+                ary, size, c_double(mean), c_double(stddev))
+        raise TypeError("unsupported type {}".format(ary.dtype))
+
+    def poisson_async(self, ary, lmbd, size=None):
+        """Asynchronous version of :func:`poisson`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        if ary.dtype in (np.uint32, np.int32):
+            return self._generate_async(
+                hiprand.hiprandGeneratePoisson,
+                ary, size, c_double(lmbd))
+        raise TypeError("unsupported type {}".format(ary.dtype))
+
 
 class PRNG(RNG):
     """Pseudo-random number generator.
@@ -81,6 +81,13 @@ def load_hip():
             hip.hipMalloc = cuda.cudaMalloc
             hip.hipFree = cuda.cudaFree
             hip.hipMemcpy = cuda.cudaMemcpy
+            hip.hipStreamCreate = cuda.cudaStreamCreate
+            hip.hipStreamDestroy = cuda.cudaStreamDestroy
+            hip.hipStreamSynchronize = cuda.cudaStreamSynchronize
+            hip.hipEventCreate = cuda.cudaEventCreate
+            hip.hipEventDestroy = cuda.cudaEventDestroy
+            hip.hipEventRecord = cuda.cudaEventRecord
+            hip.hipEventSynchronize = cuda.cudaEventSynchronize
 
     if hip is None:
         raise ImportError("both libcudart.so and libhip_hcc.so cannot be loaded: " +
@@ -96,6 +103,63 @@ class MemoryPointer(object):
     def _finalize(cls, ptr):
         check_hip(hip.hipFree(ptr))
 
+class Stream(object):
+    """HIP stream.
+
+    Work enqueued on different streams may execute concurrently.
+    Pass a stream to the **stream** attribute of a generator to make
+    all its kernel launches asynchronous with respect to the host.
+    """
+
+    def __init__(self):
+        self.stream = c_void_p()
+        check_hip(hip.hipStreamCreate(byref(self.stream)))
+        track_for_finalization(self, self.stream, Stream._finalize)
+
+    @classmethod
+    def _finalize(cls, stream):
+        check_hip(hip.hipStreamDestroy(stream))
+
+    def synchronize(self):
+        """Blocks until all work enqueued on the stream has completed."""
+        check_hip(hip.hipStreamSynchronize(self.stream))
+
+class Event(object):
+    """HIP event.
+
+    Returned by asynchronous generation calls; call :func:`synchronize`
+    to wait for the generated numbers to be ready.
+    """
+
+    def __init__(self):
+        self.event = c_void_p()
+        check_hip(hip.hipEventCreate(byref(self.event)))
+        track_for_finalization(self, self.event, Event._finalize)
+
+    @classmethod
+    def _finalize(cls, event):
+        check_hip(hip.hipEventDestroy(event))
+
+    def record(self, stream=None):
+        """Captures the work enqueued on **stream** (*None* means default stream)."""
+        s = stream.stream if isinstance(stream, Stream) else stream
+        check_hip(hip.hipEventRecord(self.event, s))
+
+    def synchronize(self):
+        """Blocks until all work captured by the event has completed."""
+        check_hip(hip.hipEventSynchronize(self.event))
+
+class ForeignMemoryPointer(object):
+    """Device memory owned by an external object.
+
+    Keeps a reference to the owner (e.g. a CuPy or Numba device array)
+    so the memory is not freed while this pointer is alive.
+    """
+
+    def __init__(self, ptr, owner=None):
+        self.ptr = c_void_p(ptr)
+        self.owner = owner
+
 def device_pointer(dary):
     return dary.data.ptr
 
@@ -134,6 +198,45 @@ class DeviceNDArray(object):
         else:
             self.data = data
 
+    @classmethod
+    def from_cuda_array_interface(cls, obj):
+        """Create a view of device memory of an external object.
+
+        **obj** must expose the ``__cuda_array_interface__`` attribute
+        (CuPy and Numba device arrays, PyTorch CUDA tensors etc.) and
+        must be C-contiguous and writable. No copy is made; the view
+        keeps a reference to **obj**.
+
+        :param obj: object with ``__cuda_array_interface__``
+
+        :returns: a new :class:`DeviceNDArray` sharing memory with **obj**
+        """
+        desc = obj.__cuda_array_interface__
+        shape = desc["shape"]
+        dtype = np.dtype(desc["typestr"])
+
+        strides = desc.get("strides")
+        if strides is not None:
+            contiguous = np.cumprod((dtype.itemsize,) + shape[:0:-1])[::-1]
+            if tuple(strides) != tuple(contiguous):
+                raise ValueError("only C-contiguous arrays are supported")
+
+        ptr, readonly = desc["data"]
+        if readonly:
+            raise ValueError("output array must be writable")
+
+        return cls(shape, dtype, data=ForeignMemoryPointer(ptr, owner=obj))
+
+    @property
+    def __cuda_array_interface__(self):
+        """See the CUDA Array Interface specification, version 2."""
+        return {
+            "shape": self.shape,
+            "typestr": self.dtype.str,
+            "data": (self.data.ptr.value or 0, False),
+            "version": 2,
+        }
+
     def copy_to_host(self, ary=None):
         """Copy from data device memory to host memory.
 
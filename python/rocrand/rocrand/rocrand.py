@@ -29,7 +29,7 @@ import numbers
 import numpy as np
 
 from .hip import load_hip, HIP_PATHS
-from .hip import empty, DeviceNDArray, device_pointer
+from .hip import empty, DeviceNDArray, MemoryPointer, Stream, Event, device_pointer
 
 from .utils import find_library, expand_paths
 from .finalize import track_for_finalization
@@ -109,6 +109,18 @@ def check_rocrand(status):
     if status != ROCRAND_STATUS_SUCCESS:
         raise RocRandError(status)
 
+def dtype_of(ary):
+    """Returns :class:`numpy.dtype` of **ary**.
+
+    Works for NumPy arrays and for objects exposing
+    ``__cuda_array_interface__`` (whose native dtype may not be
+    a NumPy one, e.g. PyTorch tensors).
+    """
+    desc = getattr(ary, "__cuda_array_interface__", None)
+    if desc is not None:
+        return np.dtype(desc["typestr"])
+    return ary.dtype
+
 
 class RocRandError(Exception):
     """Run-time rocRAND error."""
@@ -140,6 +152,11 @@ class RNG(object):
         if stream is not None:
             self.stream = stream
 
+        # Scratch device buffer reused when generating into NumPy arrays,
+        # so repeated generate calls do not allocate device memory
+        self._scratch = None
+        self._scratch_nbytes = 0
+
     @classmethod
     def _finalize(cls, gen):
         check_rocrand(rocrand.rocrand_destroy_generator(gen))
@@ -168,28 +185,63 @@ class RNG(object):
 
     @stream.setter
     def stream(self, stream):
-        check_rocrand(rocrand.rocrand_set_stream(self._gen, stream))
+        handle = stream.stream if isinstance(stream, Stream) else stream
+        check_rocrand(rocrand.rocrand_set_stream(self._gen, handle))
         self._stream = stream
 
-    def _generate(self, gen_func, ary, size, *args):
-        if size is not None:
-            if size > ary.size:
-                raise ValueError("requested size is greater than ary")
-        else:
-            size = ary.size
+    def _stream_handle(self):
+        stream = self._stream
+        return stream.stream if isinstance(stream, Stream) else stream
+
+    def _scratch_buffer(self, size, dtype):
+        dtype = np.dtype(dtype)
+        nbytes = dtype.itemsize * size
+        if self._scratch is None or self._scratch_nbytes < nbytes:
+            self._scratch = MemoryPointer(nbytes)
+            self._scratch_nbytes = nbytes
+        return DeviceNDArray(size, dtype, data=self._scratch)
 
+    def _generate(self, gen_func, ary, size, *args):
         if isinstance(ary, np.ndarray):
-            dary, needs_conversion = empty(size, ary.dtype), True
+            dary, needs_conversion = None, True
+            capacity = ary.size
         elif isinstance(ary, DeviceNDArray):
             dary, needs_conversion = ary, False
+            capacity = ary.size
+        elif hasattr(ary, "__cuda_array_interface__"):
+            dary, needs_conversion = DeviceNDArray.from_cuda_array_interface(ary), False
+            capacity = dary.size
         else:
             raise TypeError("unsupported type {}".format(type(ary)))
 
+        if size is not None:
+            if size > capacity:
+                raise ValueError("requested size is greater than ary")
+        else:
+            size = capacity
+
+        if dary is None:
+            dary = self._scratch_buffer(size, ary.dtype)
+
         check_rocrand(gen_func(self._gen, device_pointer(dary), c_size_t(size), *args))
 
         if needs_conversion:
             dary.copy_to_host(ary)
 
+    def _generate_async(self, gen_func, ary, size, *args):
+        if isinstance(ary, np.ndarray):
+            raise TypeError(
+                "asynchronous generation requires a device-side output; "
+                "use a DeviceNDArray or an object with __cuda_array_interface__")
+
+        # The launch itself is asynchronous with respect to the host;
+        # the event captures it on the generator's stream
+        self._generate(gen_func, ary, size, *args)
+
+        event = Event()
+        event.record(self._stream_handle())
+        return event
+
     def generate(self, ary, size=None):
         """Generates uniformly distributed integers.
 
@@ -198,16 +250,18 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
-        :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:  NumPy array (:class:`numpy.ndarray`),
+                     HIP device-side array (:class:`DeviceNDArray`) or
+                     object with ``__cuda_array_interface__`` (e.g. CuPy,
+                     Numba device arrays, PyTorch tensors)
         :param size: Number of samples to generate, default to **ary.size**
         """
-        if ary.dtype in (np.uint32, np.int32):
+        if dtype_of(ary) in (np.uint32, np.int32):
             self._generate(
                 rocrand.rocrand_generate,
                 ary, size)
         else:
-            raise TypeError("unsupported type {}".format(ary.dtype))
+            raise TypeError("unsupported type {}".format(dtype_of(ary)))
 
     def uniform(self, ary, size=None):
         """Generates uniformly distributed floats.
@@ -220,20 +274,22 @@ class RNG(object):
         Generated numbers are between 0.0 and 1.0, excluding 0.0 and
         including 1.0.
 
-        :param ary:  NumPy array (:class:`numpy.ndarray`) or
-                     HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:  NumPy array (:class:`numpy.ndarray`),
+                     HIP device-side array (:class:`DeviceNDArray`) or
+                     object with ``__cuda_array_interface__``
         :param size: Number of samples to generate, default to **ary.size**
         """
-        if ary.dtype == np.float32:
+        dtype = dtype_of(ary)
+        if dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_uniform,
                 ary, size)
-        elif ary.dtype == np.float64:
+        elif dtype == np.float64:
             self._generate(
                 rocrand.rocrand_generate_uniform_double,
                 ary, size)
         else:
-            raise TypeError("unsupported type {}".format(ary.dtype))
+            raise TypeError("unsupported type {}".format(dtype))
 
     def normal(self, ary, mean, stddev, size=None):
         """Generates normally distributed floats.
@@ -243,24 +299,26 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
-        :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:    NumPy array (:class:`numpy.ndarray`),
+                       HIP device-side array (:class:`DeviceNDArray`) or
+                       object with ``__cuda_array_interface__``
         :param mean:   Mean value of normal distribution
         :param stddev: Standard deviation value of normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
         """
-        if ary.dtype == np.float32:
+        dtype = dtype_of(ary)
+        if dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_normal,
                 ary, size,
                 c_float(mean), c_float(stddev))
-        elif ary.dtype == np.float64:
+        elif dtype == np.float64:
             self._generate(
                 rocrand.rocrand_generate_normal_double,
                 ary, size,
                 c_double(mean), c_double(stddev))
         else:
-            raise TypeError("unsupported type {}".format(ary.dtype))
+            raise TypeError("unsupported type {}".format(dtype))
 
     def lognormal(self, ary, mean, stddev, size=None):
         """Generates log-normally distributed floats.
@@ -270,24 +328,26 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.float32`, :class:`numpy.float64`.
 
-        :param ary:    NumPy array (:class:`numpy.ndarray`) or
-                       HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:    NumPy array (:class:`numpy.ndarray`),
+                       HIP device-side array (:class:`DeviceNDArray`) or
+                       object with ``__cuda_array_interface__``
         :param mean:   Mean value of log normal distribution
         :param stddev: Standard deviation value of log normal distribution
         :param size:   Number of samples to generate, default to **ary.size**
         """
-        if ary.dtype == np.float32:
+        dtype = dtype_of(ary)
+        if dtype == np.float32:
             self._generate(
                 rocrand.rocrand_generate_log_normal,
                 ary, size,
                 c_float(mean), c_float(stddev))
-        elif ary.dtype == np.float64:
+        elif dtype == np.float64:
             self._generate(
                 rocrand.rocrand_generate_log_normal_double,
                 ary, size,
                 c_double(mean), c_double(stddev))
         else:
-            raise TypeError("unsupported type {}".format(ary.dtype))
+            raise TypeError("unsupported type {}".format(dtype))
 
     def poisson(self, ary, lmbd, size=None):
         """Generates Poisson-distributed integers.
@@ -297,18 +357,96 @@ class RNG(object):
 
         Supported **dtype** of **ary**: :class:`numpy.uint32`, :class:`numpy.int32`.
 
-        :param ary:   NumPy array (:class:`numpy.ndarray`) or
-                      HIP device-side array (:class:`DeviceNDArray`)
+        :param ary:   NumPy array (:class:`numpy.ndarray`),
+                      HIP device-side array (:class:`DeviceNDArray`) or
+                      object with ``__cuda_array_interface__``
         :param lmbd:  lambda for the Poisson distribution
         :param size:  Number of samples to generate, default to **ary.size**
         """
-        if ary.dtype in (np.uint32, np.int32):
+        if dtype_of(ary) in (np.uint32, np.int32):
             self._generate(
                 rocrand.rocrand_generate_poisson,
                 ary, size,
                 c_double(lmbd))
         else:
-            raise TypeError("unsupported type {}".format(ary.dtype))
+            raise TypeError("unsupported type {}".format(dtype_of(ary)))
+
+    def generate_async(self, ary, size=None):
+        """Asynchronous version of :func:`generate`.
+
+        Returns as soon as the generation is enqueued on the generator's
+        stream (see the **stream** attribute); **ary** must be a
+        device-side array. Call :func:`Event.synchronize` on the returned
+        event to wait for the numbers to be ready.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        if dtype_of(ary) in (np.uint32, np.int32):
+            return self._generate_async(rocrand.rocrand_generate, ary, size)
+        raise TypeError("unsupported type {}".format(dtype_of(ary)))
+
+    def uniform_async(self, ary, size=None):
+        """Asynchronous version of :func:`uniform`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        dtype = dtype_of(ary)
+        if dtype == np.float32:
+            return self._generate_async(rocrand.rocrand_generate_uniform, ary, size)
+        elif dtype == np.float64:
+            return self._generate_async(rocrand.rocrand_generate_uniform_double, ary, size)
+        raise TypeError("unsupported type {}".format(dtype))
+
+    def normal_async(self, ary, mean, stddev, size=None):
+        """Asynchronous version of :func:`normal`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        dtype = dtype_of(ary)
+        if dtype == np.float32:
+            return self._generate_async(
+                rocrand.rocrand_generate_normal,
+                ary, size, c_float(mean), c_float(stddev))
+        elif dtype == np.float64:
+            return self._generate_async(
+                rocrand.rocrand_generate_normal_double,
+                ary, size, c_double(mean), c_double(stddev))
+        raise TypeError("unsupported type {}".format(dtype))
+
+    def lognormal_async(self, ary, mean, stddev, size=None):
+        """Asynchronous version of :func:`lognormal`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        dtype = dtype_of(ary)
+        if dtype == np.float32:
+            return self._generate_async(
+                rocrand.rocrand_generate_log_normal,
+                ary, size, c_float(mean), c_float(stddev))
+        elif dtype == np.float64:
+            return self._generate_async(
+                rocrand.rocrand_generate_log_normal_double,
+                ary, size, c_double(mean), c_double(stddev))
+        raise TypeError("unsupported type {}".format(dtype))
+
+    def poisson_async(self, ary, lmbd, size=None):
+        """Asynchronous version of :func:`poisson`.
+
+        See :func:`generate_async`.
+
+        :returns: :class:`Event` recorded after the generation
+        """
+        if dtype_of(ary) in (np.uint32, np.int32):
+            return self._generate_async(
+                rocrand.rocrand_generate_poisson,
+                ary, size, c_double(lmbd))
+        raise TypeError("unsupported type {}".format(dtype_of(ary)))
 
 
 class PRNG(RNG):
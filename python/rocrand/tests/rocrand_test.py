@@ -262,6 +262,40 @@ class TestGenerate(TestRNGBase):
             self.assertAlmostEqual(output.mean(), lambda_value, delta=max(1.0, lambda_value * 1e-1))
             self.assertAlmostEqual(output.var(), lambda_value, delta=max(1.0, lambda_value * 1e-1))
 
+    def test_cuda_array_interface(self):
+        class Foreign(object):
+            def __init__(self, dary):
+                self._dary = dary
+                self.__cuda_array_interface__ = dary.__cuda_array_interface__
+
+        d_output = empty(OUTPUT_SIZE, np.float32)
+        self.rng.uniform(Foreign(d_output))
+        output = d_output.copy_to_host()
+
+        self.assertAlmostEqual(output.mean(), 0.5, delta=0.2)
+        self.assertAlmostEqual(output.std(), math.sqrt(1 / 12.0), delta=0.2 * math.sqrt(1 / 12.0))
+
+    def test_uniform_async(self):
+        stream = Stream()
+        self.rng.stream = stream
+
+        d_output = empty(OUTPUT_SIZE, np.float32)
+        event = self.rng.uniform_async(d_output)
+        event.synchronize()
+        output = d_output.copy_to_host()
+
+        self.assertAlmostEqual(output.mean(), 0.5, delta=0.2)
+
+        with self.assertRaises(TypeError):
+            self.rng.uniform_async(np.empty(100, np.float32))
+
+    def test_scratch_buffer_reuse(self):
+        output = np.empty(OUTPUT_SIZE, np.float32)
+        self.rng.uniform(output)
+        scratch = self.rng._scratch
+        self.rng.uniform(output)
+        self.assertIs(self.rng._scratch, scratch)
+
     def test_size(self):
         output = np.full(OUTPUT_SIZE * 2, 10.0, dtype=np.float64)
         self.rng.uniform(output, size=OUTPUT_SIZE)
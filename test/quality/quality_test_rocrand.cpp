@@ -0,0 +1,448 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// GPU-accelerated quality harness. Generator output stays resident on
+// the device and is reduced to chi-square and Kolmogorov-Smirnov
+// statistics by histogram kernels, so screening an engine or ordering
+// change takes minutes instead of the days of host-bound readback the
+// Crush suite needs. Two modes:
+//
+//   default      chi-square (256 bins) and KS (2^20 bins) tests on raw
+//                engine output; suspicious p-values (below --alpha or
+//                above 1 - alpha) fail the run with a non-zero exit
+//   --pipe       stream raw 32-bit output to stdout for the deep tests,
+//                e.g.  quality_test_rocrand --pipe --engine xorwow \
+//                          | RNG_test stdin32
+//                The generator writes into mapped pinned memory, so the
+//                data makes exactly one trip to PractRand
+//
+// The KS statistic is computed from a fine histogram rather than a
+// sort; with 2^20 bins the resolution of D is 2^-20, which is two
+// orders of magnitude below the expected D for the default sample
+// count. Use the Crush suite or PractRand for verdicts near the
+// threshold. Note that quasi-random engines are *expected* to trip the
+// upper p-value bound: being more uniform than random is their job.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include <algorithm>
+
+#include "../crush/cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cerr << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status status = condition;           \
+    if(status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cerr << "ROCRAND error: " << status << " line: " << __LINE__ << std::endl; \
+        exit(status); \
+    } \
+  }
+
+const size_t chunk_size = 1 << 24;
+
+const unsigned int chi_square_bins = 1 << 8;
+const unsigned int ks_bins = 1 << 20;
+
+// Shared-memory histogram for the coarse chi-square bins; values are
+// binned by their top bits so every output bit pattern contributes
+__global__
+void histogram_shared_kernel(const unsigned int * data,
+                             const size_t size,
+                             unsigned long long * histogram,
+                             const unsigned int shift)
+{
+    __shared__ unsigned int partial[chi_square_bins];
+
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    for (unsigned int bin = hipThreadIdx_x; bin < chi_square_bins; bin += hipBlockDim_x)
+    {
+        partial[bin] = 0;
+    }
+    __syncthreads();
+
+    for (size_t index = state_id; index < size; index += stride)
+    {
+        atomicAdd(&partial[data[index] >> shift], 1u);
+    }
+    __syncthreads();
+
+    for (unsigned int bin = hipThreadIdx_x; bin < chi_square_bins; bin += hipBlockDim_x)
+    {
+        atomicAdd(&histogram[bin], static_cast<unsigned long long>(partial[bin]));
+    }
+}
+
+// Global-memory histogram for the fine KS bins (too many for shared
+// memory; contention is negligible at 2^20 bins)
+__global__
+void histogram_global_kernel(const unsigned int * data,
+                             const size_t size,
+                             unsigned long long * histogram,
+                             const unsigned int shift)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int stride = hipGridDim_x * hipBlockDim_x;
+
+    for (size_t index = state_id; index < size; index += stride)
+    {
+        atomicAdd(&histogram[data[index] >> shift], 1ULL);
+    }
+}
+
+// Regularized incomplete gamma functions (series and continued
+// fraction), used for the chi-square p-value
+double gamma_p_series(const double a, const double x)
+{
+    double ap = a;
+    double sum = 1.0 / a;
+    double del = sum;
+    for (int i = 0; i < 1000; i++)
+    {
+        ap += 1.0;
+        del *= x / ap;
+        sum += del;
+        if (std::abs(del) < std::abs(sum) * 1e-15)
+        {
+            break;
+        }
+    }
+    return sum * std::exp(-x + a * std::log(x) - std::lgamma(a));
+}
+
+double gamma_q_continued_fraction(const double a, const double x)
+{
+    const double tiny = 1e-300;
+    double b = x + 1.0 - a;
+    double c = 1.0 / tiny;
+    double d = 1.0 / b;
+    double h = d;
+    for (int i = 1; i < 1000; i++)
+    {
+        const double an = -i * (i - a);
+        b += 2.0;
+        d = an * d + b;
+        if (std::abs(d) < tiny) d = tiny;
+        c = b + an / c;
+        if (std::abs(c) < tiny) c = tiny;
+        d = 1.0 / d;
+        const double del = d * c;
+        h *= del;
+        if (std::abs(del - 1.0) < 1e-15)
+        {
+            break;
+        }
+    }
+    return h * std::exp(-x + a * std::log(x) - std::lgamma(a));
+}
+
+// P(chi2 > stat) for the given degrees of freedom
+double chi_square_p_value(const double stat, const double dof)
+{
+    const double a = 0.5 * dof;
+    const double x = 0.5 * stat;
+    if (x <= 0.0)
+    {
+        return 1.0;
+    }
+    if (x < a + 1.0)
+    {
+        return 1.0 - gamma_p_series(a, x);
+    }
+    return gamma_q_continued_fraction(a, x);
+}
+
+// P(D > d) from the asymptotic Kolmogorov distribution
+double kolmogorov_p_value(const double d, const double n)
+{
+    const double sqrt_n = std::sqrt(n);
+    const double lambda = (sqrt_n + 0.12 + 0.11 / sqrt_n) * d;
+    double sum = 0.0;
+    double sign = 1.0;
+    for (int j = 1; j <= 100; j++)
+    {
+        const double term = std::exp(-2.0 * j * j * lambda * lambda);
+        sum += sign * term;
+        if (term < 1e-15)
+        {
+            break;
+        }
+        sign = -sign;
+    }
+    return std::min(1.0, std::max(0.0, 2.0 * sum));
+}
+
+bool check_p_value(const std::string& name, const double stat,
+                   const double p, const double alpha)
+{
+    const bool suspicious = p < alpha || p > 1.0 - alpha;
+    std::cout << std::fixed << std::setprecision(6)
+        << "  " << name << ": statistic = " << stat
+        << ", p-value = " << p
+        << (suspicious ? "  FAILED" : "")
+        << std::endl;
+    return !suspicious;
+}
+
+struct device_histogram
+{
+    unsigned long long * data;
+    unsigned int bins;
+
+    device_histogram(unsigned int bins) : bins(bins)
+    {
+        HIP_CHECK(hipMalloc((void **)&data, bins * sizeof(unsigned long long)));
+        HIP_CHECK(hipMemset(data, 0, bins * sizeof(unsigned long long)));
+    }
+
+    ~device_histogram()
+    {
+        HIP_CHECK(hipFree(data));
+    }
+
+    std::vector<unsigned long long> read() const
+    {
+        std::vector<unsigned long long> h(bins);
+        HIP_CHECK(hipMemcpy(h.data(), data, bins * sizeof(unsigned long long),
+                            hipMemcpyDeviceToHost));
+        return h;
+    }
+};
+
+bool run_tests(const rocrand_rng_type rng_type,
+               const unsigned long long seed,
+               const size_t samples,
+               const double alpha)
+{
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, chunk_size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    if (seed > 0)
+    {
+        // Quasi-random generators return TYPE_ERROR here; their
+        // sequence does not depend on a seed
+        rocrand_status status = rocrand_set_seed(generator, seed);
+        if (status != ROCRAND_STATUS_TYPE_ERROR)
+        {
+            ROCRAND_CHECK(status);
+        }
+    }
+
+    device_histogram chi_square_histogram(chi_square_bins);
+    device_histogram ks_histogram(ks_bins);
+
+    size_t generated = 0;
+    while (generated < samples)
+    {
+        const size_t n = std::min(chunk_size, samples - generated);
+        ROCRAND_CHECK(rocrand_generate(generator, data, n));
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(histogram_shared_kernel),
+            dim3(128), dim3(256), 0, 0,
+            data, n, chi_square_histogram.data, 32 - 8
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        hipLaunchKernelGGL(
+            HIP_KERNEL_NAME(histogram_global_kernel),
+            dim3(128), dim3(256), 0, 0,
+            data, n, ks_histogram.data, 32 - 20
+        );
+        HIP_CHECK(hipPeekAtLastError());
+        generated += n;
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    bool passed = true;
+
+    // Chi-square against the uniform expectation
+    {
+        const auto histogram = chi_square_histogram.read();
+        const double expected = static_cast<double>(samples) / chi_square_bins;
+        double stat = 0.0;
+        for (unsigned int bin = 0; bin < chi_square_bins; bin++)
+        {
+            const double d = histogram[bin] - expected;
+            stat += d * d / expected;
+        }
+        passed &= check_p_value("chi-square", stat,
+            chi_square_p_value(stat, chi_square_bins - 1), alpha);
+    }
+
+    // KS from the fine histogram: the empirical CDF is exact at bin
+    // edges, so D is resolved to one bin width
+    {
+        const auto histogram = ks_histogram.read();
+        double d = 0.0;
+        unsigned long long cumulative = 0;
+        for (unsigned int bin = 0; bin < ks_bins; bin++)
+        {
+            cumulative += histogram[bin];
+            const double empirical = static_cast<double>(cumulative) / samples;
+            const double uniform = static_cast<double>(bin + 1) / ks_bins;
+            d = std::max(d, std::abs(empirical - uniform));
+        }
+        passed &= check_p_value("ks", d,
+            kolmogorov_p_value(d, static_cast<double>(samples)), alpha);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+    return passed;
+}
+
+// Streams raw 32-bit output to stdout until the pipe is closed (or
+// the requested byte count is reached). The generator writes into
+// mapped pinned memory, so no separate device-to-host copy is needed.
+void run_pipe(const rocrand_rng_type rng_type,
+              const unsigned long long seed,
+              const unsigned long long pipe_bytes)
+{
+    unsigned int * host_data;
+    unsigned int * device_data;
+    HIP_CHECK(hipHostMalloc((void **)&host_data,
+                            chunk_size * sizeof(unsigned int),
+                            hipHostMallocMapped));
+    HIP_CHECK(hipHostGetDevicePointer((void **)&device_data, host_data, 0));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    if (seed > 0)
+    {
+        rocrand_status status = rocrand_set_seed(generator, seed);
+        if (status != ROCRAND_STATUS_TYPE_ERROR)
+        {
+            ROCRAND_CHECK(status);
+        }
+    }
+
+    unsigned long long written = 0;
+    while (pipe_bytes == 0 || written < pipe_bytes)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, device_data, chunk_size));
+        HIP_CHECK(hipDeviceSynchronize());
+        const size_t bytes = chunk_size * sizeof(unsigned int);
+        if (std::fwrite(host_data, 1, bytes, stdout) != bytes)
+        {
+            break;
+        }
+        written += bytes;
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipHostFree(host_data));
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "sobol32",
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+    parser.set_optional<std::vector<std::string>>("engine", "engine", {"philox"},
+        "space-separated list of random number engines, or all");
+    parser.set_optional<unsigned long long>("seed", "seed", 0,
+        "seed (0 keeps the default seed)");
+    parser.set_optional<size_t>("samples", "samples", size_t(1) << 30,
+        "number of 32-bit samples per statistical test");
+    parser.set_optional<double>("alpha", "alpha", 1e-6,
+        "significance level; p-values below alpha or above 1 - alpha fail");
+    parser.set_optional<bool>("pipe", "pipe", false,
+        "stream raw 32-bit output to stdout (for PractRand et al.)");
+    parser.set_optional<unsigned long long>("pipe-bytes", "pipe-bytes", 0,
+        "stop the pipe after this many bytes (0 streams until closed)");
+    parser.run_and_exit_if_error();
+
+    std::vector<std::string> engines;
+    {
+        auto es = parser.get<std::vector<std::string>>("engine");
+        if (std::find(es.begin(), es.end(), "all") != es.end())
+        {
+            engines = all_engines;
+        }
+        else
+        {
+            for (auto e : all_engines)
+            {
+                if (std::find(es.begin(), es.end(), e) != es.end())
+                    engines.push_back(e);
+            }
+        }
+    }
+    if (engines.empty())
+    {
+        std::cerr << "Wrong engine name" << std::endl;
+        return 1;
+    }
+
+    const unsigned long long seed = parser.get<unsigned long long>("seed");
+
+    bool passed = true;
+    for (auto engine : engines)
+    {
+        rocrand_rng_type rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        if (engine == "xorwow")
+            rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+        else if (engine == "mrg32k3a")
+            rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+        else if (engine == "philox")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if (engine == "sobol32")
+            rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+        else if (engine == "mtgp32")
+            rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+
+        if (parser.get<bool>("pipe"))
+        {
+            // Only one engine can feed a pipe
+            run_pipe(rng_type, seed, parser.get<unsigned long long>("pipe-bytes"));
+            return 0;
+        }
+
+        std::cout << engine << ":" << std::endl;
+        passed &= run_tests(rng_type, seed,
+            parser.get<size_t>("samples"), parser.get<double>("alpha"));
+    }
+
+    return passed ? 0 : 1;
+}
@@ -532,6 +532,88 @@ TEST(hiprand_kernel_h_xorwow, hiprand_normal)
     hiprand_kernel_h_hiprand_normal_test<state_type>();
 }
 
+struct affine_transform
+{
+    float a;
+    float b;
+
+    __device__
+    float operator()(float x) const
+    {
+        return a * x + b;
+    }
+};
+
+__global__
+void hiprand_normal_transformed_kernel(float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    hiprandStatePhilox4_32_10_t state;
+    hiprand_init(12345, state_id, 0, &state);
+    const affine_transform transform = { 2.0f, 5.0f };
+
+    // 6 values per draw batch exercise both the four-wide path and
+    // the scalar tail
+    float values[6];
+    unsigned int index = state_id * 6;
+    const unsigned int stride = global_size * 6;
+    while(index < size)
+    {
+        hiprand_normal_transformed_n(&state, values, transform);
+        values[0] = hiprand_normal_transformed(&state, transform);
+        for(unsigned int i = 0; i < 6; i++)
+        {
+            if(index + i < size)
+                output[index + i] = values[i];
+        }
+        index += stride;
+    }
+}
+
+TEST(hiprand_kernel_h_philox4x32_10, hiprand_normal_transformed)
+{
+    const size_t output_size = 8190;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(hiprand_normal_transformed_kernel),
+        dim3(4), dim3(64), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 5.0, 0.4);
+
+    double stddev = 0;
+    for(auto v : output_host)
+    {
+        stddev += std::pow(static_cast<double>(v) - mean, 2);
+    }
+    stddev = std::sqrt(stddev / output_size);
+    EXPECT_NEAR(stddev, 2.0, 0.4);
+}
+
 template<class T>
 void hiprand_kernel_h_hiprand_log_normal_test()
 {
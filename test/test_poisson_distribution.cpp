@@ -130,3 +130,92 @@ const double lambdas[] = { 1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0 };
 INSTANTIATE_TEST_CASE_P(poisson_distribution_tests,
                         poisson_distribution_tests,
                         ::testing::ValuesIn(lambdas));
+
+// Alternating between lambdas must reuse the cached tables instead of
+// rebuilding them; the tables are identified by their allocations
+TEST(poisson_distribution_manager_tests, cache_hit_test)
+{
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> manager;
+
+    manager.set_lambda(5.5);
+    const double * probability0 = manager.dis.probability;
+    const unsigned int size0 = manager.dis.size;
+    ASSERT_NE(probability0, static_cast<const double *>(NULL));
+
+    manager.set_lambda(20.0);
+    ASSERT_NE(manager.dis.probability, static_cast<const double *>(NULL));
+
+    // Setting the active lambda again is a no-op
+    manager.set_lambda(20.0);
+
+    manager.set_lambda(5.5);
+    EXPECT_EQ(manager.dis.probability, probability0);
+    EXPECT_EQ(manager.dis.size, size0);
+}
+
+// Check that the distributions stay correct while the manager switches
+// between cached lambdas
+TEST(poisson_distribution_manager_tests, alternating_lambda_test)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> manager;
+
+    const double lambdas[] = { 1.0, 5.5, 20.0, 100.0 };
+    const size_t lambdas_count = sizeof(lambdas) / sizeof(lambdas[0]);
+    const size_t rounds = 4;
+    const size_t samples_count = 100000;
+
+    std::vector<unsigned int> values(samples_count);
+    for (size_t round = 0; round < rounds; round++)
+    {
+        for (size_t li = 0; li < lambdas_count; li++)
+        {
+            const double lambda = lambdas[li];
+            manager.set_lambda(lambda);
+
+            for (size_t si = 0; si < samples_count; si++)
+            {
+                values[si] = manager.dis(gen());
+            }
+
+            const double mean = get_mean(values);
+            const double variance = get_variance(values, mean);
+
+            EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 1e-2));
+            EXPECT_NEAR(variance, lambda, std::max(1.0, lambda * 2e-2));
+        }
+    }
+}
+
+// More distinct lambdas than the cache holds; evicted tables must be
+// rebuilt correctly when their lambda comes around again
+TEST(poisson_distribution_manager_tests, eviction_test)
+{
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    poisson_distribution_manager<ROCRAND_DISCRETE_METHOD_ALIAS, true> manager;
+
+    const size_t lambdas_count = 40;
+    const size_t samples_count = 20000;
+
+    std::vector<unsigned int> values(samples_count);
+    for (size_t round = 0; round < 2; round++)
+    {
+        for (size_t li = 0; li < lambdas_count; li++)
+        {
+            const double lambda = 10.0 + 5.0 * li;
+            manager.set_lambda(lambda);
+
+            for (size_t si = 0; si < samples_count; si++)
+            {
+                values[si] = manager.dis(gen());
+            }
+
+            const double mean = get_mean(values);
+            EXPECT_NEAR(mean, lambda, std::max(1.0, lambda * 2e-2));
+        }
+    }
+}
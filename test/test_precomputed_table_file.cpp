@@ -0,0 +1,86 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <rng/table_file.hpp>
+
+// The table file is mapped once per process when the singleton first
+// resolves a name, so the file must exist and ROCRAND_TABLE_FILE must
+// name it before the first lookup. All scenarios that need a mapped
+// file therefore live in this one test; the unmapped fallback path is
+// what every other test executable in the suite runs through.
+#ifndef _WIN32
+TEST(precomputed_table_file_tests, lookup_test)
+{
+    const unsigned int table[4] = { 11u, 22u, 33u, 44u };
+    const unsigned int fallback[2] = { 55u, 66u };
+
+    const std::string path = "test_precomputed_table_file.tmp.bin";
+    {
+        std::ofstream fout(path, std::ios_base::out | std::ios_base::trunc
+                                     | std::ios_base::binary);
+        ASSERT_TRUE(fout.good());
+        const unsigned int version = 1;
+        const unsigned int count = 1;
+        char name[48] = "test_table";
+        const unsigned long long offset = 16 + 64;
+        const unsigned long long bytes = sizeof(table);
+        fout.write("ROCRTBL\0", 8);
+        fout.write(reinterpret_cast<const char *>(&version), sizeof(version));
+        fout.write(reinterpret_cast<const char *>(&count), sizeof(count));
+        fout.write(name, sizeof(name));
+        fout.write(reinterpret_cast<const char *>(&offset), sizeof(offset));
+        fout.write(reinterpret_cast<const char *>(&bytes), sizeof(bytes));
+        fout.write(reinterpret_cast<const char *>(table), sizeof(table));
+        ASSERT_TRUE(fout.good());
+    }
+    ASSERT_EQ(setenv("ROCRAND_TABLE_FILE", path.c_str(), 1), 0);
+
+    typedef rocrand_host::detail::precomputed_table_file table_file;
+    ASSERT_TRUE(table_file::mapped());
+
+    // A carried name resolves into the mapping
+    size_t bytes = 0;
+    const void * data =
+        table_file::lookup("test_table", fallback, sizeof(fallback), &bytes);
+    ASSERT_NE(data, static_cast<const void *>(NULL));
+    EXPECT_NE(data, static_cast<const void *>(fallback));
+    EXPECT_EQ(bytes, sizeof(table));
+    EXPECT_EQ(std::memcmp(data, table, sizeof(table)), 0);
+
+    // A name the file does not carry falls back to the compiled-in table
+    data = table_file::lookup("no_such_table", fallback, sizeof(fallback), &bytes);
+    EXPECT_EQ(data, static_cast<const void *>(fallback));
+    EXPECT_EQ(bytes, sizeof(fallback));
+
+    // The size output is optional
+    data = table_file::lookup("test_table", fallback, sizeof(fallback));
+    EXPECT_NE(data, static_cast<const void *>(fallback));
+
+    std::remove(path.c_str());
+}
+#endif // _WIN32
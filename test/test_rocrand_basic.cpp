@@ -43,6 +43,28 @@ TEST(rocrand_basic_tests, rocrand_generator_test)
     EXPECT_EQ(gen, static_cast<rocrand_generator>(0));
 }
 
+TEST(rocrand_basic_tests, rocrand_device_states_test)
+{
+    size_t state_size = 0;
+    EXPECT_EQ(rocrand_get_device_state_size(ROCRAND_RNG_PSEUDO_XORWOW, NULL),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_get_device_state_size(ROCRAND_RNG_PSEUDO_MTGP32, &state_size),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_get_device_state_size(ROCRAND_RNG_PSEUDO_XORWOW, &state_size));
+    EXPECT_GT(state_size, 0u);
+
+    void * states = NULL;
+    EXPECT_EQ(rocrand_create_device_states(ROCRAND_RNG_PSEUDO_XORWOW, 0, 0, &states),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_create_device_states(ROCRAND_RNG_PSEUDO_MTGP32, 256, 0, &states),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_create_device_states(ROCRAND_RNG_PSEUDO_XORWOW,
+                                               256 * 64, 12345ULL, &states));
+    HIP_CHECK(hipDeviceSynchronize());
+    ROCRAND_CHECK(rocrand_destroy_device_states(states));
+    EXPECT_EQ(rocrand_destroy_device_states(NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+}
+
 TEST_P(rocrand_basic_tests, rocrand_create_destroy_generator_test)
 {
     const rocrand_rng_type rng_type = GetParam();
@@ -58,8 +58,14 @@ TEST(rocrand_cpp_wrapper, rocrand_rng_ctor)
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::philox4x32_10>());
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::mrg32k3a>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::threefry4x32_20>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::mrg31k3p>());
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::mtgp32>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::mt19937>());
     ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::sobol32>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::sobol64>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::scrambled_sobol32>());
+    ASSERT_NO_THROW(rocrand_rng_ctor_template<rocrand_cpp::scrambled_sobol64>());
 }
 
 template<class T>
@@ -78,10 +84,14 @@ TEST(rocrand_cpp_wrapper, rocrand_prng_ctor)
     ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::philox4x32_10>());
     ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::mrg32k3a>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::threefry4x32_20>());
+    ASSERT_NO_THROW(rocrand_prng_ctor_template<rocrand_cpp::mrg31k3p>());
 
-    // mtgp32 does not have ctor with offset
+    // mtgp32 and mt19937 do not have ctors with offset
     rocrand_cpp::mtgp32();
     rocrand_cpp::mtgp32(11ULL);
+    rocrand_cpp::mt19937();
+    rocrand_cpp::mt19937(11ULL);
 }
 
 template<class T1, class T2>
@@ -95,8 +105,14 @@ TEST(rocrand_cpp_wrapper, rocrand_rng_result_type)
     assert_same_types<unsigned int, rocrand_cpp::philox4x32_10::result_type>();
     assert_same_types<unsigned int, rocrand_cpp::xorwow::result_type>();
     assert_same_types<unsigned int, rocrand_cpp::mrg32k3a::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::threefry4x32_20::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::mrg31k3p::result_type>();
     assert_same_types<unsigned int, rocrand_cpp::mtgp32::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::mt19937::result_type>();
     assert_same_types<unsigned int, rocrand_cpp::sobol32::result_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::sobol64::result_type>();
+    assert_same_types<unsigned int, rocrand_cpp::scrambled_sobol32::result_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::scrambled_sobol64::result_type>();
 }
 
 TEST(rocrand_cpp_wrapper, rocrand_rng_offset_type)
@@ -104,8 +120,12 @@ TEST(rocrand_cpp_wrapper, rocrand_rng_offset_type)
     assert_same_types<unsigned long long, rocrand_cpp::philox4x32_10::offset_type>();
     assert_same_types<unsigned long long, rocrand_cpp::xorwow::offset_type>();
     assert_same_types<unsigned long long, rocrand_cpp::mrg32k3a::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::threefry4x32_20::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::mrg31k3p::offset_type>();
     assert_same_types<unsigned long long, rocrand_cpp::mtgp32::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::mt19937::offset_type>();
     assert_same_types<unsigned long long, rocrand_cpp::sobol32::offset_type>();
+    assert_same_types<unsigned long long, rocrand_cpp::sobol64::offset_type>();
 }
 
 TEST(rocrand_cpp_wrapper, rocrand_prng_default_seed)
@@ -113,11 +133,16 @@ TEST(rocrand_cpp_wrapper, rocrand_prng_default_seed)
     EXPECT_EQ(rocrand_cpp::philox4x32_10::default_seed, ROCRAND_PHILOX4x32_DEFAULT_SEED);
     EXPECT_EQ(rocrand_cpp::xorwow::default_seed, ROCRAND_XORWOW_DEFAULT_SEED);
     EXPECT_EQ(rocrand_cpp::mrg32k3a::default_seed, ROCRAND_MRG32K3A_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::threefry4x32_20::default_seed, ROCRAND_THREEFRY4x32_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::mrg31k3p::default_seed, ROCRAND_MRG31K3P_DEFAULT_SEED);
 }
 
 TEST(rocrand_cpp_wrapper, rocrand_qrng_default_num_dimensions)
 {
     EXPECT_EQ(rocrand_cpp::sobol32::default_num_dimensions, 1U);
+    EXPECT_EQ(rocrand_cpp::sobol64::default_num_dimensions, 1U);
+    EXPECT_EQ(rocrand_cpp::scrambled_sobol32::default_num_dimensions, 1U);
+    EXPECT_EQ(rocrand_cpp::scrambled_sobol64::default_num_dimensions, 1U);
 }
 
 template<class T>
@@ -143,6 +168,9 @@ void rocrand_qrng_ctor_template()
 TEST(rocrand_cpp_wrapper, rocrand_qrng_ctor)
 {
     ASSERT_NO_THROW(rocrand_qrng_ctor_template<rocrand_cpp::sobol32>());
+    ASSERT_NO_THROW(rocrand_qrng_ctor_template<rocrand_cpp::sobol64>());
+    ASSERT_NO_THROW(rocrand_qrng_ctor_template<rocrand_cpp::scrambled_sobol32>());
+    ASSERT_NO_THROW(rocrand_qrng_ctor_template<rocrand_cpp::scrambled_sobol64>());
 }
 
 template<class T>
@@ -158,7 +186,10 @@ TEST(rocrand_cpp_wrapper, rocrand_prng_seed)
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::philox4x32_10>());
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::mrg32k3a>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::threefry4x32_20>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::mrg31k3p>());
     ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::mtgp32>());
+    ASSERT_NO_THROW(rocrand_prng_seed_template<rocrand_cpp::mt19937>());
 }
 
 template<class T>
@@ -183,6 +214,8 @@ void rocrand_qrng_dims_template()
 TEST(rocrand_cpp_wrapper, rocrand_qrng_dims)
 {
     ASSERT_NO_THROW(rocrand_qrng_dims_template<rocrand_cpp::sobol32>());
+    ASSERT_NO_THROW(rocrand_qrng_dims_template<rocrand_cpp::sobol64>());
+    ASSERT_NO_THROW(rocrand_qrng_dims_template<rocrand_cpp::scrambled_sobol32>());
 }
 
 template<class T>
@@ -198,7 +231,10 @@ TEST(rocrand_cpp_wrapper, rocrand_rng_offset)
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::philox4x32_10>());
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::mrg32k3a>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::threefry4x32_20>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::mrg31k3p>());
     ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::sobol32>());
+    ASSERT_NO_THROW(rocrand_rng_offset_template<rocrand_cpp::sobol64>());
 }
 
 template<class T>
@@ -217,8 +253,13 @@ TEST(rocrand_cpp_wrapper, rocrand_rng_stream)
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::philox4x32_10>());
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::xorwow>());
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::mrg32k3a>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::threefry4x32_20>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::mrg31k3p>());
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::mtgp32>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::mt19937>());
     ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::sobol32>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::sobol64>());
+    ASSERT_NO_THROW(rocrand_rng_stream_template<rocrand_cpp::scrambled_sobol32>());
 }
 
 template<class T, class IntType>
@@ -270,6 +311,9 @@ TEST(rocrand_cpp_wrapper, rocrand_uniform_int_dist)
     ASSERT_NO_THROW((
         rocrand_uniform_int_dist_template<rocrand_cpp::mrg32k3a, unsigned int>()
     ));
+    ASSERT_NO_THROW((
+        rocrand_uniform_int_dist_template<rocrand_cpp::threefry4x32_20, unsigned int>()
+    ));
     ASSERT_NO_THROW((
         rocrand_uniform_int_dist_template<rocrand_cpp::mtgp32, unsigned int>()
     ));
@@ -327,12 +371,30 @@ TEST(rocrand_cpp_wrapper, rocrand_uniform_real_dist_float)
     ASSERT_NO_THROW((
         rocrand_uniform_real_dist_template<rocrand_cpp::mrg32k3a, float>()
     ));
+    ASSERT_NO_THROW((
+        rocrand_uniform_real_dist_template<rocrand_cpp::threefry4x32_20, float>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_uniform_real_dist_template<rocrand_cpp::mrg31k3p, float>()
+    ));
     ASSERT_NO_THROW((
         rocrand_uniform_real_dist_template<rocrand_cpp::mtgp32, float>()
     ));
+    ASSERT_NO_THROW((
+        rocrand_uniform_real_dist_template<rocrand_cpp::mt19937, float>()
+    ));
     ASSERT_NO_THROW((
         rocrand_uniform_real_dist_template<rocrand_cpp::sobol32, float>()
     ));
+    ASSERT_NO_THROW((
+        rocrand_uniform_real_dist_template<rocrand_cpp::sobol64, float>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_uniform_real_dist_template<rocrand_cpp::scrambled_sobol32, float>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_uniform_real_dist_template<rocrand_cpp::scrambled_sobol64, float>()
+    ));
 }
 
 TEST(rocrand_cpp_wrapper, rocrand_uniform_real_dist_double)
@@ -411,12 +473,24 @@ TEST(rocrand_cpp_wrapper, rocrand_normal_dist_float)
     ASSERT_NO_THROW((
         rocrand_normal_dist_template<rocrand_cpp::mrg32k3a, float>()
     ));
+    ASSERT_NO_THROW((
+        rocrand_normal_dist_template<rocrand_cpp::threefry4x32_20, float>()
+    ));
+    ASSERT_NO_THROW((
+        rocrand_normal_dist_template<rocrand_cpp::mrg31k3p, float>()
+    ));
     ASSERT_NO_THROW((
         rocrand_normal_dist_template<rocrand_cpp::mtgp32, float>()
     ));
+    ASSERT_NO_THROW((
+        rocrand_normal_dist_template<rocrand_cpp::mt19937, float>()
+    ));
     ASSERT_NO_THROW((
         rocrand_normal_dist_template<rocrand_cpp::sobol32, float>()
     ));
+    ASSERT_NO_THROW((
+        rocrand_normal_dist_template<rocrand_cpp::sobol64, float>()
+    ));
 }
 
 TEST(rocrand_cpp_wrapper, rocrand_normal_dist_double)
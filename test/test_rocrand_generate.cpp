@@ -19,6 +19,8 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <cmath>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -73,6 +75,519 @@ TEST(rocrand_generate_tests, simple_test_2)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST(rocrand_generate_tests, uniform_bits_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 1313;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_uniform_bits(generator, data, size, 12),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    const unsigned int bits[] = { 8, 16, 32 };
+    for(unsigned int b : bits)
+    {
+        ROCRAND_CHECK(
+            rocrand_generate_uniform_bits(generator, data, size, b)
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        float host_data[size];
+        HIP_CHECK(hipMemcpy(host_data, data, size * sizeof(float),
+                            hipMemcpyDeviceToHost));
+
+        // Values stay in (0; 1] and lie on the 2^-bits grid
+        const double scale = 1.0 / (1ull << b);
+        double sum = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_GT(host_data[i], 0.0f);
+            ASSERT_LE(host_data[i], 1.0f);
+            if(b < 32)
+            {
+                const double steps = host_data[i] / scale;
+                ASSERT_EQ(steps, std::floor(steps));
+            }
+            sum += host_data[i];
+        }
+        const double mean = sum / size;
+        ASSERT_NEAR(mean, 0.5, 0.05);
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Only the counter-based PHILOX generators slice their draws
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+    EXPECT_EQ(
+        rocrand_generate_uniform_bits(generator, data, size, 16),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, inverse_cdf_distributions_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 8192;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+
+    // The Cauchy mean is undefined; half the mass lies below the median
+    ROCRAND_CHECK(rocrand_generate_cauchy(generator, data, size, 2.0f, 0.5f));
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    size_t below = 0;
+    for(float v : host_data)
+    {
+        if(v < 2.0f) below++;
+    }
+    EXPECT_NEAR(static_cast<double>(below) / size, 0.5, 0.05);
+
+    // Weibull with shape 1 is exponential with mean equal to the scale
+    EXPECT_EQ(
+        rocrand_generate_weibull(generator, data, size, 0.0f, 2.0f),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_generate_weibull(generator, data, size, 1.0f, 2.0f));
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    double sum = 0.0;
+    for(float v : host_data)
+    {
+        ASSERT_GE(v, 0.0f);
+        sum += v;
+    }
+    EXPECT_NEAR(sum / size, 2.0, 0.2);
+
+    // The logistic distribution is symmetric around its location
+    ROCRAND_CHECK(rocrand_generate_logistic(generator, data, size, -1.0f, 0.5f));
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    sum = 0.0;
+    for(float v : host_data)
+    {
+        sum += v;
+    }
+    EXPECT_NEAR(sum / size, -1.0, 0.1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_tests, transform_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 8192;
+    unsigned int * input;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&input, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&output, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // One raw buffer feeds several distributions
+    ROCRAND_CHECK(rocrand_generate(generator, input, size));
+
+    EXPECT_EQ(
+        rocrand_transform(input, output, size,
+                          (rocrand_transform_type)999, 0.0f, 0.0f, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_transform(input + 1, output, size - 4,
+                          ROCRAND_TRANSFORM_UNIFORM, 0.0f, 0.0f, 0),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    std::vector<float> host_data(size);
+
+    ROCRAND_CHECK(
+        rocrand_transform(input, output, size,
+                          ROCRAND_TRANSFORM_EXPONENTIAL, 2.0f, 0.0f, 0)
+    );
+    HIP_CHECK(hipMemcpy(host_data.data(), output, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    double sum = 0.0;
+    for(float v : host_data)
+    {
+        ASSERT_GT(v, 0.0f);
+        sum += v;
+    }
+    EXPECT_NEAR(sum / size, 0.5, 0.05);
+
+    ROCRAND_CHECK(
+        rocrand_transform(input, output, size,
+                          ROCRAND_TRANSFORM_NORMAL, 1.0f, 2.0f, 0)
+    );
+    HIP_CHECK(hipMemcpy(host_data.data(), output, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    sum = 0.0;
+    for(float v : host_data)
+    {
+        sum += v;
+    }
+    EXPECT_NEAR(sum / size, 1.0, 0.1);
+
+    // Each double consumes two raw values
+    double * output_double;
+    HIP_CHECK(hipMalloc((void **)&output_double,
+                        (size / 2) * sizeof(double)));
+    EXPECT_EQ(
+        rocrand_transform_double(input, output_double, size / 2 - 1,
+                                 ROCRAND_TRANSFORM_UNIFORM, 0.0, 0.0, 0),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+    ROCRAND_CHECK(
+        rocrand_transform_double(input, output_double, size / 2,
+                                 ROCRAND_TRANSFORM_UNIFORM, 0.0, 0.0, 0)
+    );
+    std::vector<double> host_data_double(size / 2);
+    HIP_CHECK(hipMemcpy(host_data_double.data(), output_double,
+                        (size / 2) * sizeof(double),
+                        hipMemcpyDeviceToHost));
+    sum = 0.0;
+    for(double v : host_data_double)
+    {
+        ASSERT_GT(v, 0.0);
+        ASSERT_LE(v, 1.0);
+        sum += v;
+    }
+    EXPECT_NEAR(sum / (size / 2), 0.5, 0.05);
+
+    HIP_CHECK(hipFree(input));
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(output_double));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_tests, persistent_mode_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t chunk = 1000;
+    const size_t chunks = 64;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, chunk * chunks * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_set_persistent_mode(generator, 1));
+
+    // Many small requests become queue pushes on the resident kernel
+    for(size_t i = 0; i < chunks; i++)
+    {
+        ROCRAND_CHECK(
+            rocrand_generate_uniform(generator, data + i * chunk, chunk)
+        );
+    }
+    ROCRAND_CHECK(rocrand_persistent_synchronize(generator));
+
+    std::vector<float> host_data(chunk * chunks);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        chunk * chunks * sizeof(float),
+                        hipMemcpyDeviceToHost));
+    double sum = 0.0;
+    for(float v : host_data)
+    {
+        ASSERT_GT(v, 0.0f);
+        ASSERT_LE(v, 1.0f);
+        sum += v;
+    }
+    EXPECT_NEAR(sum / (chunk * chunks), 0.5, 0.05);
+
+    // Stopping writes the engines back; ordinary launches resume
+    ROCRAND_CHECK(rocrand_set_persistent_mode(generator, 0));
+    ROCRAND_CHECK(rocrand_generate_uniform(generator, data, chunk));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Only the PHILOX generators host the service
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+    EXPECT_EQ(
+        rocrand_set_persistent_mode(generator, 1),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+namespace {
+
+struct chunk_record
+{
+    size_t chunks;
+    size_t bytes;
+    unsigned long long sum;
+};
+
+void chunk_sum_callback(void * data, size_t bytes, void * user_data)
+{
+    chunk_record * record = static_cast<chunk_record *>(user_data);
+    const unsigned char * values = static_cast<const unsigned char *>(data);
+    for(size_t i = 0; i < bytes; i++)
+    {
+        record->sum += values[i];
+    }
+    record->chunks++;
+    record->bytes += bytes;
+}
+
+} // end anonymous namespace
+
+TEST(rocrand_generate_tests, chunks_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t total_bytes = (1 << 20) + 12345;
+    const size_t chunk_bytes = 100000;
+
+    EXPECT_EQ(
+        rocrand_generate_chunks(generator, total_bytes, 0,
+                                chunk_sum_callback, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_chunks(generator, total_bytes, chunk_bytes,
+                                NULL, NULL),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    chunk_record record = { 0, 0, 0 };
+    ROCRAND_CHECK(
+        rocrand_generate_chunks(generator, total_bytes, chunk_bytes,
+                                chunk_sum_callback, &record)
+    );
+
+    // The call returns only after the last callback completed
+    EXPECT_EQ(record.chunks, (total_bytes + chunk_bytes - 1) / chunk_bytes);
+    EXPECT_EQ(record.bytes, total_bytes);
+    EXPECT_NEAR(
+        record.sum / static_cast<double>(record.bytes), 127.5, 1.0
+    );
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // Generators without a bytes path report a type error
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_MRG32K3A
+        )
+    );
+    EXPECT_EQ(
+        rocrand_generate_chunks(generator, total_bytes, chunk_bytes,
+                                chunk_sum_callback, &record),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_tests, subsequence_test)
+{
+    const size_t size = 8192;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, 2 * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Two ranks with the same seed must produce disjoint streams
+    std::vector<unsigned int> host_data(2 * size);
+    for(unsigned int rank = 0; rank < 2; rank++)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(
+            rocrand_create_generator(
+                &generator,
+                ROCRAND_RNG_PSEUDO_MRG32K3A
+            )
+        );
+        ROCRAND_CHECK(rocrand_set_seed(generator, 707));
+
+        EXPECT_EQ(
+            rocrand_set_subsequence(generator, rank, 0),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+        EXPECT_EQ(
+            rocrand_set_subsequence(generator, 2, 2),
+            ROCRAND_STATUS_OUT_OF_RANGE
+        );
+        ROCRAND_CHECK(rocrand_set_subsequence(generator, rank, 2));
+
+        ROCRAND_CHECK(rocrand_generate(generator, data + rank * size, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(host_data.data() + rank * size, data + rank * size,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+
+    size_t matches = 0;
+    double sum = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data[i] == host_data[size + i]) matches++;
+        sum += host_data[size + i] / 4294967296.0;
+    }
+    // The partitions start 2^63 subsequences apart; identical prefixes
+    // would mean the skipahead was not applied
+    EXPECT_LT(matches, size / 100);
+    EXPECT_NEAR(sum / size, 0.5, 0.05);
+
+    // Quasi-random generators have no subsequence space to partition
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_QUASI_SOBOL32
+        )
+    );
+    EXPECT_EQ(
+        rocrand_set_subsequence(generator, 0, 2),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_tests, reseed_test)
+{
+    const size_t size = 8192;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+    ROCRAND_CHECK(rocrand_set_seed(generator, 111));
+
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    // Re-keying in place must switch to a different stream
+    ROCRAND_CHECK(rocrand_reseed(generator, 222));
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> host_data2(size);
+    HIP_CHECK(hipMemcpy(host_data2.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    size_t matches = 0;
+    double sum = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data[i] == host_data2[i]) matches++;
+        sum += host_data2[i] / 4294967296.0;
+    }
+    EXPECT_LT(matches, size / 100);
+    EXPECT_NEAR(sum / size, 0.5, 0.05);
+
+    // Non-counter-based generators fall back to set_seed() semantics:
+    // a reseeded generator restarts the stream of the new seed
+    rocrand_generator reseeded, fresh;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&reseeded, ROCRAND_RNG_PSEUDO_MRG32K3A)
+    );
+    ROCRAND_CHECK(
+        rocrand_create_generator(&fresh, ROCRAND_RNG_PSEUDO_MRG32K3A)
+    );
+    ROCRAND_CHECK(rocrand_set_seed(reseeded, 111));
+    ROCRAND_CHECK(rocrand_generate(reseeded, data, size));
+    ROCRAND_CHECK(rocrand_reseed(reseeded, 333));
+    ROCRAND_CHECK(rocrand_generate(reseeded, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_set_seed(fresh, 333));
+    ROCRAND_CHECK(rocrand_generate(fresh, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipMemcpy(host_data2.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_destroy_generator(reseeded));
+    ROCRAND_CHECK(rocrand_destroy_generator(fresh));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], host_data2[i]);
+    }
+
+    // Quasi-random generators take no seed
+    rocrand_generator qgenerator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&qgenerator, ROCRAND_RNG_QUASI_SOBOL32)
+    );
+    EXPECT_EQ(
+        rocrand_reseed(qgenerator, 111),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(qgenerator));
+
+    HIP_CHECK(hipFree(data));
+}
+
 TEST(rocrand_generate_tests, simple_neg_test)
 {
     const size_t size = 256;
@@ -0,0 +1,297 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+TEST(rocrand_generate_async_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_async(generator, data, size, NULL),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+// The asynchronous call must produce the same stream as the plain one
+TEST(rocrand_generate_async_tests, equivalence_test)
+{
+    const unsigned long long seed = 12345ULL;
+
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g0, seed));
+    ROCRAND_CHECK(rocrand_set_seed(g1, seed));
+
+    const size_t size = 12563;
+    unsigned int * data0;
+    unsigned int * data1;
+    HIP_CHECK(hipMalloc((void **)&data0, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&data1, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate(g0, data0, size));
+    ROCRAND_CHECK(rocrand_generate_async(g1, data1, size, NULL));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data0(size);
+    std::vector<unsigned int> host_data1(size);
+    HIP_CHECK(hipMemcpy(host_data0.data(), data0,
+                        size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_data1.data(), data1,
+                        size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data0[i], host_data1[i]) << "where i = " << i;
+    }
+
+    HIP_CHECK(hipFree(data0));
+    HIP_CHECK(hipFree(data1));
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+// Waiting on the recorded event from another stream must order the
+// consumer after the generation kernel
+TEST(rocrand_generate_async_tests, event_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    hipStream_t gen_stream;
+    hipStream_t copy_stream;
+    HIP_CHECK(hipStreamCreateWithFlags(&gen_stream, hipStreamNonBlocking));
+    HIP_CHECK(hipStreamCreateWithFlags(&copy_stream, hipStreamNonBlocking));
+    ROCRAND_CHECK(rocrand_set_stream(generator, gen_stream));
+
+    hipEvent_t event;
+    HIP_CHECK(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    const size_t size = 131072;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_async(generator, data, size, event));
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipStreamWaitEvent(copy_stream, event, 0));
+    HIP_CHECK(hipMemcpyAsync(host_data.data(), data,
+                             size * sizeof(unsigned int),
+                             hipMemcpyDeviceToHost, copy_stream));
+    HIP_CHECK(hipStreamSynchronize(copy_stream));
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipEventDestroy(event));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(gen_stream));
+    HIP_CHECK(hipStreamDestroy(copy_stream));
+}
+
+TEST(rocrand_generate_async_tests, uniform_float_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW)
+    );
+
+    hipEvent_t event;
+    HIP_CHECK(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    const size_t size = 131072;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_uniform_async(generator, data, size, event));
+    HIP_CHECK(hipEventSynchronize(event));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const double mean = sum / size;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipEventDestroy(event));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_async_tests, uniform_double_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW)
+    );
+
+    hipEvent_t event;
+    HIP_CHECK(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    const size_t size = 131072;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_uniform_double_async(generator, data, size, event));
+    HIP_CHECK(hipEventSynchronize(event));
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(double), hipMemcpyDeviceToHost));
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0);
+        ASSERT_LE(host_data[i], 1.0);
+        sum += host_data[i];
+    }
+    const double mean = sum / size;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipEventDestroy(event));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_async_tests, normal_float_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    hipEvent_t event;
+    HIP_CHECK(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    const size_t size = 131072;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_async(generator, data, size, 2.0f, 5.0f, event)
+    );
+    HIP_CHECK(hipEventSynchronize(event));
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    double std = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = std::sqrt(std / size);
+
+    EXPECT_NEAR(2.0, mean, 0.4); // 20%
+    EXPECT_NEAR(5.0, std, 1.0); // 20%
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipEventDestroy(event));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_async_tests, normal_double_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    hipEvent_t event;
+    HIP_CHECK(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+
+    const size_t size = 131072;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_double_async(generator, data, size, 2.0, 5.0, event)
+    );
+    HIP_CHECK(hipEventSynchronize(event));
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(double), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    double std = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = std::sqrt(std / size);
+
+    EXPECT_NEAR(2.0, mean, 0.4); // 20%
+    EXPECT_NEAR(5.0, std, 1.0); // 20%
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipEventDestroy(event));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
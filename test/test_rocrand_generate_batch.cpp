@@ -0,0 +1,187 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+TEST(rocrand_generate_batch_tests, neg_test)
+{
+    unsigned int * buffers[1] = { NULL };
+    const size_t sizes[1] = { 256 };
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, buffers, sizes, 1),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, buffers, sizes, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, NULL, sizes, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, buffers, NULL, 1),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_batch_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW)
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int * buffers[1] = { data };
+    const size_t sizes[1] = { size };
+    EXPECT_EQ(
+        rocrand_generate_batch(generator, buffers, sizes, 1),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// With every buffer size a multiple of 4 the batched call must match
+// buffer-by-buffer rocrand_generate() calls bit for bit
+TEST(rocrand_generate_batch_tests, equivalence_test)
+{
+    const unsigned long long seed = 12345ULL;
+    const size_t sizes[] = { 4096, 256, 131072, 12564 };
+    const int count = sizeof(sizes) / sizeof(sizes[0]);
+
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g0, seed));
+    ROCRAND_CHECK(rocrand_set_seed(g1, seed));
+
+    unsigned int * buffers0[count];
+    unsigned int * buffers1[count];
+    for(int b = 0; b < count; b++)
+    {
+        HIP_CHECK(hipMalloc((void **)&buffers0[b], sizes[b] * sizeof(unsigned int)));
+        HIP_CHECK(hipMalloc((void **)&buffers1[b], sizes[b] * sizeof(unsigned int)));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(int b = 0; b < count; b++)
+    {
+        ROCRAND_CHECK(rocrand_generate(g0, buffers0[b], sizes[b]));
+    }
+    ROCRAND_CHECK(rocrand_generate_batch(g1, buffers1, sizes, count));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(int b = 0; b < count; b++)
+    {
+        std::vector<unsigned int> host_data0(sizes[b]);
+        std::vector<unsigned int> host_data1(sizes[b]);
+        HIP_CHECK(hipMemcpy(host_data0.data(), buffers0[b],
+                            sizes[b] * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(host_data1.data(), buffers1[b],
+                            sizes[b] * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        for(size_t i = 0; i < sizes[b]; i++)
+        {
+            ASSERT_EQ(host_data0[i], host_data1[i])
+                << "where b = " << b << ", i = " << i;
+        }
+    }
+
+    for(int b = 0; b < count; b++)
+    {
+        HIP_CHECK(hipFree(buffers0[b]));
+        HIP_CHECK(hipFree(buffers1[b]));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+// Buffer sizes that are not multiples of 4 still get a valid uniform
+// stream, just not the sequential-call layout
+TEST(rocrand_generate_batch_tests, odd_sizes_test)
+{
+    const size_t sizes[] = { 1313, 1, 65537, 12563 };
+    const int count = sizeof(sizes) / sizeof(sizes[0]);
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    unsigned int * buffers[count];
+    for(int b = 0; b < count; b++)
+    {
+        HIP_CHECK(hipMalloc((void **)&buffers[b], sizes[b] * sizeof(unsigned int)));
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_batch(generator, buffers, sizes, count));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(int b = 0; b < count; b++)
+    {
+        if(sizes[b] < 1024)
+        {
+            continue;
+        }
+        std::vector<unsigned int> host_data(sizes[b]);
+        HIP_CHECK(hipMemcpy(host_data.data(), buffers[b],
+                            sizes[b] * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        unsigned long long sum = 0;
+        for(size_t i = 0; i < sizes[b]; i++)
+        {
+            sum += host_data[i];
+        }
+        const unsigned int mean = sum / sizes[b];
+        ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+    }
+
+    for(int b = 0; b < count; b++)
+    {
+        HIP_CHECK(hipFree(buffers[b]));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
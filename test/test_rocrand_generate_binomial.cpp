@@ -0,0 +1,186 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_binomial_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_binomial_tests, uint_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const unsigned int trials = 100;
+    const double p = 0.25;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 131072;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_binomial(generator, data, size, trials, p)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_LE(host_data[i], trials);
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    double var = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        const double x = host_data[i] - mean;
+        var += x * x;
+    }
+    var = var / size;
+
+    // B(trials, p) has mean trials*p and variance trials*p*(1-p)
+    const double expected_mean = trials * p;
+    const double expected_var = trials * p * (1.0 - p);
+    EXPECT_NEAR(mean, expected_mean, std::max(1.0, expected_mean * 1e-2));
+    EXPECT_NEAR(var, expected_var, std::max(1.0, expected_var * 5e-2));
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Changing (trials, p) rebuilds the cached table; alternating between
+// parameter sets must keep sampling from the right one
+TEST(rocrand_generate_binomial_tests, changing_parameters_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    const unsigned int trials[] = { 10, 100, 1000 };
+    const double ps[] = { 0.9, 0.5, 0.125 };
+    const size_t params_count = sizeof(trials) / sizeof(trials[0]);
+    const size_t rounds = 3;
+
+    const size_t size = 65536;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    for(size_t round = 0; round < rounds; round++)
+    {
+        for(size_t pi = 0; pi < params_count; pi++)
+        {
+            ROCRAND_CHECK(
+                rocrand_generate_binomial(generator, data, size,
+                                          trials[pi], ps[pi])
+            );
+            HIP_CHECK(hipDeviceSynchronize());
+            HIP_CHECK(hipMemcpy(host_data.data(), data,
+                                size * sizeof(unsigned int),
+                                hipMemcpyDeviceToHost));
+
+            double mean = 0.0;
+            for(size_t i = 0; i < size; i++)
+            {
+                mean += host_data[i];
+            }
+            mean = mean / size;
+
+            const double expected_mean = trials[pi] * ps[pi];
+            EXPECT_NEAR(mean, expected_mean,
+                        std::max(1.0, expected_mean * 2e-2))
+                << "where trials = " << trials[pi] << ", p = " << ps[pi];
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_binomial_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_MRG32K3A)
+    );
+
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 0, 0.5),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 100, 0.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 100, 1.0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_binomial_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_binomial(generator, data, size, 100, 0.5),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_binomial_tests,
+                        rocrand_generate_binomial_tests,
+                        ::testing::ValuesIn(rng_types));
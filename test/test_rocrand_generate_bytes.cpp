@@ -0,0 +1,131 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_bytes_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// Unlike rocrand_generate(), any length and alignment is accepted
+TEST_P(rocrand_generate_bytes_tests, odd_length_and_alignment_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t buffer_size = 131072;
+    unsigned char * buffer;
+    HIP_CHECK(hipMalloc((void **)&buffer, buffer_size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    const size_t offsets[] = { 0, 1, 2, 3 };
+    const size_t sizes[] = { 131064, 131063, 17, 1 };
+    for(size_t c = 0; c < sizeof(offsets) / sizeof(offsets[0]); c++)
+    {
+        HIP_CHECK(hipMemset(buffer, 0, buffer_size));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        ROCRAND_CHECK(
+            rocrand_generate_bytes(generator, buffer + offsets[c], sizes[c])
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned char> host_data(buffer_size);
+        HIP_CHECK(hipMemcpy(host_data.data(), buffer, buffer_size,
+                            hipMemcpyDeviceToHost));
+
+        // Bytes outside the requested range stay untouched
+        for(size_t i = 0; i < offsets[c]; i++)
+        {
+            ASSERT_EQ(host_data[i], 0) << "where i = " << i;
+        }
+        for(size_t i = offsets[c] + sizes[c]; i < buffer_size; i++)
+        {
+            ASSERT_EQ(host_data[i], 0) << "where i = " << i;
+        }
+
+        if(sizes[c] < 1024)
+        {
+            continue;
+        }
+        unsigned long long sum = 0;
+        for(size_t i = offsets[c]; i < offsets[c] + sizes[c]; i++)
+        {
+            sum += host_data[i];
+        }
+        const double mean = static_cast<double>(sum) / sizes[c];
+        ASSERT_NEAR(mean, 127.5, 127.5 * 0.1) << "where c = " << c;
+    }
+
+    HIP_CHECK(hipFree(buffer));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_bytes_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW)
+    );
+
+    const size_t size = 256;
+    unsigned char * data;
+    HIP_CHECK(hipMalloc((void **)&data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_bytes(generator, data, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_bytes_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned char * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_bytes(generator, data, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_bytes_tests,
+                        rocrand_generate_bytes_tests,
+                        ::testing::ValuesIn(rng_types));
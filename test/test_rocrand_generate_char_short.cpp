@@ -0,0 +1,203 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_char_short_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_char_short_tests, char_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 131072;
+    unsigned char * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned char)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_char(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned char> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned char),
+                        hipMemcpyDeviceToHost));
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const double mean = static_cast<double>(sum) / size;
+    ASSERT_NEAR(mean, 127.5, 127.5 * 0.1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_char_short_tests, short_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 131072;
+    unsigned short * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned short)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_short(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned short> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned short),
+                        hipMemcpyDeviceToHost));
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const double mean = static_cast<double>(sum) / size;
+    ASSERT_NEAR(mean, 32767.5, 32767.5 * 0.1);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// 4 bytes are packed per generated 32-bit value, so the byte stream
+// must be the reinterpreted 32-bit stream
+TEST(rocrand_generate_char_short_tests, char_packing_test)
+{
+    const unsigned long long seed = 12345ULL;
+    const size_t size = 65536;
+
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_seed(g0, seed));
+    ROCRAND_CHECK(rocrand_set_seed(g1, seed));
+
+    unsigned char * char_data;
+    unsigned int * uint_data;
+    HIP_CHECK(hipMalloc((void **)&char_data, size * sizeof(unsigned char)));
+    HIP_CHECK(hipMalloc((void **)&uint_data, (size / 4) * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_char(g0, char_data, size));
+    ROCRAND_CHECK(rocrand_generate(g1, uint_data, size / 4));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned char> host_char_data(size);
+    std::vector<unsigned char> host_uint_data(size);
+    HIP_CHECK(hipMemcpy(host_char_data.data(), char_data,
+                        size * sizeof(unsigned char),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_uint_data.data(), uint_data,
+                        size * sizeof(unsigned char),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_char_data[i], host_uint_data[i]) << "where i = " << i;
+    }
+
+    HIP_CHECK(hipFree(char_data));
+    HIP_CHECK(hipFree(uint_data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+TEST(rocrand_generate_char_short_tests, length_not_multiple_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    const size_t size = 256;
+    unsigned char * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned char)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Sizes that do not fill whole 32-bit words are rejected
+    EXPECT_EQ(rocrand_generate_char(generator, data, 255),
+              ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    EXPECT_EQ(
+        rocrand_generate_short(generator,
+                               reinterpret_cast<unsigned short *>(data), 127),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    // So are destinations not aligned to 4 bytes
+    EXPECT_EQ(rocrand_generate_char(generator, data + 1, 252),
+              ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    EXPECT_EQ(
+        rocrand_generate_short(generator,
+                               reinterpret_cast<unsigned short *>(data + 2), 126),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_char_short_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned char * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_char(generator, data, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_short(generator,
+                               reinterpret_cast<unsigned short *>(data), size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_char_short_tests,
+                        rocrand_generate_char_short_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,142 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_exponential_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_exponential_tests, float_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const float lambda = 1.5f;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 131072;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_exponential(generator, data, size, lambda));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(float), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GE(host_data[i], 0.0f);
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    double std = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = std::sqrt(std / size);
+
+    // Mean and standard deviation of Exp(lambda) are both 1/lambda
+    EXPECT_NEAR(mean, 1.0 / lambda, 0.1 / lambda);
+    EXPECT_NEAR(std, 1.0 / lambda, 0.1 / lambda);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_exponential_tests, double_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const double lambda = 0.25;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 131072;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_exponential_double(generator, data, size, lambda)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(double), hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GE(host_data[i], 0.0);
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    EXPECT_NEAR(mean, 1.0 / lambda, 0.1 / lambda);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_exponential_tests, neg_test)
+{
+    const size_t size = 256;
+    float * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_exponential(generator, data, size, 1.0f),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_exponential_double(generator,
+                                            reinterpret_cast<double *>(data),
+                                            size, 1.0),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_exponential_tests,
+                        rocrand_generate_exponential_tests,
+                        ::testing::ValuesIn(rng_types));
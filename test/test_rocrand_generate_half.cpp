@@ -0,0 +1,168 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_half_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_half_tests, uniform_half_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 131072;
+    __half * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(__half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_uniform_half(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<__half> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(__half),
+                        hipMemcpyDeviceToHost));
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        const float v = __half2float(host_data[i]);
+        ASSERT_GT(v, 0.0f);
+        ASSERT_LE(v, 1.0f);
+        sum += v;
+    }
+    const double mean = sum / size;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_half_tests, normal_half_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 131072;
+    __half * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(__half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_half(generator, data, size,
+                                     __float2half(2.0f), __float2half(5.0f))
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<__half> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(__half),
+                        hipMemcpyDeviceToHost));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += __half2float(host_data[i]);
+    }
+    mean = mean / size;
+
+    double std = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(__half2float(host_data[i]) - mean, 2);
+    }
+    std = std::sqrt(std / size);
+
+    EXPECT_NEAR(2.0, mean, 0.4); // 20%
+    EXPECT_NEAR(5.0, std, 1.0); // 20%
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Halves are produced as packed half2, so odd lengths and pointers not
+// aligned to half2 are rejected
+TEST(rocrand_generate_half_tests, length_not_multiple_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    const size_t size = 256;
+    __half * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(__half)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(rocrand_generate_uniform_half(generator, data, 255),
+              ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    EXPECT_EQ(rocrand_generate_uniform_half(generator, data + 1, 254),
+              ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    EXPECT_EQ(
+        rocrand_generate_normal_half(generator, data, 255,
+                                     __float2half(0.0f), __float2half(1.0f)),
+        ROCRAND_STATUS_LENGTH_NOT_MULTIPLE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_half_tests, neg_test)
+{
+    const size_t size = 256;
+    __half * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_uniform_half(generator, data, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+    EXPECT_EQ(
+        rocrand_generate_normal_half(generator, data, size,
+                                     __float2half(0.0f), __float2half(1.0f)),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_half_tests,
+                        rocrand_generate_half_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,128 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_long_long_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_long_long_tests, ullong_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 65536;
+    unsigned long long * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_long_long(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned long long> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned long long),
+                        hipMemcpyDeviceToHost));
+
+    // Both 32-bit halves must be populated, so the normalized mean is
+    // checked rather than one that truncation could also satisfy
+    double mean = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += static_cast<double>(host_data[i]) / ULLONG_MAX;
+    }
+    mean = mean / size;
+    ASSERT_NEAR(mean, 0.5, 0.05);
+
+    size_t low_half_nonzero = 0;
+    size_t high_half_nonzero = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if((host_data[i] & 0xFFFFFFFFULL) != 0) low_half_nonzero++;
+        if((host_data[i] >> 32) != 0) high_half_nonzero++;
+    }
+    EXPECT_GT(low_half_nonzero, size / 2);
+    EXPECT_GT(high_half_nonzero, size / 2);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_long_long_tests, dimensions_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL64)
+    );
+
+    const size_t size = 12345;
+    unsigned long long * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_long_long(generator, data, size));
+
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 4));
+    EXPECT_EQ(rocrand_generate_long_long(generator, data, size),
+              ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 15));
+    ROCRAND_CHECK(rocrand_generate_long_long(generator, data, size));
+
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_long_long_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned long long * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_long_long(generator, data, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_QUASI_SOBOL32,
+    ROCRAND_RNG_QUASI_SOBOL64
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_long_long_tests,
+                        rocrand_generate_long_long_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,165 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_multinomial_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_generate_multinomial_tests, counts_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    // Unnormalized on purpose; the weights sum to 10
+    const double h_weights[] = { 1.0, 2.0, 3.0, 4.0 };
+    const size_t num_weights = sizeof(h_weights) / sizeof(h_weights[0]);
+    double * weights;
+    HIP_CHECK(hipMalloc((void **)&weights, num_weights * sizeof(double)));
+    HIP_CHECK(hipMemcpy(weights, h_weights, num_weights * sizeof(double),
+                        hipMemcpyHostToDevice));
+
+    const size_t num_draws = 4096;
+    const unsigned int trials = 1000;
+    unsigned int * counts;
+    HIP_CHECK(hipMalloc((void **)&counts,
+                        num_draws * num_weights * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_multinomial(generator, counts, num_draws,
+                                     trials, weights, num_weights)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_counts(num_draws * num_weights);
+    HIP_CHECK(hipMemcpy(host_counts.data(), counts,
+                        num_draws * num_weights * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    // Every row must sum to exactly the number of trials
+    std::vector<unsigned long long> category_sums(num_weights, 0);
+    for(size_t d = 0; d < num_draws; d++)
+    {
+        unsigned long long row_sum = 0;
+        for(size_t w = 0; w < num_weights; w++)
+        {
+            const unsigned int c = host_counts[d * num_weights + w];
+            row_sum += c;
+            category_sums[w] += c;
+        }
+        ASSERT_EQ(row_sum, trials) << "where d = " << d;
+    }
+
+    for(size_t w = 0; w < num_weights; w++)
+    {
+        const double mean = static_cast<double>(category_sums[w]) / num_draws;
+        const double expected = trials * h_weights[w] / 10.0;
+        EXPECT_NEAR(mean, expected, expected * 0.05) << "where w = " << w;
+    }
+
+    HIP_CHECK(hipFree(weights));
+    HIP_CHECK(hipFree(counts));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_multinomial_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW)
+    );
+
+    const double h_weights[] = { 1.0, 1.0 };
+    double * weights;
+    HIP_CHECK(hipMalloc((void **)&weights, 2 * sizeof(double)));
+    HIP_CHECK(hipMemcpy(weights, h_weights, 2 * sizeof(double),
+                        hipMemcpyHostToDevice));
+
+    unsigned int * counts;
+    HIP_CHECK(hipMalloc((void **)&counts, 2 * 16 * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_multinomial(generator, counts, 16, 100, weights, 2),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(weights));
+    HIP_CHECK(hipFree(counts));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_multinomial_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    unsigned int * counts;
+    HIP_CHECK(hipMalloc((void **)&counts, 16 * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double * weights;
+    HIP_CHECK(hipMalloc((void **)&weights, sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_multinomial(generator, counts, 16, 100, weights, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(weights));
+    HIP_CHECK(hipFree(counts));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_multinomial_tests, neg_test)
+{
+    unsigned int * counts = NULL;
+    const double * weights = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_multinomial(generator, counts, 16, 100, weights, 2),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_multinomial_tests,
+                        rocrand_generate_multinomial_tests,
+                        ::testing::ValuesIn(rng_types));
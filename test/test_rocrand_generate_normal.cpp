@@ -21,6 +21,9 @@
 #include <stdio.h>
 #include <gtest/gtest.h>
 
+#include <vector>
+#include <cmath>
+
 #include <hip/hip_runtime.h>
 #include <rocrand.h>
 
@@ -101,6 +104,185 @@ TEST(rocrand_generate_normal_tests, double_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+TEST(rocrand_generate_normal_tests, truncated_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 8192;
+    const float mean = 5.0f;
+    const float stddev = 2.0f;
+    const float low = 4.0f;
+    const float high = 6.0f;
+    float * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // bounds must form an interval, stddev must be positive
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size,
+                                          mean, stddev, high, low),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal(generator, data, size,
+                                          mean, 0.0f, low, high),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    ROCRAND_CHECK(
+        rocrand_generate_truncated_normal(generator, data, size,
+                                          mean, stddev, low, high)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<float> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(float),
+                        hipMemcpyDeviceToHost));
+
+    double sum = 0.0;
+    for(float v : host_data)
+    {
+        ASSERT_GE(v, low);
+        ASSERT_LE(v, high);
+        sum += v;
+    }
+    // The interval is symmetric around the mean, so the truncated mean
+    // equals the mean
+    EXPECT_NEAR(sum / size, mean, 0.1);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_normal_tests, truncated_double_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_XORWOW
+        )
+    );
+
+    const size_t size = 8192;
+    const double mean = 0.0;
+    const double stddev = 1.0;
+    const double low = 1.0;
+    const double high = 4.0;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_truncated_normal_double(generator, data, size,
+                                                 mean, stddev, low, high)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(double),
+                        hipMemcpyDeviceToHost));
+
+    double sum = 0.0;
+    for(double v : host_data)
+    {
+        ASSERT_GE(v, low);
+        ASSERT_LE(v, high);
+        sum += v;
+    }
+    // E[X | a < X < b] = (phi(a) - phi(b)) / (Phi(b) - Phi(a))
+    const double phi_a = std::exp(-0.5 * low * low) / std::sqrt(2.0 * M_PI);
+    const double phi_b = std::exp(-0.5 * high * high) / std::sqrt(2.0 * M_PI);
+    const double cap_a = 0.5 * std::erfc(-low / std::sqrt(2.0));
+    const double cap_b = 0.5 * std::erfc(-high / std::sqrt(2.0));
+    const double expected = (phi_a - phi_b) / (cap_b - cap_a);
+    EXPECT_NEAR(sum / size, expected, 0.05);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // MRG generators do not provide the full-range 32-bit draws the
+    // truncation path slices
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_MRG32K3A
+        )
+    );
+    EXPECT_EQ(
+        rocrand_generate_truncated_normal_double(generator, data, size,
+                                                 mean, stddev, low, high),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_generate_normal_tests, double_fast_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 8192;
+    const double mean = 5.0;
+    const double stddev = 2.0;
+    double * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(double)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_generate_normal_double_fast(generator, data, size, mean, stddev)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<double> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(double),
+                        hipMemcpyDeviceToHost));
+
+    double sum = 0.0;
+    for(double v : host_data)
+    {
+        sum += v;
+    }
+    const double sample_mean = sum / size;
+    double var = 0.0;
+    for(double v : host_data)
+    {
+        var += (v - sample_mean) * (v - sample_mean);
+    }
+    EXPECT_NEAR(sample_mean, mean, 0.1);
+    EXPECT_NEAR(std::sqrt(var / size), stddev, 0.1);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    // MRG generators do not provide the full-range 32-bit draws the
+    // hybrid-precision transform consumes
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_MRG32K3A
+        )
+    );
+    EXPECT_EQ(
+        rocrand_generate_normal_double_fast(generator, data, size, mean, stddev),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+
+    HIP_CHECK(hipFree(data));
+}
+
 TEST(rocrand_generate_normal_tests, neg_test)
 {
     const size_t size = 256;
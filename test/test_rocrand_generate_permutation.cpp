@@ -0,0 +1,155 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_generate_permutation_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+// The output must be a bijection on [0; n), including for lengths that
+// are not powers of two (the Feistel domain is larger and cycled down)
+TEST_P(rocrand_generate_permutation_tests, bijection_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t sizes[] = { 1, 2, 100, 131071 };
+    for(size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        const size_t size = sizes[s];
+        unsigned int * perm;
+        HIP_CHECK(hipMalloc((void **)&perm, size * sizeof(unsigned int)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        ROCRAND_CHECK(rocrand_generate_permutation(generator, perm, size));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> host_perm(size);
+        HIP_CHECK(hipMemcpy(host_perm.data(), perm,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        std::vector<bool> seen(size, false);
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_LT(host_perm[i], size) << "where i = " << i;
+            ASSERT_FALSE(seen[host_perm[i]])
+                << "where i = " << i << ", size = " << size;
+            seen[host_perm[i]] = true;
+        }
+
+        HIP_CHECK(hipFree(perm));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Successive calls must produce independent permutations
+TEST(rocrand_generate_permutation_tests, independence_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    const size_t size = 131072;
+    unsigned int * perm;
+    HIP_CHECK(hipMalloc((void **)&perm, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate_permutation(generator, perm, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> host_perm0(size);
+    HIP_CHECK(hipMemcpy(host_perm0.data(), perm,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    ROCRAND_CHECK(rocrand_generate_permutation(generator, perm, size));
+    HIP_CHECK(hipDeviceSynchronize());
+    std::vector<unsigned int> host_perm1(size);
+    HIP_CHECK(hipMemcpy(host_perm1.data(), perm,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    // A pair of independent uniform permutations agrees in ~1 position
+    // on average; identical keys would agree everywhere
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_perm0[i] == host_perm1[i]) same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(perm));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_permutation_tests, type_error_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW)
+    );
+
+    const size_t size = 256;
+    unsigned int * perm;
+    HIP_CHECK(hipMalloc((void **)&perm, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_generate_permutation(generator, perm, size),
+        ROCRAND_STATUS_TYPE_ERROR
+    );
+
+    HIP_CHECK(hipFree(perm));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_permutation_tests, neg_test)
+{
+    const size_t size = 256;
+    unsigned int * perm = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_generate_permutation(generator, perm, size),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_7,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_generate_permutation_tests,
+                        rocrand_generate_permutation_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -19,6 +19,8 @@
 // THE SOFTWARE.
 
 #include <stdio.h>
+#include <vector>
+#include <algorithm>
 #include <gtest/gtest.h>
 
 #include <hip/hip_runtime.h>
@@ -51,6 +53,112 @@ TEST(rocrand_generate_poisson_tests, uint_test)
     ROCRAND_CHECK(rocrand_destroy_generator(generator));
 }
 
+// Changing lambda every call exercises the asynchronous table rebuild
+// path; correctness is checked by the sample means once the stream
+// has drained
+TEST(rocrand_generate_poisson_tests, changing_lambda_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    hipStream_t stream;
+    HIP_CHECK(hipStreamCreate(&stream));
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    const size_t size = 4096;
+    const double lambdas[] = { 10.0, 100.0, 1000.0, 55.5 };
+    const size_t steps = sizeof(lambdas) / sizeof(lambdas[0]);
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, steps * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t step = 0; step < steps; step++)
+    {
+        ROCRAND_CHECK(
+            rocrand_generate_poisson(generator, data + step * size,
+                                     size, lambdas[step])
+        );
+    }
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    std::vector<unsigned int> host_data(steps * size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        steps * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t step = 0; step < steps; step++)
+    {
+        double sum = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            sum += host_data[step * size + i];
+        }
+        const double mean = sum / size;
+        EXPECT_NEAR(mean, lambdas[step], std::max(2.0, lambdas[step] * 0.05));
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipStreamDestroy(stream));
+}
+
+// Alternating between a fixed set of lambdas hits the manager's LRU
+// table cache after the first round; every step must keep sampling
+// from the right table
+TEST(rocrand_generate_poisson_tests, alternating_lambda_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(
+            &generator,
+            ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+        )
+    );
+
+    const size_t size = 4096;
+    const double lambdas[] = { 10.0, 100.0, 1000.0, 55.5 };
+    const size_t lambdas_count = sizeof(lambdas) / sizeof(lambdas[0]);
+    const size_t rounds = 4;
+    const size_t steps = rounds * lambdas_count;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, steps * size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t step = 0; step < steps; step++)
+    {
+        ROCRAND_CHECK(
+            rocrand_generate_poisson(generator, data + step * size,
+                                     size, lambdas[step % lambdas_count])
+        );
+    }
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(steps * size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        steps * size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    for(size_t step = 0; step < steps; step++)
+    {
+        const double lambda = lambdas[step % lambdas_count];
+        double sum = 0.0;
+        for(size_t i = 0; i < size; i++)
+        {
+            sum += host_data[step * size + i];
+        }
+        const double mean = sum / size;
+        EXPECT_NEAR(mean, lambda, std::max(2.0, lambda * 0.05));
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
 TEST(rocrand_generate_poisson_tests, neg_test)
 {
     const size_t size = 256;
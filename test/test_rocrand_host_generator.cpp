@@ -0,0 +1,255 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// The host generator writes through the passed pointer on host threads,
+// so plain host memory works without any HIP allocation or sync
+TEST(rocrand_host_generator_tests, host_memory_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+
+    const size_t size = 131313;
+    std::vector<unsigned int> data(size, 0);
+    ROCRAND_CHECK(rocrand_generate(g, data.data(), size));
+
+    unsigned int any = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        any |= data[i];
+    }
+    EXPECT_NE(any, 0u);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_host_generator_tests, uniform_float_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+
+    const size_t size = 131313;
+    std::vector<float> data(size);
+    ROCRAND_CHECK(rocrand_generate_uniform(g, data.data(), size));
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(data[i], 0.0f);
+        ASSERT_LE(data[i], 1.0f);
+        sum += data[i];
+    }
+    const double mean = sum / size;
+    EXPECT_NEAR(mean, 0.5, 0.05);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_host_generator_tests, normal_float_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+
+    const size_t size = 131072;
+    std::vector<float> data(size);
+    ROCRAND_CHECK(rocrand_generate_normal(g, data.data(), size, 2.0f, 5.0f));
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += data[i];
+    }
+    mean = mean / size;
+
+    double std = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(data[i] - mean, 2);
+    }
+    std = std::sqrt(std / size);
+
+    EXPECT_NEAR(2.0, mean, 0.4); // 20%
+    EXPECT_NEAR(5.0, std, 1.0); // 20%
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+// The 8/16-bit outputs go through the packed 32-bit path, which keeps
+// the device generators' length and alignment requirements
+TEST(rocrand_host_generator_tests, length_not_multiple_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+
+    std::vector<unsigned char> char_data(256);
+    EXPECT_EQ(rocrand_generate_char(g, char_data.data(), 255),
+              ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    ROCRAND_CHECK(rocrand_generate_char(g, char_data.data(), 256));
+
+    std::vector<unsigned short> short_data(256);
+    EXPECT_EQ(rocrand_generate_short(g, short_data.data(), 255),
+              ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    ROCRAND_CHECK(rocrand_generate_short(g, short_data.data(), 256));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_host_generator_tests, same_seed_test)
+{
+    const unsigned long long seed = 0xdeadbeefbeefdeadULL;
+
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+    ROCRAND_CHECK(rocrand_set_seed(g0, seed));
+    ROCRAND_CHECK(rocrand_set_seed(g1, seed));
+
+    const size_t size = 131313;
+    std::vector<unsigned int> data0(size);
+    std::vector<unsigned int> data1(size);
+    ROCRAND_CHECK(rocrand_generate(g0, data0.data(), size));
+    ROCRAND_CHECK(rocrand_generate(g1, data1.data(), size));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(data0[i], data1[i]) << "where i = " << i;
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+TEST(rocrand_host_generator_tests, different_seed_test)
+{
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+    ROCRAND_CHECK(rocrand_set_seed(g0, 5ULL));
+    ROCRAND_CHECK(rocrand_set_seed(g1, 10ULL));
+
+    const size_t size = 131313;
+    std::vector<unsigned int> data0(size);
+    std::vector<unsigned int> data1(size);
+    ROCRAND_CHECK(rocrand_generate(g0, data0.data(), size));
+    ROCRAND_CHECK(rocrand_generate(g1, data1.data(), size));
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(data0[i] == data1[i]) same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+TEST(rocrand_host_generator_tests, offset_test)
+{
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+    ROCRAND_CHECK(rocrand_set_offset(g1, 1337ULL));
+
+    const size_t size = 131313;
+    std::vector<unsigned int> data0(size);
+    std::vector<unsigned int> data1(size);
+    ROCRAND_CHECK(rocrand_generate(g0, data0.data(), size));
+    ROCRAND_CHECK(rocrand_generate(g1, data1.data(), size));
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(data0[i] == data1[i]) same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    // Resetting the offset rewinds the generator to a reproducible state
+    ROCRAND_CHECK(rocrand_set_offset(g1, 0ULL));
+    ROCRAND_CHECK(rocrand_generate(g1, data1.data(), size));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(data0[i], data1[i]) << "where i = " << i;
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+// The host generator walks the same virtual grid as a device
+// PHILOX-4x32-10 generator under legacy ordering, so the integer
+// streams must match bit for bit
+TEST(rocrand_host_generator_tests, device_match_test)
+{
+    const unsigned long long seed = 54321ULL;
+
+    rocrand_generator g_host = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_host, ROCRAND_RNG_PSEUDO_PHILOX4_32_10_HOST));
+    ROCRAND_CHECK(rocrand_set_seed(g_host, seed));
+
+    rocrand_generator g_device = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g_device, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_ordering(g_device, ROCRAND_ORDERING_PSEUDO_LEGACY));
+    ROCRAND_CHECK(rocrand_set_seed(g_device, seed));
+
+    // An odd size exercises the tail handling of both paths; two calls
+    // check that the saved engine states also stay in lockstep
+    const size_t size = 131313;
+    std::vector<unsigned int> host_data(size);
+    std::vector<unsigned int> device_data(size);
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(int call = 0; call < 2; call++)
+    {
+        ROCRAND_CHECK(rocrand_generate(g_host, host_data.data(), size));
+
+        ROCRAND_CHECK(rocrand_generate(g_device, data, size));
+        HIP_CHECK(hipDeviceSynchronize());
+        HIP_CHECK(hipMemcpy(device_data.data(), data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_EQ(host_data[i], device_data[i])
+                << "where i = " << i << ", call = " << call;
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(g_host));
+    ROCRAND_CHECK(rocrand_destroy_generator(g_device));
+}
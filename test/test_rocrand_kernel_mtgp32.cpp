@@ -59,6 +59,18 @@ void rocrand_kernel(GeneratorState * states, unsigned int * output, const size_t
     rocrand_mtgp32_block_copy(&state, &states[state_id]);
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_block_generate_kernel(GeneratorState * states, unsigned int * output, const size_t size)
+{
+    const size_t per_block = size / hipGridDim_x;
+    rocrand_mtgp32_block_generate(
+        &states[hipBlockIdx_x],
+        output + hipBlockIdx_x * per_block,
+        per_block
+    );
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_uniform_kernel(GeneratorState * states, float * output, const size_t size)
@@ -227,6 +239,49 @@ TEST(rocrand_kernel_mtgp32, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_mtgp32, rocrand_block_generate)
+{
+    typedef rocrand_state_mtgp32 state_type;
+
+    state_type * states;
+    hipMalloc(&states, sizeof(state_type) * 8);
+
+    ROCRAND_CHECK(rocrand_make_state_mtgp32(states, mtgp32dc_params_fast_11213, 8, 0));
+
+    // Not a multiple of the block size to exercise the masked tail
+    const size_t output_size = 8 * 1000;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_block_generate_kernel<state_type>),
+        dim3(8), dim3(256), 0, 0,
+        states, output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(states));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v) / UINT_MAX;
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
 TEST(rocrand_kernel_mtgp32, rocrand_uniform)
 {
     typedef rocrand_state_mtgp32 state_type;
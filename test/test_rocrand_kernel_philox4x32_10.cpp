@@ -69,6 +69,33 @@ void rocrand_kernel(unsigned int * output, const size_t size)
     }
 }
 
+template <class GeneratorState>
+__global__
+void rocrand_warp_kernel(unsigned int * output, const size_t size)
+{
+    // One state per warp, shared in LDS
+    __shared__ GeneratorState states[4];
+    const unsigned int warp_id = hipThreadIdx_x / warpSize;
+    const unsigned int global_warp_id =
+        hipBlockIdx_x * (hipBlockDim_x / warpSize) + warp_id;
+    if(hipThreadIdx_x % warpSize == 0)
+    {
+        rocrand_init(0, global_warp_id, 0, &states[warp_id]);
+    }
+    __syncthreads();
+
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+    unsigned int index = state_id;
+    // The trailing iteration leaves some lanes inactive, exercising
+    // the partial-warp path
+    while(index < size)
+    {
+        output[index] = rocrand_warp(&states[warp_id]);
+        index += global_size;
+    }
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_uniform_kernel(float * output, const size_t size)
@@ -293,6 +320,42 @@ TEST(rocrand_kernel_philox4x32_10, rocrand)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_philox4x32_10, rocrand_warp)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const size_t output_size = 8200;
+    unsigned int * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_warp_kernel<state_type>),
+        dim3(8), dim3(128), 0, 0,
+        output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned int),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v) / UINT_MAX;
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
 TEST(rocrand_kernel_philox4x32_10, rocrand_uniform)
 {
     typedef rocrand_state_philox4x32_10 state_type;
@@ -0,0 +1,187 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+#include <cmath>
+
+#include <hip/hip_runtime.h>
+
+#define FQUALIFIERS __forceinline__ __host__ __device__
+#include <rocrand_kernel.h>
+#include <rocrand_sobol_precomputed.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// Derives 64-bit direction vectors from the precomputed 32-bit table,
+// the same way rocrand_sobol64 does
+static void expand_direction_vectors(const unsigned int * vectors32,
+                                     unsigned long long * vectors64,
+                                     unsigned int dimensions)
+{
+    for(unsigned int dim = 0; dim < dimensions; dim++)
+    {
+        for(unsigned int j = 0; j < 32; j++)
+        {
+            vectors64[dim * 64 + j] =
+                static_cast<unsigned long long>(vectors32[dim * 32 + j]) << 32;
+        }
+        for(unsigned int j = 32; j < 64; j++)
+        {
+            vectors64[dim * 64 + j] = 1ULL << (63 - j);
+        }
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_kernel(unsigned long long * output, unsigned long long * vectors, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    const unsigned int n = size / global_size;
+    GeneratorState state;
+    rocrand_init(vectors, 1234 + state_id * n, &state);
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        output[state_id * n + i] = rocrand(&state);
+    }
+}
+
+template <class GeneratorState>
+__global__
+void rocrand_skipahead_kernel(unsigned long long * output, unsigned long long * vectors, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    const unsigned int n = size / global_size;
+    GeneratorState state;
+    rocrand_init(vectors, 1234, &state);
+    skipahead(static_cast<unsigned long long>(state_id) * n, &state);
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        output[state_id * n + i] = rocrand(&state);
+    }
+}
+
+TEST(rocrand_kernel_sobol64, rocrand_state_sobol64_type)
+{
+    EXPECT_EQ(sizeof(rocrand_state_sobol64), 66 * sizeof(unsigned long long));
+    EXPECT_EQ(sizeof(rocrand_state_sobol64[32]), 32 * sizeof(rocrand_state_sobol64));
+}
+
+TEST(rocrand_kernel_sobol64, rocrand)
+{
+    typedef rocrand_state_sobol64 state_type;
+
+    const size_t output_size = 8192;
+    unsigned long long * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long h_vectors[64];
+    expand_direction_vectors(h_sobol32_direction_vectors, h_vectors, 1);
+
+    unsigned long long * m_vector;
+    HIP_CHECK(hipMalloc(&m_vector, sizeof(unsigned long long) * 64));
+    HIP_CHECK(hipMemcpy(m_vector, h_vectors, sizeof(unsigned long long) * 64, hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, m_vector, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned long long> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned long long),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(m_vector));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v) / ULLONG_MAX;
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
+// Checks that skipahead() matches generating and discarding the same
+// number of values, so consecutive threads continue one sequence
+TEST(rocrand_kernel_sobol64, rocrand_skipahead)
+{
+    typedef rocrand_state_sobol64 state_type;
+
+    const size_t output_size = 8192;
+    unsigned long long * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(unsigned long long)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long h_vectors[64];
+    expand_direction_vectors(h_sobol32_direction_vectors, h_vectors, 1);
+
+    unsigned long long * m_vector;
+    HIP_CHECK(hipMalloc(&m_vector, sizeof(unsigned long long) * 64));
+    HIP_CHECK(hipMemcpy(m_vector, h_vectors, sizeof(unsigned long long) * 64, hipMemcpyHostToDevice));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_skipahead_kernel<state_type>),
+        dim3(8), dim3(32), 0, 0,
+        output, m_vector, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<unsigned long long> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(unsigned long long),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    HIP_CHECK(hipFree(m_vector));
+
+    // The whole output is one continuous Sobol sequence; compare it
+    // against the host-side engine
+    rocrand_state_sobol64 engine(h_vectors, 1234);
+    for(size_t i = 0; i < output_size; i++)
+    {
+        ASSERT_EQ(output_host[i], engine());
+    }
+}
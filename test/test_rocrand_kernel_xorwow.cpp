@@ -88,6 +88,23 @@ void rocrand_uniform_kernel(float * output, const size_t size)
     }
 }
 
+__global__
+void rocrand_uniform_from_states_kernel(rocrand_state_xorwow * states,
+                                        float * output, const size_t size)
+{
+    const unsigned int state_id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const unsigned int global_size = hipGridDim_x * hipBlockDim_x;
+
+    rocrand_state_xorwow state = states[state_id];
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_uniform(&state);
+        index += global_size;
+    }
+    states[state_id] = state;
+}
+
 template <class GeneratorState>
 __global__
 void rocrand_normal_kernel(float * output, const size_t size)
@@ -314,6 +331,52 @@ TEST(rocrand_kernel_xorwow, rocrand_uniform)
     EXPECT_NEAR(mean, 0.5, 0.1);
 }
 
+TEST(rocrand_kernel_xorwow, rocrand_create_device_states)
+{
+    typedef rocrand_state_xorwow state_type;
+
+    const size_t states_size = 4 * 64;
+    void * states;
+    ROCRAND_CHECK(
+        rocrand_create_device_states(
+            ROCRAND_RNG_PSEUDO_XORWOW,
+            states_size, 54321ULL, &states
+        )
+    );
+
+    const size_t output_size = 8192;
+    float * output;
+    HIP_CHECK(hipMalloc((void **)&output, output_size * sizeof(float)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(
+        HIP_KERNEL_NAME(rocrand_uniform_from_states_kernel),
+        dim3(4), dim3(64), 0, 0,
+        static_cast<state_type *>(states), output, output_size
+    );
+    HIP_CHECK(hipPeekAtLastError());
+
+    std::vector<float> output_host(output_size);
+    HIP_CHECK(
+        hipMemcpy(
+            output_host.data(), output,
+            output_size * sizeof(float),
+            hipMemcpyDeviceToHost
+        )
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+    ROCRAND_CHECK(rocrand_destroy_device_states(states));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+    EXPECT_NEAR(mean, 0.5, 0.1);
+}
+
 TEST(rocrand_kernel_xorwow, rocrand_normal)
 {
     typedef rocrand_state_xorwow state_type;
@@ -0,0 +1,399 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// The integer scaling must be bit-exact with the double-precision
+// expression it replaced, including the rounding crossings
+TEST(rocrand_mrg31k3p_prng_tests, uint_scale_test)
+{
+    auto reference = [](unsigned int v) -> unsigned int
+    {
+        const double d = v * ROCRAND_MRG31K3P_UINT_NORM;
+        // The device-side cast saturates; on the host it would overflow
+        return d >= 4294967296.0
+            ? 0xFFFFFFFFU
+            : static_cast<unsigned int>(d);
+    };
+
+    const unsigned int m1 = ROCRAND_MRG31K3P_M1;
+
+    // Both ends of the range, where the rounding crossings sit
+    for(unsigned int v = 0; v < (1U << 20); v++)
+    {
+        ASSERT_EQ(rocrand_device::detail::mrg31k3p_uint_scale(v),
+                  reference(v)) << "where v = " << v;
+    }
+    for(unsigned int v = m1 - (1U << 20); v <= m1; v++)
+    {
+        ASSERT_EQ(rocrand_device::detail::mrg31k3p_uint_scale(v),
+                  reference(v)) << "where v = " << v;
+    }
+
+    // Strided sweep over the whole range
+    for(unsigned long long v = 0; v <= m1; v += 97)
+    {
+        const unsigned int x = static_cast<unsigned int>(v);
+        ASSERT_EQ(rocrand_device::detail::mrg31k3p_uint_scale(x),
+                  reference(x)) << "where v = " << x;
+    }
+}
+
+TEST(rocrand_mrg31k3p_prng_tests, uniform_uint_test)
+{
+    const size_t size = 1313;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_mrg31k3p g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_mrg31k3p_prng_tests, uniform_float_test)
+{
+    const size_t size = 1313;
+    float * data;
+    hipMalloc(&data, sizeof(float) * size);
+
+    rocrand_mrg31k3p g;
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const float mean = sum / size;
+    ASSERT_NEAR(mean, 0.5f, 0.05f);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_mrg31k3p_prng_tests, normal_float_test)
+{
+    const size_t size = 1314;
+    float * data;
+    hipMalloc(&data, sizeof(float) * size);
+
+    rocrand_mrg31k3p g;
+    ROCRAND_CHECK(g.generate_normal(data, size, 2.0f, 5.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float mean = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    float std = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = sqrt(std / size);
+
+    EXPECT_NEAR(2.0f, mean, 0.4f); // 20%
+    EXPECT_NEAR(5.0f, std, 1.0f); // 20%
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_mrg31k3p_prng_tests, poisson_test)
+{
+    const size_t size = 1313;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_mrg31k3p g;
+    ROCRAND_CHECK(g.generate_poisson(data, size, 5.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    double var = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        double x = host_data[i] - mean;
+        var += x * x;
+    }
+    var = var / size;
+
+    EXPECT_NEAR(mean, 5.5, std::max(1.0, 5.5 * 1e-2));
+    EXPECT_NEAR(var, 5.5, std::max(1.0, 5.5 * 1e-2));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Check if the numbers generated by first generate() call are different from
+// the numbers generated by the 2nd call (same generator)
+TEST(rocrand_mrg31k3p_prng_tests, state_progress_test)
+{
+    // Device data
+    const size_t size = 1025;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    // Generator
+    rocrand_mrg31k3p g0;
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data1[size];
+    HIP_CHECK(hipMemcpy(host_data1, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data2[size];
+    HIP_CHECK(hipMemcpy(host_data2, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data1[i] == host_data2[i]) same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Checks if generators with the same seed and in the same state
+// generate the same numbers
+TEST(rocrand_mrg31k3p_prng_tests, same_seed_test)
+{
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+
+    // Device side data
+    const size_t size = 1024;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    // Generators
+    rocrand_mrg31k3p g0, g1;
+    // Set same seeds
+    g0.set_seed(seed);
+    g1.set_seed(seed);
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g1 and copy to host
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Numbers generated using same generator with same
+    // seed should be the same
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(g0_host_data[i], g1_host_data[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Checks if generators with the same seed and in the same state generate
+// the same numbers
+TEST(rocrand_mrg31k3p_prng_tests, different_seed_test)
+{
+    const unsigned long long seed0 = 0xdeadbeefdeadbeefULL;
+    const unsigned long long seed1 = 0xbeefdeadbeefdeadULL;
+
+    // Device side data
+    const size_t size = 1024;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    // Generators
+    rocrand_mrg31k3p g0, g1;
+    // Set different seeds
+    g0.set_seed(seed0);
+    g1.set_seed(seed1);
+    ASSERT_NE(g0.get_seed(), g1.get_seed());
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g1 and copy to host
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(g1_host_data[i] == g0_host_data[i]) same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_mrg31k3p_prng_tests, discard_test)
+{
+    const unsigned long long seed = 12345ULL;
+    rocrand_mrg31k3p::engine_type engine1(seed, 0, 678ULL);
+    rocrand_mrg31k3p::engine_type engine2(seed, 0, 677ULL);
+
+    (void)engine2.next();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    const unsigned long long ds[] = {
+        1ULL, 4ULL, 37ULL, 583ULL, 7452ULL,
+        21032ULL, 35678ULL, 66778ULL, 10313475ULL, 82120230ULL
+    };
+
+    for (auto d : ds)
+    {
+        for (unsigned long long i = 0; i < d; i++)
+        {
+            (void)engine1.next();
+        }
+        engine2.discard(d);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TEST(rocrand_mrg31k3p_prng_tests, discard_sequence_test)
+{
+    const unsigned long long seed = 23456ULL;
+    rocrand_mrg31k3p::engine_type engine1(seed, 123ULL, 444ULL);
+    rocrand_mrg31k3p::engine_type engine2(seed, 123ULL, 444ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard( 5356446450ULL);
+    engine1.discard_sequence(123ULL);
+    engine1.discard(30000000006ULL);
+
+    engine2.discard_sequence(3ULL);
+    engine2.discard(35356446456ULL);
+    engine2.discard_sequence(120ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard_sequence(3456000ULL);
+    engine1.discard_sequence(1000005ULL);
+
+    engine2.discard_sequence(4456005ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+}
+
+TEST(rocrand_mrg31k3p_prng_tests, discard_subsequence_test)
+{
+    const unsigned long long seed = 23456ULL;
+    rocrand_mrg31k3p::engine_type engine1(seed, 0, 444ULL);
+    rocrand_mrg31k3p::engine_type engine2(seed, 123ULL, 444ULL);
+
+    engine1.discard_subsequence(123ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard( 5356446450ULL);
+    engine1.discard_subsequence(123ULL);
+    engine1.discard(30000000006ULL);
+
+    engine2.discard_subsequence(3ULL);
+    engine2.discard(35356446456ULL);
+    engine2.discard_subsequence(120ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard_subsequence(3456000ULL);
+    engine1.discard_subsequence(1000005ULL);
+
+    engine2.discard_subsequence(4456005ULL);
+
+    EXPECT_EQ(engine1(), engine2());
+}
@@ -101,6 +101,43 @@ TEST(rocrand_mrg32k3a_prng_tests, mad_u64_u32_test)
     HIP_CHECK(hipFree(r));
 }
 
+// The integer scaling must be bit-exact with the double-precision
+// expression it replaced, including the rounding crossings and the
+// saturating conversion at the upper bound
+TEST(rocrand_mrg32k3a_prng_tests, uint_scale_test)
+{
+    auto reference = [](unsigned int v) -> unsigned int
+    {
+        const double d = v * ROCRAND_MRG32K3A_UINT_NORM;
+        // The device-side cast saturates; on the host it would overflow
+        return d >= 4294967296.0
+            ? 0xFFFFFFFFU
+            : static_cast<unsigned int>(d);
+    };
+
+    const unsigned int m1 = ROCRAND_MRG32K3A_M1;
+
+    // Both ends of the range, where the crossings and the saturation sit
+    for(unsigned int v = 0; v < (1U << 20); v++)
+    {
+        ASSERT_EQ(rocrand_device::detail::mrg32k3a_uint_scale(v),
+                  reference(v)) << "where v = " << v;
+    }
+    for(unsigned int v = m1 - (1U << 20); v <= m1; v++)
+    {
+        ASSERT_EQ(rocrand_device::detail::mrg32k3a_uint_scale(v),
+                  reference(v)) << "where v = " << v;
+    }
+
+    // Strided sweep over the whole range
+    for(unsigned long long v = 0; v <= m1; v += 97)
+    {
+        const unsigned int x = static_cast<unsigned int>(v);
+        ASSERT_EQ(rocrand_device::detail::mrg32k3a_uint_scale(x),
+                  reference(x)) << "where v = " << x;
+    }
+}
+
 TEST(rocrand_mrg32k3a_prng_tests, uniform_uint_test)
 {
     const size_t size = 1313;
@@ -0,0 +1,225 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_ordering_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST(rocrand_ordering_tests, set_ordering_test)
+{
+    rocrand_generator g = NULL;
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_LEGACY),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_BEST));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_LEGACY));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_COUNTER));
+    EXPECT_EQ(rocrand_set_ordering(g, static_cast<rocrand_ordering>(999)),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // The element-keyed counter ordering exists only for Philox
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_MRG32K3A));
+    ROCRAND_CHECK(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_LEGACY));
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_COUNTER),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Quasi-random generators have their own ordering control
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(rocrand_set_ordering(g, ROCRAND_ORDERING_PSEUDO_LEGACY),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+// Two generators of the same type and seed must agree under legacy
+// ordering, whose grid does not depend on the device
+TEST_P(rocrand_ordering_tests, legacy_reproducibility_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+    const unsigned long long seed = 67890ULL;
+
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, rng_type));
+    ROCRAND_CHECK(rocrand_set_ordering(g0, ROCRAND_ORDERING_PSEUDO_LEGACY));
+    ROCRAND_CHECK(rocrand_set_ordering(g1, ROCRAND_ORDERING_PSEUDO_LEGACY));
+    ROCRAND_CHECK(rocrand_set_seed(g0, seed));
+    ROCRAND_CHECK(rocrand_set_seed(g1, seed));
+
+    const size_t size = 131313;
+    unsigned int * data0;
+    unsigned int * data1;
+    HIP_CHECK(hipMalloc((void **)&data0, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&data1, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate(g0, data0, size));
+    ROCRAND_CHECK(rocrand_generate(g1, data1, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data0(size);
+    std::vector<unsigned int> host_data1(size);
+    HIP_CHECK(hipMemcpy(host_data0.data(), data0,
+                        size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_data1.data(), data1,
+                        size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data0[i], host_data1[i]) << "where i = " << i;
+    }
+
+    HIP_CHECK(hipFree(data0));
+    HIP_CHECK(hipFree(data1));
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+// Under counter ordering a buffer depends only on the seed, the offset
+// and the sequence of generate calls
+TEST(rocrand_ordering_tests, counter_reproducibility_test)
+{
+    const unsigned long long seed = 24680ULL;
+    const size_t sizes[] = { 100, 131313, 4096 };
+    const size_t calls = sizeof(sizes) / sizeof(sizes[0]);
+
+    rocrand_generator g0 = NULL;
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g0, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+    ROCRAND_CHECK(rocrand_set_ordering(g0, ROCRAND_ORDERING_PSEUDO_COUNTER));
+    ROCRAND_CHECK(rocrand_set_ordering(g1, ROCRAND_ORDERING_PSEUDO_COUNTER));
+    ROCRAND_CHECK(rocrand_set_seed(g0, seed));
+    ROCRAND_CHECK(rocrand_set_seed(g1, seed));
+
+    unsigned int * data0;
+    unsigned int * data1;
+    HIP_CHECK(hipMalloc((void **)&data0, sizes[1] * sizeof(unsigned int)));
+    HIP_CHECK(hipMalloc((void **)&data1, sizes[1] * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t c = 0; c < calls; c++)
+    {
+        ROCRAND_CHECK(rocrand_generate(g0, data0, sizes[c]));
+        ROCRAND_CHECK(rocrand_generate(g1, data1, sizes[c]));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> host_data0(sizes[c]);
+        std::vector<unsigned int> host_data1(sizes[c]);
+        HIP_CHECK(hipMemcpy(host_data0.data(), data0,
+                            sizes[c] * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(host_data1.data(), data1,
+                            sizes[c] * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        for(size_t i = 0; i < sizes[c]; i++)
+        {
+            ASSERT_EQ(host_data0[i], host_data1[i])
+                << "where i = " << i << ", call = " << c;
+        }
+    }
+
+    // Re-seeding rewinds the call sequence as well
+    ROCRAND_CHECK(rocrand_set_seed(g0, seed));
+    ROCRAND_CHECK(rocrand_generate(g0, data0, sizes[0]));
+    ROCRAND_CHECK(rocrand_set_seed(g1, seed));
+    ROCRAND_CHECK(rocrand_generate(g1, data1, sizes[0]));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data0(sizes[0]);
+    std::vector<unsigned int> host_data1(sizes[0]);
+    HIP_CHECK(hipMemcpy(host_data0.data(), data0,
+                        sizes[0] * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(host_data1.data(), data1,
+                        sizes[0] * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < sizes[0]; i++)
+    {
+        ASSERT_EQ(host_data0[i], host_data1[i]) << "where i = " << i;
+    }
+
+    HIP_CHECK(hipFree(data0));
+    HIP_CHECK(hipFree(data1));
+    ROCRAND_CHECK(rocrand_destroy_generator(g0));
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+// The orderings change the output layout, not its distribution
+TEST(rocrand_ordering_tests, counter_uniform_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+    ROCRAND_CHECK(
+        rocrand_set_ordering(generator, ROCRAND_ORDERING_PSEUDO_COUNTER)
+    );
+
+    const size_t size = 131072;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_PSEUDO_MT19937
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_ordering_tests,
+                        rocrand_ordering_tests,
+                        ::testing::ValuesIn(rng_types));
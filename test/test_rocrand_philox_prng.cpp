@@ -163,6 +163,66 @@ TEST(rocrand_philox_prng_tests, same_seed_test)
     HIP_CHECK(hipFree(data));
 }
 
+// Checks that under ROCRAND_ORDERING_PSEUDO_COUNTER the output depends
+// only on the seed and the sequence of call sizes: the same range
+// produced by one call and by two calls is bit-identical, which the
+// grid-tied stateful mode does not guarantee
+TEST(rocrand_philox_prng_tests, counter_ordering_test)
+{
+    const unsigned long long seed = 0xdeadbeefdeadbeefULL;
+
+    // Device side data
+    const size_t size = 1313;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    // Generators
+    rocrand_philox4x32_10 g0, g1;
+    // Set same seeds
+    g0.set_seed(seed);
+    g1.set_seed(seed);
+    ROCRAND_CHECK(g0.set_ordering(ROCRAND_ORDERING_PSEUDO_COUNTER));
+    ROCRAND_CHECK(g1.set_ordering(ROCRAND_ORDERING_PSEUDO_COUNTER));
+
+    // Generate the whole range in one call on g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate the same range in two calls on g1 and copy to host;
+    // the split must be a multiple of 4 so the counters stay aligned
+    const size_t split = 512;
+    ROCRAND_CHECK(g1.generate(data, split));
+    ROCRAND_CHECK(g1.generate(data + split, size - split));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(g0_host_data[i], g1_host_data[i]);
+    }
+
+    // Reseeding rewinds the counter
+    g1.set_seed(seed);
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(g0_host_data[i], g1_host_data[i]);
+    }
+    HIP_CHECK(hipFree(data));
+}
+
 // Checks if generators with the same seed and in the same state generate
 // the same numbers
 TEST(rocrand_philox_prng_tests, different_seed_test)
@@ -0,0 +1,176 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_sample_discrete_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST_P(rocrand_sample_discrete_tests, host_weights_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    // Unnormalized on purpose; the weights sum to 10
+    const double weights[] = { 1.0, 2.0, 3.0, 4.0 };
+    const size_t num_weights = sizeof(weights) / sizeof(weights[0]);
+
+    const size_t size = 131072;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The second call samples from the cached table
+    for(int call = 0; call < 2; call++)
+    {
+        ROCRAND_CHECK(
+            rocrand_sample_discrete(generator, data, size, weights, num_weights)
+        );
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> host_data(size);
+        HIP_CHECK(hipMemcpy(host_data.data(), data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+
+        std::vector<size_t> histogram(num_weights, 0);
+        for(size_t i = 0; i < size; i++)
+        {
+            ASSERT_LT(host_data[i], num_weights) << "where i = " << i;
+            histogram[host_data[i]]++;
+        }
+
+        for(size_t w = 0; w < num_weights; w++)
+        {
+            const double expected = size * weights[w] / 10.0;
+            EXPECT_NEAR(histogram[w], expected, expected * 0.05)
+                << "where w = " << w << ", call = " << call;
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Weights resident on the device are processed without a host copy and
+// must give the same distribution
+TEST(rocrand_sample_discrete_tests, device_weights_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    const double h_weights[] = { 4.0, 3.0, 2.0, 1.0 };
+    const size_t num_weights = sizeof(h_weights) / sizeof(h_weights[0]);
+    double * weights;
+    HIP_CHECK(hipMalloc((void **)&weights, num_weights * sizeof(double)));
+    HIP_CHECK(hipMemcpy(weights, h_weights, num_weights * sizeof(double),
+                        hipMemcpyHostToDevice));
+
+    const size_t size = 131072;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(
+        rocrand_sample_discrete(generator, data, size, weights, num_weights)
+    );
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+
+    std::vector<size_t> histogram(num_weights, 0);
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_LT(host_data[i], num_weights) << "where i = " << i;
+        histogram[host_data[i]]++;
+    }
+
+    for(size_t w = 0; w < num_weights; w++)
+    {
+        const double expected = size * h_weights[w] / 10.0;
+        EXPECT_NEAR(histogram[w], expected, expected * 0.05)
+            << "where w = " << w;
+    }
+
+    HIP_CHECK(hipFree(weights));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_sample_discrete_tests, out_of_range_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(
+        rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10)
+    );
+
+    const double weights[] = { 1.0 };
+    const size_t size = 256;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(
+        rocrand_sample_discrete(generator, data, size, weights, 0),
+        ROCRAND_STATUS_OUT_OF_RANGE
+    );
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_sample_discrete_tests, neg_test)
+{
+    const double weights[] = { 1.0, 1.0 };
+    const size_t size = 256;
+    unsigned int * data = NULL;
+
+    rocrand_generator generator = NULL;
+    EXPECT_EQ(
+        rocrand_sample_discrete(generator, data, size, weights, 2),
+        ROCRAND_STATUS_NOT_CREATED
+    );
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_sample_discrete_tests,
+                        rocrand_sample_discrete_tests,
+                        ::testing::ValuesIn(rng_types));
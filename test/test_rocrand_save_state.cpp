@@ -0,0 +1,179 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+class rocrand_save_state_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
+
+TEST(rocrand_save_state_tests, rocrand_get_state_size_test)
+{
+    size_t state_size = 0;
+    EXPECT_EQ(rocrand_get_state_size(NULL, &state_size),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_get_state_size(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_get_state_size(g, &state_size));
+    EXPECT_GT(state_size, 0u);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    // Quasi-random generators do not support state serialization
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(rocrand_get_state_size(g, &state_size),
+              ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+TEST(rocrand_save_state_tests, rocrand_save_load_state_neg_test)
+{
+    std::vector<char> state(16);
+    EXPECT_EQ(rocrand_save_state(NULL, state.data()),
+              ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_load_state(NULL, state.data()),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_save_state(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_load_state(g, NULL), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_QUASI_SOBOL32));
+    EXPECT_EQ(rocrand_save_state(g, state.data()), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_load_state(g, state.data()), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+}
+
+// Check that restoring a saved state continues the stream exactly where
+// the snapshot was taken
+TEST_P(rocrand_save_state_tests, rocrand_save_load_state_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const size_t size = 12563;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc((void **)&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, rng_type));
+
+    // Advance the generator so the snapshot is not the initial state
+    ROCRAND_CHECK(rocrand_generate(g, (unsigned int *)data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t state_size = 0;
+    ROCRAND_CHECK(rocrand_get_state_size(g, &state_size));
+    ASSERT_GT(state_size, 0u);
+    std::vector<char> state(state_size);
+    ROCRAND_CHECK(rocrand_save_state(g, state.data()));
+
+    ROCRAND_CHECK(rocrand_generate(g, (unsigned int *)data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data1(size);
+    HIP_CHECK(hipMemcpy(host_data1.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // The same generator, rewound to the snapshot, repeats the output
+    ROCRAND_CHECK(rocrand_load_state(g, state.data()));
+    ROCRAND_CHECK(rocrand_generate(g, (unsigned int *)data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data2(size);
+    HIP_CHECK(hipMemcpy(host_data2.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data1[i], host_data2[i]) << "where i = " << i;
+    }
+
+    // A fresh generator of the same type restored from the snapshot
+    // continues the stream identically
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g1, rng_type));
+    ROCRAND_CHECK(rocrand_initialize_generator(g1));
+    ROCRAND_CHECK(rocrand_load_state(g1, state.data()));
+    ROCRAND_CHECK(rocrand_generate(g1, (unsigned int *)data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipMemcpy(host_data2.data(), data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data1[i], host_data2[i]) << "where i = " << i;
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+    HIP_CHECK(hipFree(data));
+}
+
+// A state saved from one generator type must not load into another
+TEST(rocrand_save_state_tests, rocrand_load_state_mismatch_test)
+{
+    rocrand_generator g = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    size_t state_size = 0;
+    ROCRAND_CHECK(rocrand_get_state_size(g, &state_size));
+    std::vector<char> state(state_size);
+    ROCRAND_CHECK(rocrand_save_state(g, state.data()));
+    ROCRAND_CHECK(rocrand_destroy_generator(g));
+
+    rocrand_generator g1 = NULL;
+    ROCRAND_CHECK(rocrand_create_generator(&g1, ROCRAND_RNG_PSEUDO_XORWOW));
+    ROCRAND_CHECK(rocrand_initialize_generator(g1));
+    EXPECT_EQ(rocrand_load_state(g1, state.data()),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(g1));
+}
+
+const rocrand_rng_type rng_types[] = {
+    ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+    ROCRAND_RNG_PSEUDO_MRG32K3A,
+    ROCRAND_RNG_PSEUDO_MRG31K3P,
+    ROCRAND_RNG_PSEUDO_XORWOW,
+    ROCRAND_RNG_PSEUDO_MTGP32,
+    ROCRAND_RNG_PSEUDO_MT19937,
+    ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+};
+
+INSTANTIATE_TEST_CASE_P(rocrand_save_state_tests,
+                        rocrand_save_state_tests,
+                        ::testing::ValuesIn(rng_types));
@@ -0,0 +1,320 @@
+// Copyright (c) 2017 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <stdio.h>
+#include <gtest/gtest.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#include <rng/generator_type.hpp>
+#include <rng/generators.hpp>
+
+#define HIP_CHECK(state) ASSERT_EQ(state, hipSuccess)
+#define ROCRAND_CHECK(state) ASSERT_EQ(state, ROCRAND_STATUS_SUCCESS)
+
+// The scrambled variants are the sobol generators constructed with
+// scrambled = true; the scramble constants are derived from the seed.
+
+TEST(rocrand_scrambled_sobol_qrng_tests, uniform_uint_test)
+{
+    const size_t size = 1313;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_sobol32 g(0, 0, true);
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        sum += host_data[i];
+    }
+    const unsigned int mean = sum / size;
+    ASSERT_NEAR(mean, UINT_MAX / 2, UINT_MAX / 20);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_scrambled_sobol_qrng_tests, uniform_float_test)
+{
+    const size_t size = 1313;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    rocrand_sobol32 g(0, 0, true);
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const float mean = sum / size;
+    ASSERT_NEAR(mean, 0.5f, 0.05f);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_scrambled_sobol_qrng_tests, uniform_float_sobol64_test)
+{
+    const size_t size = 1313;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    rocrand_sobol64 g(0, 0, true);
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double sum = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_GT(host_data[i], 0.0f);
+        ASSERT_LE(host_data[i], 1.0f);
+        sum += host_data[i];
+    }
+    const float mean = sum / size;
+    ASSERT_NEAR(mean, 0.5f, 0.05f);
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_scrambled_sobol_qrng_tests, normal_float_test)
+{
+    const size_t size = 1313;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    rocrand_sobol32 g(0, 0, true);
+    ROCRAND_CHECK(g.generate_normal(data, size, 2.0f, 5.0f));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float host_data[size];
+    HIP_CHECK(hipMemcpy(host_data, data, sizeof(float) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    float mean = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i];
+    }
+    mean = mean / size;
+
+    float std = 0.0f;
+    for(size_t i = 0; i < size; i++)
+    {
+        std += std::pow(host_data[i] - mean, 2);
+    }
+    std = sqrt(std / size);
+
+    EXPECT_NEAR(2.0f, mean, 0.4f); // 20%
+    EXPECT_NEAR(5.0f, std, 1.0f); // 20%
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Scrambling must actually change the sequence: a scrambled generator
+// and a plain one starting from the same state should disagree on
+// almost all values
+TEST(rocrand_scrambled_sobol_qrng_tests, scrambled_vs_plain_test)
+{
+    const size_t size = 1024;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_sobol32 g_scrambled(0, 0, true);
+    rocrand_sobol32 g_plain(0, 0, false);
+
+    ROCRAND_CHECK(g_scrambled.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int scrambled_host_data[size];
+    HIP_CHECK(hipMemcpy(scrambled_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(g_plain.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int plain_host_data[size];
+    HIP_CHECK(hipMemcpy(plain_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(scrambled_host_data[i] == plain_host_data[i]) same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// The scramble constants are derived from the seed, so two scrambled
+// generators with the same seed must generate identical sequences
+TEST(rocrand_scrambled_sobol_qrng_tests, same_seed_test)
+{
+    const unsigned long long seed = 5ULL;
+
+    const size_t size = 1024;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_sobol32 g0(0, 0, true);
+    rocrand_sobol32 g1(0, 0, true);
+    g0.set_seed(seed);
+    g1.set_seed(seed);
+
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(g0_host_data[i], g1_host_data[i]);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Different seeds select different scramblings of the same sequence
+TEST(rocrand_scrambled_sobol_qrng_tests, different_seed_test)
+{
+    const unsigned long long seed0 = 5ULL;
+    const unsigned long long seed1 = 10ULL;
+
+    const size_t size = 1024;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    rocrand_sobol32 g0(0, 0, true);
+    rocrand_sobol32 g1(0, 0, true);
+    g0.set_seed(seed0);
+    g1.set_seed(seed1);
+    ASSERT_NE(g0.get_seed(), g1.get_seed());
+
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g0_host_data[size];
+    HIP_CHECK(hipMemcpy(g0_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(g1.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int g1_host_data[size];
+    HIP_CHECK(hipMemcpy(g1_host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(g1_host_data[i] == g0_host_data[i]) same++;
+    }
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+// Check if the numbers generated by first generate() call are different from
+// the numbers generated by the 2nd call (same generator)
+TEST(rocrand_scrambled_sobol_qrng_tests, state_progress_test)
+{
+    // Device data
+    const size_t size = 1025;
+    unsigned int * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    // Generator
+    rocrand_sobol32 g0(0, 0, true);
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data1[size];
+    HIP_CHECK(hipMemcpy(host_data1, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Generate using g0 and copy to host
+    ROCRAND_CHECK(g0.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned int host_data2[size];
+    HIP_CHECK(hipMemcpy(host_data2, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    size_t same = 0;
+    for(size_t i = 0; i < size; i++)
+    {
+        if(host_data1[i] == host_data2[i]) same++;
+    }
+    // It may happen that numbers are the same, so we
+    // just make sure that most of them are different.
+    EXPECT_LT(same, static_cast<size_t>(0.01f * size));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(rocrand_scrambled_sobol_qrng_tests, dimesions_test)
+{
+    const size_t size = 12345;
+    float * data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * size));
+
+    rocrand_sobol32 g(0, 0, true);
+
+    ROCRAND_CHECK(g.generate(data, size));
+
+    g.set_dimensions(4);
+    EXPECT_EQ(g.generate(data, size), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+
+    g.set_dimensions(15);
+    ROCRAND_CHECK(g.generate(data, size));
+
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,186 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <iomanip>
+#include <cstring>
+
+using namespace std;
+
+#define ROCRAND_MRG31K3P_M1 2147483647
+#define ROCRAND_MRG31K3P_M2 2147462579
+
+// One-step transition matrices of the two MRG31k3p components acting on
+// the state vector (x(n-3), x(n-2), x(n-1)).
+//
+// x1(n) = (2^22 * x1(n-2) + (2^7 + 1) * x1(n-3)) mod m1
+// x2(n) = (2^15 * x2(n-1) + (2^15 + 1) * x2(n-3)) mod m2
+
+unsigned long long A1_[9] =
+{
+    0,   1,       0,
+    0,   0,       1,
+    129, 4194304, 0
+};
+
+unsigned long long A2_[9] =
+{
+    0,     1, 0,
+    0,     0, 1,
+    32769, 0, 32768
+};
+
+void mod_mat_sq(unsigned long long * A,
+                unsigned long long m)
+{
+    unsigned long long x[9];
+    unsigned long long a;
+    for (size_t i = 0; i < 3; i++) {
+        for (size_t j = 0; j < 3; j++) {
+            a = 0;
+            for (size_t k = 0; k < 3; k++) {
+                a += (A[i + 3 * k] * A[k + 3 * j]) % m;
+            }
+            x[i + 3 * j] = a % m;
+        }
+    }
+    for (size_t i = 0; i < 3; i++) {
+        A[i + 3 * 0] = x[i + 3 * 0];
+        A[i + 3 * 1] = x[i + 3 * 1];
+        A[i + 3 * 2] = x[i + 3 * 2];
+    }
+}
+
+// Computes A^(2^p) mod m
+void mod_mat_pow2(unsigned long long * A, unsigned long long * B, int p, unsigned long long m)
+{
+    for (int i = 0; i < 9; i++)
+        A[i] = B[i];
+    for (int i = 0; i < p; i++)
+        mod_mat_sq(A, m);
+}
+
+void init_matrices(unsigned long long * matrix, unsigned long long * A, int n, unsigned long long m)
+{
+    unsigned long long x[9];
+    for (int i = 0; i < 9; i++)
+        x[i] = A[i];
+
+    for (int i = 0 ; i < n ; i++) {
+        if (i > 0) {
+            mod_mat_sq(x, m);
+        }
+        for (int j = 0; j < 9; j++)
+            matrix[j + (i * 9)] = x[j];
+    }
+}
+
+void write_matrices(std::ofstream& fout, const std::string name, unsigned long long * a, int n, int bits, bool is_device)
+{
+    fout << "static const ";
+    fout << (is_device ? "__constant__ " : "") << "unsigned long long " << name << "[MRG313P_N] = " << std::endl;
+    fout << "    {" << std::endl;
+    fout << "        ";
+    for (int k = 0; k < n; k++)
+    {
+        fout << a[k] << ", ";
+        if ((k + 1) % bits == 0 && k != 1)
+            fout  << std::endl << "        ";
+    }
+    fout << std::endl;
+    fout << "    };" << std::endl;
+    fout << std::endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    if (argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./mrg31k3p_precomputed_generator ../../library/include/rocrand_mrg31k3p_precomputed.h" << std::endl;
+        return -1;
+    }
+
+    unsigned int MRG313P_DIM = 64;
+    unsigned int MRG313P_N = MRG313P_DIM * 9;
+    unsigned long long * A1 = new unsigned long long[MRG313P_N];
+    unsigned long long * A2 = new unsigned long long[MRG313P_N];
+    unsigned long long * A1P72 = new unsigned long long[MRG313P_N];
+    unsigned long long * A2P72 = new unsigned long long[MRG313P_N];
+    unsigned long long * A1P134 = new unsigned long long[MRG313P_N];
+    unsigned long long * A2P134 = new unsigned long long[MRG313P_N];
+
+    // Subsequences are 2^72 numbers long, sequences are 2^134 numbers
+    // long (the stream structure used by clRNG)
+    unsigned long long A1p72[9], A2p72[9], A1p134[9], A2p134[9];
+    mod_mat_pow2(A1p72, A1_, 72, ROCRAND_MRG31K3P_M1);
+    mod_mat_pow2(A2p72, A2_, 72, ROCRAND_MRG31K3P_M2);
+    mod_mat_pow2(A1p134, A1_, 134, ROCRAND_MRG31K3P_M1);
+    mod_mat_pow2(A2p134, A2_, 134, ROCRAND_MRG31K3P_M2);
+
+    init_matrices(A1, A1_, MRG313P_DIM, ROCRAND_MRG31K3P_M1);
+    init_matrices(A2, A2_, MRG313P_DIM, ROCRAND_MRG31K3P_M2);
+    init_matrices(A1P72, A1p72, MRG313P_DIM, ROCRAND_MRG31K3P_M1);
+    init_matrices(A2P72, A2p72, MRG313P_DIM, ROCRAND_MRG31K3P_M2);
+    init_matrices(A1P134, A1p134, MRG313P_DIM, ROCRAND_MRG31K3P_M1);
+    init_matrices(A2P134, A2p134, MRG313P_DIM, ROCRAND_MRG31K3P_M2);
+    const std::string file_path(argv[1]);
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MRG31K3P_PRECOMPUTED_H_
+#define ROCRAND_MRG31K3P_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/mrg31k3p_precomputed_generator
+
+)";
+
+    fout << "#define MRG313P_DIM " << MRG313P_DIM << std::endl;
+    fout << "#define MRG313P_N " << MRG313P_N << std::endl;
+    fout << std::endl;
+
+    write_matrices(fout, "d_31k3p_A1", A1, MRG313P_N, 9, true);
+    write_matrices(fout, "h_31k3p_A1", A1, MRG313P_N, 9, false);
+    write_matrices(fout, "d_31k3p_A2", A2, MRG313P_N, 9, true);
+    write_matrices(fout, "h_31k3p_A2", A2, MRG313P_N, 9, false);
+    write_matrices(fout, "d_31k3p_A1P72", A1P72, MRG313P_N, 9, true);
+    write_matrices(fout, "h_31k3p_A1P72", A1P72, MRG313P_N, 9, false);
+    write_matrices(fout, "d_31k3p_A2P72", A2P72, MRG313P_N, 9, true);
+    write_matrices(fout, "h_31k3p_A2P72", A2P72, MRG313P_N, 9, false);
+    write_matrices(fout, "d_31k3p_A1P134", A1P134, MRG313P_N, 9, true);
+    write_matrices(fout, "h_31k3p_A1P134", A1P134, MRG313P_N, 9, false);
+    write_matrices(fout, "d_31k3p_A2P134", A2P134, MRG313P_N, 9, true);
+    write_matrices(fout, "h_31k3p_A2P134", A2P134, MRG313P_N, 9, false);
+
+    fout << R"(
+#endif // ROCRAND_MRG31K3P_PRECOMPUTED_H_
+)";
+
+
+    delete[] A1;
+    delete[] A2;
+    delete[] A1P72;
+    delete[] A2P72;
+    delete[] A1P134;
+    delete[] A2P134;
+
+    return 0;
+}
@@ -98,7 +98,7 @@ void init_matrices(unsigned long long * matrix, unsigned long long * A, int n, u
 void write_matrices(std::ofstream& fout, const std::string name, unsigned long long * a, int n, int bits, bool is_device)
 {
     fout << "static const ";
-    fout << (is_device ? "__device__ " : "") << "unsigned long long " << name << "[MRG323A_N] = " << std::endl;
+    fout << (is_device ? "__constant__ " : "") << "unsigned long long " << name << "[MRG323A_N] = " << std::endl;
     fout << "    {" << std::endl;
     fout << "        ";
     for (int k = 0; k < n; k++)
@@ -0,0 +1,558 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Generates rocrand_mtgp32_jump_precomputed.h: one minimal polynomial of the
+// MTGP32 state transition per parameter set of mtgp32dc_params_fast_11213.
+//
+// The MTGP32 recursion is F2-linear on its 351-word (11232-bit) state window,
+// and one generated value corresponds to exactly one state transition. Given
+// the minimal polynomial p of the transition A, a jump by N steps can be
+// evaluated as h(A)s where h = x^N mod p, which takes O(deg(p)) transitions
+// instead of N. The minimal polynomial is recovered with the Berlekamp-Massey
+// algorithm from an output bit sequence of the recursion and verified by
+// checking that it annihilates random and seeded states, and by comparing
+// polynomial jumps against sequential stepping.
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdint>
+#include <cstdlib>
+
+// rocrand_mtgp32.h is a device-side header; predefine its include guard and
+// provide the parameter struct it declares so that the parameter table header
+// can be used from this host-only tool.
+#define ROCRAND_MTGP32_H_
+struct mtgp32_params_fast_t {
+    int mexp;
+    int pos;
+    int sh1;
+    int sh2;
+    uint32_t tbl[16];
+    uint32_t tmp_tbl[16];
+    uint32_t flt_tmp_tbl[16];
+    uint32_t mask;
+    unsigned char poly_sha1[21];
+};
+namespace rocrand_device {
+    typedef mtgp32_params_fast_t mtgp32_fast_params;
+}
+#include "rocrand_mtgp32_11213.h"
+
+const int MTGP32_N = 351;                   // state words
+const int MTGP32_STATE_BITS = 32 * MTGP32_N; // 11232, F2-linear state dimension
+const int MTGP32_JUMP_POLY_SIZE = MTGP32_STATE_BITS / 32 + 1;
+
+typedef std::vector<uint64_t> bitvec;
+
+inline bool get_bit(const bitvec& v, int i)
+{
+    return (v[i / 64] >> (i % 64)) & 1;
+}
+
+inline void set_bit(bitvec& v, int i)
+{
+    v[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+// One step of the MTGP32 recursion; identical to
+// rocrand_device::mtgp32_engine::para_rec.
+inline unsigned int para_rec(const mtgp32_params_fast_t& p,
+                             unsigned int mask,
+                             unsigned int X1, unsigned int X2, unsigned int Y)
+{
+    unsigned int X = (X1 & mask) ^ X2;
+    X ^= X << p.sh1;
+    Y = X ^ (Y >> p.sh2);
+    return Y ^ p.tbl[Y & 0x0f];
+}
+
+// Appends n new state words to w (w must start with at least MTGP32_N words).
+void run_recursion(const mtgp32_params_fast_t& p, unsigned int mask,
+                   std::vector<unsigned int>& w, size_t n)
+{
+    size_t k = w.size() - MTGP32_N;
+    w.reserve(w.size() + n);
+    for (size_t i = 0; i < n; i++, k++)
+    {
+        w.push_back(para_rec(p, mask, w[k], w[k + 1], w[k + p.pos]));
+    }
+}
+
+int poly_degree(const bitvec& v)
+{
+    for (int i = int(v.size()) * 64 - 1; i >= 0; i--)
+    {
+        if (get_bit(v, i))
+            return i;
+    }
+    return -1;
+}
+
+// a ^= b << s (bits)
+void xor_shifted(bitvec& a, const bitvec& b, int s)
+{
+    const int ws = s / 64;
+    const int bs = s % 64;
+    for (int i = int(b.size()) - 1; i >= 0; i--)
+    {
+        if (b[i] == 0)
+            continue;
+        if (size_t(i + ws) < a.size())
+            a[i + ws] ^= b[i] << bs;
+        if (bs != 0 && size_t(i + ws + 1) < a.size())
+            a[i + ws + 1] ^= b[i] >> (64 - bs);
+    }
+}
+
+// 64 bits of v starting at bit pos (v must have a zero pad word at the end)
+inline uint64_t get_word64(const bitvec& v, int pos)
+{
+    const int w = pos / 64;
+    const int b = pos % 64;
+    uint64_t r = v[w] >> b;
+    if (b != 0)
+        r |= v[w + 1] << (64 - b);
+    return r;
+}
+
+// Berlekamp-Massey over GF(2): returns the connection polynomial C
+// (C_0 = 1, s_n = sum_{j=1..L} C_j s_{n-j}) and its degree L.
+int berlekamp_massey(const std::vector<bool>& s, bitvec& C)
+{
+    const int n_total = int(s.size());
+    const int words = n_total / 64 + 2;
+
+    // s reversed, for word-parallel discrepancy computation
+    bitvec R(words, 0);
+    for (int i = 0; i < n_total; i++)
+    {
+        if (s[n_total - 1 - i])
+            set_bit(R, i);
+    }
+
+    C.assign(words, 0);
+    bitvec B(words, 0);
+    bitvec T(words, 0);
+    set_bit(C, 0);
+    set_bit(B, 0);
+    int L = 0;
+    int m = 1;
+
+    for (int n = 0; n < n_total; n++)
+    {
+        // d = sum_{j=0..L} C_j s_{n-j}; s_{n-j} = R[(n_total - 1 - n) + j]
+        const int base = n_total - 1 - n;
+        uint64_t acc = 0;
+        for (int w = 0; w <= L / 64; w++)
+        {
+            acc ^= C[w] & get_word64(R, base + 64 * w);
+        }
+        const bool d = __builtin_parityll(acc);
+
+        if (d)
+        {
+            if (2 * L <= n)
+            {
+                T = C;
+                xor_shifted(C, B, m);
+                B = T;
+                L = n + 1 - L;
+                m = 1;
+            }
+            else
+            {
+                xor_shifted(C, B, m);
+                m++;
+            }
+        }
+        else
+        {
+            m++;
+        }
+    }
+    return L;
+}
+
+// Minimal polynomial candidate for parameter set p: Berlekamp-Massey on an
+// output bit sequence of the recursion from a random state.
+int minimal_poly_candidate(const mtgp32_params_fast_t& p, unsigned int mask,
+                           std::mt19937& rng, bitvec& mp)
+{
+    const int n_total = 2 * MTGP32_STATE_BITS + 64;
+
+    std::vector<unsigned int> w(MTGP32_N);
+    for (int i = 0; i < MTGP32_N; i++)
+    {
+        w[i] = rng();
+    }
+    const unsigned int obs_mask = rng() | 1;
+    run_recursion(p, mask, w, n_total);
+
+    std::vector<bool> s(n_total);
+    for (int i = 0; i < n_total; i++)
+    {
+        s[i] = __builtin_parity(w[MTGP32_N + i] & obs_mask);
+    }
+
+    bitvec C;
+    const int L = berlekamp_massey(s, C);
+
+    // The minimal polynomial is the reciprocal of the connection polynomial
+    mp.assign(C.size(), 0);
+    for (int i = 0; i <= L; i++)
+    {
+        if (get_bit(C, L - i))
+            set_bit(mp, i);
+    }
+    return L;
+}
+
+// Checks mp(A)state == 0, i.e. that mp annihilates the orbit of state.
+bool annihilates(const mtgp32_params_fast_t& p, unsigned int mask,
+                 const bitvec& mp, int deg,
+                 const std::vector<unsigned int>& state)
+{
+    std::vector<unsigned int> w(state);
+    run_recursion(p, mask, w, deg);
+
+    std::vector<unsigned int> acc(MTGP32_N, 0);
+    for (int i = 0; i <= deg; i++)
+    {
+        if (!get_bit(mp, i))
+            continue;
+        for (int j = 0; j < MTGP32_N; j++)
+        {
+            acc[j] ^= w[i + j];
+        }
+    }
+    for (int j = 0; j < MTGP32_N; j++)
+    {
+        if (acc[j] != 0)
+            return false;
+    }
+    return true;
+}
+
+// Packed uint32 polynomial arithmetic mirroring the device jump kernel:
+// r = a * b mod c, most significant multiplier bit first.
+typedef std::vector<unsigned int> poly32;
+
+inline bool get_bit32(const poly32& v, int i)
+{
+    return (v[i / 32] >> (i % 32)) & 1;
+}
+
+void mul_mod(poly32& r, const poly32& a, const poly32& b,
+             const poly32& c, int degc)
+{
+    poly32 rs(r.size());
+    std::fill(r.begin(), r.end(), 0);
+    for (int i = degc - 1; i >= 0; i--)
+    {
+        for (size_t j = 0; j < r.size(); j++)
+        {
+            rs[j] = (r[j] << 1) | (j > 0 ? (r[j - 1] >> 31) : 0);
+        }
+        const bool reduce = get_bit32(rs, degc);
+        const bool add = get_bit32(a, i);
+        for (size_t j = 0; j < r.size(); j++)
+        {
+            r[j] = rs[j] ^ (reduce ? c[j] : 0) ^ (add ? b[j] : 0);
+        }
+    }
+}
+
+// h = x^n mod c
+void pow_mod(poly32& h, unsigned long long n, const poly32& c, int degc)
+{
+    std::fill(h.begin(), h.end(), 0);
+    h[0] = 1;
+    int top = -1;
+    for (int i = 63; i >= 0; i--)
+    {
+        if ((n >> i) & 1)
+        {
+            top = i;
+            break;
+        }
+    }
+    poly32 r(h.size());
+    poly32 rs(h.size());
+    for (int e = top; e >= 0; e--)
+    {
+        mul_mod(r, h, h, c, degc);
+        if ((n >> e) & 1)
+        {
+            // r = r * x mod c
+            for (size_t j = 0; j < r.size(); j++)
+            {
+                rs[j] = (r[j] << 1) | (j > 0 ? (r[j - 1] >> 31) : 0);
+            }
+            const bool reduce = get_bit32(rs, degc);
+            for (size_t j = 0; j < r.size(); j++)
+            {
+                r[j] = rs[j] ^ (reduce ? c[j] : 0);
+            }
+        }
+        h = r;
+    }
+}
+
+// Full jump check: h(A)s with h = x^n mod mp must equal A^n s.
+bool check_jump(const mtgp32_params_fast_t& p, unsigned int mask,
+                const poly32& mp32, int deg,
+                unsigned long long n, std::mt19937& rng)
+{
+    std::vector<unsigned int> s(MTGP32_N);
+    for (int i = 0; i < MTGP32_N; i++)
+    {
+        s[i] = rng();
+    }
+
+    poly32 h(MTGP32_JUMP_POLY_SIZE);
+    pow_mod(h, n, mp32, deg);
+
+    int degh = -1;
+    for (int i = deg; i >= 0; i--)
+    {
+        if (get_bit32(h, i))
+        {
+            degh = i;
+            break;
+        }
+    }
+
+    // Horner: acc = A * acc (+ s), circular window as in the jump kernel
+    std::vector<unsigned int> acc(MTGP32_N, 0);
+    int head = 0;
+    for (int i = degh; i >= 0; i--)
+    {
+        acc[head] = para_rec(p, mask,
+                             acc[head],
+                             acc[(head + 1) % MTGP32_N],
+                             acc[(head + p.pos) % MTGP32_N]);
+        head = (head + 1) % MTGP32_N;
+        if (get_bit32(h, i))
+        {
+            for (int j = 0; j < MTGP32_N; j++)
+            {
+                acc[(head + j) % MTGP32_N] ^= s[j];
+            }
+        }
+    }
+
+    std::vector<unsigned int> w(s);
+    run_recursion(p, mask, w, n);
+    for (int j = 0; j < MTGP32_N; j++)
+    {
+        if (acc[(head + j) % MTGP32_N] != w[n + j])
+            return false;
+    }
+    return true;
+}
+
+// Seeded state, identical to rocrand_device::rocrand_mtgp32_init_state
+void init_state(std::vector<unsigned int>& array,
+                const mtgp32_params_fast_t& p, unsigned int seed)
+{
+    array.assign(MTGP32_N, 0);
+    unsigned int hidden_seed = p.tbl[4] ^ (p.tbl[8] << 16);
+    unsigned int tmp = hidden_seed;
+    tmp += tmp >> 16;
+    tmp += tmp >> 8;
+    tmp &= 0xff;
+    tmp |= tmp << 8;
+    tmp |= tmp << 16;
+    for (int i = 0; i < MTGP32_N; i++)
+        array[i] = tmp;
+    array[0] = seed;
+    array[1] = hidden_seed;
+    for (int i = 1; i < MTGP32_N; i++)
+        array[i] ^= (1812433253) * (array[i - 1] ^ (array[i - 1] >> 30)) + i;
+}
+
+int main(int argc, char const *argv[])
+{
+    if (argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./mtgp32_jump_polynomial_generator ../../library/include/rocrand_mtgp32_jump_precomputed.h" << std::endl;
+        return -1;
+    }
+
+    const int sets = sizeof(mtgp32dc_params_fast_11213)
+        / sizeof(mtgp32dc_params_fast_11213[0]);
+    const unsigned int mask = mtgp32dc_params_fast_11213[0].mask;
+
+    std::vector<poly32> polys(sets, poly32(MTGP32_JUMP_POLY_SIZE, 0));
+    std::vector<int> degrees(sets);
+
+    std::mt19937 rng(11213);
+    for (int k = 0; k < sets; k++)
+    {
+        const mtgp32_params_fast_t& p = mtgp32dc_params_fast_11213[k];
+
+        bitvec mp;
+        int deg = minimal_poly_candidate(p, mask, rng, mp);
+
+        // Berlekamp-Massey observes the recursion output only, so it misses
+        // the nilpotent part of the transition: the 19 state bits above the
+        // Mersenne exponent leave no trace in the output tail and contribute
+        // a factor x^e, e <= 11232 - 11213. Multiply by x until the result
+        // annihilates full random states.
+        for (int attempt = 0; ; attempt++)
+        {
+            std::vector<unsigned int> random_state(MTGP32_N);
+            for (int i = 0; i < MTGP32_N; i++)
+            {
+                random_state[i] = rng();
+            }
+            std::vector<unsigned int> seeded_state;
+            init_state(seeded_state, p, rng());
+
+            if (annihilates(p, mask, mp, deg, random_state)
+                && annihilates(p, mask, mp, deg, seeded_state))
+            {
+                break;
+            }
+            if (attempt >= MTGP32_STATE_BITS - p.mexp)
+            {
+                std::cerr << "Verification failed for parameter set " << k << std::endl;
+                return -1;
+            }
+            bitvec t(mp.size(), 0);
+            xor_shifted(t, mp, 1);
+            mp = t;
+            deg++;
+        }
+
+        if (deg > MTGP32_STATE_BITS)
+        {
+            std::cerr << "Degree " << deg << " out of range for parameter set " << k << std::endl;
+            return -1;
+        }
+
+        degrees[k] = deg;
+        for (int i = 0; i <= deg; i++)
+        {
+            if (get_bit(mp, i))
+                polys[k][i / 32] |= 1u << (i % 32);
+        }
+
+        if (k % 64 == 0)
+        {
+            std::cerr << "set " << k << " degree " << deg << std::endl;
+        }
+    }
+
+    // End-to-end jump checks on a few sets
+    {
+        std::mt19937 check_rng(271828);
+        const int check_sets[] = { 0, 1, sets / 2, sets - 1 };
+        const unsigned long long check_offsets[] = { 1, 256, 12345, 1234567 };
+        for (int k : check_sets)
+        {
+            for (unsigned long long n : check_offsets)
+            {
+                if (!check_jump(mtgp32dc_params_fast_11213[k], mask,
+                                polys[k], degrees[k], n, check_rng))
+                {
+                    std::cerr << "Jump check failed for parameter set " << k
+                        << ", offset " << n << std::endl;
+                    return -1;
+                }
+            }
+            std::cerr << "jump checks passed for set " << k << std::endl;
+        }
+    }
+
+    const std::string file_path(argv[1]);
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_MTGP32_JUMP_PRECOMPUTED_H_
+#define ROCRAND_MTGP32_JUMP_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/mtgp32_jump_polynomial_generator
+//
+// Minimal polynomials of the MTGP32 state transition, one per parameter set
+// of mtgp32dc_params_fast_11213, packed 32 bits per word, bit i of
+// polynomial k at d_mtgp32_jump_polys[k][i / 32] >> (i % 32).
+
+)";
+    fout << "#define MTGP32_JUMP_POLY_N " << sets << std::endl;
+    fout << "#define MTGP32_JUMP_POLY_SIZE " << MTGP32_JUMP_POLY_SIZE << std::endl;
+    fout << std::endl;
+
+    fout << "static const __device__ unsigned int d_mtgp32_jump_poly_degrees[MTGP32_JUMP_POLY_N] = {" << std::endl;
+    for (int k = 0; k < sets; k++)
+    {
+        if (k % 16 == 0)
+            fout << "    ";
+        fout << degrees[k] << ", ";
+        if (k % 16 == 15)
+            fout << std::endl;
+    }
+    fout << "};" << std::endl;
+    fout << std::endl;
+
+    fout << "static const __device__ unsigned int d_mtgp32_jump_polys[MTGP32_JUMP_POLY_N][MTGP32_JUMP_POLY_SIZE] = {" << std::endl;
+    for (int k = 0; k < sets; k++)
+    {
+        fout << "    {" << std::endl;
+        for (int i = 0; i < MTGP32_JUMP_POLY_SIZE; i++)
+        {
+            if (i % 16 == 0)
+                fout << "        ";
+            fout << polys[k][i] << ", ";
+            if (i % 16 == 15)
+                fout << std::endl;
+        }
+        fout << "    }," << std::endl;
+    }
+    fout << "};" << std::endl;
+    fout << std::endl;
+
+    fout << "#endif // ROCRAND_MTGP32_JUMP_PRECOMPUTED_H_" << std::endl;
+
+    return 0;
+}
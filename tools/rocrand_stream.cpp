@@ -0,0 +1,461 @@
+// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Streaming random-file writer: pre-generates large random datasets at
+// disk speed by pipelining three stages that run concurrently:
+//
+//   generate (GPU kernel)  ->  async DtoH into a pinned ring buffer
+//                          ->  O_DIRECT write() on a writer thread
+//
+// Generation of chunk i+1 overlaps the copy of chunk i (double-buffered
+// device staging, events ordering buffer reuse), and the writer thread
+// drains completed ring slots in order, so the disk never waits for the
+// GPU and vice versa. Engines and distributions are selected like in
+// benchmark_rocrand_generate.cpp. O_DIRECT is dropped automatically on
+// filesystems that reject it and for tail writes that break alignment.
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <numeric>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <string.h>
+
+#include "cmdparser.hpp"
+
+#include <hip/hip_runtime.h>
+#include <rocrand.h>
+
+#define HIP_CHECK(condition)         \
+  {                                  \
+    hipError_t error = condition;    \
+    if(error != hipSuccess){         \
+        std::cerr << "HIP error: " << error << " line: " << __LINE__ << std::endl; \
+        exit(error); \
+    } \
+  }
+
+#define ROCRAND_CHECK(condition)                 \
+  {                                              \
+    rocrand_status _status = condition;           \
+    if(_status != ROCRAND_STATUS_SUCCESS) {       \
+        std::cerr << "ROCRAND error: " << _status << " line: " << __LINE__ << std::endl; \
+        exit(_status); \
+    } \
+  }
+
+typedef rocrand_rng_type rng_type_t;
+
+template<typename T>
+using generate_func_type = std::function<rocrand_status(rocrand_generator, T *, size_t)>;
+
+// Number of pinned ring slots; enough that the writer can fall one
+// disk latency behind without stalling the GPU
+const size_t ring_slots = 4;
+
+// Writes must be multiples of this for O_DIRECT on common filesystems
+const size_t direct_io_alignment = 4096;
+
+// One pinned ring slot handed from the GPU pipeline to the writer
+struct ring_slot
+{
+    void * data;
+    size_t bytes;
+    hipEvent_t ready; // recorded on the copy stream after the DtoH
+};
+
+// Orders slot hand-off between the enqueueing main thread and the
+// writer thread
+struct ring_state
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t produced = 0; // slots enqueued by the pipeline
+    size_t consumed = 0; // slots fully written to disk
+    bool failed = false;
+};
+
+// Writer thread: drains ring slots in order, waiting for each slot's
+// DtoH to complete before handing its bytes to write(). Alignment of
+// the pinned buffers (page-locked allocations are page aligned) and
+// of full chunks satisfies O_DIRECT; the flag is cleared before an
+// unaligned tail write.
+void write_slots(int fd, bool direct, size_t total_slots,
+                 std::vector<ring_slot> * ring, ring_state * state)
+{
+    for(size_t i = 0; i < total_slots; i++)
+    {
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->cv.wait(lock, [&] { return state->produced > i || state->failed; });
+            if(state->failed)
+            {
+                return;
+            }
+        }
+        ring_slot& slot = (*ring)[i % ring_slots];
+        if(hipEventSynchronize(slot.ready) != hipSuccess)
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->failed = true;
+            state->cv.notify_all();
+            return;
+        }
+        if(direct && (slot.bytes % direct_io_alignment) != 0)
+        {
+            // Unaligned tail; finish the file with buffered writes
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_DIRECT);
+            direct = false;
+        }
+        const char * p = static_cast<const char *>(slot.data);
+        size_t left = slot.bytes;
+        while(left > 0)
+        {
+            const ssize_t written = write(fd, p, left);
+            if(written < 0)
+            {
+                std::cerr << "write() failed: " << strerror(errno) << std::endl;
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->failed = true;
+                state->cv.notify_all();
+                return;
+            }
+            p += written;
+            left -= written;
+        }
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->consumed = i + 1;
+            state->cv.notify_all();
+        }
+    }
+}
+
+template<typename T>
+void run_stream(const cli::Parser& parser,
+                const rng_type_t rng_type,
+                generate_func_type<T> generate_func)
+{
+    const size_t size = parser.get<size_t>("size");
+    const std::string path = parser.get<std::string>("output");
+    const size_t chunk_bytes_opt = parser.get<size_t>("chunk-bytes");
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t dimensions = parser.get<size_t>("dimensions");
+    rocrand_status status = rocrand_set_quasi_random_generator_dimensions(generator, dimensions);
+    if (status != ROCRAND_STATUS_TYPE_ERROR) // If the RNG is not quasi-random
+    {
+        ROCRAND_CHECK(status);
+    }
+
+    // Values per chunk; quasi-random generators need a multiple of
+    // their dimension count per call
+    size_t chunk = std::max<size_t>(chunk_bytes_opt / sizeof(T), 1);
+    chunk -= chunk % std::max<size_t>(dimensions, 1);
+    chunk = std::max<size_t>(chunk, std::max<size_t>(dimensions, 1));
+
+    // Open with O_DIRECT when the filesystem supports it
+    bool direct = true;
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0644);
+    if(fd < 0)
+    {
+        direct = false;
+        fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    }
+    if(fd < 0)
+    {
+        std::cerr << "cannot open " << path << ": " << strerror(errno) << std::endl;
+        exit(1);
+    }
+    if(direct && (chunk * sizeof(T)) % direct_io_alignment != 0)
+    {
+        // Dimension rounding broke the write alignment
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) & ~O_DIRECT);
+        direct = false;
+    }
+
+    // Double-buffered device staging and the pinned ring
+    T * device_buffer[2];
+    HIP_CHECK(hipMalloc((void **)&device_buffer[0], chunk * sizeof(T)));
+    HIP_CHECK(hipMalloc((void **)&device_buffer[1], chunk * sizeof(T)));
+
+    hipStream_t gen_stream, copy_stream;
+    HIP_CHECK(hipStreamCreate(&gen_stream));
+    HIP_CHECK(hipStreamCreate(&copy_stream));
+    ROCRAND_CHECK(rocrand_set_stream(generator, gen_stream));
+
+    hipEvent_t gen_done[2], copy_done[2];
+    for(int i = 0; i < 2; i++)
+    {
+        HIP_CHECK(hipEventCreateWithFlags(&gen_done[i], hipEventDisableTiming));
+        HIP_CHECK(hipEventCreateWithFlags(&copy_done[i], hipEventDisableTiming));
+    }
+
+    std::vector<ring_slot> ring(ring_slots);
+    for(size_t i = 0; i < ring_slots; i++)
+    {
+        HIP_CHECK(hipHostMalloc(&ring[i].data, chunk * sizeof(T)));
+        HIP_CHECK(hipEventCreateWithFlags(&ring[i].ready, hipEventDisableTiming));
+    }
+
+    const size_t total_slots = (size + chunk - 1) / chunk;
+    ring_state state;
+    std::thread writer(write_slots, fd, direct, total_slots, &ring, &state);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    size_t generated = 0;
+    size_t slot_index = 0;
+    while(generated < size)
+    {
+        const size_t n = std::min(chunk, size - generated);
+        const unsigned int buf = slot_index & 1;
+
+        // The ring slot and the device buffer must both be free
+        {
+            std::unique_lock<std::mutex> lock(state.mutex);
+            state.cv.wait(lock, [&] {
+                return slot_index - state.consumed < ring_slots || state.failed;
+            });
+            if(state.failed)
+            {
+                break;
+            }
+        }
+        if(slot_index >= 2)
+        {
+            HIP_CHECK(hipStreamWaitEvent(gen_stream, copy_done[buf], 0));
+        }
+
+        ROCRAND_CHECK(generate_func(generator, device_buffer[buf], n));
+        HIP_CHECK(hipEventRecord(gen_done[buf], gen_stream));
+
+        ring_slot& slot = ring[slot_index % ring_slots];
+        slot.bytes = n * sizeof(T);
+        HIP_CHECK(hipStreamWaitEvent(copy_stream, gen_done[buf], 0));
+        HIP_CHECK(hipMemcpyAsync(slot.data, device_buffer[buf], slot.bytes,
+                                 hipMemcpyDeviceToHost, copy_stream));
+        HIP_CHECK(hipEventRecord(slot.ready, copy_stream));
+        HIP_CHECK(hipEventRecord(copy_done[buf], copy_stream));
+
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            state.produced = slot_index + 1;
+            state.cv.notify_all();
+        }
+        generated += n;
+        slot_index++;
+    }
+
+    writer.join();
+    if(state.failed)
+    {
+        std::cerr << "streaming failed" << std::endl;
+        exit(1);
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    const double bytes = static_cast<double>(size) * sizeof(T);
+    std::cout << std::fixed << std::setprecision(3)
+              << "Wrote " << bytes / (1 << 30) << " GiB to " << path
+              << " in " << elapsed.count() / 1e3 << " s ("
+              << bytes / (elapsed.count() / 1e3 * (1 << 30)) << " GiB/s, "
+              << (direct ? "O_DIRECT" : "buffered") << ")"
+              << std::endl;
+
+    close(fd);
+    for(size_t i = 0; i < ring_slots; i++)
+    {
+        HIP_CHECK(hipEventDestroy(ring[i].ready));
+        HIP_CHECK(hipHostFree(ring[i].data));
+    }
+    for(int i = 0; i < 2; i++)
+    {
+        HIP_CHECK(hipEventDestroy(gen_done[i]));
+        HIP_CHECK(hipEventDestroy(copy_done[i]));
+    }
+    HIP_CHECK(hipStreamDestroy(copy_stream));
+    HIP_CHECK(hipStreamDestroy(gen_stream));
+    HIP_CHECK(hipFree(device_buffer[1]));
+    HIP_CHECK(hipFree(device_buffer[0]));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+void run_streams(const cli::Parser& parser,
+                 const rng_type_t rng_type,
+                 const std::string& distribution)
+{
+    if (distribution == "uniform-uint")
+    {
+        run_stream<unsigned int>(parser, rng_type,
+            [](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-float")
+    {
+        run_stream<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_uniform(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "uniform-double")
+    {
+        run_stream<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_uniform_double(gen, data, size);
+            }
+        );
+    }
+    if (distribution == "normal-float")
+    {
+        run_stream<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_normal(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "normal-double")
+    {
+        run_stream<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_normal_double(gen, data, size, 0.0, 1.0);
+            }
+        );
+    }
+    if (distribution == "log-normal-float")
+    {
+        run_stream<float>(parser, rng_type,
+            [](rocrand_generator gen, float * data, size_t size) {
+                return rocrand_generate_log_normal(gen, data, size, 0.0f, 1.0f);
+            }
+        );
+    }
+    if (distribution == "log-normal-double")
+    {
+        run_stream<double>(parser, rng_type,
+            [](rocrand_generator gen, double * data, size_t size) {
+                return rocrand_generate_log_normal_double(gen, data, size, 0.0, 1.0);
+            }
+        );
+    }
+    if (distribution == "poisson")
+    {
+        const double lambda = parser.get<double>("lambda");
+        run_stream<unsigned int>(parser, rng_type,
+            [lambda](rocrand_generator gen, unsigned int * data, size_t size) {
+                return rocrand_generate_poisson(gen, data, size, lambda);
+            }
+        );
+    }
+}
+
+const std::vector<std::string> all_engines = {
+    "xorwow",
+    "mrg32k3a",
+    "mtgp32",
+    "philox",
+    "sobol32",
+};
+
+const std::vector<std::string> all_distributions = {
+    "uniform-uint",
+    "uniform-float",
+    "uniform-double",
+    "normal-float",
+    "normal-double",
+    "log-normal-float",
+    "log-normal-double",
+    "poisson"
+};
+
+int main(int argc, char *argv[])
+{
+    cli::Parser parser(argc, argv);
+
+    const std::string distribution_desc =
+        "distribution:" +
+        std::accumulate(all_distributions.begin(), all_distributions.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        );
+    const std::string engine_desc =
+        "random number engine:" +
+        std::accumulate(all_engines.begin(), all_engines.end(), std::string(),
+            [](std::string a, std::string b) {
+                return a + "\n      " + b;
+            }
+        );
+
+    parser.set_required<std::string>("output", "output", "output file path");
+    parser.set_optional<size_t>("size", "size", 1024 * 1024 * 256, "number of values");
+    parser.set_optional<size_t>("chunk-bytes", "chunk-bytes", 16 * 1024 * 1024,
+        "bytes per pipelined chunk");
+    parser.set_optional<size_t>("dimensions", "dimensions", 1, "number of dimensions of quasi-random values");
+    parser.set_optional<std::string>("dis", "dis", "uniform-uint", distribution_desc.c_str());
+    parser.set_optional<std::string>("engine", "engine", "philox", engine_desc.c_str());
+    parser.set_optional<double>("lambda", "lambda", 10.0, "lambda of Poisson distribution");
+    parser.run_and_exit_if_error();
+
+    const std::string engine = parser.get<std::string>("engine");
+    rng_type_t rng_type;
+    if (engine == "xorwow")
+        rng_type = ROCRAND_RNG_PSEUDO_XORWOW;
+    else if (engine == "mrg32k3a")
+        rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
+    else if (engine == "philox")
+        rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+    else if (engine == "sobol32")
+        rng_type = ROCRAND_RNG_QUASI_SOBOL32;
+    else if (engine == "mtgp32")
+        rng_type = ROCRAND_RNG_PSEUDO_MTGP32;
+    else
+    {
+        std::cerr << "Wrong engine name" << std::endl;
+        return 1;
+    }
+
+    const std::string distribution = parser.get<std::string>("dis");
+    if (std::find(all_distributions.begin(), all_distributions.end(), distribution)
+            == all_distributions.end())
+    {
+        std::cerr << "Wrong distribution name" << std::endl;
+        return 1;
+    }
+
+    run_streams(parser, rng_type, distribution);
+    return 0;
+}
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <string>
 #include <iomanip>
+#include <cstdlib>
 
 using namespace std;
 
@@ -59,6 +60,47 @@ void init_direction_vectors(struct sobol_set * inputs, unsigned int * directions
     }
 }
 
+void init_direction_vectors64(struct sobol_set * inputs, unsigned long long * directions, int n_directions, int n)
+{
+    for (int i = 0 ; i < n ; i++) {
+        if (i == 0)
+            for (int j = 0 ; j < n_directions ; j++)
+                directions[j] = 1ULL << (63 - j);
+        else
+        {
+            int ix = i - 1;
+            int s = inputs[ix].s;
+            for (int j = 0 ; j < s ; j++)
+                directions[j] = (unsigned long long)inputs[ix].m[j] << (63 - j);
+            for (int j = s ; j < n_directions ; j++)
+            {
+                directions[j] = directions[j - s] ^ (directions[j - s] >> s);
+                for (int k = 1 ; k < s ; k++)
+                    directions[j] ^= (((unsigned long long)((inputs[ix].a >> (s - 1 - k)) & 1) * directions[j - k]));
+            }
+        }
+        directions += n_directions;
+    }
+}
+
+void write_matrices64(std::ofstream& fout, const std::string name, unsigned long long * a, int n, int bits, bool is_device)
+{
+    fout << "static const ";
+    fout << (is_device ? "__device__ " : "") << "unsigned long long " << name << "[SOBOL64_N] = " << std::endl;
+    fout << "    {" << std::endl;
+    fout << "        ";
+    for (int k = 0; k < n; k++)
+    {
+        fout << "0x";
+        fout << hex << setw(16) << setfill('0') << a[k] << "ULL, ";
+        if ((k + 1) % bits == 0 && k != 1)
+            fout  << std::endl << "        ";
+    }
+    fout << std::endl;
+    fout << "    };" << std::endl;
+    fout << std::endl;
+}
+
 void write_matrices(std::ofstream& fout, const std::string name, unsigned int * a, int n, int bits, bool is_device)
 {
     fout << "static const ";
@@ -77,24 +119,75 @@ void write_matrices(std::ofstream& fout, const std::string name, unsigned int *
     fout << std::endl;
 }
 
+// Writes the direction vectors as a rocRAND binary table file (the
+// format read by library/src/rng/table_file.hpp when the
+// ROCRAND_TABLE_FILE environment variable points at it): the magic
+// "ROCRTBL\0", format version, table count, 64-byte directory entries
+// of {48-byte name, payload offset, payload size}, then the payloads.
+bool write_table_file(const std::string file_path, unsigned int * directions, unsigned int n)
+{
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    if (!fout) {
+        cout << "Table file cannot be opened for writing!\n";
+        return false;
+    }
+
+    const unsigned int version = 1;
+    const unsigned int count = 1;
+    char name[48] = "sobol32_direction_vectors";
+    const unsigned long long offset = 16 + 64 * count;
+    const unsigned long long bytes = sizeof(unsigned int) * (unsigned long long)n;
+
+    fout.write("ROCRTBL\0", 8);
+    fout.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    fout.write(reinterpret_cast<const char *>(&count), sizeof(count));
+    fout.write(name, sizeof(name));
+    fout.write(reinterpret_cast<const char *>(&offset), sizeof(offset));
+    fout.write(reinterpret_cast<const char *>(&bytes), sizeof(bytes));
+    fout.write(reinterpret_cast<const char *>(directions), bytes);
+
+    return fout.good();
+}
+
 int main(int argc, char const *argv[])
 {
-    if (argc != 3 || std::string(argv[1]) == "--help")
+    if ((argc != 3 && argc != 4 && argc != 5) || std::string(argv[1]) == "--help"
+        || (argc == 5 && std::string(argv[2]) != "--table-file"))
     {
         std::cout << "Usage:" << std::endl;
-        std::cout << "  ./sobol_direction_vector_generator new-joe-kuo-6.21201 ../../library/include/rocrand_sobol_precomputed.h" << std::endl;
+        std::cout << "  ./sobol_direction_vector_generator new-joe-kuo-6.21201 ../../library/include/rocrand_sobol_precomputed.h [../../library/include/rocrand_sobol64_precomputed.h]" << std::endl;
+        std::cout << "  ./sobol_direction_vector_generator new-joe-kuo-6.21201 --table-file rocrand_tables.bin <dimensions>" << std::endl;
         std::cout << "  (the source file can be downloaded here: http://web.maths.unsw.edu.au/~fkuo/sobol/)" << std::endl;
+        std::cout << "  When the third path is given, 64-bit direction vectors are written to it as well." << std::endl;
+        std::cout << "  The --table-file form writes a binary table file for the ROCRAND_TABLE_FILE" << std::endl;
+        std::cout << "  environment variable instead of headers; <dimensions> may exceed 20000 up to" << std::endl;
+        std::cout << "  the dimension count of the source file." << std::endl;
         return -1;
     }
 
     const std::string vector_file(argv[1]);
-    unsigned int SOBOL_DIM = 20000;
+    const bool table_file = (argc == 5);
+    unsigned int SOBOL_DIM = table_file ? atoi(argv[4]) : 20000;
     unsigned int SOBOL_N = SOBOL_DIM * 32;
+    if (SOBOL_DIM < 1) {
+        cout << "Invalid dimension count!\n";
+        return -1;
+    }
     struct sobol_set * inputs = new struct sobol_set[SOBOL_DIM];
     unsigned int * directions = new unsigned int[SOBOL_N];
     bool read = read_sobol_set(inputs, SOBOL_DIM, vector_file);
 
-    if (read)
+    if (read && table_file)
+    {
+        init_direction_vectors(inputs, directions, 32, SOBOL_DIM);
+        if (!write_table_file(argv[3], directions, SOBOL_N))
+        {
+            delete[] inputs;
+            delete[] directions;
+            return -1;
+        }
+    }
+    else if (read)
     {
         init_direction_vectors(inputs, directions, 32, SOBOL_DIM);
         const std::string file_path(argv[2]);
@@ -137,6 +230,51 @@ int main(int argc, char const *argv[])
         fout << R"(
 #endif // ROCRAND_SOBOL_PRECOMPUTED_H_
 )";
+
+        if (argc == 4)
+        {
+            unsigned long long * directions64 = new unsigned long long[SOBOL_DIM * 64];
+            init_direction_vectors64(inputs, directions64, 64, SOBOL_DIM);
+            std::ofstream fout64(argv[3], std::ios_base::out | std::ios_base::trunc);
+            fout64 << R"(// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_SOBOL64_PRECOMPUTED_H_
+#define ROCRAND_SOBOL64_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/sobol_direction_vector_generator
+
+)";
+            fout64 << "#define SOBOL64_DIM " << SOBOL_DIM << std::endl;
+            fout64 << "#define SOBOL64_N " << (SOBOL_DIM * 64) << std::endl;
+            fout64 << std::endl;
+
+            write_matrices64(fout64, "h_sobol64_direction_vectors", directions64,
+            SOBOL_DIM * 64, 64, false);
+
+            fout64 << R"(
+#endif // ROCRAND_SOBOL64_PRECOMPUTED_H_
+)";
+            delete[] directions64;
+        }
     }
 
     delete[] inputs;
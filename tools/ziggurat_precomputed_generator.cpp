@@ -0,0 +1,148 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <iomanip>
+#include <cmath>
+
+// Computes the ziggurat tables for the standard normal distribution
+// following Marsaglia and Tsang, "The Ziggurat Method for Generating
+// Random Variables" (2000), with 128 layers. The single-precision
+// tables scale against 2^31 (one 32-bit draw per candidate), the
+// double-precision tables against 2^63 (two 32-bit draws).
+
+const int ZIG_NORM_N = 128;
+
+// Rightmost layer coordinate and area of each layer
+const double ZIG_NORM_R = 3.442619855899;
+const double ZIG_NORM_V = 9.91256303526217e-3;
+
+static unsigned int kn[ZIG_NORM_N];
+static double wn[ZIG_NORM_N];
+static double fn[ZIG_NORM_N];
+
+static unsigned long long kn_d[ZIG_NORM_N];
+static double wn_d[ZIG_NORM_N];
+static double fn_d[ZIG_NORM_N];
+
+template<class UIntType>
+void compute_tables(UIntType * k, double * w, double * f, const double m)
+{
+    double dn = ZIG_NORM_R;
+    double tn = ZIG_NORM_R;
+    const double q = ZIG_NORM_V / std::exp(-0.5 * dn * dn);
+
+    k[0] = (UIntType)((dn / q) * m);
+    k[1] = 0;
+    w[0] = q / m;
+    w[ZIG_NORM_N - 1] = dn / m;
+    f[0] = 1.0;
+    f[ZIG_NORM_N - 1] = std::exp(-0.5 * dn * dn);
+    for(int i = ZIG_NORM_N - 2; i >= 1; i--)
+    {
+        dn = std::sqrt(-2.0 * std::log(ZIG_NORM_V / dn + std::exp(-0.5 * dn * dn)));
+        k[i + 1] = (UIntType)((dn / tn) * m);
+        tn = dn;
+        f[i] = std::exp(-0.5 * dn * dn);
+        w[i] = dn / m;
+    }
+}
+
+template<class UIntType>
+void write_uint_array(std::ofstream& fout, const std::string& name,
+                      const std::string& type, const std::string& suffix,
+                      const UIntType * values)
+{
+    fout << "static const __device__ " << type << " " << name
+         << "[ZIG_NORM_N] = " << std::endl;
+    fout << "    {" << std::endl << "        ";
+    for(int i = 0; i < ZIG_NORM_N; i++)
+    {
+        fout << values[i] << suffix << ", ";
+        if(i % 8 == 7)
+        {
+            fout << std::endl << "        ";
+        }
+    }
+    fout << std::endl << "    };" << std::endl << std::endl;
+}
+
+void write_real_array(std::ofstream& fout, const std::string& name,
+                      const std::string& type, const std::string& suffix,
+                      const double * values)
+{
+    fout << "static const __device__ " << type << " " << name
+         << "[ZIG_NORM_N] = " << std::endl;
+    fout << "    {" << std::endl << "        ";
+    // showpoint keeps a decimal point so the "f" suffix stays valid
+    fout << std::showpoint << std::setprecision(17);
+    for(int i = 0; i < ZIG_NORM_N; i++)
+    {
+        fout << values[i] << suffix << ", ";
+        if(i % 4 == 3)
+        {
+            fout << std::endl << "        ";
+        }
+    }
+    fout << std::endl << "    };" << std::endl << std::endl;
+}
+
+int main(int argc, char const *argv[])
+{
+    if (argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./ziggurat_precomputed_generator ../../library/include/rocrand_ziggurat_precomputed.h" << std::endl;
+        return -1;
+    }
+
+    compute_tables(kn, wn, fn, 2147483648.0);
+    compute_tables(kn_d, wn_d, fn_d, 9223372036854775808.0);
+
+    const std::string file_path(argv[1]);
+    std::ofstream fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    fout << R"(// Copyright (c) 2018 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_ZIGGURAT_PRECOMPUTED_H_
+#define ROCRAND_ZIGGURAT_PRECOMPUTED_H_
+
+// Auto-generated file. Do not edit!
+// Generated by tools/ziggurat_precomputed_generator
+
+#define ZIG_NORM_N 128
+#define ZIG_NORM_R 3.442619855899
+#define ZIG_NORM_R_FLOAT 3.442619855899f
+
+)";
+
+    write_uint_array(fout, "d_zig_norm_kn", "unsigned int", "U", kn);
+    write_real_array(fout, "d_zig_norm_wn", "float", "f", wn);
+    write_real_array(fout, "d_zig_norm_fn", "float", "f", fn);
+
+    write_uint_array(fout, "d_zig_norm_kn_d", "unsigned long long", "ULL", kn_d);
+    write_real_array(fout, "d_zig_norm_wn_d", "double", "", wn_d);
+    write_real_array(fout, "d_zig_norm_fn_d", "double", "", fn_d);
+
+    fout << R"(
+#endif // ROCRAND_ZIGGURAT_PRECOMPUTED_H_
+)";
+
+    return 0;
+}